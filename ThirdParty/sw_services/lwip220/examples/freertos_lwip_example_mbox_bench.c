@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Measures the messages per second that pass through the mailboxes of the
+ * FreeRTOS port (sys_arch.c) from 1, 2 and 4 producer tasks to one consumer
+ * task, which is how tcpip_thread uses its mailbox. Each run is made with a
+ * FreeRTOS queue (sys_mbox_new()) and, when lwip220_tcpip_mbox_mpsc is
+ * enabled, with the MPSC ring (sys_mbox_new_mpsc()); both are read one
+ * message at a time with sys_arch_mbox_fetch() and in bursts of
+ * MBOX_BENCH_BURST with sys_arch_mbox_fetch_burst(). The consumer checks the
+ * sum of all messages, so a lost or duplicated message fails the run.
+ *
+ * No network interface is needed.
+ */
+
+#include "lwip/opt.h"
+#include "lwip/sys.h"
+#include "xil_printf.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+#if NO_SYS
+#error "The mailbox benchmark needs SOCKET_API (FreeRTOS)"
+#endif
+
+#define MBOX_BENCH_MSGS		400000UL
+#define MBOX_BENCH_SIZE		1024
+#define MBOX_BENCH_BURST	16
+#define MBOX_BENCH_MAX_PROD	4
+#define THREAD_STACKSIZE	1024
+
+#ifdef LWIP_SYS_ARCH_MBOX_MPSC
+#define MBOX_BENCH_KINDS	2
+#else
+#define MBOX_BENCH_KINDS	1
+#endif
+
+static sys_mbox_t bench_mbox;
+/* One per producer, sys_sem_t is a binary semaphore */
+static sys_sem_t bench_done[MBOX_BENCH_MAX_PROD];
+static unsigned long bench_per_prod;
+
+static void producer_thread(void *arg)
+{
+	sys_sem_t *done = arg;
+	unsigned long i;
+
+	for (i = 1; i <= bench_per_prod; i++) {
+		sys_mbox_post(&bench_mbox, (void *)i);
+	}
+	/* The consumer frees the mailbox once all producers are out of it */
+	sys_sem_signal(done);
+	vTaskDelete(NULL);
+}
+
+/* Returns the messages per second, or 0 if the run failed */
+static u32_t bench_run(int mpsc, u32_t burst, int n_prod)
+{
+	void *msgs[MBOX_BENCH_BURST];
+	unsigned long expected, sum = 0, got = 0, total;
+	u32_t start, elapsed, n, i;
+	err_t err;
+	int p;
+
+	LWIP_UNUSED_ARG(mpsc);
+	bench_per_prod = MBOX_BENCH_MSGS / n_prod;
+	total = bench_per_prod * n_prod;
+	expected = n_prod * (bench_per_prod * (bench_per_prod + 1) / 2);
+
+#ifdef LWIP_SYS_ARCH_MBOX_MPSC
+	if (mpsc)
+		err = sys_mbox_new_mpsc(&bench_mbox, MBOX_BENCH_SIZE);
+	else
+#endif
+		err = sys_mbox_new(&bench_mbox, MBOX_BENCH_SIZE);
+	if (err != ERR_OK)
+		return 0;
+
+	start = sys_now();
+	for (p = 0; p < n_prod; p++) {
+		sys_thread_new("mbox_prod", producer_thread, &bench_done[p],
+				THREAD_STACKSIZE, DEFAULT_THREAD_PRIO);
+	}
+	while (got < total) {
+		if (burst > 1) {
+			n = sys_arch_mbox_fetch_burst(&bench_mbox, msgs,
+							burst, 0);
+		} else {
+			sys_arch_mbox_fetch(&bench_mbox, &msgs[0], 0);
+			n = 1;
+		}
+		for (i = 0; i < n; i++)
+			sum += (unsigned long)msgs[i];
+		got += n;
+	}
+	elapsed = sys_now() - start;
+
+	for (p = 0; p < n_prod; p++)
+		sys_arch_sem_wait(&bench_done[p], 0);
+	sys_mbox_free(&bench_mbox);
+
+	if (sum != expected) {
+		xil_printf("Message sum mismatch: %lu instead of %lu\r\n",
+				sum, expected);
+		return 0;
+	}
+	if (elapsed == 0)
+		elapsed = 1;
+
+	return (u32_t)((u64_t)total * 1000 / elapsed);
+}
+
+static void bench_thread(void *arg)
+{
+	int n_prod, mpsc;
+	u32_t burst, rate;
+	int status = 0;
+
+	LWIP_UNUSED_ARG(arg);
+	for (n_prod = 0; n_prod < MBOX_BENCH_MAX_PROD; n_prod++) {
+		if (sys_sem_new(&bench_done[n_prod], 0) != ERR_OK) {
+			xil_printf("Failed to create semaphore\r\n");
+			vTaskDelete(NULL);
+			return;
+		}
+	}
+
+	xil_printf("mbox   burst  prod      msgs/s\r\n");
+	for (n_prod = 1; n_prod <= MBOX_BENCH_MAX_PROD; n_prod *= 2) {
+		for (mpsc = 0; mpsc < MBOX_BENCH_KINDS; mpsc++) {
+			for (burst = 1; burst <= MBOX_BENCH_BURST;
+					burst *= MBOX_BENCH_BURST) {
+				rate = bench_run(mpsc, burst, n_prod);
+				if (rate == 0)
+					status = -1;
+				xil_printf("%s  %5d  %4d  %10d\r\n",
+						mpsc ? "mpsc " : "queue",
+						burst, n_prod, rate);
+			}
+		}
+	}
+	for (n_prod = 0; n_prod < MBOX_BENCH_MAX_PROD; n_prod++)
+		sys_sem_free(&bench_done[n_prod]);
+
+	if (status == 0)
+		xil_printf("Successfully ran lwIP mailbox benchmark\r\n");
+	else
+		xil_printf("lwIP mailbox benchmark failed\r\n");
+	vTaskDelete(NULL);
+}
+
+int main()
+{
+	sys_thread_new("mbox_bench", bench_thread, NULL,
+			THREAD_STACKSIZE, DEFAULT_THREAD_PRIO);
+	vTaskStartScheduler();
+	while (1);
+	return 0;
+}
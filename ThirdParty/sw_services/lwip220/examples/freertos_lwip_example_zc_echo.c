@@ -0,0 +1,319 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * TCP echo server built on the zero-copy socket API of the port
+ * (netif/xlwip_zc.h). Data is taken from the socket with xlwip_zc_recv() and
+ * sent back with xlwip_zc_send() without being copied: every pbuf of a
+ * received chain is wrapped in an xlwip_zc_pbuf descriptor that points into
+ * the received payload. The received chain is freed once lwIP has released
+ * all descriptors made from it.
+ *
+ * The lifetime of the buffers is checked for every connection:
+ * - each descriptor is released exactly once,
+ * - a received chain is referenced only by the application when it is freed,
+ *   i.e. sending it did not leave a reference behind,
+ * - all descriptors, including those sent just before the close, are
+ *   released within ZC_ECHO_DRAIN_MS after the socket is closed.
+ */
+
+#include <string.h>
+#include "lwip/sockets.h"
+#include "lwip/inet.h"
+#include "lwip/sys.h"
+#include "netif/xlwip_zc.h"
+#include "xil_printf.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+#if !XLWIP_CONFIG_ZERO_COPY_SOCKET
+#error "The zero-copy echo example needs lwip220_zero_copy_socket"
+#endif
+
+#define ZC_ECHO_PORT		7
+#define ZC_ECHO_BATCH		8
+#define ZC_ECHO_SLOTS		32
+#define ZC_ECHO_DESCS		128
+#define ZC_ECHO_DRAIN_MS	5000
+#define THREAD_STACKSIZE	1024
+
+/* A received chain, freed once all of its descriptors are released */
+struct zc_echo_slot {
+	struct pbuf *p;
+	int pending;
+};
+
+/* Sends one pbuf of a received chain back */
+struct zc_echo_desc {
+	struct xlwip_zc_pbuf zp;
+	struct zc_echo_slot *slot;
+	int in_use;
+};
+
+static struct zc_echo_slot slots[ZC_ECHO_SLOTS];
+static struct zc_echo_desc descs[ZC_ECHO_DESCS];
+static struct pbuf *tx[ZC_ECHO_DESCS];
+
+/* Counters of the current connection */
+static u32_t n_bytes, n_rx, n_rx_freed, n_desc, n_desc_released;
+static u32_t n_bad_release, n_bad_ref;
+
+extern struct netif server_netif;
+
+void print_app_header()
+{
+	xil_printf("\r\n%20s %6d $ nc %s %d < <file>\r\n",
+			"Zero-copy echo server", ZC_ECHO_PORT,
+			inet_ntoa(server_netif.ip_addr), ZC_ECHO_PORT);
+}
+
+/* Free callback of the descriptors, called by lwIP in the tcpip thread */
+static void zc_echo_free(struct xlwip_zc_pbuf *zp, void *arg)
+{
+	struct zc_echo_desc *d = arg;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	LWIP_UNUSED_ARG(zp);
+	SYS_ARCH_PROTECT(lev);
+	if (!d->in_use) {
+		n_bad_release++;
+	} else {
+		d->in_use = 0;
+		d->slot->pending--;
+		n_desc_released++;
+	}
+	SYS_ARCH_UNPROTECT(lev);
+}
+
+static struct zc_echo_desc *zc_echo_desc_get(void)
+{
+	int i;
+
+	for (i = 0; i < ZC_ECHO_DESCS; i++) {
+		if (!descs[i].in_use) {
+			descs[i].in_use = 1;
+			return &descs[i];
+		}
+	}
+	return NULL;
+}
+
+static void zc_echo_pending_add(struct zc_echo_slot *slot, int n)
+{
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	slot->pending += n;
+	SYS_ARCH_UNPROTECT(lev);
+}
+
+/*
+ * Frees the received chains no longer used by any descriptor. Returns the
+ * number of chains still in use.
+ */
+static int zc_echo_reap(void)
+{
+	SYS_ARCH_DECL_PROTECT(lev);
+	int i, pending, busy = 0;
+
+	for (i = 0; i < ZC_ECHO_SLOTS; i++) {
+		if (slots[i].p == NULL)
+			continue;
+		SYS_ARCH_PROTECT(lev);
+		pending = slots[i].pending;
+		SYS_ARCH_UNPROTECT(lev);
+		if (pending > 0) {
+			busy++;
+			continue;
+		}
+		if (slots[i].p->ref != 1)
+			n_bad_ref++;
+		pbuf_free(slots[i].p);
+		slots[i].p = NULL;
+		n_rx_freed++;
+	}
+	return busy;
+}
+
+/* Hands all n descriptors of p to lwIP, waiting while the send buffer is full */
+static int zc_echo_send(int sd, struct pbuf **p, int n)
+{
+	int ret, i;
+
+	while (n > 0) {
+		ret = xlwip_zc_send(sd, p, n, 0);
+		if (ret < 0) {
+			if (errno != EWOULDBLOCK) {
+				/* The descriptors not accepted are still ours */
+				for (i = 0; i < n; i++)
+					pbuf_free(p[i]);
+				return -1;
+			}
+			vTaskDelay(1);
+			continue;
+		}
+		p += ret;
+		n -= ret;
+	}
+	return 0;
+}
+
+/* Queues the pbufs of the chain in slot for sending, returns -1 on error */
+static int zc_echo_queue(int sd, struct zc_echo_slot *slot, int *ntx)
+{
+	struct zc_echo_desc *d;
+	struct pbuf *q;
+	int ret = 0;
+
+	/* Keeps the chain from being freed while it is queued */
+	zc_echo_pending_add(slot, 1);
+	for (q = slot->p; q != NULL; q = q->next) {
+		if (q->len == 0)
+			continue;
+		while ((d = zc_echo_desc_get()) == NULL) {
+			/* Send what is queued and wait for it to be acked */
+			ret = zc_echo_send(sd, tx, *ntx);
+			*ntx = 0;
+			if (ret < 0)
+				goto out;
+			vTaskDelay(1);
+			zc_echo_reap();
+		}
+		d->slot = slot;
+		zc_echo_pending_add(slot, 1);
+		tx[(*ntx)++] = xlwip_zc_pbuf_init(&d->zp, q->payload, q->len,
+						zc_echo_free, d);
+		n_desc++;
+	}
+out:
+	zc_echo_pending_add(slot, -1);
+	return ret;
+}
+
+static void zc_echo_serve(int sd)
+{
+	struct pbuf *rx[ZC_ECHO_BATCH];
+	int i, n, ntx, ret, err, busy, waited;
+
+	n_bytes = n_rx = n_rx_freed = n_desc = n_desc_released = 0;
+	n_bad_release = n_bad_ref = 0;
+
+	while (1) {
+		zc_echo_reap();
+		/* Take no more chains than there are free slots */
+		for (i = 0, n = 0; (i < ZC_ECHO_SLOTS) && (n < ZC_ECHO_BATCH); i++) {
+			if (slots[i].p == NULL)
+				n++;
+		}
+		if (n == 0) {
+			vTaskDelay(1);
+			continue;
+		}
+		ret = xlwip_zc_recv(sd, rx, n, 0);
+		if (ret <= 0)
+			break;
+
+		ntx = 0;
+		err = 0;
+		for (i = 0, n = 0; n < ret; i++) {
+			if (slots[i].p != NULL)
+				continue;
+			slots[i].p = rx[n++];
+			slots[i].pending = 0;
+			n_rx++;
+			n_bytes += slots[i].p->tot_len;
+			if (!err && (zc_echo_queue(sd, &slots[i], &ntx) < 0))
+				err = 1;
+		}
+		if (err || (zc_echo_send(sd, tx, ntx) < 0))
+			break;
+	}
+	close(sd);
+
+	/* Data sent just before the close is released when it is acked */
+	for (waited = 0; waited < ZC_ECHO_DRAIN_MS; waited += 10) {
+		busy = zc_echo_reap();
+		if (busy == 0)
+			break;
+		vTaskDelay(10 / portTICK_RATE_MS);
+	}
+
+	if ((busy == 0) && (n_rx_freed == n_rx) &&
+			(n_desc_released == n_desc) &&
+			(n_bad_release == 0) && (n_bad_ref == 0)) {
+		xil_printf("Echoed %d bytes, all %d buffers released\r\n",
+				n_bytes, n_desc);
+	} else {
+		xil_printf("Buffer lifetime error: rx %d/%d freed, "
+				"desc %d/%d released, %d bad releases, "
+				"%d bad refs\r\n", n_rx_freed, n_rx,
+				n_desc_released, n_desc, n_bad_release,
+				n_bad_ref);
+	}
+}
+
+static void zc_echo_thread(void *arg)
+{
+	struct sockaddr_in address, remote;
+	socklen_t size;
+	int sock, sd;
+
+	LWIP_UNUSED_ARG(arg);
+	sock = socket(AF_INET, SOCK_STREAM, 0);
+	if (sock < 0) {
+		xil_printf("Error creating socket\r\n");
+		vTaskDelete(NULL);
+		return;
+	}
+
+	memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_port = htons(ZC_ECHO_PORT);
+	address.sin_addr.s_addr = INADDR_ANY;
+	if ((bind(sock, (struct sockaddr *)&address, sizeof(address)) < 0) ||
+			(listen(sock, 1) < 0)) {
+		xil_printf("Error binding to port %d\r\n", ZC_ECHO_PORT);
+		close(sock);
+		vTaskDelete(NULL);
+		return;
+	}
+
+	/* One connection at a time, the buffers are shared */
+	while (1) {
+		size = sizeof(remote);
+		sd = accept(sock, (struct sockaddr *)&remote, &size);
+		if (sd >= 0)
+			zc_echo_serve(sd);
+	}
+}
+
+void start_application()
+{
+	sys_thread_new("zc_echo", zc_echo_thread, 0,
+			THREAD_STACKSIZE, DEFAULT_THREAD_PRIO);
+}
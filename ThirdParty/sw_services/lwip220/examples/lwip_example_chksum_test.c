@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Checks the architecture optimized checksum routines of the port
+ * (xlwip_chksum.c) against a plain byte-wise Internet checksum. Every length
+ * up to CHKSUM_TEST_SHORT_LEN is checked at all source and destination
+ * offsets within CHKSUM_TEST_ALIGN, followed by long buffers around the block
+ * and batch sizes of the kernels. No network interface is needed.
+ *
+ * Build it on the target with lwip220_arch_checksum enabled to check the
+ * NEON, ARM or MicroBlaze kernel. Defining CHKSUM_TEST_HOST builds it on a
+ * host against the generic C kernel, e.g.
+ *   gcc -DCHKSUM_TEST_HOST -I<lwipopts.h with LWIP_ARCH_CHKSUM 1>
+ *       -I<lwip>/src/include -I<lwip>/contrib/ports/xilinx/include
+ *       lwip_example_chksum_test.c <lwip>/contrib/ports/xilinx/xlwip_chksum.c
+ */
+
+#include <string.h>
+#include "lwip/opt.h"
+#include "lwip/arch.h"
+#include "lwip/def.h"
+#ifdef CHKSUM_TEST_HOST
+#include <stdio.h>
+#define xil_printf printf
+#else
+#include "xil_printf.h"
+#endif
+
+#if !LWIP_ARCH_CHKSUM
+#error "Enable lwip220_arch_checksum (LWIP_ARCH_CHKSUM) to run this test"
+#endif
+
+#define CHKSUM_TEST_SHORT_LEN	300
+#define CHKSUM_TEST_ALIGN	8
+#define CHKSUM_TEST_GUARD	16
+#define CHKSUM_TEST_BUF_SIZE	(0xFFFF + CHKSUM_TEST_ALIGN + CHKSUM_TEST_GUARD)
+#define CHKSUM_TEST_FILL	0x5A
+#define CHKSUM_TEST_MAX_REPORT	10
+
+enum chksum_test_pattern {
+	PATTERN_RANDOM,
+	PATTERN_ONES,
+	PATTERN_ZEROS,
+	PATTERN_ALTERNATE,
+	PATTERN_COUNT
+};
+
+/* Lengths around the block sizes, the NEON batch size and the 16 bit limit */
+static const u32_t long_lens[] = {
+	511, 512, 513, 1023, 1024, 1460, 1461, 1500, 1514, 4095, 4096, 8191,
+	8192, 8193, 8256, 9000, 16383, 16384, 16447, 32767, 65533, 65534, 65535
+};
+
+static u8_t src_buf[CHKSUM_TEST_BUF_SIZE];
+static u8_t dst_buf[CHKSUM_TEST_BUF_SIZE];
+static u32_t prng_state = 0x12345678;
+static u32_t fails;
+
+static u32_t prng_next(void)
+{
+	prng_state ^= prng_state << 13;
+	prng_state ^= prng_state >> 17;
+	prng_state ^= prng_state << 5;
+	return prng_state;
+}
+
+static void fill_pattern(u8_t *buf, u32_t len, int pattern)
+{
+	u32_t i;
+
+	for (i = 0; i < len; i++) {
+		switch (pattern) {
+		case PATTERN_ONES:
+			buf[i] = 0xFF;
+			break;
+		case PATTERN_ZEROS:
+			buf[i] = 0x00;
+			break;
+		case PATTERN_ALTERNATE:
+			buf[i] = (i & 1) ? 0x00 : 0xFF;
+			break;
+		default:
+			buf[i] = (u8_t)prng_next();
+			break;
+		}
+	}
+}
+
+/*
+ * Byte-wise Internet checksum with the result format of lwip_standard_chksum:
+ * the host order, non-inverted sum of the buffer read as 16 bit words.
+ */
+static u16_t chksum_ref(const u8_t *buf, u32_t len)
+{
+	u32_t sum = 0;
+	u32_t i;
+	u8_t be[2];
+	u16_t w;
+
+	for (i = 0; (i + 1) < len; i += 2) {
+		sum += ((u32_t)buf[i] << 8) | buf[i + 1];
+	}
+	if (i < len) {
+		sum += (u32_t)buf[i] << 8;
+	}
+	while ((sum >> 16) != 0) {
+		sum = (sum & 0xFFFF) + (sum >> 16);
+	}
+	be[0] = (u8_t)(sum >> 8);
+	be[1] = (u8_t)sum;
+	memcpy(&w, be, sizeof(w));
+
+	return w;
+}
+
+static void check_one(u32_t len, u32_t src_off, u32_t dst_off, int pattern)
+{
+	const u8_t *src = src_buf + src_off;
+	u8_t *dst = dst_buf + dst_off;
+	u16_t expected;
+	u16_t sum;
+	u16_t copy_sum;
+	u32_t i;
+	int bad_copy = 0;
+
+	fill_pattern(src_buf, len + src_off + CHKSUM_TEST_GUARD, pattern);
+	memset(dst_buf, CHKSUM_TEST_FILL, len + dst_off + CHKSUM_TEST_GUARD);
+
+	expected = chksum_ref(src, len);
+	sum = xlwip_chksum(src, (int)len);
+	copy_sum = xlwip_chksum_copy(dst, src, (u16_t)len);
+
+	if (memcmp(dst, src, len) != 0) {
+		bad_copy = 1;
+	}
+	for (i = 0; i < dst_off; i++) {
+		if (dst_buf[i] != CHKSUM_TEST_FILL) {
+			bad_copy = 1;
+		}
+	}
+	for (i = 0; i < CHKSUM_TEST_GUARD; i++) {
+		if (dst[len + i] != CHKSUM_TEST_FILL) {
+			bad_copy = 1;
+		}
+	}
+
+	if ((sum != expected) || (copy_sum != expected) || bad_copy) {
+		if (fails < CHKSUM_TEST_MAX_REPORT) {
+			xil_printf("len %d src off %d dst off %d pattern %d: "
+				   "expected 0x%04x chksum 0x%04x copy 0x%04x%s\r\n",
+				   (int)len, (int)src_off, (int)dst_off, pattern,
+				   expected, sum, copy_sum,
+				   bad_copy ? " (bad copy)" : "");
+		}
+		fails++;
+	}
+}
+
+int main(void)
+{
+	u32_t len;
+	u32_t src_off;
+	u32_t dst_off;
+	u32_t i;
+	int pattern;
+
+	xil_printf("lwIP checksum test\r\n");
+
+	for (pattern = 0; pattern < PATTERN_COUNT; pattern++) {
+		for (len = 0; len <= CHKSUM_TEST_SHORT_LEN; len++) {
+			for (src_off = 0; src_off < CHKSUM_TEST_ALIGN; src_off++) {
+				for (dst_off = 0; dst_off < CHKSUM_TEST_ALIGN;
+				     dst_off++) {
+					check_one(len, src_off, dst_off, pattern);
+				}
+			}
+		}
+	}
+
+	for (pattern = 0; pattern < PATTERN_COUNT; pattern++) {
+		for (i = 0; i < (sizeof(long_lens) / sizeof(long_lens[0])); i++) {
+			for (src_off = 0; src_off < CHKSUM_TEST_ALIGN; src_off++) {
+				check_one(long_lens[i], src_off, src_off, pattern);
+				check_one(long_lens[i], src_off,
+					  (src_off + 1) % CHKSUM_TEST_ALIGN, pattern);
+				check_one(long_lens[i], src_off,
+					  (src_off + 2) % CHKSUM_TEST_ALIGN, pattern);
+			}
+		}
+	}
+
+	/* random lengths and offsets */
+	for (i = 0; i < 2000; i++) {
+		check_one(prng_next() % 0x10000, prng_next() % CHKSUM_TEST_ALIGN,
+			  prng_next() % CHKSUM_TEST_ALIGN, PATTERN_RANDOM);
+	}
+
+	if (fails != 0) {
+		xil_printf("lwIP checksum test failed, %d mismatches\r\n",
+			   (int)fails);
+		return -1;
+	}
+
+	xil_printf("Successfully ran lwIP checksum test\r\n");
+	return 0;
+}
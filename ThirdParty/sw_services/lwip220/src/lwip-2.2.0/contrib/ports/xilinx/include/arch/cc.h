@@ -44,6 +44,7 @@ extern "C" {
 #include <stdlib.h>
 
 #include "lwipopts.h"
+#include "xlwipconfig.h"
 
 /** if you want to use the struct timeval provided
  * by your system, set this to 0 and include <sys/time.h> in cc.h */
@@ -76,6 +77,23 @@ typedef signed     long long    s64_t;
 
 typedef unsigned long mem_ptr_t;
 
+#if LWIP_ARCH_CHKSUM
+/* Architecture optimized checksum routines, see xlwip_chksum.c */
+u16_t xlwip_chksum(const void *dataptr, int len);
+u16_t xlwip_chksum_copy(void *dst, const void *src, u16_t len);
+#define LWIP_CHKSUM xlwip_chksum
+#define LWIP_CHKSUM_COPY(dst, src, len) xlwip_chksum_copy(dst, src, len)
+#endif
+
+#if XLWIP_CONFIG_EMACPS_PTP
+/* GEM hardware timestamp of a received frame, see
+ * xemacpsif_pbuf_get_timestamp(). Pbufs start without one.
+ */
+#define XLWIP_PBUF_TS_NONE		0xFFFFFFFFU
+#define LWIP_PBUF_CUSTOM_DATA		u64_t ts_sec; u32_t ts_nsec;
+#define LWIP_PBUF_CUSTOM_DATA_INIT(p)	((p)->ts_nsec = XLWIP_PBUF_TS_NONE)
+#endif
+
 #define PACK_STRUCT_FIELD(x) x
 #define PACK_STRUCT_STRUCT __attribute__((packed))
 #define PACK_STRUCT_BEGIN
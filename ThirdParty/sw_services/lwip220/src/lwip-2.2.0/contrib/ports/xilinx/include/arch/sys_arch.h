@@ -40,6 +40,7 @@
 extern "C" {
 #endif
 #include "lwipopts.h"
+#include "xlwipconfig.h"
 
 
 #if !NO_SYS
@@ -50,19 +51,43 @@ extern "C" {
 #include "semphr.h"
 #include "timers.h"
 
+#include "lwip/err.h"
+
 #define SYS_MBOX_NULL					( ( xQueueHandle ) NULL )
 #define SYS_SEM_NULL					( ( xSemaphoreHandle ) NULL )
 #define SYS_DEFAULT_THREAD_STACK_DEPTH	configMINIMAL_STACK_SIZE
 
 typedef xSemaphoreHandle sys_sem_t;
 typedef xSemaphoreHandle sys_mutex_t;
+#if XLWIP_CONFIG_MPSC_MBOX
+/*
+ * A mailbox is either a FreeRTOS queue or, for the tcpip_thread mailbox, a
+ * multi-producer single-consumer ring. Producers post in a short critical
+ * section; the consumer reads without it and is woken with a task
+ * notification.
+ */
+typedef struct xlwip_mbox *sys_mbox_t;
+#else
 typedef xQueueHandle sys_mbox_t;
+#endif
 typedef xTaskHandle sys_thread_t;
 
 typedef unsigned long sys_prot_t;
 
 #define sys_mbox_valid( x ) ( ( ( *x ) == NULL) ? pdFALSE : pdTRUE )
 #define sys_mbox_set_invalid( x ) ( ( *x ) = NULL )
+
+#if XLWIP_CONFIG_MPSC_MBOX
+/* Used by tcpip_init() for the tcpip_thread mailbox */
+#define LWIP_SYS_ARCH_MBOX_MPSC 1
+err_t sys_mbox_new_mpsc( sys_mbox_t *pxMailBox, int iSize );
+#endif
+
+#if XLWIP_CONFIG_MBOX_FETCH_BURST > 1
+/* Number of messages tcpip_thread takes from its mailbox at once */
+#define LWIP_SYS_ARCH_MBOX_FETCH_BURST XLWIP_CONFIG_MBOX_FETCH_BURST
+#endif
+u32_t sys_arch_mbox_fetch_burst( sys_mbox_t *pxMailBox, void **ppvBuffer, u32_t ulMax, u32_t ulTimeOut );
 #define sys_sem_valid( x ) ( ( ( *x ) == NULL) ? pdFALSE : pdTRUE )
 #define sys_sem_set_invalid( x ) ( ( *x ) = NULL )
 #endif /* !NO_SYS */
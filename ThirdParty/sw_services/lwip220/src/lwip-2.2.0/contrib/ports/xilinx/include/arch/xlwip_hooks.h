@@ -0,0 +1,33 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * lwIP hooks of the Xilinx port, included by the lwIP core through
+ * LWIP_HOOK_FILENAME.
+ */
+
+#ifndef __XLWIP_HOOKS_H_
+#define __XLWIP_HOOKS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xlwipconfig.h"
+
+#if XLWIP_CONFIG_ZERO_COPY_SOCKET && LWIP_TCP
+struct tcp_pcb;
+
+/* Releases the zero-copy TCP buffers acknowledged by the peer */
+void xlwip_zc_tcp_acked(struct tcp_pcb *pcb);
+
+#define LWIP_HOOK_TCP_ACKED(pcb) xlwip_zc_tcp_acked(pcb)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __XLWIP_HOOKS_H_ */
@@ -37,6 +37,7 @@ extern "C" {
 #endif
 
 #include "lwipopts.h"
+#include "xlwipconfig.h"
 
 #if !NO_SYS
 #include "lwip/sys.h"
@@ -47,10 +48,83 @@ extern "C" {
 
 #include "netif/xtopology.h"
 
+#if XLWIP_CONFIG_GRO
+/* Maximum number of segments merged into one packet */
+#ifndef XLWIP_CONFIG_GRO_FLUSH_LIMIT
+#define XLWIP_CONFIG_GRO_FLUSH_LIMIT	8
+#endif
+/* Number of TCP flows tracked per interface */
+#ifndef XLWIP_CONFIG_GRO_FLOWS
+#define XLWIP_CONFIG_GRO_FLOWS		4
+#endif
+
+struct xemac_gro;
+
+/* receive coalescing statistics of a TCP flow */
+struct xemac_gro_stats {
+	ip4_addr_t src_ip;
+	ip4_addr_t dst_ip;
+	u16_t src_port;
+	u16_t dst_port;
+	u32_t rx_segs;		/* segments received */
+	u32_t merged_segs;	/* segments appended to an earlier one */
+	u32_t delivered;	/* packets handed to lwIP */
+	u32_t flush_limit;	/* flushes on reaching the flush limit */
+	u32_t flush_batch;	/* flushes at the end of a receive batch */
+	u32_t flush_other;	/* flushes on flags, order or header change */
+};
+#endif
+
+#if XLWIP_CONFIG_COALESCE
+/* Interval between two samples of the frame rate, in ms */
+#ifndef XLWIP_CONFIG_COALESCE_INTERVAL
+#define XLWIP_CONFIG_COALESCE_INTERVAL	10
+#endif
+/* Interrupts per second above which frames are coalesced */
+#ifndef XLWIP_CONFIG_COALESCE_IRQ_RATE
+#define XLWIP_CONFIG_COALESCE_IRQ_RATE	20000
+#endif
+/* Longest time a completed frame may wait for its interrupt, in us */
+#ifndef XLWIP_CONFIG_COALESCE_MAX_DELAY
+#define XLWIP_CONFIG_COALESCE_MAX_DELAY	100
+#endif
+/* Delay timer unit of AXI DMA, 125 clocks of its scatter gather clock, in ns */
+#ifndef XLWIP_CONFIG_COALESCE_AXIDMA_TIMER_UNIT
+#define XLWIP_CONFIG_COALESCE_AXIDMA_TIMER_UNIT	1250
+#endif
+
+#define XEMAC_COALESCE_RX	0
+#define XEMAC_COALESCE_TX	1
+
+/* adaptive interrupt coalescing statistics of a DMA direction */
+struct xemac_coalesce_stats {
+	u32_t samples;		/* frame rate samples taken */
+	u32_t updates;		/* settings written to the hardware */
+	u32_t frame_rate;	/* frames per second, smoothed */
+	u32_t irq_rate;		/* interrupts per second, last sample */
+	u32_t count;		/* frames per interrupt in effect */
+	u32_t delay_us;		/* interrupt delay in effect */
+	u32_t min_avail;	/* fewest BDs left to the hardware at a sample */
+};
+
+/* adaptive interrupt coalescing state of a DMA direction */
+struct xemac_coalesce {
+	u32_t frames;		/* frames since the last sample */
+	u32_t irqs;		/* interrupts since the last sample */
+	u32_t last_ms;		/* time of the last sample */
+	u32_t max_count;	/* largest frame count the hardware takes */
+	u32_t max_delay_us;	/* largest delay the hardware takes */
+	struct xemac_coalesce_stats stats;
+};
+#endif
+
 struct xemac_s {
 	enum xemac_types type;
 	int  topology_index;
 	void *state;
+#if XLWIP_CONFIG_GRO
+	struct xemac_gro *gro;
+#endif
 #if !NO_SYS
     sys_sem_t sem_rx_data_available;
 #if defined(__arm__) && !defined(ARMR5)
@@ -77,6 +151,24 @@ struct netif *	xemac_add(struct netif *netif,
 #if defined (__arm__) || defined (__aarch64__)
 void xemacpsif_resetrx_on_no_rxdata(struct netif *netif);
 #endif
+#if XLWIP_CONFIG_GRO
+err_t		xemac_gro_input(struct pbuf *p, struct netif *netif);
+void		xemac_gro_flush(struct netif *netif);
+int		xemac_gro_get_stats(struct netif *netif, int flow,
+			struct xemac_gro_stats *stats);
+void		xemac_gro_clear_stats(struct netif *netif);
+#endif
+#if XLWIP_CONFIG_COALESCE
+void		xemac_coalesce_init(struct xemac_coalesce *c, u32_t count,
+			u32_t delay_us, u32_t max_count, u32_t max_delay_us);
+int		xemac_coalesce_sample(struct xemac_coalesce *c, u32_t avail);
+#if NO_SYS
+void		xemac_coalesce_tick(u32_t ms);
+#endif
+int		xemac_coalesce_get_stats(struct netif *netif, int dir,
+			struct xemac_coalesce_stats *stats);
+void		xemac_coalesce_clear_stats(struct netif *netif);
+#endif
 
 /* global lwip debug variable used for debugging */
 extern int lwip_runtime_debug;
@@ -79,6 +79,26 @@ unsigned phy_setup_axiemac (XAxiEthernet *xaxiemacp);
 /* xaxiemacif_hw.c */
 void 	xaxiemac_error_handler(XAxiEthernet * Temac);
 
+#ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA
+#define XAXIEMACIF_MCDMA_MAX_CHAN	(XMCDMA_MAX_CHAN_PER_DEVICE / 2)
+
+/* Maximum number of frames taken from an RX channel queue before the input
+ * path moves on to the next channel
+ */
+#ifndef XLWIP_CONFIG_MCDMA_RX_BUDGET
+#define XLWIP_CONFIG_MCDMA_RX_BUDGET	16
+#endif
+
+/* frames received on an MCDMA channel, waiting to be passed to lwIP */
+typedef struct {
+	struct pbuf **frames;
+	u32_t head;
+	u32_t tail;
+	u32_t rx_frames;
+	u32_t rx_dropped;
+} xaxiemacif_rx_chan_q;
+#endif
+
 /* structure within each netif, encapsulating all information required for
  * using a particular temac instance
  */
@@ -101,6 +121,17 @@ typedef struct {
 	void *tx_bdspace;
 
 	enum ethernet_link_status eth_link_status;
+
+#ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA
+	/* one receive queue per MCDMA channel, served round-robin */
+	xaxiemacif_rx_chan_q rx_chan_q[XAXIEMACIF_MCDMA_MAX_CHAN];
+	u8_t rx_chan_cur;
+	u32_t rx_chan_served;
+#endif
+#if XLWIP_CONFIG_COALESCE && defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_DMA)
+	/* interrupt coalescing controllers, XEMAC_COALESCE_RX/TX */
+	struct xemac_coalesce coal[2];
+#endif
 } xaxiemacif_s;
 
 extern xaxiemacif_s xaxiemacif;
@@ -119,6 +150,7 @@ s32_t process_sent_bds(XAxiDma_BdRing *txring);
 #ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA
 XStatus init_axi_mcdma(struct xemac_s *xemac);
 XStatus axi_mcdma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p);
+struct pbuf *axi_mcdma_rx_dequeue(xaxiemacif_s *xaxiemacif);
 #else
 XStatus init_axi_dma(struct xemac_s *xemac);
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
@@ -112,6 +112,42 @@ extern "C" {
 
 #define MAX_FRAME_SIZE_JUMBO (XEMACPS_MTU_JUMBO + XEMACPS_HDR_SIZE + XEMACPS_TRL_SIZE)
 
+/* The transmit path reaps sent BDs when the free count drops to the low-water
+ * mark, freeing at most the budget number of BDs. The TX done interrupt
+ * always reaps the whole ring.
+ */
+#ifndef XLWIP_CONFIG_TX_REAP_LOW_WATER
+#define XLWIP_CONFIG_TX_REAP_LOW_WATER	5
+#endif
+#ifndef XLWIP_CONFIG_TX_REAP_BUDGET
+#define XLWIP_CONFIG_TX_REAP_BUDGET	XLWIP_CONFIG_N_TX_DESC
+#endif
+
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+/* Time a blocking sender waits for its frame to go out */
+#define XEMACPS_TX_BLOCK_TIMEOUT_MS	1000
+#if NO_SYS
+typedef void (*xemacpsif_tx_complete_fn)(void *arg);
+#endif
+#endif
+
+#if XLWIP_CONFIG_EMACPS_PTP
+/* Called with the hardware timestamp of every sent frame, see
+ * xemacpsif_set_tx_timestamp_callback()
+ */
+typedef void (*xemacpsif_tx_timestamp_fn)(struct pbuf *p, u64_t sec,
+		u32_t nsec, void *arg);
+
+/* PI servo steering the timestamp unit of a GEM to a PTP master */
+struct xemacpsif_ptp_servo {
+	s32_t kp;		/* proportional gain, ppb per 1000 ns of offset */
+	s32_t ki;		/* integral gain, ppb per 1000 ns of offset */
+	s64_t step_threshold;	/* offsets above this many ns step the clock */
+	s32_t max_ppb;		/* frequency adjustment limit */
+	s64_t drift;		/* integral term, in ppb */
+};
+#endif
+
 void 	xemacpsif_setmac(u32_t index, u8_t *addr);
 u8_t*	xemacpsif_getmac(u32_t index);
 err_t 	xemacpsif_init(struct netif *netif);
@@ -136,6 +172,29 @@ typedef struct {
 
 	unsigned int last_rx_frms_cntr;
 	enum ethernet_link_status eth_link_status;
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+#if !NO_SYS
+	/* given when a frame sent with blocking TX completes */
+	sys_sem_t tx_complete_sem;
+#else
+	/* called from the TX done interrupt when a blocking frame completes */
+	xemacpsif_tx_complete_fn tx_complete_cb;
+	void *tx_complete_arg;
+#endif
+#endif
+#if XLWIP_CONFIG_EMACPS_PTP
+	/* set when the BD rings carry hardware timestamps */
+	u8_t hw_ts;
+	/* frequency adjustment of the timestamp unit */
+	s32_t tsu_ppb;
+	/* called from the TX reap with the timestamp of each sent frame */
+	xemacpsif_tx_timestamp_fn tx_ts_cb;
+	void *tx_ts_arg;
+#endif
+#if XLWIP_CONFIG_COALESCE
+	/* interrupt moderation controllers, XEMAC_COALESCE_RX/TX */
+	struct xemac_coalesce coal[2];
+#endif
 } xemacpsif_s;
 
 extern xemacpsif_s xemacpsif;
@@ -145,6 +204,28 @@ s32_t	xemacps_is_tx_space_available(xemacpsif_s *emac);
 /* xemacpsif_dma.c */
 
 void  xemacps_process_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring);
+u32_t xemacps_reap_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring,
+		u32_t budget);
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE && NO_SYS
+void  xemacpsif_set_tx_complete_callback(struct netif *netif,
+		xemacpsif_tx_complete_fn cb, void *arg);
+#endif
+#if XLWIP_CONFIG_EMACPS_PTP
+/* xemacpsif_ptp.c */
+void  xemacpsif_ptp_init(xemacpsif_s *xemacpsif);
+err_t xemacpsif_pbuf_get_timestamp(const struct pbuf *p, u64_t *sec,
+		u32_t *nsec);
+err_t xemacpsif_set_tx_timestamp_callback(struct netif *netif,
+		xemacpsif_tx_timestamp_fn cb, void *arg);
+void  xemacpsif_ptp_gettime(struct netif *netif, u64_t *sec, u32_t *nsec);
+void  xemacpsif_ptp_settime(struct netif *netif, u64_t sec, u32_t nsec);
+void  xemacpsif_ptp_adjtime(struct netif *netif, s64_t delta);
+void  xemacpsif_ptp_adjfreq(struct netif *netif, s32_t ppb);
+void  xemacpsif_ptp_servo_init(struct xemacpsif_ptp_servo *servo, s32_t kp,
+		s32_t ki, s64_t step_threshold, s32_t max_ppb);
+s32_t xemacpsif_ptp_servo_sample(struct netif *netif,
+		struct xemacpsif_ptp_servo *servo, s64_t offset);
+#endif
 u32_t phy_setup_emacps (XEmacPs *xemacpsp, u32_t phy_addr);
 #ifdef SGMII_FIXED_LINK
 u32_t pcs_setup_emacps (XEmacPs *xemacps);
@@ -0,0 +1,69 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Zero-copy socket extension of the Xilinx port (socket mode only).
+ *
+ * Send: the application wraps its own DMA-safe buffers in xlwip_zc_pbuf
+ * descriptors and hands them over with xlwip_zc_send()/xlwip_zc_sendto().
+ * The data is never copied; the MAC DMA reads it from the application
+ * buffer. When lwIP no longer needs a buffer (UDP: the frame was sent,
+ * TCP: the data was acknowledged by the peer, or the connection was torn
+ * down) the free callback of the descriptor is called. It may be called
+ * from the tcpip thread or from the TX done interrupt of the MAC, so it
+ * must not block.
+ *
+ * Receive: xlwip_zc_recv() returns the pbufs received by the netif as they
+ * are, without copying them to an application buffer. The application
+ * releases them with pbuf_free().
+ *
+ * Each call handles a batch of buffers with a single request to the tcpip
+ * thread, instead of one mbox post and context switch per buffer.
+ */
+
+#ifndef __XLWIP_ZC_H_
+#define __XLWIP_ZC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "lwip/opt.h"
+#include "xlwipconfig.h"
+
+#if XLWIP_CONFIG_ZERO_COPY_SOCKET
+
+#include "lwip/pbuf.h"
+#include "lwip/sockets.h"
+
+struct xlwip_zc_pbuf;
+
+/* Called when lwIP releases the buffer of a zero-copy descriptor */
+typedef void (*xlwip_zc_free_fn)(struct xlwip_zc_pbuf *zp, void *arg);
+
+/* Zero-copy send descriptor, owned by the application until it is sent */
+struct xlwip_zc_pbuf {
+	struct pbuf_custom pc;
+	xlwip_zc_free_fn free_fn;
+	void *arg;
+	/* Used by the port while the buffer waits for its TCP ACK */
+	struct xlwip_zc_pbuf *next;
+	u32_t end_seq;
+};
+
+struct pbuf *xlwip_zc_pbuf_init(struct xlwip_zc_pbuf *zp, void *buf,
+				u16_t len, xlwip_zc_free_fn free_fn, void *arg);
+int xlwip_zc_send(int s, struct pbuf **p, int n, int flags);
+int xlwip_zc_sendto(int s, struct pbuf **p, int n,
+		    const struct sockaddr *to, socklen_t tolen);
+int xlwip_zc_recv(int s, struct pbuf **p, int n, int flags);
+
+#endif /* XLWIP_CONFIG_ZERO_COPY_SOCKET */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __XLWIP_ZC_H_ */
@@ -43,6 +43,10 @@
 #include "lwip/tcp.h"
 #include "lwip/udp.h"
 #include "lwip/priv/tcp_priv.h"
+#if XLWIP_CONFIG_GRO
+#include "lwip/inet_chksum.h"
+#include <string.h>
+#endif
 
 #include "netif/etharp.h"
 #include "netif/xadapter.h"
@@ -59,6 +63,28 @@
 #include "netif/xemacpsif.h"
 #endif
 
+#if XLWIP_CONFIG_GRO
+/* TCP segment held for merging */
+struct xemac_gro_flow {
+	struct pbuf *head;	/* held frame, NULL if none */
+	u32_t next_seq;		/* sequence number expected next */
+	u32_t csum;		/* payload sum of the merged segments */
+	u16_t seg_len;		/* payload length of the first segment */
+	u16_t n_segs;
+	u32_t pay_len;		/* payload length held */
+	u32_t last_used;
+	u8_t in_use;
+	struct xemac_gro_stats stats;
+};
+
+struct xemac_gro {
+	u32_t tick;
+	struct xemac_gro_flow flow[XLWIP_CONFIG_GRO_FLOWS];
+};
+
+static void xemac_gro_init(struct netif *netif);
+#endif
+
 #if !NO_SYS
 #include "lwip/tcpip.h"
 
@@ -195,6 +221,12 @@ xemac_add(struct netif *netif,
 						(UINTPTR)mac_baseaddr);
 	}
 
+#if XLWIP_CONFIG_GRO
+	if (nif != NULL) {
+		xemac_gro_init(nif);
+	}
+#endif
+
 	#ifdef OS_IS_FREERTOS
 		/* Start thread to detect link periodically for Hot Plug autodetect */
 		sys_thread_new("link_detect_thread", link_detect_thread, netif,
@@ -227,8 +259,13 @@ xemacif_input_thread(struct netif *netif)
 }
 #endif
 
+#if XLWIP_CONFIG_GRO
+static int
+xemacif_input_frames(struct netif *netif)
+#else
 int
 xemacif_input(struct netif *netif)
+#endif
 {
 	struct xemac_s *emac = (struct xemac_s *)netif->state;
 
@@ -273,6 +310,579 @@ xemacif_input(struct netif *netif)
 	return n_packets;
 }
 
+#if XLWIP_CONFIG_GRO
+/*
+ * With GRO the frames read by one call form a receive batch. In socket mode
+ * the MAC input routine already drains its queue; with NO_SYS it reads one
+ * frame per call, so it is called until the queue is empty or enough frames
+ * for every flow to reach the flush limit were read. The segments still held
+ * are flushed at the end of the batch.
+ */
+int
+xemacif_input(struct netif *netif)
+{
+	int n_packets = 0;
+	int n;
+
+	do {
+		n = xemacif_input_frames(netif);
+		n_packets += n;
+	} while (NO_SYS && (n > 0) &&
+		 (n_packets < (XLWIP_CONFIG_GRO_FLUSH_LIMIT *
+			       XLWIP_CONFIG_GRO_FLOWS)));
+
+	xemac_gro_flush(netif);
+
+	return n_packets;
+}
+
+static void
+xemac_gro_init(struct netif *netif)
+{
+	struct xemac_s *emac = (struct xemac_s *)netif->state;
+
+	emac->gro = mem_malloc(sizeof *emac->gro);
+	if (emac->gro == NULL) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("xemac_gro_init: out of memory, GRO disabled\r\n"));
+		return;
+	}
+	memset(emac->gro, 0, sizeof *emac->gro);
+}
+
+/*
+ * Checks that p is an IPv4 TCP segment without IP options or fragmentation
+ * whose headers are in the first pbuf, and returns its headers.
+ */
+static int
+xemac_gro_parse(struct pbuf *p, struct ip_hdr **iphdr,
+		struct tcp_hdr **tcphdr, u16_t *tcphlen, u16_t *paylen)
+{
+	struct eth_hdr *ethhdr = (struct eth_hdr *)p->payload;
+	struct ip_hdr *iph;
+	struct tcp_hdr *tcph;
+	u16_t iplen;
+	u16_t hlen;
+
+	if (p->len < (SIZEOF_ETH_HDR + IP_HLEN + TCP_HLEN)) {
+		return 0;
+	}
+	if (ethhdr->type != PP_HTONS(ETHTYPE_IP)) {
+		return 0;
+	}
+	iph = (struct ip_hdr *)((u8_t *)p->payload + SIZEOF_ETH_HDR);
+	if ((IPH_V(iph) != 4) || (IPH_HL_BYTES(iph) != IP_HLEN) ||
+	    (IPH_PROTO(iph) != IP_PROTO_TCP) ||
+	    ((IPH_OFFSET(iph) & PP_HTONS(IP_OFFMASK | IP_MF)) != 0)) {
+		return 0;
+	}
+	iplen = lwip_ntohs(IPH_LEN(iph));
+	tcph = (struct tcp_hdr *)((u8_t *)iph + IP_HLEN);
+	hlen = TCPH_HDRLEN_BYTES(tcph);
+	if ((hlen < TCP_HLEN) || (iplen < (IP_HLEN + hlen)) ||
+	    (p->len < (SIZEOF_ETH_HDR + IP_HLEN + hlen)) ||
+	    (p->tot_len < (SIZEOF_ETH_HDR + iplen))) {
+		return 0;
+	}
+
+	*iphdr = iph;
+	*tcphdr = tcph;
+	*tcphlen = hlen;
+	*paylen = iplen - IP_HLEN - hlen;
+	return 1;
+}
+
+#if CHECKSUM_CHECK_TCP
+static u32_t
+xemac_gro_fold(u32_t acc)
+{
+	acc = (acc >> 16) + (acc & 0xffffUL);
+	acc = (acc >> 16) + (acc & 0xffffUL);
+	return acc;
+}
+
+/* sum of the pseudo header and the TCP header */
+static u32_t
+xemac_gro_hdr_sum(struct ip_hdr *iph, struct tcp_hdr *tcph, u16_t tcphlen,
+		u16_t tcplen)
+{
+	u32_t src = ip4_addr_get_u32(&iph->src);
+	u32_t dst = ip4_addr_get_u32(&iph->dest);
+	u32_t acc;
+
+	acc = (src & 0xffffUL) + (src >> 16) + (dst & 0xffffUL) + (dst >> 16);
+	acc += (u32_t)lwip_htons((u16_t)IP_PROTO_TCP);
+	acc += (u32_t)lwip_htons(tcplen);
+	acc += (u16_t)~inet_chksum(tcph, tcphlen);
+	return acc;
+}
+#endif
+
+/*
+ * Hands the segment held by a flow to lwIP. When segments were merged the
+ * IP length and checksum are rewritten, and the TCP checksum is rebuilt from
+ * the payload sums derived from the checksums of the merged segments, so a
+ * corrupted segment still fails the check done by lwIP.
+ */
+static void
+xemac_gro_flush_flow(struct netif *netif, struct xemac_gro_flow *flow)
+{
+	struct pbuf *p = flow->head;
+	struct ip_hdr *iph;
+	struct tcp_hdr *tcph;
+	u16_t tcphlen;
+	u16_t iplen;
+
+	if (p == NULL) {
+		return;
+	}
+	flow->head = NULL;
+
+	if (flow->n_segs > 1) {
+		iph = (struct ip_hdr *)((u8_t *)p->payload + SIZEOF_ETH_HDR);
+		tcph = (struct tcp_hdr *)((u8_t *)iph + IP_HLEN);
+		tcphlen = TCPH_HDRLEN_BYTES(tcph);
+		iplen = (u16_t)(IP_HLEN + tcphlen + flow->pay_len);
+
+		IPH_LEN_SET(iph, lwip_htons(iplen));
+		IPH_CHKSUM_SET(iph, 0);
+		IPH_CHKSUM_SET(iph, inet_chksum(iph, IP_HLEN));
+#if CHECKSUM_CHECK_TCP
+		tcph->chksum = 0;
+		tcph->chksum = (u16_t)~xemac_gro_fold(flow->csum +
+				xemac_gro_hdr_sum(iph, tcph, tcphlen,
+						  (u16_t)(iplen - IP_HLEN)));
+#endif
+	}
+
+	flow->stats.delivered++;
+	if (netif->input(p, netif) != ERR_OK) {
+		pbuf_free(p);
+	}
+}
+
+/*
+ * Returns the entry of the flow of a segment. A new flow takes an idle entry,
+ * or the least recently used one after flushing it.
+ */
+static struct xemac_gro_flow *
+xemac_gro_lookup(struct netif *netif, struct xemac_gro *gro,
+		struct ip_hdr *iph, struct tcp_hdr *tcph)
+{
+	struct xemac_gro_flow *flow;
+	struct xemac_gro_flow *victim = NULL;
+	u16_t src_port = lwip_ntohs(tcph->src);
+	u16_t dst_port = lwip_ntohs(tcph->dest);
+	int i;
+
+	for (i = 0; i < XLWIP_CONFIG_GRO_FLOWS; i++) {
+		flow = &gro->flow[i];
+		if ((flow->in_use != 0U) &&
+		    ip4_addr_cmp(&flow->stats.src_ip, &iph->src) &&
+		    ip4_addr_cmp(&flow->stats.dst_ip, &iph->dest) &&
+		    (flow->stats.src_port == src_port) &&
+		    (flow->stats.dst_port == dst_port)) {
+			return flow;
+		}
+		if ((victim == NULL) ||
+		    ((victim->head != NULL) && (flow->head == NULL)) ||
+		    (((victim->head == NULL) == (flow->head == NULL)) &&
+		     ((s32_t)(flow->last_used - victim->last_used) < 0))) {
+			victim = flow;
+		}
+	}
+
+	xemac_gro_flush_flow(netif, victim);
+	memset(&victim->stats, 0, sizeof victim->stats);
+	ip4_addr_copy(victim->stats.src_ip, iph->src);
+	ip4_addr_copy(victim->stats.dst_ip, iph->dest);
+	victim->stats.src_port = src_port;
+	victim->stats.dst_port = dst_port;
+	victim->in_use = 1U;
+	return victim;
+}
+
+/*
+ * Starts holding a segment, or delivers it when it cannot carry more data:
+ * flags other than ACK and PSH, no payload, or PSH set.
+ */
+static err_t
+xemac_gro_hold(struct netif *netif, struct xemac_gro_flow *flow,
+		struct pbuf *p, struct ip_hdr *iph, struct tcp_hdr *tcph,
+		u16_t tcphlen, u16_t paylen)
+{
+	u8_t flags = TCPH_FLAGS(tcph);
+
+	if ((paylen == 0) || (flags != TCP_ACK)) {
+		flow->stats.delivered++;
+		return netif->input(p, netif);
+	}
+
+	pbuf_realloc(p, (u16_t)(SIZEOF_ETH_HDR + IP_HLEN + tcphlen + paylen));
+	flow->head = p;
+	flow->next_seq = lwip_ntohl(tcph->seqno) + paylen;
+	flow->seg_len = paylen;
+	flow->pay_len = paylen;
+	flow->n_segs = 1;
+#if CHECKSUM_CHECK_TCP
+	flow->csum = (u16_t)~xemac_gro_fold(xemac_gro_hdr_sum(iph, tcph,
+			tcphlen, (u16_t)(tcphlen + paylen)));
+#else
+	LWIP_UNUSED_ARG(iph);
+#endif
+	return ERR_OK;
+}
+
+/*
+ * GRO receive: called by the MAC input routines for each received frame
+ * instead of netif->input, with the same contract (the caller frees p when
+ * an error is returned). In-order TCP segments of a flow are appended to the
+ * segment held for it, the others are passed on after the held segment of
+ * their flow.
+ */
+err_t
+xemac_gro_input(struct pbuf *p, struct netif *netif)
+{
+	struct xemac_s *emac = (struct xemac_s *)netif->state;
+	struct xemac_gro *gro = emac->gro;
+	struct xemac_gro_flow *flow;
+	struct ip_hdr *iph;
+	struct tcp_hdr *tcph;
+	struct ip_hdr *hiph;
+	struct tcp_hdr *htcph;
+	u16_t tcphlen;
+	u16_t paylen;
+	u8_t flags;
+
+	if ((gro == NULL) ||
+	    !xemac_gro_parse(p, &iph, &tcph, &tcphlen, &paylen)) {
+		return netif->input(p, netif);
+	}
+
+	flow = xemac_gro_lookup(netif, gro, iph, tcph);
+	flow->stats.rx_segs++;
+	flow->last_used = ++gro->tick;
+
+	if (flow->head == NULL) {
+		return xemac_gro_hold(netif, flow, p, iph, tcph, tcphlen, paylen);
+	}
+
+	hiph = (struct ip_hdr *)((u8_t *)flow->head->payload + SIZEOF_ETH_HDR);
+	htcph = (struct tcp_hdr *)((u8_t *)hiph + IP_HLEN);
+	flags = TCPH_FLAGS(tcph);
+
+	/*
+	 * only a segment continuing the held one with the same headers, and
+	 * only while the merged frame fits the u16_t tot_len of a pbuf.
+	 * xemac_gro_parse() takes no VLAN tagged frames, so the Ethernet
+	 * header is SIZEOF_ETH_HDR bytes.
+	 */
+	if ((paylen == 0) || (paylen > flow->seg_len) ||
+	    ((flags & (u8_t)~TCP_PSH) != TCP_ACK) ||
+	    (lwip_ntohl(tcph->seqno) != flow->next_seq) ||
+	    (tcph->ackno != htcph->ackno) || (tcph->wnd != htcph->wnd) ||
+	    (tcphlen != TCPH_HDRLEN_BYTES(htcph)) ||
+	    (memcmp(tcph + 1, htcph + 1, tcphlen - TCP_HLEN) != 0) ||
+	    (IPH_TOS(iph) != IPH_TOS(hiph)) || (IPH_TTL(iph) != IPH_TTL(hiph)) ||
+	    (IPH_OFFSET(iph) != IPH_OFFSET(hiph)) ||
+	    (memcmp((u8_t *)p->payload + ETH_PAD_SIZE,
+		    (u8_t *)flow->head->payload + ETH_PAD_SIZE,
+		    SIZEOF_ETH_HDR - ETH_PAD_SIZE) != 0) ||
+	    ((IP_HLEN + tcphlen + flow->pay_len + paylen) >
+	     (0xffffU - SIZEOF_ETH_HDR))) {
+		flow->stats.flush_other++;
+		xemac_gro_flush_flow(netif, flow);
+		return xemac_gro_hold(netif, flow, p, iph, tcph, tcphlen, paylen);
+	}
+
+#if CHECKSUM_CHECK_TCP
+	{
+		u32_t csum = (u16_t)~xemac_gro_fold(xemac_gro_hdr_sum(iph, tcph,
+				tcphlen, (u16_t)(tcphlen + paylen)));
+		/* the payload lands at an odd offset in the merged segment */
+		if ((flow->pay_len & 1U) != 0U) {
+			csum = SWAP_BYTES_IN_WORD(csum);
+		}
+		flow->csum += csum;
+	}
+#endif
+	pbuf_realloc(p, (u16_t)(SIZEOF_ETH_HDR + IP_HLEN + tcphlen + paylen));
+	pbuf_remove_header(p, SIZEOF_ETH_HDR + IP_HLEN + tcphlen);
+	pbuf_cat(flow->head, p);
+	flow->next_seq += paylen;
+	flow->pay_len += paylen;
+	flow->n_segs++;
+	flow->stats.merged_segs++;
+	if ((flags & TCP_PSH) != 0) {
+		TCPH_SET_FLAG(htcph, TCP_PSH);
+	}
+
+	if (flow->n_segs >= XLWIP_CONFIG_GRO_FLUSH_LIMIT) {
+		flow->stats.flush_limit++;
+		xemac_gro_flush_flow(netif, flow);
+	} else if (((flags & TCP_PSH) != 0) || (paylen < flow->seg_len)) {
+		/* end of a burst */
+		flow->stats.flush_other++;
+		xemac_gro_flush_flow(netif, flow);
+	}
+	return ERR_OK;
+}
+
+/*
+ * Hands all held segments to lwIP. Called at the end of each receive batch
+ * by xemacif_input().
+ */
+void
+xemac_gro_flush(struct netif *netif)
+{
+	struct xemac_s *emac = (struct xemac_s *)netif->state;
+	struct xemac_gro *gro = emac->gro;
+	int i;
+
+	if (gro == NULL) {
+		return;
+	}
+	for (i = 0; i < XLWIP_CONFIG_GRO_FLOWS; i++) {
+		if (gro->flow[i].head != NULL) {
+			gro->flow[i].stats.flush_batch++;
+			xemac_gro_flush_flow(netif, &gro->flow[i]);
+		}
+	}
+}
+
+/*
+ * Copies the statistics of flow entry 'flow' (0 to XLWIP_CONFIG_GRO_FLOWS - 1)
+ * of an interface. Returns 0 on success, -1 if the entry is unused.
+ */
+int
+xemac_gro_get_stats(struct netif *netif, int flow,
+		struct xemac_gro_stats *stats)
+{
+	struct xemac_s *emac = (struct xemac_s *)netif->state;
+	struct xemac_gro *gro = emac->gro;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	if ((gro == NULL) || (flow < 0) || (flow >= XLWIP_CONFIG_GRO_FLOWS) ||
+	    (gro->flow[flow].in_use == 0U)) {
+		return -1;
+	}
+	SYS_ARCH_PROTECT(lev);
+	*stats = gro->flow[flow].stats;
+	SYS_ARCH_UNPROTECT(lev);
+	return 0;
+}
+
+void
+xemac_gro_clear_stats(struct netif *netif)
+{
+	struct xemac_s *emac = (struct xemac_s *)netif->state;
+	struct xemac_gro *gro = emac->gro;
+	int i;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	if (gro == NULL) {
+		return;
+	}
+	SYS_ARCH_PROTECT(lev);
+	for (i = 0; i < XLWIP_CONFIG_GRO_FLOWS; i++) {
+		gro->flow[i].stats.rx_segs = 0;
+		gro->flow[i].stats.merged_segs = 0;
+		gro->flow[i].stats.delivered = 0;
+		gro->flow[i].stats.flush_limit = 0;
+		gro->flow[i].stats.flush_batch = 0;
+		gro->flow[i].stats.flush_other = 0;
+	}
+	SYS_ARCH_UNPROTECT(lev);
+}
+#endif
+
+#if XLWIP_CONFIG_COALESCE
+/*
+ * Adaptive interrupt coalescing. The DMA interrupt handlers of an adapter
+ * count the frames of each direction and call xemac_coalesce_sample() once
+ * per interrupt. Every XLWIP_CONFIG_COALESCE_INTERVAL ms it turns the frame
+ * rate into the number of frames per interrupt that keeps the interrupt rate
+ * under XLWIP_CONFIG_COALESCE_IRQ_RATE, and into the delay after which an
+ * interrupt is raised anyway. The adapter writes them to the hardware when it
+ * returns 1.
+ *
+ * At low rates every frame interrupts at once. The delay never exceeds
+ * XLWIP_CONFIG_COALESCE_MAX_DELAY, and the count never exceeds the frames
+ * that arrive within that delay or half the BDs the hardware has left, so
+ * coalescing neither adds more latency than configured nor lets a ring run
+ * dry while an interrupt is held back.
+ */
+#if NO_SYS
+/* Time base of the controllers, advanced by xemac_coalesce_tick() */
+static volatile u32_t xemac_coalesce_ms;
+#define XEMAC_COALESCE_NOW()	(xemac_coalesce_ms)
+#else
+#define XEMAC_COALESCE_NOW()	sys_now()
+#endif
+
+#define USEC_PER_SEC		1000000U
+
+void
+xemac_coalesce_init(struct xemac_coalesce *c, u32_t count, u32_t delay_us,
+		u32_t max_count, u32_t max_delay_us)
+{
+	c->frames = 0;
+	c->irqs = 0;
+	c->last_ms = XEMAC_COALESCE_NOW();
+	c->max_count = max_count;
+	c->max_delay_us = LWIP_MIN(max_delay_us, XLWIP_CONFIG_COALESCE_MAX_DELAY);
+	c->stats.samples = 0;
+	c->stats.updates = 0;
+	c->stats.frame_rate = 0;
+	c->stats.irq_rate = 0;
+	c->stats.count = count;
+	c->stats.delay_us = delay_us;
+	c->stats.min_avail = 0xFFFFFFFFU;
+}
+
+#if NO_SYS
+/*
+ * Advances the time base of the coalescing controllers by ms. Without an
+ * operating system the application calls it from its periodic timer, at
+ * least every XLWIP_CONFIG_COALESCE_INTERVAL ms; until it does, the
+ * settings made at initialization stay in effect.
+ */
+void
+xemac_coalesce_tick(u32_t ms)
+{
+	xemac_coalesce_ms += ms;
+}
+#endif
+
+/*
+ * Called by the interrupt handler of a direction after it has processed the
+ * completed BDs; avail is the number of BDs the hardware can still use, empty
+ * RX BDs or free TX BDs. Returns 1 if stats.count and stats.delay_us changed
+ * and must be written to the hardware.
+ */
+int
+xemac_coalesce_sample(struct xemac_coalesce *c, u32_t avail)
+{
+	u32_t now = XEMAC_COALESCE_NOW();
+	u32_t elapsed = now - c->last_ms;
+	u32_t rate, count, delay, limit;
+
+	c->irqs++;
+	if (elapsed < XLWIP_CONFIG_COALESCE_INTERVAL) {
+		return 0;
+	}
+
+	rate = (u32_t)(((u64_t)c->frames * 1000U) / elapsed);
+	c->stats.irq_rate = (u32_t)(((u64_t)c->irqs * 1000U) / elapsed);
+	c->frames = 0;
+	c->irqs = 0;
+	c->last_ms = now;
+	c->stats.samples++;
+	if (avail < c->stats.min_avail) {
+		c->stats.min_avail = avail;
+	}
+
+	/* Follow a rising rate at once, so that the interrupts of a burst are
+	 * coalesced from its start, and a falling one over a few samples
+	 */
+	if (rate >= c->stats.frame_rate) {
+		c->stats.frame_rate = rate;
+	} else {
+		c->stats.frame_rate -= (c->stats.frame_rate - rate + 1U) / 2U;
+	}
+	rate = c->stats.frame_rate;
+
+	count = (rate + XLWIP_CONFIG_COALESCE_IRQ_RATE - 1U) /
+		XLWIP_CONFIG_COALESCE_IRQ_RATE;
+	if (count > 1U) {
+		limit = (u32_t)(((u64_t)rate * c->max_delay_us) / USEC_PER_SEC);
+		count = LWIP_MIN(count, limit);
+	}
+	count = LWIP_MIN(count, avail / 2U);
+	count = LWIP_MIN(count, c->max_count);
+	if (count <= 1U) {
+		count = 1U;
+		delay = 0U;
+	} else {
+		/* The time count frames take to arrive */
+		delay = (u32_t)(((u64_t)count * USEC_PER_SEC) / rate);
+		delay = LWIP_MAX(delay, 1U);
+		delay = LWIP_MIN(delay, c->max_delay_us);
+	}
+
+	/* Small changes of the delay are not worth a register write */
+	if ((count == c->stats.count) &&
+	    ((delay == c->stats.delay_us) ||
+	     ((delay > c->stats.delay_us - c->stats.delay_us / 8U) &&
+	      (delay < c->stats.delay_us + c->stats.delay_us / 8U)))) {
+		return 0;
+	}
+	c->stats.count = count;
+	c->stats.delay_us = delay;
+	c->stats.updates++;
+	return 1;
+}
+
+static struct xemac_coalesce *
+xemac_coalesce_get(struct netif *netif)
+{
+	struct xemac_s *emac = (struct xemac_s *)netif->state;
+
+	switch (emac->type) {
+#if defined(XLWIP_CONFIG_INCLUDE_GEM)
+	case xemac_type_emacps:
+		return ((xemacpsif_s *)emac->state)->coal;
+#endif
+#if defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_DMA)
+	case xemac_type_axi_ethernet:
+		return ((xaxiemacif_s *)emac->state)->coal;
+#endif
+	default:
+		return NULL;
+	}
+}
+
+/*
+ * Copies the coalescing statistics of direction dir (XEMAC_COALESCE_RX or
+ * XEMAC_COALESCE_TX) of an interface. Returns 0 on success, -1 if the
+ * interface has no coalescing controller.
+ */
+int
+xemac_coalesce_get_stats(struct netif *netif, int dir,
+		struct xemac_coalesce_stats *stats)
+{
+	struct xemac_coalesce *c = xemac_coalesce_get(netif);
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	if ((c == NULL) || ((dir != XEMAC_COALESCE_RX) &&
+			    (dir != XEMAC_COALESCE_TX))) {
+		return -1;
+	}
+	SYS_ARCH_PROTECT(lev);
+	*stats = c[dir].stats;
+	SYS_ARCH_UNPROTECT(lev);
+	return 0;
+}
+
+void
+xemac_coalesce_clear_stats(struct netif *netif)
+{
+	struct xemac_coalesce *c = xemac_coalesce_get(netif);
+	int dir;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	if (c == NULL) {
+		return;
+	}
+	SYS_ARCH_PROTECT(lev);
+	for (dir = XEMAC_COALESCE_RX; dir <= XEMAC_COALESCE_TX; dir++) {
+		c[dir].stats.samples = 0;
+		c[dir].stats.updates = 0;
+		c[dir].stats.min_avail = 0xFFFFFFFFU;
+	}
+	SYS_ARCH_UNPROTECT(lev);
+}
+#endif
+
 #ifdef SGMII_FIXED_LINK
 static u32_t pcs_link_detect(XEmacPs *xemacp)
 {
@@ -251,12 +251,17 @@ static struct pbuf *low_level_input(struct netif *netif)
 	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
 	struct pbuf *p;
 
+#ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA
+	/* return one packet from the receive queues of the channels */
+	p = axi_mcdma_rx_dequeue(xaxiemacif);
+#else
 	/* see if there is data to process */
 	if (pq_qlength(xaxiemacif->recv_q) == 0)
 		return NULL;
 
 	/* return one packet from receive q */
 	p = (struct pbuf *)pq_dequeue(xaxiemacif->recv_q);
+#endif
 	return p;
 }
 
@@ -329,7 +334,11 @@ int xaxiemacif_input(struct netif *netif)
 			case ETHTYPE_PPPOE:
 #endif /* PPPOE_SUPPORT */
 				/* full packet send to tcpip_thread to process */
+#if XLWIP_CONFIG_GRO
+				if (xemac_gro_input(p, netif) != ERR_OK) {
+#else
 				if (netif->input(p, netif) != ERR_OK) {
+#endif
 					LWIP_DEBUGF(NETIF_DEBUG, ("xaxiemacif_input: IP input error\r\n"));
 					pbuf_free(p);
 					p = NULL;
@@ -369,9 +378,14 @@ static err_t low_level_init(struct netif *netif)
 	xemac->type = xemac_type_axi_ethernet;
 
 	xaxiemacif->send_q = NULL;
+#ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA
+	/* MCDMA frames are queued per channel, see axi_mcdma_rx_dequeue() */
+	xaxiemacif->recv_q = NULL;
+#else
 	xaxiemacif->recv_q = pq_create_queue();
 	if (!xaxiemacif->recv_q)
 		return ERR_MEM;
+#endif
 
 	/* maximum transfer unit */
 #ifdef USE_JUMBO_FRAMES
@@ -129,6 +129,32 @@ volatile u32_t notifyinfo[XLWIP_CONFIG_N_TX_DESC];
 #define XAxiDma_BD_TO_INDEX(ringptr, bdptr)				\
 	(((UINTPTR)bdptr - (UINTPTR)(ringptr)->FirstBdAddr) / (ringptr)->Separation)
 
+#if XLWIP_CONFIG_COALESCE
+/* Limits of the coalescing counter and delay timer of a channel */
+#define AXIDMA_COALESCE_COUNT_MAX	0xFFU
+#define AXIDMA_COALESCE_TIMER_MAX	0xFFU
+#define AXIDMA_COALESCE_MAX_DELAY	\
+	((AXIDMA_COALESCE_TIMER_MAX * XLWIP_CONFIG_COALESCE_AXIDMA_TIMER_UNIT) / 1000U)
+
+/* Writes the settings chosen by xemac_coalesce_sample() to a channel. The
+ * delay timer runs in units of XLWIP_CONFIG_COALESCE_AXIDMA_TIMER_UNIT ns
+ * and is not needed when every frame interrupts.
+ */
+static void axidma_coalesce_apply(XAxiDma_BdRing *ring,
+		struct xemac_coalesce *c)
+{
+	u32_t timer = 0;
+
+	if (c->stats.count > 1) {
+		timer = (c->stats.delay_us * 1000U) /
+			XLWIP_CONFIG_COALESCE_AXIDMA_TIMER_UNIT;
+		timer = LWIP_MAX(timer, 1U);
+		timer = LWIP_MIN(timer, AXIDMA_COALESCE_TIMER_MAX);
+	}
+	XAxiDma_BdRingSetCoalesce(ring, c->stats.count, timer);
+}
+#endif
+
 static inline void bd_csum_enable(XAxiDma_Bd *bd)
 {
 	XAxiDma_BdWrite((bd), XAXIDMA_BD_USR0_OFFSET,
@@ -311,6 +337,13 @@ static void axidma_send_handler(void *arg)
 		process_sent_bds(txringptr);
 	}
 
+#if XLWIP_CONFIG_COALESCE
+	if (xemac_coalesce_sample(&xaxiemacif->coal[XEMAC_COALESCE_TX],
+				  XAxiDma_BdRingGetFreeCnt(txringptr))) {
+		axidma_coalesce_apply(txringptr,
+				      &xaxiemacif->coal[XEMAC_COALESCE_TX]);
+	}
+#endif
 	XAxiDma_BdRingIntEnable(txringptr, XAXIDMA_IRQ_ALL_MASK);
 
 #if !NO_SYS
@@ -483,7 +516,19 @@ static void axidma_recv_handler(void *arg)
 		/* return all the processed bd's back to the stack */
 		/* setup_rx_bds -> use XAxiDma_BdRingGetFreeCnt */
 		setup_rx_bds(rxring);
+#if XLWIP_CONFIG_COALESCE
+		xaxiemacif->coal[XEMAC_COALESCE_RX].frames += bd_processed;
+#endif
+	}
+#if XLWIP_CONFIG_COALESCE
+	/* The BDs left to the hardware are those not free */
+	if (xemac_coalesce_sample(&xaxiemacif->coal[XEMAC_COALESCE_RX],
+				  XAxiDma_BdRingGetCnt(rxring) -
+				  XAxiDma_BdRingGetFreeCnt(rxring))) {
+		axidma_coalesce_apply(rxring,
+				      &xaxiemacif->coal[XEMAC_COALESCE_RX]);
 	}
+#endif
 	XAxiDma_BdRingIntEnable(rxring, XAXIDMA_IRQ_ALL_MASK);
 #if !NO_SYS
 	sys_sem_signal(&xemac->sem_rx_data_available);
@@ -652,6 +697,9 @@ XStatus axidma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p)
     }
 #endif
 
+#if XLWIP_CONFIG_COALESCE
+	xaxiemacif->coal[XEMAC_COALESCE_TX].frames++;
+#endif
 	/* enq to h/w */
 	return XAxiDma_BdRingToHw(txring, n_pbufs, txbdset);
 }
@@ -816,6 +864,16 @@ XStatus init_axi_dma(struct xemac_s *xemac)
 		LWIP_DEBUGF(NETIF_DEBUG, ("Error setting coalescing settings\r\n"));
 		return ERR_IF;
 	}
+#if XLWIP_CONFIG_COALESCE
+	xemac_coalesce_init(&xaxiemacif->coal[XEMAC_COALESCE_TX],
+			    XLWIP_CONFIG_N_TX_COALESCE,
+			    XLWIP_CONFIG_COALESCE_AXIDMA_TIMER_UNIT / 1000U,
+			    AXIDMA_COALESCE_COUNT_MAX, AXIDMA_COALESCE_MAX_DELAY);
+	xemac_coalesce_init(&xaxiemacif->coal[XEMAC_COALESCE_RX],
+			    XLWIP_CONFIG_N_RX_COALESCE,
+			    XLWIP_CONFIG_COALESCE_AXIDMA_TIMER_UNIT / 1000U,
+			    AXIDMA_COALESCE_COUNT_MAX, AXIDMA_COALESCE_MAX_DELAY);
+#endif
 	/* start DMA */
 	status = XAxiDma_BdRingStart(txringptr);
 	if (status != XST_SUCCESS) {
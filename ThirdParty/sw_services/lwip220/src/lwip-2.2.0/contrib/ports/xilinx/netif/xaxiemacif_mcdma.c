@@ -36,6 +36,9 @@
 #include "lwip/sys.h"
 #endif
 
+#include <string.h>
+
+#include "lwip/mem.h"
 #include "lwip/stats.h"
 #include "lwip/inet_chksum.h"
 
@@ -84,6 +87,26 @@
 #define XMCDMA_COALESCEDELAY    0x1
 
 #define RESET_TIMEOUT_COUNT     10000
+/*
+ * Frames a channel queue holds: twice the RX descriptors, rounded up to a
+ * power of two so that the free-running head and tail indices can be masked
+ */
+#define RX_CHAN_Q_MIN           (2 * XLWIP_CONFIG_N_RX_DESC - 1)
+#define RX_CHAN_Q_OR1           (RX_CHAN_Q_MIN | (RX_CHAN_Q_MIN >> 1))
+#define RX_CHAN_Q_OR2           (RX_CHAN_Q_OR1 | (RX_CHAN_Q_OR1 >> 2))
+#define RX_CHAN_Q_OR4           (RX_CHAN_Q_OR2 | (RX_CHAN_Q_OR2 >> 4))
+#define RX_CHAN_Q_OR8           (RX_CHAN_Q_OR4 | (RX_CHAN_Q_OR4 >> 8))
+#define RX_CHAN_Q_SIZE          ((RX_CHAN_Q_OR8 | (RX_CHAN_Q_OR8 >> 16)) + 1)
+#define RX_CHAN_Q_MASK          (RX_CHAN_Q_SIZE - 1)
+
+#if (RX_CHAN_Q_SIZE & RX_CHAN_Q_MASK) != 0
+#error "RX_CHAN_Q_SIZE must be a power of two"
+#endif
+
+#define ETH_TYPE_OFFSET         12
+#define ETH_HLEN                14
+#define ETH_VLAN_HLEN           4
+#define IPV6_HLEN               40
 #define BLOCK_SIZE_2MB          0x200000
 #define BLOCK_SIZE_1MB          0x100000
 
@@ -244,6 +267,100 @@ static inline void *alloc_bdspace(int n_desc, u32 alignment)
 	return aligned_mem;
 }
 
+static inline u32_t get_be32(const u8_t *b)
+{
+	return ((u32_t)b[0] << 24) | ((u32_t)b[1] << 16) |
+	       ((u32_t)b[2] << 8) | (u32_t)b[3];
+}
+
+/*
+ * Hashes the addresses, protocol and TCP/UDP ports of an IPv4 or IPv6 frame
+ * whose headers are in the first pbuf. Frames of other types hash to 0.
+ * Headers are read byte-wise, the frame may not be aligned.
+ */
+static u32_t axi_mcdma_flow_hash(const struct pbuf *p)
+{
+	const u8_t *b = (const u8_t *)p->payload;
+	u32_t off = ETH_HLEN;
+	u32_t type;
+	u32_t hash = 0;
+	u32_t i;
+	u32_t hlen;
+	u8_t proto;
+
+	if (p->len < ETH_HLEN) {
+		return 0;
+	}
+	type = ((u32_t)b[ETH_TYPE_OFFSET] << 8) | b[ETH_TYPE_OFFSET + 1];
+	if ((type == ETHTYPE_VLAN) && (p->len >= (ETH_HLEN + ETH_VLAN_HLEN))) {
+		type = ((u32_t)b[ETH_HLEN + 2] << 8) | b[ETH_HLEN + 3];
+		off += ETH_VLAN_HLEN;
+	}
+
+	if ((type == ETHTYPE_IP) && (p->len >= (off + IP_HLEN))) {
+		hlen = (u32_t)(b[off] & 0x0fU) * 4U;
+		proto = b[off + 9];
+		hash = get_be32(&b[off + 12]) ^ get_be32(&b[off + 16]);
+		/* no ports in fragments other than the first */
+		if ((((b[off + 6] & 0x1fU) | b[off + 7]) != 0U) ||
+		    ((b[off + 6] & 0x20U) != 0U)) {
+			proto = 0;
+		}
+		off += hlen;
+	} else if ((type == ETHTYPE_IPV6) && (p->len >= (off + IPV6_HLEN))) {
+		proto = b[off + 6];
+		for (i = 8; i < IPV6_HLEN; i += 4) {
+			hash ^= get_be32(&b[off + i]);
+		}
+		off += IPV6_HLEN;
+	} else {
+		return 0;
+	}
+
+	hash ^= proto;
+	if (((proto == IP_PROTO_TCP) || (proto == IP_PROTO_UDP)) &&
+	    (p->len >= (off + 4))) {
+		hash ^= get_be32(&b[off]);
+	}
+
+	/* mix the bits so that the low ones select the channel */
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6bUL;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35UL;
+	hash ^= hash >> 16;
+	return hash;
+}
+
+/*
+ * Takes a received frame from the channel queues. The channels are served
+ * round-robin, up to XLWIP_CONFIG_MCDMA_RX_BUDGET frames each, so a busy
+ * channel does not starve the others. Called with interrupts disabled.
+ */
+struct pbuf *axi_mcdma_rx_dequeue(xaxiemacif_s *xaxiemacif)
+{
+	u8_t ChanCnt = xaxiemacif->axi_ethernet.Config.AxiMcDmaChan_Cnt;
+	xaxiemacif_rx_chan_q *q;
+	struct pbuf *p;
+	u8_t i;
+
+	for (i = 0; i <= ChanCnt; i++) {
+		q = &xaxiemacif->rx_chan_q[xaxiemacif->rx_chan_cur];
+		if ((q->head != q->tail) &&
+		    (xaxiemacif->rx_chan_served < XLWIP_CONFIG_MCDMA_RX_BUDGET)) {
+			p = q->frames[q->tail & RX_CHAN_Q_MASK];
+			q->tail++;
+			xaxiemacif->rx_chan_served++;
+			return p;
+		}
+		xaxiemacif->rx_chan_served = 0;
+		if (++xaxiemacif->rx_chan_cur >= ChanCnt) {
+			xaxiemacif->rx_chan_cur = 0;
+		}
+	}
+	return NULL;
+}
+
 static void axi_mcdma_send_error_handler(void *CallBackRef, u32 ChanId, u32 Mask)
 {
 	u32 timeOut;
@@ -393,6 +510,10 @@ static void axi_mcdma_recv_handler(void *CallBackRef, u32 ChanId)
 	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
 	XMcdma *McDmaInstPtr = &xaxiemacif->aximcdma;
 	XMcdma_ChanCtrl *Rx_Chan;
+	xaxiemacif_rx_chan_q *q;
+#if XLWIP_CONFIG_MCDMA_RX_STEERING
+	u8_t ChanCnt = xaxiemacif->axi_ethernet.Config.AxiMcDmaChan_Cnt;
+#endif
 
 #if !NO_SYS
 	xInsideISR++;
@@ -420,15 +541,26 @@ static void axi_mcdma_recv_handler(void *CallBackRef, u32 ChanId)
 			LWIP_DEBUGF(NETIF_DEBUG, ("Incorrect csum as calculated by the hw\r\n"));
 		}
 #endif
-		/* store it in the receive queue,
-		 * where it'll be processed by a different handler
+		/* store it in the receive queue of the channel, or of the
+		 * channel its flow hashes to, where it'll be processed by a
+		 * different handler
 		 */
-		if (pq_enqueue(xaxiemacif->recv_q, (void*)p) < 0) {
+#if XLWIP_CONFIG_MCDMA_RX_STEERING
+		q = &xaxiemacif->rx_chan_q[axi_mcdma_flow_hash(p) % ChanCnt];
+#else
+		q = &xaxiemacif->rx_chan_q[ChanId - 1];
+#endif
+		if ((q->head - q->tail) >= RX_CHAN_Q_SIZE) {
 #if LINK_STATS
 			lwip_stats.link.memerr++;
 			lwip_stats.link.drop++;
 #endif
+			q->rx_dropped++;
 			pbuf_free(p);
+		} else {
+			q->frames[q->head & RX_CHAN_Q_MASK] = p;
+			q->head++;
+			q->rx_frames++;
 		}
 		rxbd = (XMcdma_Bd *)XMcdma_BdChainNextBd(Rx_Chan, rxbd);
 	}
@@ -535,26 +667,32 @@ XStatus axi_mcdma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p)
 	XMcdma_Bd *txbdset, *txbd, *last_txbd = NULL;
 	XMcdma_ChanCtrl *Tx_Chan;
 	XStatus status;
-	static u8_t ChanId = 1;
-	u8_t next_ChanId = ChanId;
+	u8_t ChanCnt = xaxiemacif->axi_ethernet.Config.AxiMcDmaChan_Cnt;
+	u8_t ChanId;
+	u8_t first_ChanId;
 
 	/* first count the number of pbufs */
 	for (q = p; q != NULL; q = q->next)
 		n_pbufs++;
 
-	/* Transfer packets to TX DMA Channels in round-robin manner */
-	do {
+	/* Keep the frames of a flow on one TX DMA channel so that they stay
+	 * in order, moving to the next channel only when it is full
+	 */
+	ChanId = (u8_t)(axi_mcdma_flow_hash(p) % ChanCnt) + 1;
+	first_ChanId = ChanId;
+	while (1) {
 		Tx_Chan = XMcdma_GetMcdmaTxChan(&xaxiemacif->aximcdma, ChanId);
+		if (n_pbufs <= Tx_Chan->BdCnt)
+			break;
 
-		if (++ChanId > xaxiemacif->axi_ethernet.Config.AxiMcDmaChan_Cnt)
+		if (++ChanId > ChanCnt)
 			ChanId = 1;
 
-		if ((next_ChanId == ChanId) && (n_pbufs > Tx_Chan->BdCnt)) {
+		if (ChanId == first_ChanId) {
 			LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error, not enough BD space in All Chans\r\n"));
 			return ERR_IF;
 		}
-
-	} while (n_pbufs > Tx_Chan->BdCnt);
+	}
 
 	txbdset = (XMcdma_Bd *)XMcdma_GetChanCurBd(Tx_Chan);
 
@@ -802,6 +940,9 @@ XStatus init_axi_mcdma(struct xemac_s *xemac)
 	LWIP_DEBUGF(NETIF_DEBUG, ("tx_bdspace: 0x%08x\r\n",
 				xaxiemacif->tx_bdspace));
 
+	xaxiemacif->rx_chan_cur = 0;
+	xaxiemacif->rx_chan_served = 0;
+
 	/* Initialize MCDMA */
 	baseaddr = xaxiemacif->axi_ethernet.Config.AxiDevBaseAddress;
 	dmaconfig = XMcdma_LookupConfigBaseAddr(baseaddr);
@@ -820,6 +961,15 @@ XStatus init_axi_mcdma(struct xemac_s *xemac)
 		ChanId <= xaxiemacif->axi_ethernet.Config.AxiMcDmaChan_Cnt;
 								ChanId++) {
 
+		memset(&xaxiemacif->rx_chan_q[ChanId - 1], 0,
+		       sizeof(xaxiemacif->rx_chan_q[ChanId - 1]));
+		xaxiemacif->rx_chan_q[ChanId - 1].frames =
+			mem_malloc(RX_CHAN_Q_SIZE * sizeof(struct pbuf *));
+		if (xaxiemacif->rx_chan_q[ChanId - 1].frames == NULL) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("%s@%d: Error: Unable to allocate RX chan queue\r\n", __FILE__, __LINE__));
+			return ERR_MEM;
+		}
+
 		status = axi_mcdma_setup_rx_chan(xemac, ChanId);
 		if (status != XST_SUCCESS) {
 			LWIP_DEBUGF(NETIF_DEBUG, ("%s@%d: Error: MCDMA Rx chan setup failed\r\n", __FILE__, __LINE__));
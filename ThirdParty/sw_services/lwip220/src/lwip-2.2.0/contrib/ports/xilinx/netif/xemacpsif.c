@@ -150,7 +150,9 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p)
     s32_t freecnt;
     XEmacPs_BdRing *txring;
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+#if NO_SYS
 	u32_t notfifyblocksleepcntr;
+#endif
 	u32_t to_block_index;
 #endif
 
@@ -161,9 +163,10 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p)
 	SYS_ARCH_PROTECT(lev);
 	/* check if space is available to send */
     freecnt = xemacps_is_tx_space_available(xemacpsif);
-    if (freecnt <= 5) {
+    if (freecnt <= XLWIP_CONFIG_TX_REAP_LOW_WATER) {
 	txring = &(XEmacPs_GetTxRing(&xemacpsif->emacps));
-		xemacps_process_sent_bds(xemacpsif, txring);
+		(void)xemacps_reap_sent_bds(xemacpsif, txring,
+				XLWIP_CONFIG_TX_REAP_BUDGET);
 	}
 
     if (xemacps_is_tx_space_available(xemacpsif)) {
@@ -187,17 +190,35 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p)
 	SYS_ARCH_UNPROTECT(lev);
 
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
-	if (netif_is_opt_block_tx_set(netif, NETIF_ENABLE_BLOCKING_TX_FOR_PACKET)) {
-		/* Wait for approx 1 second before timing out */
-		notfifyblocksleepcntr = 900000;
-		while(notifyinfo[to_block_index] == 1) {
-			usleep(1);
-			notfifyblocksleepcntr--;
-			if (notfifyblocksleepcntr <= 0) {
+	if ((err == ERR_OK) &&
+	    netif_is_opt_block_tx_set(netif, NETIF_ENABLE_BLOCKING_TX_FOR_PACKET)) {
+#if !NO_SYS
+		/* Sleep until the TX done interrupt frees the frame. A give left
+		 * over from an earlier timed out frame only causes one more pass.
+		 */
+		while (notifyinfo[to_block_index] != 0) {
+			if (sys_arch_sem_wait(&xemacpsif->tx_complete_sem,
+					XEMACPS_TX_BLOCK_TIMEOUT_MS) == SYS_ARCH_TIMEOUT) {
 				err = ERR_TIMEOUT;
 				break;
 			}
 		}
+#else
+		/* With a completion callback the sender is told from the TX done
+		 * interrupt, otherwise poll for approx 1 second before timing out
+		 */
+		if (xemacpsif->tx_complete_cb == NULL) {
+			notfifyblocksleepcntr = 900000;
+			while(notifyinfo[to_block_index] != 0) {
+				usleep(1);
+				notfifyblocksleepcntr--;
+				if (notfifyblocksleepcntr <= 0) {
+					err = ERR_TIMEOUT;
+					break;
+				}
+			}
+		}
+#endif
 	}
 	netif_clear_opt_block_tx(netif, NETIF_ENABLE_BLOCKING_TX_FOR_PACKET);
 #endif
@@ -297,7 +318,11 @@ s32_t xemacpsif_input(struct netif *netif)
 			case ETHTYPE_PPPOE:
 	#endif /* PPPOE_SUPPORT */
 				/* full packet send to tcpip_thread to process */
+#if XLWIP_CONFIG_GRO
+				if (xemac_gro_input(p, netif) != ERR_OK) {
+#else
 				if (netif->input(p, netif) != ERR_OK) {
+#endif
 					LWIP_DEBUGF(NETIF_DEBUG, ("xemacpsif_input: IP input error\r\n"));
 					pbuf_free(p);
 					p = NULL;
@@ -391,6 +416,23 @@ static err_t low_level_init(struct netif *netif)
 
 #if !NO_SYS
 	sys_sem_new(&xemac->sem_rx_data_available, 0);
+#endif
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+#if !NO_SYS
+	if (sys_sem_new(&xemacpsif->tx_complete_sem, 0) != ERR_OK) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("xemacpsif_init: out of memory\r\n"));
+		return ERR_MEM;
+	}
+#else
+	xemacpsif->tx_complete_cb = NULL;
+	xemacpsif->tx_complete_arg = NULL;
+#endif
+#endif
+#if XLWIP_CONFIG_EMACPS_PTP
+	xemacpsif->hw_ts = 0;
+	xemacpsif->tsu_ppb = 0;
+	xemacpsif->tx_ts_cb = NULL;
+	xemacpsif->tx_ts_arg = NULL;
 #endif
 	/* obtain config of this emac */
 	mac_config = (XEmacPs_Config *)xemacps_lookup_config((unsigned)(UINTPTR)netif->state);
@@ -794,3 +836,28 @@ void xemacpsif_resetrx_on_no_rxdata(struct netif *netif)
 
 	resetrx_on_no_rxdata(xemacpsif);
 }
+
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE && NO_SYS
+/*
+ * xemacpsif_set_tx_complete_callback():
+ *
+ * Registers a function called from the TX done interrupt when a frame sent
+ * with NETIF_ENABLE_BLOCKING_TX_FOR_PACKET is out. While a callback is set
+ * low_level_output() returns without polling for the completion. Passing
+ * NULL restores the polled wait.
+ *
+ */
+
+void xemacpsif_set_tx_complete_callback(struct netif *netif,
+		xemacpsif_tx_complete_fn cb, void *arg)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	xemacpsif->tx_complete_cb = cb;
+	xemacpsif->tx_complete_arg = arg;
+	SYS_ARCH_UNPROTECT(lev);
+}
+#endif
@@ -33,6 +33,10 @@
 #include "lwip/stats.h"
 #include "lwip/sys.h"
 #include "lwip/inet_chksum.h"
+#if LWIP_NETIF_LSO
+#include "lwip/prot/ip4.h"
+#include "lwip/prot/tcp.h"
+#endif
 
 #include "netif/xadapter.h"
 #include "netif/xemacpsif.h"
@@ -77,6 +81,13 @@ static s32_t emac_intr_num;
 volatile u32_t notifyinfo[4*XLWIP_CONFIG_N_TX_DESC];
 #endif
 
+#if LWIP_NETIF_LSO
+/* Largest TX buffer of one BD that keeps UFO payload BDs 8 byte multiples */
+#define LSO_MAX_BD_LEN	0x3FF8U
+/* Frame check sequence, counted in the UFO max frame size */
+#define LSO_FCS_LEN	4U
+#endif
+
 /******************************************************************************
  * Each BD is of 8 bytes of size and the BDs (BD chain) need to be  put
  * at uncached memory location. If they are not put at uncached
@@ -133,6 +144,35 @@ extern u32 xInsideISR;
 #define XEMACPS_BD_TO_INDEX(ringptr, bdptr)				\
 	(((UINTPTR)bdptr - (UINTPTR)(ringptr)->BaseBdAddr) / (ringptr)->Separation)
 
+#if XLWIP_CONFIG_COALESCE
+/* Longest interrupt moderation time at 1 Gb/s, in us */
+#define EMACPS_COALESCE_MAX_DELAY	\
+	((XEMACPS_INTMOD_MAX * XEMACPS_INTMOD_UNIT_NS_1000) / 1000U)
+
+/* Writes the delay chosen by xemac_coalesce_sample() to the interrupt
+ * moderation of a direction. The GEM has no frame count threshold, the count
+ * only sizes the delay. The moderation unit grows tenfold with each lower
+ * link speed.
+ */
+static void emacps_coalesce_apply(xemacpsif_s *xemacpsif, u32_t dir,
+		struct xemac_coalesce *c)
+{
+	u32_t unit_ns = XEMACPS_INTMOD_UNIT_NS_1000;
+	u32_t units;
+	u16 speed;
+
+	speed = XEmacPs_GetOperatingSpeed(&xemacpsif->emacps);
+	if (speed == 100) {
+		unit_ns *= 10U;
+	} else if (speed == 10) {
+		unit_ns *= 100U;
+	}
+	units = (c->stats.delay_us * 1000U + unit_ns - 1U) / unit_ns;
+	units = LWIP_MIN(units, XEMACPS_INTMOD_MAX);
+	(void)XEmacPs_SetIntrModeration(&xemacpsif->emacps, dir, units);
+}
+#endif
+
 
 s32_t xemacps_is_tx_space_available(xemacpsif_s *emac)
 {
@@ -230,19 +270,34 @@ u32_t get_base_index_rxpbufsstorage (xemacpsif_s *xemacpsif)
 	return index;
 }
 
-void xemacps_process_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring)
+/*
+ * Frees up to budget sent BDs and their pbufs, and returns the number freed.
+ * BDs of a frame are only returned by the driver once the whole frame is
+ * sent, so a budget never splits a frame. When a frame sent with blocking TX
+ * is freed, the waiting sender is woken up.
+ */
+u32_t xemacps_reap_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring,
+		u32_t budget)
 {
 	XEmacPs_Bd *txbdset;
 	XEmacPs_Bd *curbdpntr;
 	s32_t n_bds;
 	XStatus status;
 	s32_t n_pbufs_freed = 0;
+	u32_t n_reaped = 0;
 	u32_t bdindex;
 	struct pbuf *p;
 	u32 *temp;
 	u32_t index;
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
 	u32_t tx_task_notifier_index;
+	u32_t n_blocked_done = 0;
+#endif
+#if XLWIP_CONFIG_EMACPS_PTP
+	XEmacPs_TsuTime now, ts;
+	u32_t now_read = 0;
+	/* BDs come back whole frames at a time */
+	u32_t first_bd = 1;
 #endif
 
 	index = get_base_index_txpbufsstorage (xemacpsif);
@@ -250,18 +305,32 @@ void xemacps_process_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring)
 	tx_task_notifier_index = get_base_index_tasknotifyinfo (xemacpsif);
 #endif
 
-	while (1) {
+	while (n_reaped < budget) {
 		/* obtain processed BD's */
 		n_bds = XEmacPs_BdRingFromHwTx(txring,
-								XLWIP_CONFIG_N_TX_DESC, &txbdset);
+								budget - n_reaped, &txbdset);
 		if (n_bds == 0)  {
-			return;
+			break;
 		}
 		/* free the processed BD's */
 		n_pbufs_freed = n_bds;
 		curbdpntr = txbdset;
 		while (n_pbufs_freed > 0) {
 			bdindex = XEMACPS_BD_TO_INDEX(txring, curbdpntr);
+#if XLWIP_CONFIG_EMACPS_PTP
+			/* The timestamp is in the first BD of the frame */
+			if ((first_bd != 0) && (xemacpsif->tx_ts_cb != NULL) &&
+			    XEmacPs_BdIsTxTs(curbdpntr)) {
+				if (now_read == 0) {
+					XEmacPs_GetTsuTime(&xemacpsif->emacps, &now);
+					now_read = 1;
+				}
+				XEmacPs_BdGetTimestamp(curbdpntr, &now, &ts);
+				xemacpsif->tx_ts_cb((struct pbuf *)tx_pbufs_storage[index + bdindex],
+						ts.Seconds, ts.NanoSeconds, xemacpsif->tx_ts_arg);
+			}
+			first_bd = XEmacPs_BdIsLast(curbdpntr);
+#endif
 			temp = (u32 *)curbdpntr;
 			*temp = 0;
 			temp++;
@@ -276,7 +345,10 @@ void xemacps_process_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring)
 				pbuf_free(p);
 			}
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
-			notifyinfo[tx_task_notifier_index + bdindex] = 0;
+			if (notifyinfo[tx_task_notifier_index + bdindex] != 0) {
+				notifyinfo[tx_task_notifier_index + bdindex] = 0;
+				n_blocked_done++;
+			}
 #endif
 			tx_pbufs_storage[index + bdindex] = 0;
 			curbdpntr = XEmacPs_BdRingNext(txring, curbdpntr);
@@ -288,8 +360,26 @@ void xemacps_process_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring)
 		if (status != XST_SUCCESS) {
 			LWIP_DEBUGF(NETIF_DEBUG, ("Failure while freeing in Tx Done ISR\r\n"));
 		}
+		n_reaped += n_bds;
 	}
-	return;
+
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+	if (n_blocked_done != 0) {
+#if !NO_SYS
+		sys_sem_signal(&xemacpsif->tx_complete_sem);
+#else
+		if (xemacpsif->tx_complete_cb != NULL) {
+			xemacpsif->tx_complete_cb(xemacpsif->tx_complete_arg);
+		}
+#endif
+	}
+#endif
+	return n_reaped;
+}
+
+void xemacps_process_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring)
+{
+	(void)xemacps_reap_sent_bds(xemacpsif, txring, XLWIP_CONFIG_N_TX_DESC);
 }
 
 void emacps_send_handler(void *arg)
@@ -309,10 +399,276 @@ void emacps_send_handler(void *arg)
 
 	/* If Transmit done interrupt is asserted, process completed BD's */
 	xemacps_process_sent_bds(xemacpsif, txringptr);
+#if XLWIP_CONFIG_COALESCE
+	if (xemac_coalesce_sample(&xemacpsif->coal[XEMAC_COALESCE_TX],
+				  XEmacPs_BdRingGetFreeCnt(txringptr))) {
+		emacps_coalesce_apply(xemacpsif, XEMACPS_SEND,
+				      &xemacpsif->coal[XEMAC_COALESCE_TX]);
+	}
+#endif
 #if !NO_SYS
 	xInsideISR--;
 #endif
 }
+#if LWIP_NETIF_LSO
+/*
+ * Parses the headers of a large send offload frame. They are all in the first
+ * pbuf. Returns the number of bytes that go in the header BD, which are the
+ * Ethernet, IP and TCP headers for TSO and the Ethernet and IP headers for
+ * UFO, or 0 if the frame can not be cut by the MAC.
+ */
+static u32_t emacps_lso_hdrlen(struct pbuf *p, u32_t *lso_type)
+{
+	struct eth_hdr *ethhdr = (struct eth_hdr *)p->payload;
+	struct ip_hdr *iphdr;
+	struct tcp_hdr *tcphdr;
+	u32_t hdrlen = SIZEOF_ETH_HDR;
+	u16_t type = ethhdr->type;
+
+	if (type == PP_HTONS(ETHTYPE_VLAN)) {
+		if (p->len < (SIZEOF_ETH_HDR + SIZEOF_VLAN_HDR)) {
+			return 0;
+		}
+		type = ((struct eth_vlan_hdr *)((u8_t *)ethhdr + SIZEOF_ETH_HDR))->tpid;
+		hdrlen += SIZEOF_VLAN_HDR;
+	}
+	if ((type != PP_HTONS(ETHTYPE_IP)) || (p->len < (hdrlen + IP_HLEN))) {
+		return 0;
+	}
+
+	iphdr = (struct ip_hdr *)((u8_t *)ethhdr + hdrlen);
+	hdrlen += IPH_HL_BYTES(iphdr);
+	if (IPH_PROTO(iphdr) == IP_PROTO_UDP) {
+		*lso_type = XEMACPS_TXBUF_LSO_UFO;
+	} else if ((IPH_PROTO(iphdr) == IP_PROTO_TCP) &&
+		   (p->len >= (hdrlen + TCP_HLEN))) {
+		tcphdr = (struct tcp_hdr *)((u8_t *)ethhdr + hdrlen);
+		hdrlen += TCPH_HDRLEN_BYTES(tcphdr);
+		*lso_type = XEMACPS_TXBUF_LSO_TSO;
+	} else {
+		return 0;
+	}
+
+	/* The payload must not start in the header BD */
+	if (p->len < hdrlen) {
+		return 0;
+	}
+	return hdrlen;
+}
+
+/*
+ * Returns the number of BDs needed to send a large send offload frame: one
+ * for the headers and as many as needed for the payload, or 0 if the payload
+ * BDs of a UFO frame, but the last, can not be made multiples of 8 bytes.
+ */
+static u32_t emacps_lso_count_bds(struct pbuf *p, u32_t hdrlen, u32_t lso_type)
+{
+	struct pbuf *q;
+	u32_t offset = hdrlen;
+	u32_t len;
+	u32_t n_bds = 1;
+
+	for (q = p; q != NULL; q = q->next) {
+		len = q->len - offset;
+		offset = 0;
+		if (len == 0) {
+			continue;
+		}
+		if ((lso_type == XEMACPS_TXBUF_LSO_UFO) && (q->next != NULL) &&
+		    ((len & 0x7U) != 0U)) {
+			return 0;
+		}
+		n_bds += (len + LSO_MAX_BD_LEN - 1) / LSO_MAX_BD_LEN;
+	}
+	return n_bds;
+}
+
+/*
+ * Gives back the BDs of a large send offload frame that could not be set up:
+ * the BDs from txbdset up to end are reset as the TX done path resets them
+ * and drop their pbuf references, then the whole set is unallocated.
+ */
+static void emacps_lso_unalloc(XEmacPs_BdRing *txring, XEmacPs_Bd *txbdset,
+				XEmacPs_Bd *end, u32_t n_bds, u32_t index)
+{
+	XEmacPs_Bd *txbd;
+	u32_t bdindex;
+	u32 *temp;
+
+	for (txbd = txbdset; txbd != end; txbd = XEmacPs_BdRingNext(txring, txbd)) {
+		bdindex = XEMACPS_BD_TO_INDEX(txring, txbd);
+		temp = (u32 *)txbd;
+		*temp = 0;
+		temp++;
+		if (bdindex == (XLWIP_CONFIG_N_TX_DESC - 1)) {
+			*temp = 0xC0000000;
+		} else {
+			*temp = 0x80000000;
+		}
+		if (tx_pbufs_storage[index + bdindex] != 0) {
+			pbuf_free((struct pbuf *)tx_pbufs_storage[index + bdindex]);
+			tx_pbufs_storage[index + bdindex] = 0;
+		}
+	}
+	dsb();
+	XEmacPs_BdRingUnAlloc(txring, n_bds, txbdset);
+}
+
+/*
+ * Sends a frame marked with PBUF_FLAG_LSO. The first BD holds the headers
+ * and the LSO type; the payload BDs hold the MSS (TSO) or the max frame size
+ * (UFO). The MAC replicates the headers and fixes up lengths, IP ids,
+ * sequence numbers or fragment offsets, and checksums of every frame it cuts.
+ */
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+static XStatus emacps_lso_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p,
+					u32_t block_till_tx_complete, u32_t *to_block_index)
+#else
+static XStatus emacps_lso_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
+#endif
+{
+	struct pbuf *q;
+	XEmacPs_Bd *txbdset, *txbd, *last_txbd = NULL;
+	XEmacPs_BdRing *txring;
+	XStatus status;
+	u32_t n_bds, i;
+	u32_t bdindex = 0;
+	u32_t index;
+	u32_t hdrlen;
+	u32_t lso_type = 0;
+	u32_t mss;
+	u32_t offset, len, chunk;
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+	u32_t tx_task_notifier_index;
+#endif
+
+	hdrlen = emacps_lso_hdrlen(p, &lso_type);
+	if (hdrlen == 0) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: LSO frame not supported\r\n"));
+		return XST_FAILURE;
+	}
+
+	n_bds = emacps_lso_count_bds(p, hdrlen, lso_type);
+	if (n_bds == 0) {
+		/* Send a contiguous copy, only its last payload BD is short */
+		q = pbuf_clone(PBUF_RAW, PBUF_RAM, p);
+		if (q == NULL) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error allocating LSO copy\r\n"));
+			return XST_FAILURE;
+		}
+		q->flags = p->flags;
+		q->lso_mss = p->lso_mss;
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+		status = emacps_lso_sgsend(xemacpsif, q, block_till_tx_complete,
+					   to_block_index);
+#else
+		status = emacps_lso_sgsend(xemacpsif, q);
+#endif
+		pbuf_free(q);
+		return status;
+	}
+
+	if (lso_type == XEMACPS_TXBUF_LSO_UFO) {
+		mss = p->lso_mss + hdrlen + LSO_FCS_LEN;
+	} else {
+		mss = p->lso_mss;
+	}
+	mss = (mss << XEMACPS_TXBUF_MSS_SHIFT) & XEMACPS_TXBUF_MSS_MASK;
+
+	txring = &(XEmacPs_GetTxRing(&xemacpsif->emacps));
+	index = get_base_index_txpbufsstorage (xemacpsif);
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+	tx_task_notifier_index = get_base_index_tasknotifyinfo (xemacpsif);
+#endif
+
+	status = XEmacPs_BdRingAlloc(txring, n_bds, &txbdset);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error allocating TxBD\r\n"));
+		return XST_FAILURE;
+	}
+
+	txbd = txbdset;
+	offset = 0;
+	for (q = p; q != NULL; q = q->next) {
+		if ((q != p) && (q->len == 0)) {
+			continue;
+		}
+		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
+			Xil_DCacheFlushRange((UINTPTR)q->payload, (UINTPTR)q->len);
+		}
+
+		/* The pbuf is released when its first BD is sent */
+		bdindex = XEMACPS_BD_TO_INDEX(txring, txbd);
+		if (tx_pbufs_storage[index + bdindex] != 0) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("PBUFS not available\r\n"));
+			emacps_lso_unalloc(txring, txbdset, txbd, n_bds, index);
+			return XST_FAILURE;
+		}
+		tx_pbufs_storage[index + bdindex] = (UINTPTR)q;
+		pbuf_ref(q);
+
+		len = q->len;
+		if (q == p) {
+			XEmacPs_BdSetAddressTx(txbd, (UINTPTR)q->payload);
+			XEmacPs_BdSetLength(txbd, hdrlen);
+			XEmacPs_BdWrite(txbd, XEMACPS_BD_STAT_OFFSET,
+				XEmacPs_BdRead(txbd, XEMACPS_BD_STAT_OFFSET) | lso_type);
+			XEmacPs_BdClearLast(txbd);
+			last_txbd = txbd;
+			txbd = XEmacPs_BdRingNext(txring, txbd);
+			offset = hdrlen;
+			len -= hdrlen;
+		}
+
+		while (len > 0) {
+			chunk = (len > LSO_MAX_BD_LEN) ? LSO_MAX_BD_LEN : len;
+			XEmacPs_BdSetAddressTx(txbd, (UINTPTR)q->payload + offset);
+			XEmacPs_BdSetLength(txbd, chunk);
+			XEmacPs_BdWrite(txbd, XEMACPS_BD_STAT_OFFSET,
+				XEmacPs_BdRead(txbd, XEMACPS_BD_STAT_OFFSET) | mss);
+			XEmacPs_BdClearLast(txbd);
+			last_txbd = txbd;
+			txbd = XEmacPs_BdRingNext(txring, txbd);
+			offset += chunk;
+			len -= chunk;
+		}
+		offset = 0;
+	}
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+	if (block_till_tx_complete == 1) {
+		bdindex = XEMACPS_BD_TO_INDEX(txring, last_txbd);
+		notifyinfo[tx_task_notifier_index + bdindex] = 1;
+		*to_block_index = tx_task_notifier_index + bdindex;
+	}
+#endif
+	XEmacPs_BdSetLast(last_txbd);
+
+	/* Hand the header BD to the MAC last */
+	txbd = XEmacPs_BdRingNext(txring, txbdset);
+	for (i = 1; i < n_bds; i++) {
+		XEmacPs_BdClearTxUsed(txbd);
+		txbd = XEmacPs_BdRingNext(txring, txbd);
+	}
+	XEmacPs_BdClearTxUsed(txbdset);
+	dsb();
+
+	status = XEmacPs_BdRingToHw(txring, n_bds, txbdset);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error submitting TxBD\r\n"));
+		return XST_FAILURE;
+	}
+#if XLWIP_CONFIG_COALESCE
+	xemacpsif->coal[XEMAC_COALESCE_TX].frames++;
+#endif
+	/* Start transmit */
+	XEmacPs_WriteReg((xemacpsif->emacps).Config.BaseAddress,
+	XEMACPS_NWCTRL_OFFSET,
+	(XEmacPs_ReadReg((xemacpsif->emacps).Config.BaseAddress,
+	XEMACPS_NWCTRL_OFFSET) | XEMACPS_NWCTRL_STARTTX_MASK));
+	return status;
+}
+#endif
+
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
 XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p,
 					u32_t block_till_tx_complete, u32_t *to_block_index)
@@ -333,6 +689,17 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 	u32_t tx_task_notifier_index;
 #endif
 
+#if LWIP_NETIF_LSO
+	if ((p->flags & PBUF_FLAG_LSO) != 0) {
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+		return emacps_lso_sgsend(xemacpsif, p, block_till_tx_complete,
+					 to_block_index);
+#else
+		return emacps_lso_sgsend(xemacpsif, p);
+#endif
+	}
+#endif
+
 	txring = &(XEmacPs_GetTxRing(&xemacpsif->emacps));
 
 	index = get_base_index_txpbufsstorage (xemacpsif);
@@ -411,6 +778,9 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error submitting TxBD\r\n"));
 		return XST_FAILURE;
 	}
+#if XLWIP_CONFIG_COALESCE
+	xemacpsif->coal[XEMAC_COALESCE_TX].frames++;
+#endif
 	/* Start transmit */
 	XEmacPs_WriteReg((xemacpsif->emacps).Config.BaseAddress,
 	XEMACPS_NWCTRL_OFFSET,
@@ -512,6 +882,10 @@ void emacps_recv_handler(void *arg)
 	u32_t regval;
 	u32_t index;
 	u32_t gigeversion;
+#if XLWIP_CONFIG_EMACPS_PTP
+	XEmacPs_TsuTime now, ts;
+	u32_t now_read = 0;
+#endif
 
 	xemac = (struct xemac_s *)(arg);
 	xemacpsif = (xemacpsif_s *)(xemac->state);
@@ -555,6 +929,18 @@ void emacps_recv_handler(void *arg)
 #endif
 			pbuf_realloc(p, rx_bytes);
 
+#if XLWIP_CONFIG_EMACPS_PTP
+			if ((xemacpsif->hw_ts != 0) && XEmacPs_BdIsRxTs(curbdptr)) {
+				if (now_read == 0) {
+					XEmacPs_GetTsuTime(&xemacpsif->emacps, &now);
+					now_read = 1;
+				}
+				XEmacPs_BdGetTimestamp(curbdptr, &now, &ts);
+				p->ts_sec = ts.Seconds;
+				p->ts_nsec = ts.NanoSeconds;
+			}
+#endif
+
 			/* Invalidate RX frame before queuing to handle
 			 * L1 cache prefetch conditions on any architecture.
 			 */
@@ -577,7 +963,19 @@ void emacps_recv_handler(void *arg)
 		/* free up the BD's */
 		XEmacPs_BdRingFree(rxring, bd_processed, rxbdset);
 		setup_rx_bds(xemacpsif, rxring);
+#if XLWIP_CONFIG_COALESCE
+		xemacpsif->coal[XEMAC_COALESCE_RX].frames += bd_processed;
+#endif
 	}
+#if XLWIP_CONFIG_COALESCE
+	/* The BDs left to the hardware are those not free */
+	if (xemac_coalesce_sample(&xemacpsif->coal[XEMAC_COALESCE_RX],
+				  XEmacPs_BdRingGetCnt(rxring) -
+				  XEmacPs_BdRingGetFreeCnt(rxring))) {
+		emacps_coalesce_apply(xemacpsif, XEMACPS_RECV,
+				      &xemacpsif->coal[XEMAC_COALESCE_RX]);
+	}
+#endif
 #if !NO_SYS
 	sys_sem_signal(&xemac->sem_rx_data_available);
 	xInsideISR--;
@@ -586,6 +984,20 @@ void emacps_recv_handler(void *arg)
 	return;
 }
 
+static XStatus emacps_bd_ring_create(xemacpsif_s *xemacpsif,
+		XEmacPs_BdRing *ring, void *bdspace, u32_t n_bds)
+{
+#if XLWIP_CONFIG_EMACPS_PTP
+	/* Extended BDs carry the timestamps when the GEM supports them */
+	if (xemacpsif->hw_ts != 0) {
+		return XEmacPs_BdRingCreateExt(ring, (UINTPTR)bdspace,
+				(UINTPTR)bdspace, BD_ALIGNMENT, n_bds);
+	}
+#endif
+	return XEmacPs_BdRingCreate(ring, (UINTPTR)bdspace, (UINTPTR)bdspace,
+			BD_ALIGNMENT, n_bds);
+}
+
 void clean_dma_txdescs(struct xemac_s *xemac)
 {
 	XEmacPs_Bd bdtemplate;
@@ -600,9 +1012,8 @@ void clean_dma_txdescs(struct xemac_s *xemac)
 	/*
 	 * Create the TxBD ring
 	 */
-	XEmacPs_BdRingCreate(txringptr, (UINTPTR) xemacpsif->tx_bdspace,
-			(UINTPTR) xemacpsif->tx_bdspace, BD_ALIGNMENT,
-				 XLWIP_CONFIG_N_TX_DESC);
+	emacps_bd_ring_create(xemacpsif, txringptr, xemacpsif->tx_bdspace,
+			XLWIP_CONFIG_N_TX_DESC);
 	XEmacPs_BdRingClone(txringptr, &bdtemplate, XEMACPS_SEND);
 }
 
@@ -679,6 +1090,11 @@ XStatus init_dma(struct xemac_s *xemac)
 		return ERR_IF;
 	}
 
+#if XLWIP_CONFIG_EMACPS_PTP
+	/* Select extended BDs before the rings are laid out */
+	xemacpsif_ptp_init(xemacpsif);
+#endif
+
 	/*
 	 * Setup RxBD space.
 	 *
@@ -691,9 +1107,8 @@ XStatus init_dma(struct xemac_s *xemac)
 	 * Create the RxBD ring
 	 */
 
-	status = XEmacPs_BdRingCreate(rxringptr, (UINTPTR) xemacpsif->rx_bdspace,
-				(UINTPTR) xemacpsif->rx_bdspace, BD_ALIGNMENT,
-				     XLWIP_CONFIG_N_RX_DESC);
+	status = emacps_bd_ring_create(xemacpsif, rxringptr,
+				xemacpsif->rx_bdspace, XLWIP_CONFIG_N_RX_DESC);
 
 	if (status != XST_SUCCESS) {
 		LWIP_DEBUGF(NETIF_DEBUG, ("Error setting up RxBD space\r\n"));
@@ -711,9 +1126,8 @@ XStatus init_dma(struct xemac_s *xemac)
 	/*
 	 * Create the TxBD ring
 	 */
-	status = XEmacPs_BdRingCreate(txringptr, (UINTPTR) xemacpsif->tx_bdspace,
-				(UINTPTR) xemacpsif->tx_bdspace, BD_ALIGNMENT,
-				     XLWIP_CONFIG_N_TX_DESC);
+	status = emacps_bd_ring_create(xemacpsif, txringptr,
+				xemacpsif->tx_bdspace, XLWIP_CONFIG_N_TX_DESC);
 
 	if (status != XST_SUCCESS) {
 		return ERR_IF;
@@ -806,6 +1220,21 @@ XStatus init_dma(struct xemac_s *xemac)
 		XEmacPs_Out32((xemacpsif->emacps.Config.BaseAddress + XEMACPS_TXQBASE_OFFSET),
 				   (UINTPTR)bdtxterminate);
 	}
+#if XLWIP_CONFIG_COALESCE
+	/* Start without moderation; the GEM of Zynq has none, so its
+	 * controllers get no delay to work with and keep it that way.
+	 */
+	for (i = XEMAC_COALESCE_RX; i <= XEMAC_COALESCE_TX; i++) {
+		xemac_coalesce_init(&xemacpsif->coal[i], 1, 0,
+				    (i == XEMAC_COALESCE_RX) ?
+				    XLWIP_CONFIG_N_RX_DESC : XLWIP_CONFIG_N_TX_DESC,
+				    (gigeversion > 2) ? EMACPS_COALESCE_MAX_DELAY : 0);
+	}
+	if (gigeversion > 2) {
+		(void)XEmacPs_SetIntrModeration(&xemacpsif->emacps, XEMACPS_RECV, 0);
+		(void)XEmacPs_SetIntrModeration(&xemacpsif->emacps, XEMACPS_SEND, 0);
+	}
+#endif
 #if !NO_SYS
 #ifdef SDT
 	xPortInstallInterruptHandler(xemacpsif->emacps.Config.IntrId,
@@ -58,6 +58,39 @@ XEmacPs_Config *xemacps_lookup_config(unsigned mac_base)
 	return (cfgptr);
 }
 
+/*
+ * Applies the checksum offload selected in lwipopts.h and advertises the
+ * large send offload of GEM revisions that have it. Large send offload needs
+ * the TX checksum offload.
+ */
+static void init_emacps_offload(XEmacPs *xemacpsp, struct netif *netif)
+{
+#if LWIP_NETIF_LSO && defined(LWIP_FULL_CSUM_OFFLOAD_TX)
+	u32_t gigeversion;
+#endif
+
+#ifndef LWIP_FULL_CSUM_OFFLOAD_TX
+	XEmacPs_ClearOptions(xemacpsp, XEMACPS_TX_CHKSUM_ENABLE_OPTION);
+#endif
+#ifndef LWIP_FULL_CSUM_OFFLOAD_RX
+	XEmacPs_ClearOptions(xemacpsp, XEMACPS_RX_CHKSUM_ENABLE_OPTION);
+#endif
+
+#if LWIP_NETIF_LSO
+	netif->lso_flags = 0;
+#ifdef LWIP_FULL_CSUM_OFFLOAD_TX
+	gigeversion = ((Xil_In32(xemacpsp->Config.BaseAddress + 0xFC)) >> 16) & 0xFFF;
+	if ((gigeversion > 2) &&
+	    ((XEmacPs_ReadReg(xemacpsp->Config.BaseAddress, XEMACPS_DCFG6_OFFSET) &
+	      XEMACPS_DCFG6_LSO_MASK) != 0)) {
+		netif->lso_flags = NETIF_LSO_TCP | NETIF_LSO_UDP;
+	}
+#endif
+#else
+	LWIP_UNUSED_ARG(netif);
+#endif
+}
+
 void init_emacps(xemacpsif_s *xemacps, struct netif *netif)
 {
 	XEmacPs *xemacpsp;
@@ -83,6 +116,8 @@ void init_emacps(xemacpsif_s *xemacps, struct netif *netif)
 	XEmacPs_SetOptions(xemacpsp, XEMACPS_JUMBO_ENABLE_OPTION);
 #endif
 
+	init_emacps_offload(xemacpsp, netif);
+
 #ifdef LWIP_IGMP
 	XEmacPs_SetOptions(xemacpsp, XEMACPS_MULTICAST_OPTION);
 #endif
@@ -164,6 +199,8 @@ void init_emacps_on_error (xemacpsif_s *xemacps, struct netif *netif)
 
 	xemacpsp = &xemacps->emacps;
 
+	init_emacps_offload(xemacpsp, netif);
+
 	/* set mac address */
 	status = XEmacPs_SetMacAddress(xemacpsp, (void*)(netif->hwaddr), 1);
 	if (status != XST_SUCCESS) {
@@ -0,0 +1,234 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * IEEE 1588 hardware timestamps of the GEM adapter.
+ *
+ * When the GEM supports extended BDs (ZynqMP and later) the adapter lays the
+ * BD rings out with room for a timestamp per BD and has the MAC timestamp
+ * every frame. The receive handler stores the timestamp of each frame in its
+ * pbuf, read with xemacpsif_pbuf_get_timestamp(). The TX reap hands the
+ * timestamp of each sent frame to the callback set with
+ * xemacpsif_set_tx_timestamp_callback(), together with its first pbuf, which
+ * holds the Ethernet header. No PTP event registers are polled and no frame
+ * has to be flagged beforehand, so the same path serves PTP and latency
+ * measurement.
+ *
+ * The timestamp unit (TSU) is read, set, stepped and slewed with the
+ * xemacpsif_ptp_*time() and xemacpsif_ptp_adjfreq() functions. A PTP stack
+ * feeds its offsets from the master to xemacpsif_ptp_servo_sample(), a
+ * simple PI servo that slews the TSU, or steps it when the offset is large.
+ */
+
+#include "lwipopts.h"
+#include "xlwipconfig.h"
+
+#if XLWIP_CONFIG_EMACPS_PTP
+
+#include "lwip/pbuf.h"
+#include "lwip/sys.h"
+#include "netif/xadapter.h"
+#include "netif/xemacpsif.h"
+
+#define NSEC_PER_SEC	1000000000
+
+/* Sub-nanosecond part of the TSU increment */
+#define TSU_SUBNS_MASK	((1U << XEMACPS_1588_SUBNS_WIDTH) - 1U)
+
+static xemacpsif_s *netif_to_xemacpsif(struct netif *netif)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+
+	return (xemacpsif_s *)(xemac->state);
+}
+
+/* Programs the TSU increment for the TSU clock and the current slew */
+static void xemacpsif_tsu_set_incr(xemacpsif_s *xemacpsif)
+{
+	s64_t incr;
+
+	incr = (s64_t)(((u64_t)NSEC_PER_SEC << XEMACPS_1588_SUBNS_WIDTH) /
+		       XLWIP_CONFIG_EMACPS_TSU_CLK_FREQ);
+	incr += (incr * xemacpsif->tsu_ppb) / NSEC_PER_SEC;
+	XEmacPs_SetTsuIncrement(&xemacpsif->emacps,
+			(u32)(incr >> XEMACPS_1588_SUBNS_WIDTH),
+			(u32)incr & TSU_SUBNS_MASK);
+}
+
+/*
+ * Called by init_dma() before the BD rings are created. Extended BDs are
+ * used when the GEM has them; the TSU runs in any case.
+ */
+void xemacpsif_ptp_init(xemacpsif_s *xemacpsif)
+{
+	LONG status;
+
+	status = XEmacPs_SetTimestampMode(&xemacpsif->emacps,
+			XEMACPS_BDCTRL_TS_ALL, XEMACPS_BDCTRL_TS_ALL);
+	if (status == XST_SUCCESS) {
+		xemacpsif->hw_ts = 1;
+	} else {
+		LWIP_DEBUGF(NETIF_DEBUG, ("xemacpsif_ptp_init: no hardware timestamps in BDs\r\n"));
+		xemacpsif->hw_ts = 0;
+	}
+	xemacpsif_tsu_set_incr(xemacpsif);
+}
+
+/*
+ * Returns the hardware timestamp of a received frame, ERR_VAL if the pbuf
+ * has none. The stack keeps the first pbuf of a frame as the head of what it
+ * delivers, so the timestamp is also found on the pbufs handed to raw API
+ * receive callbacks and by xlwip_zc_recv().
+ */
+err_t xemacpsif_pbuf_get_timestamp(const struct pbuf *p, u64_t *sec,
+		u32_t *nsec)
+{
+	if (p->ts_nsec == XLWIP_PBUF_TS_NONE) {
+		return ERR_VAL;
+	}
+	*sec = p->ts_sec;
+	*nsec = p->ts_nsec;
+	return ERR_OK;
+}
+
+/*
+ * Registers a function called with the hardware timestamp of every sent
+ * frame. It is called from the TX done interrupt or from the transmit path
+ * when it reaps sent BDs, so it must not block. The pbuf is the first one of
+ * the frame and is freed after the callback returns unless the callback
+ * takes a reference. Returns ERR_IF when the GEM does not timestamp frames.
+ */
+err_t xemacpsif_set_tx_timestamp_callback(struct netif *netif,
+		xemacpsif_tx_timestamp_fn cb, void *arg)
+{
+	xemacpsif_s *xemacpsif = netif_to_xemacpsif(netif);
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	if (xemacpsif->hw_ts == 0) {
+		return ERR_IF;
+	}
+	SYS_ARCH_PROTECT(lev);
+	xemacpsif->tx_ts_cb = cb;
+	xemacpsif->tx_ts_arg = arg;
+	SYS_ARCH_UNPROTECT(lev);
+	return ERR_OK;
+}
+
+void xemacpsif_ptp_gettime(struct netif *netif, u64_t *sec, u32_t *nsec)
+{
+	xemacpsif_s *xemacpsif = netif_to_xemacpsif(netif);
+	XEmacPs_TsuTime now;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	XEmacPs_GetTsuTime(&xemacpsif->emacps, &now);
+	SYS_ARCH_UNPROTECT(lev);
+	*sec = now.Seconds;
+	*nsec = now.NanoSeconds;
+}
+
+void xemacpsif_ptp_settime(struct netif *netif, u64_t sec, u32_t nsec)
+{
+	xemacpsif_s *xemacpsif = netif_to_xemacpsif(netif);
+	XEmacPs_TsuTime time;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	time.Seconds = sec;
+	time.NanoSeconds = nsec;
+	SYS_ARCH_PROTECT(lev);
+	XEmacPs_SetTsuTime(&xemacpsif->emacps, &time);
+	SYS_ARCH_UNPROTECT(lev);
+}
+
+/* Steps the TSU by delta ns */
+void xemacpsif_ptp_adjtime(struct netif *netif, s64_t delta)
+{
+	xemacpsif_s *xemacpsif = netif_to_xemacpsif(netif);
+	XEmacPs_TsuTime time;
+	s64_t nsec;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	if ((delta > -NSEC_PER_SEC) && (delta < NSEC_PER_SEC)) {
+		/* The TSU applies it without losing the time it takes us */
+		XEmacPs_AdjustTsuTime(&xemacpsif->emacps, (s32)delta);
+		return;
+	}
+
+	SYS_ARCH_PROTECT(lev);
+	XEmacPs_GetTsuTime(&xemacpsif->emacps, &time);
+	nsec = (s64_t)time.NanoSeconds + (delta % NSEC_PER_SEC);
+	time.Seconds += (u64_t)(delta / NSEC_PER_SEC);
+	if (nsec < 0) {
+		nsec += NSEC_PER_SEC;
+		time.Seconds--;
+	} else if (nsec >= NSEC_PER_SEC) {
+		nsec -= NSEC_PER_SEC;
+		time.Seconds++;
+	}
+	time.NanoSeconds = (u32)nsec;
+	XEmacPs_SetTsuTime(&xemacpsif->emacps, &time);
+	SYS_ARCH_UNPROTECT(lev);
+}
+
+/* Slews the TSU by ppb parts per billion from its nominal frequency */
+void xemacpsif_ptp_adjfreq(struct netif *netif, s32_t ppb)
+{
+	xemacpsif_s *xemacpsif = netif_to_xemacpsif(netif);
+
+	xemacpsif->tsu_ppb = ppb;
+	xemacpsif_tsu_set_incr(xemacpsif);
+}
+
+/*
+ * Initializes a servo. For a sync interval of one second kp = 700 and
+ * ki = 300 track a master well; larger intervals need smaller gains.
+ */
+void xemacpsif_ptp_servo_init(struct xemacpsif_ptp_servo *servo, s32_t kp,
+		s32_t ki, s64_t step_threshold, s32_t max_ppb)
+{
+	servo->kp = kp;
+	servo->ki = ki;
+	servo->step_threshold = step_threshold;
+	servo->max_ppb = max_ppb;
+	servo->drift = 0;
+}
+
+static s64_t servo_clamp(s64_t val, s32_t max)
+{
+	if (val > max) {
+		return max;
+	}
+	if (val < -max) {
+		return -max;
+	}
+	return val;
+}
+
+/*
+ * Feeds the offset of the TSU from the master, in ns (positive when the TSU
+ * is ahead), to the servo. Offsets above the step threshold step the TSU and
+ * keep the frequency; smaller ones slew it. Returns the frequency adjustment
+ * in effect, in ppb.
+ */
+s32_t xemacpsif_ptp_servo_sample(struct netif *netif,
+		struct xemacpsif_ptp_servo *servo, s64_t offset)
+{
+	s64_t ppb;
+
+	if ((offset > servo->step_threshold) ||
+	    (offset < -servo->step_threshold)) {
+		xemacpsif_ptp_adjtime(netif, -offset);
+		return netif_to_xemacpsif(netif)->tsu_ppb;
+	}
+
+	servo->drift = servo_clamp(servo->drift -
+			(servo->ki * offset) / 1000, servo->max_ppb);
+	ppb = servo_clamp(servo->drift - (servo->kp * offset) / 1000,
+			servo->max_ppb);
+	xemacpsif_ptp_adjfreq(netif, (s32_t)ppb);
+	return (s32_t)ppb;
+}
+
+#endif /* XLWIP_CONFIG_EMACPS_PTP */
@@ -59,6 +59,216 @@ functions are being called from an interrupt context or not.  This relies on
 the interrupt handler setting this variable manually. */
 u32 xInsideISR;
 
+#if XLWIP_CONFIG_MPSC_MBOX
+/* One entry of an MPSC ring; ulSeq tells whether it is free or filled */
+struct xlwip_mbox_slot
+{
+	u32_t ulSeq;
+	void *pvMsg;
+};
+
+struct xlwip_mbox
+{
+	xQueueHandle xQueue;		/* NULL for an MPSC ring */
+	struct xlwip_mbox_slot *pxSlots;
+	u32_t ulMask;
+	u32_t ulHead;			/* Next slot claimed by a producer */
+	u32_t ulTail;			/* Next slot read by the consumer */
+	xTaskHandle xWaiter;		/* Consumer blocked on the ring */
+	u32_t ulFullWaiters;		/* Producers waiting for a free slot */
+	xSemaphoreHandle xSpace;	/* Given by the consumer for them */
+};
+
+#define prvMBOX_QUEUE( pxMailBox )	( ( *( pxMailBox ) )->xQueue )
+#define prvMBOX_IS_MPSC( pxMailBox )	( ( *( pxMailBox ) )->xQueue == NULL )
+
+/*---------------------------------------------------------------------------*
+ * MPSC ring helpers
+ *---------------------------------------------------------------------------*
+ * Producers (any task or ISR) claim a slot by advancing ulHead, write the
+ * message and publish it through the sequence number of the slot, all in one
+ * short critical section, so producers serialize on it just as they do on a
+ * FreeRTOS queue. The single consumer reads the slots in order with acquire
+ * loads and release stores and never takes the critical section. A consumer
+ * with nothing to read registers itself in xWaiter and sleeps on its task
+ * notification; the producer that publishes next takes xWaiter and notifies
+ * it. Blocking producers that
+ * find the ring full count themselves in ulFullWaiters and wait on xSpace,
+ * which the consumer gives after reading.
+ *---------------------------------------------------------------------------*/
+static err_t prvMpscPush( struct xlwip_mbox *pxBox, void *pvMsg )
+{
+struct xlwip_mbox_slot *pxSlot;
+u32_t ulPos;
+err_t xReturn = ERR_OK;
+unsigned portBASE_TYPE uxSavedInterruptStatus = 0U;
+
+	/* Claim and publish in one short critical section: a producer that is
+	preempted between the two would hold back the consumer, i.e. tcpip_thread,
+	for as long as it does not run again */
+	if( xInsideISR != pdFALSE )
+	{
+		uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+	}
+	else
+	{
+		taskENTER_CRITICAL();
+	}
+
+	ulPos = pxBox->ulHead;
+	pxSlot = &pxBox->pxSlots[ ulPos & pxBox->ulMask ];
+	if( __atomic_load_n( &pxSlot->ulSeq, __ATOMIC_ACQUIRE ) != ulPos )
+	{
+		/* Full, the consumer has not read this slot yet */
+		xReturn = ERR_MEM;
+	}
+	else
+	{
+		pxSlot->pvMsg = pvMsg;
+		pxBox->ulHead = ulPos + 1U;
+		__atomic_store_n( &pxSlot->ulSeq, ulPos + 1U, __ATOMIC_RELEASE );
+	}
+
+	if( xInsideISR != pdFALSE )
+	{
+		taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+	}
+	else
+	{
+		taskEXIT_CRITICAL();
+	}
+
+	return xReturn;
+}
+
+static int prvMpscPop( struct xlwip_mbox *pxBox, void **ppvMsg )
+{
+struct xlwip_mbox_slot *pxSlot;
+u32_t ulTail = pxBox->ulTail;
+
+	pxSlot = &pxBox->pxSlots[ ulTail & pxBox->ulMask ];
+	if( __atomic_load_n( &pxSlot->ulSeq, __ATOMIC_ACQUIRE ) != ( ulTail + 1U ) )
+	{
+		return 0;
+	}
+	*ppvMsg = pxSlot->pvMsg;
+	__atomic_store_n( &pxSlot->ulSeq, ulTail + pxBox->ulMask + 1U, __ATOMIC_RELEASE );
+	pxBox->ulTail = ulTail + 1U;
+
+	return 1;
+}
+
+static int prvMpscEmpty( struct xlwip_mbox *pxBox )
+{
+struct xlwip_mbox_slot *pxSlot = &pxBox->pxSlots[ pxBox->ulTail & pxBox->ulMask ];
+
+	return ( __atomic_load_n( &pxSlot->ulSeq, __ATOMIC_ACQUIRE ) != ( pxBox->ulTail + 1U ) );
+}
+
+/* Called by the consumer after reading slots */
+static void prvMpscFreed( struct xlwip_mbox *pxBox )
+{
+	__atomic_thread_fence( __ATOMIC_SEQ_CST );
+	if( __atomic_load_n( &pxBox->ulFullWaiters, __ATOMIC_RELAXED ) != 0U )
+	{
+		xSemaphoreGive( pxBox->xSpace );
+	}
+}
+
+/* Called by a producer that may block when the ring is full */
+static void prvMpscPushWait( struct xlwip_mbox *pxBox, void *pvMsg )
+{
+	while( prvMpscPush( pxBox, pvMsg ) != ERR_OK )
+	{
+		__atomic_add_fetch( &pxBox->ulFullWaiters, 1U, __ATOMIC_SEQ_CST );
+		if( prvMpscPush( pxBox, pvMsg ) == ERR_OK )
+		{
+			__atomic_sub_fetch( &pxBox->ulFullWaiters, 1U, __ATOMIC_SEQ_CST );
+			return;
+		}
+		/* Bounded, xSpace wakes one of several waiting producers */
+		( void ) xSemaphoreTake( pxBox->xSpace, 1 );
+		__atomic_sub_fetch( &pxBox->ulFullWaiters, 1U, __ATOMIC_SEQ_CST );
+	}
+}
+
+static void prvMpscWake( struct xlwip_mbox *pxBox )
+{
+xTaskHandle xWaiter;
+portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
+
+	/* Pairs with the fence of prvMpscFetch() */
+	__atomic_thread_fence( __ATOMIC_SEQ_CST );
+	xWaiter = __atomic_exchange_n( &pxBox->xWaiter, NULL, __ATOMIC_SEQ_CST );
+	if( xWaiter == NULL )
+	{
+		return;
+	}
+
+	if( xInsideISR != pdFALSE )
+	{
+		vTaskNotifyGiveFromISR( xWaiter, &xHigherPriorityTaskWoken );
+		if( xHigherPriorityTaskWoken == pdTRUE )
+		{
+			portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+		}
+	}
+	else
+	{
+		xTaskNotifyGive( xWaiter );
+	}
+}
+
+/* Reads up to ulMax messages; returns 0 if none came within ulTimeOut ms */
+static u32_t prvMpscFetch( struct xlwip_mbox *pxBox, void **ppvBuffer, u32_t ulMax, u32_t ulTimeOut )
+{
+portTickType xStartTime, xElapsed, xTicks, xWait;
+u32_t ulCount;
+
+	xStartTime = xTaskGetTickCount();
+	xTicks = ulTimeOut / portTICK_RATE_MS;
+
+	for( ;; )
+	{
+		ulCount = 0U;
+		while( ( ulCount < ulMax ) && prvMpscPop( pxBox, &ppvBuffer[ ulCount ] ) )
+		{
+			ulCount++;
+		}
+		if( ulCount != 0U )
+		{
+			prvMpscFreed( pxBox );
+			return ulCount;
+		}
+
+		if( ulTimeOut != 0UL )
+		{
+			xElapsed = xTaskGetTickCount() - xStartTime;
+			if( xElapsed >= xTicks )
+			{
+				return 0U;
+			}
+			xWait = xTicks - xElapsed;
+		}
+		else
+		{
+			xWait = portMAX_DELAY;
+		}
+
+		__atomic_store_n( &pxBox->xWaiter, xTaskGetCurrentTaskHandle(), __ATOMIC_SEQ_CST );
+		__atomic_thread_fence( __ATOMIC_SEQ_CST );
+		if( prvMpscEmpty( pxBox ) )
+		{
+			/* A stale notification only costs one more pass */
+			( void ) ulTaskNotifyTake( pdTRUE, xWait );
+		}
+		__atomic_store_n( &pxBox->xWaiter, NULL, __ATOMIC_SEQ_CST );
+	}
+}
+#else
+#define prvMBOX_QUEUE( pxMailBox )	( *( pxMailBox ) )
+#endif /* XLWIP_CONFIG_MPSC_MBOX */
+
 /*---------------------------------------------------------------------------*
  * Routine:  sys_mbox_new
  *---------------------------------------------------------------------------*
@@ -73,7 +283,22 @@ err_t sys_mbox_new( sys_mbox_t *pxMailBox, int iSize )
 {
 err_t xReturn = ERR_MEM;
 
+#if XLWIP_CONFIG_MPSC_MBOX
+	*pxMailBox = pvPortMalloc( sizeof( struct xlwip_mbox ) );
+	if( *pxMailBox == NULL )
+	{
+		return xReturn;
+	}
+	( *pxMailBox )->pxSlots = NULL;
+	( *pxMailBox )->xQueue = xQueueCreate( iSize, sizeof( void * ) );
+	if( ( *pxMailBox )->xQueue == NULL )
+	{
+		vPortFree( *pxMailBox );
+		*pxMailBox = NULL;
+	}
+#else
 	*pxMailBox = xQueueCreate( iSize, sizeof( void * ) );
+#endif
 
 	if( *pxMailBox != NULL )
 	{
@@ -83,6 +308,67 @@ err_t xReturn = ERR_MEM;
 	return xReturn;
 }
 
+#if XLWIP_CONFIG_MPSC_MBOX
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_mbox_new_mpsc
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Creates a new mailbox on an MPSC ring. Any task or ISR may post to
+ *      it in a short critical section, but only one task may fetch from it,
+ *      without taking the critical section.
+ * Inputs:
+ *      int size                -- Size of elements in the mailbox, rounded
+ *                                  up to a power of two
+ * Outputs:
+ *      sys_mbox_t              -- Handle to new mailbox
+ *---------------------------------------------------------------------------*/
+err_t sys_mbox_new_mpsc( sys_mbox_t *pxMailBox, int iSize )
+{
+struct xlwip_mbox *pxBox;
+u32_t ulSize = 2U, ulIndex;
+
+	while( ulSize < ( u32_t ) iSize )
+	{
+		ulSize <<= 1;
+	}
+
+	pxBox = pvPortMalloc( sizeof( struct xlwip_mbox ) );
+	if( pxBox == NULL )
+	{
+		return ERR_MEM;
+	}
+	pxBox->pxSlots = pvPortMalloc( ulSize * sizeof( struct xlwip_mbox_slot ) );
+	if( pxBox->pxSlots == NULL )
+	{
+		vPortFree( pxBox );
+		return ERR_MEM;
+	}
+	pxBox->xSpace = xSemaphoreCreateBinary();
+	if( pxBox->xSpace == NULL )
+	{
+		vPortFree( pxBox->pxSlots );
+		vPortFree( pxBox );
+		return ERR_MEM;
+	}
+	for( ulIndex = 0U; ulIndex < ulSize; ulIndex++ )
+	{
+		pxBox->pxSlots[ ulIndex ].ulSeq = ulIndex;
+		pxBox->pxSlots[ ulIndex ].pvMsg = NULL;
+	}
+	pxBox->xQueue = NULL;
+	pxBox->ulMask = ulSize - 1U;
+	pxBox->ulHead = 0U;
+	pxBox->ulTail = 0U;
+	pxBox->xWaiter = NULL;
+	pxBox->ulFullWaiters = 0U;
+
+	*pxMailBox = pxBox;
+	SYS_STATS_INC_USED( mbox );
+
+	return ERR_OK;
+}
+#endif
+
 
 /*---------------------------------------------------------------------------*
  * Routine:  sys_mbox_free
@@ -100,7 +386,14 @@ void sys_mbox_free( sys_mbox_t *pxMailBox )
 {
 unsigned long ulMessagesWaiting;
 
-	ulMessagesWaiting = uxQueueMessagesWaiting( *pxMailBox );
+#if XLWIP_CONFIG_MPSC_MBOX
+	if( prvMBOX_IS_MPSC( pxMailBox ) )
+	{
+		ulMessagesWaiting = prvMpscEmpty( *pxMailBox ) ? 0UL : 1UL;
+	}
+	else
+#endif
+	ulMessagesWaiting = uxQueueMessagesWaiting( prvMBOX_QUEUE( pxMailBox ) );
 	configASSERT( ( ulMessagesWaiting == 0 ) );
 
 	#if SYS_STATS
@@ -114,7 +407,20 @@ unsigned long ulMessagesWaiting;
 	}
 	#endif /* SYS_STATS */
 
-	vQueueDelete( *pxMailBox );
+#if XLWIP_CONFIG_MPSC_MBOX
+	if( prvMBOX_IS_MPSC( pxMailBox ) )
+	{
+		vPortFree( ( *pxMailBox )->pxSlots );
+		vSemaphoreDelete( ( *pxMailBox )->xSpace );
+	}
+	else
+	{
+		vQueueDelete( prvMBOX_QUEUE( pxMailBox ) );
+	}
+	vPortFree( *pxMailBox );
+#else
+	vQueueDelete( prvMBOX_QUEUE( pxMailBox ) );
+#endif
 }
 
 /*---------------------------------------------------------------------------*
@@ -129,14 +435,29 @@ unsigned long ulMessagesWaiting;
 void sys_mbox_post( sys_mbox_t *pxMailBox, void *pxMessageToPost )
 {
 	portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
+#if XLWIP_CONFIG_MPSC_MBOX
+	if( prvMBOX_IS_MPSC( pxMailBox ) ) {
+		if( xInsideISR != pdFALSE ) {
+			/* Cannot wait for room in an ISR, as with the queue */
+			if( prvMpscPush( *pxMailBox, pxMessageToPost ) != ERR_OK ) {
+				SYS_STATS_INC( mbox.err );
+				return;
+			}
+		}
+		else
+			prvMpscPushWait( *pxMailBox, pxMessageToPost );
+		prvMpscWake( *pxMailBox );
+		return;
+	}
+#endif
 	if( xInsideISR != pdFALSE ) {
-		xQueueSendToBackFromISR( *pxMailBox, &pxMessageToPost, &xHigherPriorityTaskWoken );
+		xQueueSendToBackFromISR( prvMBOX_QUEUE( pxMailBox ), &pxMessageToPost, &xHigherPriorityTaskWoken );
 		if (xHigherPriorityTaskWoken == pdTRUE) {
 			portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 		}
 	}
 	else
-		xQueueSendToBack( *pxMailBox, &pxMessageToPost, portMAX_DELAY );
+		xQueueSendToBack( prvMBOX_QUEUE( pxMailBox ), &pxMessageToPost, portMAX_DELAY );
 }
 
 /*---------------------------------------------------------------------------*
@@ -157,16 +478,33 @@ err_t sys_mbox_trypost( sys_mbox_t *pxMailBox, void *pxMessageToPost )
 err_t xReturn;
 portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
 
+#if XLWIP_CONFIG_MPSC_MBOX
+	if( prvMBOX_IS_MPSC( pxMailBox ) )
+	{
+		xReturn = prvMpscPush( *pxMailBox, pxMessageToPost );
+		if( xReturn == ERR_OK )
+		{
+			prvMpscWake( *pxMailBox );
+		}
+		else
+		{
+			LWIP_DEBUGF(NETIF_DEBUG, ("Queue is full\r\n"));
+			SYS_STATS_INC( mbox.err );
+		}
+		return xReturn;
+	}
+#endif
+
 	if( xInsideISR != pdFALSE )
 	{
-		xReturn = xQueueSendFromISR( *pxMailBox, &pxMessageToPost, &xHigherPriorityTaskWoken );
+		xReturn = xQueueSendFromISR( prvMBOX_QUEUE( pxMailBox ), &pxMessageToPost, &xHigherPriorityTaskWoken );
 		if (xHigherPriorityTaskWoken == pdTRUE) {
 			portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 		}
 	}
 	else
 	{
-		xReturn = xQueueSend( *pxMailBox, &pxMessageToPost, ( portTickType ) 0 );
+		xReturn = xQueueSend( prvMBOX_QUEUE( pxMailBox ), &pxMessageToPost, ( portTickType ) 0 );
 	}
 
 	if( xReturn == pdPASS )
@@ -223,10 +561,27 @@ portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
 		ppvBuffer = &pvDummy;
 	}
 
+#if XLWIP_CONFIG_MPSC_MBOX
+	if( prvMBOX_IS_MPSC( pxMailBox ) )
+	{
+		if( prvMpscFetch( *pxMailBox, ppvBuffer, 1U, ulTimeOut ) == 0U )
+		{
+			*ppvBuffer = NULL;
+			return SYS_ARCH_TIMEOUT;
+		}
+		xElapsed = ( xTaskGetTickCount() - xStartTime ) * portTICK_RATE_MS;
+		if( ( ulTimeOut == 0UL ) && ( xElapsed == 0UL ) )
+		{
+			xElapsed = 1UL;
+		}
+		return xElapsed;
+	}
+#endif
+
 	if( ulTimeOut != 0UL )
 	{
 		if( xInsideISR != pdFALSE ) {
-			if( pdTRUE == xQueueReceiveFromISR( *pxMailBox, &( *ppvBuffer ), &xHigherPriorityTaskWoken ) )
+			if( pdTRUE == xQueueReceiveFromISR( prvMBOX_QUEUE( pxMailBox ), &( *ppvBuffer ), &xHigherPriorityTaskWoken ) )
 			{
 				xEndTime = xTaskGetTickCount();
 				xElapsed = ( xEndTime - xStartTime ) * portTICK_RATE_MS;
@@ -241,7 +596,7 @@ portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
 				ulReturn = SYS_ARCH_TIMEOUT;
 			}
 		} else {
-		if( pdTRUE == xQueueReceive( *pxMailBox, &( *ppvBuffer ), ulTimeOut/ portTICK_RATE_MS ) )
+		if( pdTRUE == xQueueReceive( prvMBOX_QUEUE( pxMailBox ), &( *ppvBuffer ), ulTimeOut/ portTICK_RATE_MS ) )
 		{
 			xEndTime = xTaskGetTickCount();
 			xElapsed = ( xEndTime - xStartTime ) * portTICK_RATE_MS;
@@ -259,13 +614,13 @@ portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
 	else
 	{
 		if( xInsideISR != pdFALSE ) {
-			xQueueReceiveFromISR( *pxMailBox, &( *ppvBuffer ), &xHigherPriorityTaskWoken );
+			xQueueReceiveFromISR( prvMBOX_QUEUE( pxMailBox ), &( *ppvBuffer ), &xHigherPriorityTaskWoken );
 			if (xHigherPriorityTaskWoken == pdTRUE) {
 				portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 			}
 		}
 		else
-			xQueueReceive( *pxMailBox, &( *ppvBuffer ), portMAX_DELAY );
+			xQueueReceive( prvMBOX_QUEUE( pxMailBox ), &( *ppvBuffer ), portMAX_DELAY );
 		xEndTime = xTaskGetTickCount();
 		xElapsed = ( xEndTime - xStartTime ) * portTICK_RATE_MS;
 
@@ -306,16 +661,28 @@ portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
 		ppvBuffer = &pvDummy;
 	}
 
+#if XLWIP_CONFIG_MPSC_MBOX
+	if( prvMBOX_IS_MPSC( pxMailBox ) )
+	{
+		if( prvMpscPop( *pxMailBox, ppvBuffer ) == 0 )
+		{
+			return SYS_MBOX_EMPTY;
+		}
+		prvMpscFreed( *pxMailBox );
+		return ERR_OK;
+	}
+#endif
+
 	if( xInsideISR != pdFALSE )
 	{
-		lResult = xQueueReceiveFromISR( *pxMailBox, &( *ppvBuffer ), &xHigherPriorityTaskWoken );
+		lResult = xQueueReceiveFromISR( prvMBOX_QUEUE( pxMailBox ), &( *ppvBuffer ), &xHigherPriorityTaskWoken );
 		if (xHigherPriorityTaskWoken == pdTRUE) {
 			portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 		}
 	}
 	else
 	{
-		lResult = xQueueReceive( *pxMailBox, &( *ppvBuffer ), 0UL );
+		lResult = xQueueReceive( prvMBOX_QUEUE( pxMailBox ), &( *ppvBuffer ), 0UL );
 	}
 
 	if( lResult == pdPASS )
@@ -330,6 +697,47 @@ portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
 	return ulReturn;
 }
 
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_arch_mbox_fetch_burst
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Like sys_arch_mbox_fetch, but once a message is there, also takes
+ *      the messages already queued behind it, up to "max" in total. Used
+ *      by tcpip_thread to handle a burst of messages per wake up.
+ * Inputs:
+ *      sys_mbox_t mbox         -- Handle of mailbox
+ *      void **msg              -- Array of at least "max" messages
+ *      u32_t max               -- Maximum number of messages to fetch
+ *      u32_t timeout           -- Number of milliseconds until timeout
+ * Outputs:
+ *      u32_t                   -- Number of messages fetched, 0 if timeout.
+ *---------------------------------------------------------------------------*/
+u32_t sys_arch_mbox_fetch_burst( sys_mbox_t *pxMailBox, void **ppvBuffer, u32_t ulMax, u32_t ulTimeOut )
+{
+u32_t ulCount;
+
+#if XLWIP_CONFIG_MPSC_MBOX
+	if( prvMBOX_IS_MPSC( pxMailBox ) )
+	{
+		return prvMpscFetch( *pxMailBox, ppvBuffer, ulMax, ulTimeOut );
+	}
+#endif
+
+	if( sys_arch_mbox_fetch( pxMailBox, &ppvBuffer[ 0 ], ulTimeOut ) == SYS_ARCH_TIMEOUT )
+	{
+		return 0U;
+	}
+	for( ulCount = 1U; ulCount < ulMax; ulCount++ )
+	{
+		if( sys_arch_mbox_tryfetch( pxMailBox, &ppvBuffer[ ulCount ] ) == SYS_MBOX_EMPTY )
+		{
+			break;
+		}
+	}
+
+	return ulCount;
+}
+
 /*---------------------------------------------------------------------------*
  * Routine:  sys_sem_new
  *---------------------------------------------------------------------------*
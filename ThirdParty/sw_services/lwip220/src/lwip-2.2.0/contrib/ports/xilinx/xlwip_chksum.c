@@ -0,0 +1,466 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Architecture optimized Internet checksum routines of the Xilinx port,
+ * used as LWIP_CHKSUM and LWIP_CHKSUM_COPY when LWIP_ARCH_CHKSUM is set.
+ *
+ * The head and tail bytes are handled like LWIP_CHKSUM_ALGORITHM 3; the
+ * aligned middle of the buffer is summed in blocks by a kernel per
+ * architecture:
+ *  - AArch64: NEON pairwise add-accumulate, 64 bytes per iteration.
+ *  - ARMv7 (Cortex-R5, Cortex-A9): 32-bit adds chained through the carry
+ *    flag (ADCS), 32 bytes per iteration.
+ *  - MicroBlaze: 32-bit adds chained through the carry bit (ADDC), 32 bytes
+ *    per iteration.
+ *  - Others: 32-bit words accumulated in 64 bits.
+ * The copy variants load every word once, store it to the destination and
+ * add it to the sum.
+ */
+
+#include "lwip/opt.h"
+
+#if LWIP_ARCH_CHKSUM
+
+#include "lwip/def.h"
+#include "lwip/inet_chksum.h"
+
+#include <string.h>
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define XLWIP_CHKSUM_BLOCK	64U
+/* Source and destination must have the same 16-bit alignment */
+#define XLWIP_CHKSUM_COPY_ALIGN	0x1U
+/* Iterations before the 32-bit lanes are widened, 2 x 2 x 0xFFFF each */
+#define XLWIP_CHKSUM_NEON_BATCH	8192U
+#elif defined(__arm__) || defined(__MICROBLAZE__)
+#define XLWIP_CHKSUM_BLOCK	32U
+#define XLWIP_CHKSUM_COPY_ALIGN	0x3U
+#else
+#define XLWIP_CHKSUM_BLOCK	32U
+#define XLWIP_CHKSUM_COPY_ALIGN	0x3U
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+
+static u64_t xlwip_chksum_neon_fold(uint32x4_t acc0, uint32x4_t acc1,
+				    uint64x2_t acc)
+{
+	acc = vpadalq_u32(acc, acc0);
+	acc = vpadalq_u32(acc, acc1);
+	return vgetq_lane_u64(acc, 0) + vgetq_lane_u64(acc, 1);
+}
+
+static u64_t xlwip_chksum_blocks(const u8_t *src, u32_t n, u32_t sum)
+{
+	uint64x2_t acc = vsetq_lane_u64(sum, vdupq_n_u64(0), 0);
+	uint32x4_t acc0, acc1;
+	u32_t batch;
+
+	while (n > 0) {
+		batch = (n > XLWIP_CHKSUM_NEON_BATCH) ? XLWIP_CHKSUM_NEON_BATCH : n;
+		n -= batch;
+		acc0 = vdupq_n_u32(0);
+		acc1 = vdupq_n_u32(0);
+		do {
+			acc0 = vpadalq_u16(acc0, vld1q_u16((const uint16_t *)src));
+			acc1 = vpadalq_u16(acc1, vld1q_u16((const uint16_t *)(src + 16)));
+			acc0 = vpadalq_u16(acc0, vld1q_u16((const uint16_t *)(src + 32)));
+			acc1 = vpadalq_u16(acc1, vld1q_u16((const uint16_t *)(src + 48)));
+			src += XLWIP_CHKSUM_BLOCK;
+		} while (--batch > 0);
+		acc = vsetq_lane_u64(xlwip_chksum_neon_fold(acc0, acc1, acc),
+				     vdupq_n_u64(0), 0);
+	}
+	return vgetq_lane_u64(acc, 0);
+}
+
+static u64_t xlwip_chksum_copy_blocks(u8_t *dst, const u8_t *src, u32_t n,
+				      u32_t sum)
+{
+	uint64x2_t acc = vsetq_lane_u64(sum, vdupq_n_u64(0), 0);
+	uint32x4_t acc0, acc1;
+	uint16x8_t v0, v1, v2, v3;
+	u32_t batch;
+
+	while (n > 0) {
+		batch = (n > XLWIP_CHKSUM_NEON_BATCH) ? XLWIP_CHKSUM_NEON_BATCH : n;
+		n -= batch;
+		acc0 = vdupq_n_u32(0);
+		acc1 = vdupq_n_u32(0);
+		do {
+			v0 = vld1q_u16((const uint16_t *)src);
+			v1 = vld1q_u16((const uint16_t *)(src + 16));
+			v2 = vld1q_u16((const uint16_t *)(src + 32));
+			v3 = vld1q_u16((const uint16_t *)(src + 48));
+			vst1q_u16((uint16_t *)dst, v0);
+			vst1q_u16((uint16_t *)(dst + 16), v1);
+			vst1q_u16((uint16_t *)(dst + 32), v2);
+			vst1q_u16((uint16_t *)(dst + 48), v3);
+			acc0 = vpadalq_u16(acc0, v0);
+			acc1 = vpadalq_u16(acc1, v1);
+			acc0 = vpadalq_u16(acc0, v2);
+			acc1 = vpadalq_u16(acc1, v3);
+			src += XLWIP_CHKSUM_BLOCK;
+			dst += XLWIP_CHKSUM_BLOCK;
+		} while (--batch > 0);
+		acc = vsetq_lane_u64(xlwip_chksum_neon_fold(acc0, acc1, acc),
+				     vdupq_n_u64(0), 0);
+	}
+	return vgetq_lane_u64(acc, 0);
+}
+
+#elif defined(__arm__)
+
+/*
+ * The carry flag is kept across iterations: LDR, STR, SUB and ADD without S,
+ * and TEQ with an unshifted immediate do not change it. The last carry is
+ * added twice in case the first add wraps the sum to 0.
+ */
+static u64_t xlwip_chksum_blocks(const u8_t *src, u32_t n, u32_t sum)
+{
+	u32_t w0, w1, w2, w3;
+
+	__asm__ __volatile__(
+		"cmn	%[s], #0\n\t"	/* clear carry */
+		"1:\n\t"
+		"ldr	%[w0], [%[p]]\n\t"
+		"ldr	%[w1], [%[p], #4]\n\t"
+		"ldr	%[w2], [%[p], #8]\n\t"
+		"ldr	%[w3], [%[p], #12]\n\t"
+		"adcs	%[s], %[s], %[w0]\n\t"
+		"adcs	%[s], %[s], %[w1]\n\t"
+		"adcs	%[s], %[s], %[w2]\n\t"
+		"adcs	%[s], %[s], %[w3]\n\t"
+		"ldr	%[w0], [%[p], #16]\n\t"
+		"ldr	%[w1], [%[p], #20]\n\t"
+		"ldr	%[w2], [%[p], #24]\n\t"
+		"ldr	%[w3], [%[p], #28]\n\t"
+		"adcs	%[s], %[s], %[w0]\n\t"
+		"adcs	%[s], %[s], %[w1]\n\t"
+		"adcs	%[s], %[s], %[w2]\n\t"
+		"adcs	%[s], %[s], %[w3]\n\t"
+		"add	%[p], %[p], #32\n\t"
+		"sub	%[n], %[n], #1\n\t"
+		"teq	%[n], #0\n\t"
+		"bne	1b\n\t"
+		"adcs	%[s], %[s], #0\n\t"
+		"adc	%[s], %[s], #0\n\t"
+		: [s] "+r" (sum), [p] "+r" (src), [n] "+r" (n),
+		  [w0] "=&r" (w0), [w1] "=&r" (w1), [w2] "=&r" (w2),
+		  [w3] "=&r" (w3)
+		:
+		: "cc", "memory");
+
+	return sum;
+}
+
+static u64_t xlwip_chksum_copy_blocks(u8_t *dst, const u8_t *src, u32_t n,
+				      u32_t sum)
+{
+	u32_t w0, w1, w2, w3;
+
+	__asm__ __volatile__(
+		"cmn	%[s], #0\n\t"	/* clear carry */
+		"1:\n\t"
+		"ldr	%[w0], [%[p]]\n\t"
+		"ldr	%[w1], [%[p], #4]\n\t"
+		"ldr	%[w2], [%[p], #8]\n\t"
+		"ldr	%[w3], [%[p], #12]\n\t"
+		"str	%[w0], [%[d]]\n\t"
+		"str	%[w1], [%[d], #4]\n\t"
+		"str	%[w2], [%[d], #8]\n\t"
+		"str	%[w3], [%[d], #12]\n\t"
+		"adcs	%[s], %[s], %[w0]\n\t"
+		"adcs	%[s], %[s], %[w1]\n\t"
+		"adcs	%[s], %[s], %[w2]\n\t"
+		"adcs	%[s], %[s], %[w3]\n\t"
+		"ldr	%[w0], [%[p], #16]\n\t"
+		"ldr	%[w1], [%[p], #20]\n\t"
+		"ldr	%[w2], [%[p], #24]\n\t"
+		"ldr	%[w3], [%[p], #28]\n\t"
+		"str	%[w0], [%[d], #16]\n\t"
+		"str	%[w1], [%[d], #20]\n\t"
+		"str	%[w2], [%[d], #24]\n\t"
+		"str	%[w3], [%[d], #28]\n\t"
+		"adcs	%[s], %[s], %[w0]\n\t"
+		"adcs	%[s], %[s], %[w1]\n\t"
+		"adcs	%[s], %[s], %[w2]\n\t"
+		"adcs	%[s], %[s], %[w3]\n\t"
+		"add	%[p], %[p], #32\n\t"
+		"add	%[d], %[d], #32\n\t"
+		"sub	%[n], %[n], #1\n\t"
+		"teq	%[n], #0\n\t"
+		"bne	1b\n\t"
+		"adcs	%[s], %[s], #0\n\t"
+		"adc	%[s], %[s], #0\n\t"
+		: [s] "+r" (sum), [p] "+r" (src), [d] "+r" (dst), [n] "+r" (n),
+		  [w0] "=&r" (w0), [w1] "=&r" (w1), [w2] "=&r" (w2),
+		  [w3] "=&r" (w3)
+		:
+		: "cc", "memory");
+
+	return sum;
+}
+
+#elif defined(__MICROBLAZE__)
+
+/*
+ * The carry bit is kept across iterations: LWI, SWI, ADDIK and BNEID do not
+ * change it. The last carry is added twice in case the first add wraps the
+ * sum to 0.
+ */
+static u64_t xlwip_chksum_blocks(const u8_t *src, u32_t n, u32_t sum)
+{
+	u32_t w0, w1, w2, w3;
+
+	__asm__ __volatile__(
+		"add	%[s], %[s], r0\n\t"	/* clear carry */
+		"1:\n\t"
+		"lwi	%[w0], %[p], 0\n\t"
+		"lwi	%[w1], %[p], 4\n\t"
+		"lwi	%[w2], %[p], 8\n\t"
+		"lwi	%[w3], %[p], 12\n\t"
+		"addc	%[s], %[s], %[w0]\n\t"
+		"addc	%[s], %[s], %[w1]\n\t"
+		"addc	%[s], %[s], %[w2]\n\t"
+		"addc	%[s], %[s], %[w3]\n\t"
+		"lwi	%[w0], %[p], 16\n\t"
+		"lwi	%[w1], %[p], 20\n\t"
+		"lwi	%[w2], %[p], 24\n\t"
+		"lwi	%[w3], %[p], 28\n\t"
+		"addc	%[s], %[s], %[w0]\n\t"
+		"addc	%[s], %[s], %[w1]\n\t"
+		"addc	%[s], %[s], %[w2]\n\t"
+		"addc	%[s], %[s], %[w3]\n\t"
+		"addik	%[n], %[n], -1\n\t"
+		"bneid	%[n], 1b\n\t"
+		"addik	%[p], %[p], 32\n\t"	/* delay slot */
+		"addc	%[s], %[s], r0\n\t"
+		"addc	%[s], %[s], r0\n\t"
+		: [s] "+r" (sum), [p] "+r" (src), [n] "+r" (n),
+		  [w0] "=&r" (w0), [w1] "=&r" (w1), [w2] "=&r" (w2),
+		  [w3] "=&r" (w3)
+		:
+		: "memory");
+
+	return sum;
+}
+
+static u64_t xlwip_chksum_copy_blocks(u8_t *dst, const u8_t *src, u32_t n,
+				      u32_t sum)
+{
+	u32_t w0, w1, w2, w3;
+
+	__asm__ __volatile__(
+		"add	%[s], %[s], r0\n\t"	/* clear carry */
+		"1:\n\t"
+		"lwi	%[w0], %[p], 0\n\t"
+		"lwi	%[w1], %[p], 4\n\t"
+		"lwi	%[w2], %[p], 8\n\t"
+		"lwi	%[w3], %[p], 12\n\t"
+		"swi	%[w0], %[d], 0\n\t"
+		"swi	%[w1], %[d], 4\n\t"
+		"swi	%[w2], %[d], 8\n\t"
+		"swi	%[w3], %[d], 12\n\t"
+		"addc	%[s], %[s], %[w0]\n\t"
+		"addc	%[s], %[s], %[w1]\n\t"
+		"addc	%[s], %[s], %[w2]\n\t"
+		"addc	%[s], %[s], %[w3]\n\t"
+		"lwi	%[w0], %[p], 16\n\t"
+		"lwi	%[w1], %[p], 20\n\t"
+		"lwi	%[w2], %[p], 24\n\t"
+		"lwi	%[w3], %[p], 28\n\t"
+		"swi	%[w0], %[d], 16\n\t"
+		"swi	%[w1], %[d], 20\n\t"
+		"swi	%[w2], %[d], 24\n\t"
+		"swi	%[w3], %[d], 28\n\t"
+		"addc	%[s], %[s], %[w0]\n\t"
+		"addc	%[s], %[s], %[w1]\n\t"
+		"addc	%[s], %[s], %[w2]\n\t"
+		"addc	%[s], %[s], %[w3]\n\t"
+		"addik	%[p], %[p], 32\n\t"
+		"addik	%[n], %[n], -1\n\t"
+		"bneid	%[n], 1b\n\t"
+		"addik	%[d], %[d], 32\n\t"	/* delay slot */
+		"addc	%[s], %[s], r0\n\t"
+		"addc	%[s], %[s], r0\n\t"
+		: [s] "+r" (sum), [p] "+r" (src), [d] "+r" (dst), [n] "+r" (n),
+		  [w0] "=&r" (w0), [w1] "=&r" (w1), [w2] "=&r" (w2),
+		  [w3] "=&r" (w3)
+		:
+		: "memory");
+
+	return sum;
+}
+
+#else
+
+static u64_t xlwip_chksum_blocks(const u8_t *src, u32_t n, u32_t sum)
+{
+	const u32_t *pl = (const u32_t *)(const void *)src;
+	u64_t acc = sum;
+
+	while (n-- > 0) {
+		acc += pl[0];
+		acc += pl[1];
+		acc += pl[2];
+		acc += pl[3];
+		acc += pl[4];
+		acc += pl[5];
+		acc += pl[6];
+		acc += pl[7];
+		pl += XLWIP_CHKSUM_BLOCK / 4U;
+	}
+	return acc;
+}
+
+static u64_t xlwip_chksum_copy_blocks(u8_t *dst, const u8_t *src, u32_t n,
+				      u32_t sum)
+{
+	const u32_t *sl = (const u32_t *)(const void *)src;
+	u32_t *dl = (u32_t *)(void *)dst;
+	u64_t acc = sum;
+	u32_t i;
+
+	while (n-- > 0) {
+		for (i = 0; i < XLWIP_CHKSUM_BLOCK / 4U; i++) {
+			dl[i] = sl[i];
+			acc += sl[i];
+		}
+		sl += XLWIP_CHKSUM_BLOCK / 4U;
+		dl += XLWIP_CHKSUM_BLOCK / 4U;
+	}
+	return acc;
+}
+
+#endif
+
+/* Folds a block sum to 17 bits */
+static u32_t xlwip_chksum_fold(u64_t acc)
+{
+	acc = (acc & 0xffffffffULL) + (acc >> 32);
+	acc = (acc & 0xffffffffULL) + (acc >> 32);
+	return FOLD_U32T((u32_t)acc);
+}
+
+/**
+ * Internet checksum of a buffer, same result as lwip_standard_chksum.
+ *
+ * @param dataptr start of the buffer, may be an odd byte address
+ * @param len number of bytes in the buffer
+ * @return host order (!) lwip checksum (non-inverted Internet sum)
+ */
+u16_t xlwip_chksum(const void *dataptr, int len)
+{
+	const u8_t *pb = (const u8_t *)dataptr;
+	u16_t t = 0;
+	u32_t sum = 0;
+	u32_t n;
+	int odd = ((mem_ptr_t)pb & 1);
+
+	if (odd && len > 0) {
+		((u8_t *)&t)[1] = *pb++;
+		len--;
+	}
+	if (((mem_ptr_t)pb & 2) && len > 1) {
+		sum += *(const u16_t *)(const void *)pb;
+		pb += 2;
+		len -= 2;
+	}
+
+	if (len >= (int)XLWIP_CHKSUM_BLOCK) {
+		n = (u32_t)len / XLWIP_CHKSUM_BLOCK;
+		sum = xlwip_chksum_fold(xlwip_chksum_blocks(pb, n, sum));
+		pb += n * XLWIP_CHKSUM_BLOCK;
+		len -= (int)(n * XLWIP_CHKSUM_BLOCK);
+	}
+
+	while (len > 1) {
+		sum += *(const u16_t *)(const void *)pb;
+		pb += 2;
+		len -= 2;
+	}
+	if (len > 0) {
+		((u8_t *)&t)[0] = *pb;
+	}
+	sum += t;
+
+	sum = FOLD_U32T(sum);
+	sum = FOLD_U32T(sum);
+	if (odd) {
+		sum = SWAP_BYTES_IN_WORD(sum);
+	}
+	return (u16_t)sum;
+}
+
+/**
+ * Copies a buffer and returns its Internet checksum, like MEMCPY followed by
+ * LWIP_CHKSUM on the destination but reading the source once.
+ *
+ * @param dst destination buffer
+ * @param src source buffer
+ * @param len number of bytes to copy
+ * @return host order (!) lwip checksum (non-inverted Internet sum)
+ */
+u16_t xlwip_chksum_copy(void *dst, const void *src, u16_t len)
+{
+	u8_t *db = (u8_t *)dst;
+	const u8_t *sb = (const u8_t *)src;
+	u16_t t = 0;
+	u32_t sum = 0;
+	u32_t n;
+	int odd;
+
+	if ((((mem_ptr_t)db ^ (mem_ptr_t)sb) & XLWIP_CHKSUM_COPY_ALIGN) != 0) {
+		MEMCPY(dst, src, len);
+		return xlwip_chksum(dst, len);
+	}
+
+	odd = ((mem_ptr_t)sb & 1);
+	if (odd && len > 0) {
+		((u8_t *)&t)[1] = *sb;
+		*db++ = *sb++;
+		len--;
+	}
+	if (((mem_ptr_t)sb & 2) && len > 1) {
+		*(u16_t *)(void *)db = *(const u16_t *)(const void *)sb;
+		sum += *(const u16_t *)(const void *)sb;
+		db += 2;
+		sb += 2;
+		len -= 2;
+	}
+
+	if (len >= XLWIP_CHKSUM_BLOCK) {
+		n = (u32_t)len / XLWIP_CHKSUM_BLOCK;
+		sum = xlwip_chksum_fold(xlwip_chksum_copy_blocks(db, sb, n, sum));
+		db += n * XLWIP_CHKSUM_BLOCK;
+		sb += n * XLWIP_CHKSUM_BLOCK;
+		len -= (u16_t)(n * XLWIP_CHKSUM_BLOCK);
+	}
+
+	while (len > 1) {
+		*(u16_t *)(void *)db = *(const u16_t *)(const void *)sb;
+		sum += *(const u16_t *)(const void *)sb;
+		db += 2;
+		sb += 2;
+		len -= 2;
+	}
+	if (len > 0) {
+		((u8_t *)&t)[0] = *sb;
+		*db = *sb;
+	}
+	sum += t;
+
+	sum = FOLD_U32T(sum);
+	sum = FOLD_U32T(sum);
+	if (odd) {
+		sum = SWAP_BYTES_IN_WORD(sum);
+	}
+	return (u16_t)sum;
+}
+
+#endif /* LWIP_ARCH_CHKSUM */
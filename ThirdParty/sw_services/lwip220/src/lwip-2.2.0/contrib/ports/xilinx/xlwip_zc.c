@@ -0,0 +1,493 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Zero-copy socket send and receive of the Xilinx port, see
+ * netif/xlwip_zc.h for the API.
+ *
+ * A batch of send buffers is passed to the tcpip thread with one
+ * tcpip_api_call(). UDP and RAW buffers are handed to the stack like any
+ * other pbuf and are released by the MAC driver once sent. TCP buffers are
+ * queued with tcp_write() without copy; the descriptors are kept on a per
+ * pcb list (a TCP ext arg) with the sequence number that ends them and are
+ * released from the LWIP_HOOK_TCP_ACKED hook of tcp_input() when the peer
+ * has acknowledged them, or when the pcb is freed. The sent callback of the
+ * pcb is not used: the netconn layer owns it and clears it when the socket
+ * is closed, while the data queued before the close is still in flight.
+ */
+
+#include "lwip/opt.h"
+#include "xlwipconfig.h"
+
+#if XLWIP_CONFIG_ZERO_COPY_SOCKET
+
+#if !LWIP_SOCKET || !LWIP_SUPPORT_CUSTOM_PBUF
+#error "The zero-copy socket API needs LWIP_SOCKET and LWIP_SUPPORT_CUSTOM_PBUF"
+#endif
+#if LWIP_TCP && (LWIP_TCP_PCB_NUM_EXT_ARGS == 0)
+#error "The zero-copy socket API needs LWIP_TCP_PCB_NUM_EXT_ARGS"
+#endif
+#if LWIP_TCP && !defined(LWIP_HOOK_FILENAME)
+#error "The zero-copy socket API needs LWIP_HOOK_FILENAME \"arch/xlwip_hooks.h\""
+#endif
+
+#include "lwip/api.h"
+#include "lwip/inet.h"
+#include "lwip/mem.h"
+#include "lwip/raw.h"
+#include "lwip/tcp.h"
+#include "lwip/udp.h"
+#include "lwip/priv/sockets_priv.h"
+#include "lwip/priv/tcp_priv.h"
+#include "lwip/priv/tcpip_priv.h"
+#include "arch/xlwip_hooks.h"
+#include "netif/xlwip_zc.h"
+
+struct xlwip_zc_msg {
+	struct tcpip_api_call_data call;
+	struct netconn *conn;
+	struct pbuf **p;
+	int n;
+	int done;
+	const ip_addr_t *addr;
+	u16_t port;
+};
+
+#if LWIP_TCP
+/* Descriptors of a TCP pcb waiting for their ACK, oldest first */
+struct xlwip_zc_tcp {
+	struct xlwip_zc_pbuf *head;
+	struct xlwip_zc_pbuf *tail;
+};
+
+static void xlwip_zc_tcp_destroy(u8_t id, void *data);
+
+static const struct tcp_ext_arg_callbacks xlwip_zc_tcp_callbacks = {
+	xlwip_zc_tcp_destroy,
+	NULL
+};
+static u8_t xlwip_zc_tcp_id;
+static u8_t xlwip_zc_tcp_id_valid;
+#endif
+
+static void xlwip_zc_pbuf_free(struct pbuf *p)
+{
+	struct xlwip_zc_pbuf *zp = (struct xlwip_zc_pbuf *)p;
+
+	if (zp->free_fn != NULL) {
+		zp->free_fn(zp, zp->arg);
+	}
+}
+
+static int xlwip_zc_is_zc_pbuf(const struct pbuf *p)
+{
+	return (p->next == NULL) &&
+		((p->flags & PBUF_FLAG_IS_CUSTOM) != 0) &&
+		(((const struct pbuf_custom *)p)->custom_free_function ==
+		 xlwip_zc_pbuf_free);
+}
+
+/*
+ * Wrap len bytes at buf in the descriptor zp. free_fn is called with zp and
+ * arg once lwIP is done with the buffer; it may run in interrupt context.
+ * The buffer must stay valid and unmodified until then.
+ */
+struct pbuf *xlwip_zc_pbuf_init(struct xlwip_zc_pbuf *zp, void *buf,
+				u16_t len, xlwip_zc_free_fn free_fn, void *arg)
+{
+	LWIP_ASSERT("zp != NULL", zp != NULL);
+
+	zp->pc.custom_free_function = xlwip_zc_pbuf_free;
+	zp->free_fn = free_fn;
+	zp->arg = arg;
+	zp->next = NULL;
+	zp->end_seq = 0;
+
+	return pbuf_alloced_custom(PBUF_RAW, len, PBUF_REF, &zp->pc, buf, len);
+}
+
+#if LWIP_TCP
+static void xlwip_zc_tcp_release(struct xlwip_zc_tcp *st, u32_t acked)
+{
+	struct xlwip_zc_pbuf *zp;
+
+	while ((st->head != NULL) && TCP_SEQ_GEQ(acked, st->head->end_seq)) {
+		zp = st->head;
+		st->head = zp->next;
+		zp->next = NULL;
+		pbuf_free(&zp->pc.pbuf);
+	}
+	if (st->head == NULL) {
+		st->tail = NULL;
+	}
+}
+
+static void xlwip_zc_tcp_destroy(u8_t id, void *data)
+{
+	struct xlwip_zc_tcp *st = (struct xlwip_zc_tcp *)data;
+	struct xlwip_zc_pbuf *zp;
+
+	LWIP_UNUSED_ARG(id);
+
+	while (st->head != NULL) {
+		zp = st->head;
+		st->head = zp->next;
+		zp->next = NULL;
+		pbuf_free(&zp->pc.pbuf);
+	}
+	mem_free(st);
+}
+
+/* LWIP_HOOK_TCP_ACKED, called in the tcpip thread */
+void xlwip_zc_tcp_acked(struct tcp_pcb *pcb)
+{
+	struct xlwip_zc_tcp *st;
+
+	if (!xlwip_zc_tcp_id_valid) {
+		return;
+	}
+	st = (struct xlwip_zc_tcp *)tcp_ext_arg_get(pcb, xlwip_zc_tcp_id);
+	if (st != NULL) {
+		xlwip_zc_tcp_release(st, pcb->lastack);
+	}
+}
+
+static err_t xlwip_zc_tcp_write(struct xlwip_zc_msg *msg)
+{
+	struct netconn *conn = msg->conn;
+	struct tcp_pcb *pcb = conn->pcb.tcp;
+	struct xlwip_zc_tcp *st;
+	struct xlwip_zc_pbuf *zp;
+	struct pbuf *q;
+	u8_t apiflags;
+	err_t err = ERR_OK;
+	int i;
+
+	if (pcb == NULL) {
+		return ERR_CONN;
+	}
+	if (conn->state == NETCONN_WRITE) {
+		return ERR_INPROGRESS;
+	}
+
+	if (!xlwip_zc_tcp_id_valid) {
+		xlwip_zc_tcp_id = tcp_ext_arg_alloc_id();
+		xlwip_zc_tcp_id_valid = 1;
+	}
+	st = (struct xlwip_zc_tcp *)tcp_ext_arg_get(pcb, xlwip_zc_tcp_id);
+	if (st == NULL) {
+		st = (struct xlwip_zc_tcp *)mem_malloc(sizeof(*st));
+		if (st == NULL) {
+			return ERR_MEM;
+		}
+		st->head = NULL;
+		st->tail = NULL;
+		tcp_ext_arg_set(pcb, xlwip_zc_tcp_id, st);
+		tcp_ext_arg_set_callbacks(pcb, xlwip_zc_tcp_id,
+					  &xlwip_zc_tcp_callbacks);
+	}
+
+	for (i = 0; i < msg->n; i++) {
+		q = msg->p[i];
+		if ((q == NULL) || !xlwip_zc_is_zc_pbuf(q)) {
+			err = ERR_ARG;
+			break;
+		}
+		if (q->len > tcp_sndbuf(pcb)) {
+			err = ERR_MEM;
+			break;
+		}
+		apiflags = (i < (msg->n - 1)) ? TCP_WRITE_FLAG_MORE : 0;
+		err = tcp_write(pcb, q->payload, q->len, apiflags);
+		if (err != ERR_OK) {
+			break;
+		}
+
+		zp = (struct xlwip_zc_pbuf *)q;
+		zp->end_seq = pcb->snd_lbb;
+		zp->next = NULL;
+		if (st->tail != NULL) {
+			st->tail->next = zp;
+		} else {
+			st->head = zp;
+		}
+		st->tail = zp;
+		msg->done++;
+	}
+
+	if (msg->done > 0) {
+		(void)tcp_output(pcb);
+	}
+	if (err == ERR_MEM) {
+		/* Let select() report the socket writable once data is acked */
+		netconn_set_flags(conn, NETCONN_FLAG_CHECK_WRITESPACE);
+		err = ERR_WOULDBLOCK;
+	}
+
+	return (msg->done > 0) ? ERR_OK : err;
+}
+#endif /* LWIP_TCP */
+
+static err_t xlwip_zc_dgram_send(struct xlwip_zc_msg *msg)
+{
+	struct netconn *conn = msg->conn;
+	struct pbuf *q;
+	err_t err = ERR_OK;
+	int i;
+
+	for (i = 0; i < msg->n; i++) {
+		q = msg->p[i];
+		if (q == NULL) {
+			err = ERR_ARG;
+			break;
+		}
+		switch (NETCONNTYPE_GROUP(netconn_type(conn))) {
+#if LWIP_UDP
+		case NETCONN_UDP:
+			if (msg->addr != NULL) {
+				err = udp_sendto(conn->pcb.udp, q, msg->addr,
+						 msg->port);
+			} else {
+				err = udp_send(conn->pcb.udp, q);
+			}
+			break;
+#endif
+#if LWIP_RAW
+		case NETCONN_RAW:
+			if (msg->addr != NULL) {
+				err = raw_sendto(conn->pcb.raw, q, msg->addr);
+			} else {
+				err = raw_send(conn->pcb.raw, q);
+			}
+			break;
+#endif
+		default:
+			err = ERR_VAL;
+			break;
+		}
+		if (err != ERR_OK) {
+			break;
+		}
+		/* The stack or the MAC driver holds its own reference now */
+		pbuf_free(q);
+		msg->done++;
+	}
+
+	return (msg->done > 0) ? ERR_OK : err;
+}
+
+static err_t xlwip_zc_send_fn(struct tcpip_api_call_data *call)
+{
+	struct xlwip_zc_msg *msg = (struct xlwip_zc_msg *)call;
+
+	if (msg->conn->pcb.tcp == NULL) {
+		return ERR_CONN;
+	}
+#if LWIP_TCP
+	if (NETCONNTYPE_GROUP(netconn_type(msg->conn)) == NETCONN_TCP) {
+		return xlwip_zc_tcp_write(msg);
+	}
+#endif
+	return xlwip_zc_dgram_send(msg);
+}
+
+static int xlwip_zc_send_batch(int s, struct pbuf **p, int n,
+			       const ip_addr_t *addr, u16_t port)
+{
+	struct lwip_sock *sock;
+	struct xlwip_zc_msg msg;
+	err_t err;
+	int ret = -1;
+
+	if ((p == NULL) || (n <= 0)) {
+		set_errno(EINVAL);
+		return -1;
+	}
+	/* Keeps the socket from being freed by a concurrent close */
+	sock = lwip_socket_get(s);
+	if (sock == NULL) {
+		return -1;
+	}
+
+	msg.conn = sock->conn;
+	msg.p = p;
+	msg.n = n;
+	msg.done = 0;
+	msg.addr = addr;
+	msg.port = port;
+	err = tcpip_api_call(xlwip_zc_send_fn, &msg.call);
+	if (msg.done == 0) {
+		set_errno(err_to_errno(err));
+	} else {
+		ret = msg.done;
+	}
+
+	lwip_socket_done(sock);
+	return ret;
+}
+
+/*
+ * Send the n zero-copy pbufs of p in order on the connected socket s.
+ * UDP and RAW sockets accept any pbuf; TCP sockets accept only single pbufs
+ * set up with xlwip_zc_pbuf_init(). Returns the number of pbufs accepted,
+ * which then belong to lwIP, or -1 with errno set if none was accepted
+ * (EWOULDBLOCK when the TCP send buffer is full). This call never blocks.
+ */
+int xlwip_zc_send(int s, struct pbuf **p, int n, int flags)
+{
+	LWIP_UNUSED_ARG(flags);
+
+	return xlwip_zc_send_batch(s, p, n, NULL, 0);
+}
+
+/*
+ * Send the n pbufs of p in order to the address to on the UDP or RAW
+ * socket s. Returns like xlwip_zc_send().
+ */
+int xlwip_zc_sendto(int s, struct pbuf **p, int n,
+		    const struct sockaddr *to, socklen_t tolen)
+{
+	ip_addr_t addr;
+	u16_t port;
+
+	if (to == NULL) {
+		return xlwip_zc_send_batch(s, p, n, NULL, 0);
+	}
+#if LWIP_IPV4
+	if ((to->sa_family == AF_INET) &&
+	    (tolen >= (socklen_t)sizeof(struct sockaddr_in))) {
+		const struct sockaddr_in *sin = (const struct sockaddr_in *)to;
+
+		inet_addr_to_ip4addr(ip_2_ip4(&addr), &sin->sin_addr);
+		IP_SET_TYPE_VAL(addr, IPADDR_TYPE_V4);
+		port = lwip_ntohs(sin->sin_port);
+		return xlwip_zc_send_batch(s, p, n, &addr, port);
+	}
+#endif
+#if LWIP_IPV6
+	if ((to->sa_family == AF_INET6) &&
+	    (tolen >= (socklen_t)sizeof(struct sockaddr_in6))) {
+		const struct sockaddr_in6 *sin6 = (const struct sockaddr_in6 *)to;
+
+		inet6_addr_to_ip6addr(ip_2_ip6(&addr), &sin6->sin6_addr);
+		IP_SET_TYPE_VAL(addr, IPADDR_TYPE_V6);
+		ip6_addr_clear_zone(ip_2_ip6(&addr));
+		port = lwip_ntohs(sin6->sin6_port);
+		return xlwip_zc_send_batch(s, p, n, &addr, port);
+	}
+#endif
+
+	set_errno(EAFNOSUPPORT);
+	return -1;
+}
+
+/*
+ * Receive up to n pbufs from socket s into p, as received by the netif.
+ * Only the first pbuf is waited for (unless the socket is non-blocking or
+ * MSG_DONTWAIT is set); the others are taken only if already queued, and
+ * the TCP window is updated once for the whole batch. For UDP and RAW
+ * sockets every pbuf is one datagram. Returns the number of pbufs, 0 when
+ * the TCP peer closed the connection, or -1 with errno set. The pbufs
+ * belong to the application, which frees them with pbuf_free().
+ */
+int xlwip_zc_recv(int s, struct pbuf **p, int n, int flags)
+{
+	struct lwip_sock *sock;
+	struct netconn *conn;
+	struct netbuf *buf;
+	struct pbuf *q;
+	size_t recvd = 0;
+	u8_t apiflags = 0;
+	err_t err = ERR_OK;
+	int count = 0;
+	int ret = -1;
+
+	if ((p == NULL) || (n <= 0)) {
+		set_errno(EINVAL);
+		return -1;
+	}
+	if ((flags & MSG_PEEK) != 0) {
+		set_errno(EOPNOTSUPP);
+		return -1;
+	}
+	/* Keeps the socket from being freed by a concurrent close */
+	sock = lwip_socket_get(s);
+	if (sock == NULL) {
+		return -1;
+	}
+	conn = sock->conn;
+	if (((flags & MSG_DONTWAIT) != 0) || netconn_is_nonblocking(conn)) {
+		apiflags = NETCONN_DONTBLOCK;
+	}
+
+#if LWIP_TCP
+	if (NETCONNTYPE_GROUP(netconn_type(conn)) == NETCONN_TCP) {
+		/* Left over by a previous lwip_recv() */
+		if (sock->lastdata.pbuf != NULL) {
+			p[count++] = sock->lastdata.pbuf;
+			recvd += sock->lastdata.pbuf->tot_len;
+			sock->lastdata.pbuf = NULL;
+			apiflags = NETCONN_DONTBLOCK | NETCONN_NOFIN;
+		}
+		/*
+		 * Once data was taken, a FIN is left pending for the next call
+		 * so that it returns 0, as lwip_recv() does
+		 */
+		while (count < n) {
+			err = netconn_recv_tcp_pbuf_flags(conn, &q,
+					apiflags | NETCONN_NOAUTORCVD);
+			if (err != ERR_OK) {
+				break;
+			}
+			p[count++] = q;
+			recvd += q->tot_len;
+			apiflags = NETCONN_DONTBLOCK | NETCONN_NOFIN;
+		}
+		if (recvd > 0) {
+			(void)netconn_tcp_recvd(conn, recvd);
+		}
+		if (count > 0) {
+			ret = count;
+		} else if (err == ERR_CLSD) {
+			ret = 0;
+		} else {
+			set_errno(err_to_errno(err));
+		}
+		goto done;
+	}
+#endif
+
+	if (sock->lastdata.netbuf != NULL) {
+		buf = sock->lastdata.netbuf;
+		sock->lastdata.netbuf = NULL;
+		err = ERR_OK;
+	} else {
+		err = netconn_recv_udp_raw_netbuf_flags(conn, &buf, apiflags);
+	}
+	while (err == ERR_OK) {
+		p[count++] = buf->p;
+		buf->p = NULL;
+		buf->ptr = NULL;
+		netbuf_delete(buf);
+		if (count == n) {
+			break;
+		}
+		err = netconn_recv_udp_raw_netbuf_flags(conn, &buf,
+						       NETCONN_DONTBLOCK);
+	}
+	if (count > 0) {
+		ret = count;
+	} else {
+		set_errno(err_to_errno(err));
+	}
+
+#if LWIP_TCP
+done:
+#endif
+	lwip_socket_done(sock);
+	return ret;
+}
+
+#endif /* XLWIP_CONFIG_ZERO_COPY_SOCKET */
@@ -528,6 +528,32 @@ get_socket(int fd)
   return sock;
 }
 
+/**
+ * Like get_socket(), for socket API extensions of a port that need the socket
+ * for a whole call. The socket is kept from being freed until
+ * lwip_socket_done() is called.
+ *
+ * @param fd externally used socket index
+ * @return struct lwip_sock for the socket or NULL (errno set) if not found
+ */
+struct lwip_sock *
+lwip_socket_get(int fd)
+{
+  return get_socket(fd);
+}
+
+/**
+ * Releases a socket returned by lwip_socket_get().
+ *
+ * @param sock the socket
+ */
+void
+lwip_socket_done(struct lwip_sock *sock)
+{
+  LWIP_UNUSED_ARG(sock);
+  done_socket(sock);
+}
+
 /**
  * Allocate a new socket for a given netconn.
  *
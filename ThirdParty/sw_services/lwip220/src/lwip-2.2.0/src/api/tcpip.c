@@ -73,6 +73,7 @@ static void tcpip_thread_handle_msg(struct tcpip_msg *msg);
 #else /* !LWIP_TIMERS */
 /* wait for a message, timeouts are processed while waiting */
 #define TCPIP_MBOX_FETCH(mbox, msg) tcpip_timeouts_mbox_fetch(mbox, msg)
+#ifndef LWIP_SYS_ARCH_MBOX_FETCH_BURST
 /**
  * Wait (forever) for a message to arrive in an mbox.
  * While waiting, timeouts are processed.
@@ -111,6 +112,41 @@ again:
     goto again;
   }
 }
+#else /* !LWIP_SYS_ARCH_MBOX_FETCH_BURST */
+/**
+ * Same as tcpip_timeouts_mbox_fetch(), but takes up to max messages
+ * already queued in the mbox at once (sys_arch_mbox_fetch_burst()).
+ *
+ * @return the number of messages stored in msg
+ */
+static u32_t
+tcpip_timeouts_mbox_fetch_burst(sys_mbox_t *mbox, void **msg, u32_t max)
+{
+  u32_t sleeptime, n;
+
+again:
+  LWIP_ASSERT_CORE_LOCKED();
+
+  sleeptime = sys_timeouts_sleeptime();
+  if (sleeptime == 0) {
+    sys_check_timeouts();
+    goto again;
+  }
+  if (sleeptime == SYS_TIMEOUTS_SLEEPTIME_INFINITE) {
+    sleeptime = 0;
+  }
+
+  UNLOCK_TCPIP_CORE();
+  n = sys_arch_mbox_fetch_burst(mbox, msg, max, sleeptime);
+  LOCK_TCPIP_CORE();
+  if (n == 0) {
+    /* timeout occurred before a message could be fetched */
+    sys_check_timeouts();
+    goto again;
+  }
+  return n;
+}
+#endif /* !LWIP_SYS_ARCH_MBOX_FETCH_BURST */
 #endif /* !LWIP_TIMERS */
 
 /**
@@ -127,6 +163,10 @@ static void
 tcpip_thread(void *arg)
 {
   struct tcpip_msg *msg;
+#if defined(LWIP_SYS_ARCH_MBOX_FETCH_BURST) && LWIP_TIMERS
+  void *msgs[LWIP_SYS_ARCH_MBOX_FETCH_BURST];
+  u32_t i, n;
+#endif
   LWIP_UNUSED_ARG(arg);
 
   LWIP_MARK_TCPIP_THREAD();
@@ -136,6 +176,22 @@ tcpip_thread(void *arg)
     tcpip_init_done(tcpip_init_done_arg);
   }
 
+#if defined(LWIP_SYS_ARCH_MBOX_FETCH_BURST) && LWIP_TIMERS
+  while (1) {                          /* MAIN Loop */
+    LWIP_TCPIP_THREAD_ALIVE();
+    /* wait for messages, timeouts are processed while waiting */
+    n = tcpip_timeouts_mbox_fetch_burst(&tcpip_mbox, msgs, LWIP_SYS_ARCH_MBOX_FETCH_BURST);
+    for (i = 0; i < n; i++) {
+      msg = (struct tcpip_msg *)msgs[i];
+      if (msg == NULL) {
+        LWIP_DEBUGF(TCPIP_DEBUG, ("tcpip_thread: invalid message: NULL\n"));
+        LWIP_ASSERT("tcpip_thread: invalid message", 0);
+        continue;
+      }
+      tcpip_thread_handle_msg(msg);
+    }
+  }
+#else
   while (1) {                          /* MAIN Loop */
     LWIP_TCPIP_THREAD_ALIVE();
     /* wait for a message, timeouts are processed while waiting */
@@ -147,6 +203,7 @@ tcpip_thread(void *arg)
     }
     tcpip_thread_handle_msg(msg);
   }
+#endif
 }
 
 /* Handle a single tcpip_msg
@@ -657,7 +714,12 @@ tcpip_init(tcpip_init_done_fn initfunc, void *arg)
 
   tcpip_init_done = initfunc;
   tcpip_init_done_arg = arg;
+#ifdef LWIP_SYS_ARCH_MBOX_MPSC
+  /* tcpip_thread is the only reader of its mbox */
+  if (sys_mbox_new_mpsc(&tcpip_mbox, TCPIP_MBOX_SIZE) != ERR_OK) {
+#else
   if (sys_mbox_new(&tcpip_mbox, TCPIP_MBOX_SIZE) != ERR_OK) {
+#endif
     LWIP_ASSERT("failed to create tcpip_thread mbox", 0);
   }
 #if LWIP_TCPIP_CORE_LOCKING
@@ -241,6 +241,9 @@ PACK_STRUCT_END
 #if LWIP_TCP && LWIP_NETIF_TX_SINGLE_PBUF && !TCP_OVERSIZE
 #error "LWIP_NETIF_TX_SINGLE_PBUF needs TCP_OVERSIZE enabled to create single-pbuf TCP packets"
 #endif
+#if LWIP_NETIF_LSO && (LWIP_NETIF_LSO_MAX_SIZE > 0xFE00)
+#error "LWIP_NETIF_LSO_MAX_SIZE must leave room for the headers in a pbuf chain"
+#endif
 #if LWIP_NETIF_TX_SINGLE_PBUF && LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
 #error "Once LWIP_NETIF_TX_SINGLE_PBUF is set blocking UDP Tx looses its relevance. Please disable LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE"
 #endif
@@ -792,6 +792,36 @@ ip4_input(struct pbuf *p, struct netif *inp)
   return ERR_OK;
 }
 
+#if LWIP_NETIF_LSO
+/**
+ * Decides whether the MAC cuts an outgoing packet. TCP marks its large
+ * segments itself, UDP datagrams larger than the MTU are marked here.
+ *
+ * @param p the packet to send, p->payload points to the IP header
+ * @param netif the netif on which to send this packet
+ */
+static void
+ip4_lso_prepare(struct pbuf *p, struct netif *netif)
+{
+  struct ip_hdr *iphdr = (struct ip_hdr *)p->payload;
+
+  if (IPH_PROTO(iphdr) == IP_PROTO_TCP) {
+    if ((netif->lso_flags & NETIF_LSO_TCP) == 0) {
+      p->flags &= (u8_t)~PBUF_FLAG_LSO;
+    }
+  } else if ((IPH_PROTO(iphdr) == IP_PROTO_UDP) &&
+             ((netif->lso_flags & NETIF_LSO_UDP) != 0) &&
+             (netif->mtu != 0) && (p->tot_len > netif->mtu) &&
+             ((IPH_OFFSET(iphdr) & PP_HTONS(IP_OFFMASK | IP_MF)) == 0)) {
+    p->flags |= PBUF_FLAG_LSO;
+    /* fragment offsets are in units of 8 bytes */
+    p->lso_mss = (u16_t)((netif->mtu - IPH_HL_BYTES(iphdr)) & ~7U);
+  } else {
+    p->flags &= (u8_t)~PBUF_FLAG_LSO;
+  }
+}
+#endif /* LWIP_NETIF_LSO */
+
 /**
  * Sends an IP packet on a network interface. This function constructs
  * the IP header and calculates the IP header checksum. If the source
@@ -1030,9 +1060,16 @@ ip4_output_if_opt_src(struct pbuf *p, const ip4_addr_t *src, const ip4_addr_t *d
   }
 #endif /* LWIP_MULTICAST_TX_OPTIONS */
 #endif /* ENABLE_LOOPBACK */
+#if LWIP_NETIF_LSO
+  ip4_lso_prepare(p, netif);
+#endif /* LWIP_NETIF_LSO */
 #if IP_FRAG
   /* don't fragment if interface has mtu set to 0 [loopif] */
   if (netif->mtu && (p->tot_len > netif->mtu)) {
+#if LWIP_NETIF_LSO
+    /* the MAC cuts this one */
+    if ((p->flags & PBUF_FLAG_LSO) == 0)
+#endif /* LWIP_NETIF_LSO */
     return ip4_frag(p, netif, dest);
   }
 #endif /* IP_FRAG */
@@ -186,6 +186,10 @@ pbuf_init_alloced_pbuf(struct pbuf *p, void *payload, u16_t tot_len, u16_t len,
   p->flags = flags;
   p->ref = 1;
   p->if_idx = NETIF_NO_INDEX;
+
+#ifdef LWIP_PBUF_CUSTOM_DATA_INIT
+  LWIP_PBUF_CUSTOM_DATA_INIT(p);
+#endif
 }
 
 /**
@@ -454,6 +454,9 @@ tcp_input(struct pbuf *p, struct netif *inp)
            now. */
         if (recv_acked > 0) {
           u16_t acked16;
+#ifdef LWIP_HOOK_TCP_ACKED
+          LWIP_HOOK_TCP_ACKED(pcb);
+#endif
 #if LWIP_WND_SCALE
           /* recv_acked is u32_t but the sent callback only takes a u16_t,
              so we might have to call it multiple times. */
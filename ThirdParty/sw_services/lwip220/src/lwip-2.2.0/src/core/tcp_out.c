@@ -135,6 +135,9 @@
 
 /* Forward declarations.*/
 static err_t tcp_output_segment(struct tcp_seg *seg, struct tcp_pcb *pcb, struct netif *netif);
+#if LWIP_NETIF_LSO
+static void tcp_lso_fit_unsent(struct tcp_pcb *pcb, u32_t wnd);
+#endif /* LWIP_NETIF_LSO */
 static err_t tcp_output_control_segment_netif(const struct tcp_pcb *pcb, struct pbuf *p,
                                               const ip_addr_t *src, const ip_addr_t *dst,
                                               struct netif *netif);
@@ -359,6 +362,43 @@ tcp_write_checks(struct tcp_pcb *pcb, u16_t len)
   return ERR_OK;
 }
 
+#if LWIP_NETIF_LSO
+/**
+ * Size of the segments built by tcp_write when the route of the pcb goes
+ * through a netif that cuts TCP segments: as many full MSS sized pieces as
+ * fit in LWIP_NETIF_LSO_MAX_SIZE and in half the max window ever received.
+ *
+ * @param pcb Protocol control block for the TCP connection
+ * @param mss_local segment size used without large send offload
+ * @param optlen length of the options of every data segment
+ * @return segment size, options included
+ */
+static u16_t
+tcp_lso_seg_size(const struct tcp_pcb *pcb, u16_t mss_local, u8_t optlen)
+{
+  struct netif *netif;
+  u32_t segsz;
+  u32_t nsegs;
+
+  if ((mss_local < pcb->mss) || (pcb->mss <= optlen) ||
+      !IP_IS_V4(&pcb->remote_ip)) {
+    return mss_local;
+  }
+  netif = tcp_route(pcb, &pcb->local_ip, &pcb->remote_ip);
+  if ((netif == NULL) || ((netif->lso_flags & NETIF_LSO_TCP) == 0)) {
+    return mss_local;
+  }
+
+  segsz = (u32_t)pcb->mss - optlen;
+  nsegs = LWIP_MIN(LWIP_NETIF_LSO_MAX_SIZE / segsz,
+                   (pcb->snd_wnd_max / 2) / segsz);
+  if (nsegs <= 1) {
+    return mss_local;
+  }
+  return (u16_t)(nsegs * segsz + optlen);
+}
+#endif /* LWIP_NETIF_LSO */
+
 /**
  * @ingroup tcp_raw
  * Write data for sending (but does not send it immediately).
@@ -460,6 +500,9 @@ tcp_write(struct tcp_pcb *pcb, const void *arg, u16_t len, u8_t apiflags)
   {
     optlen = LWIP_TCP_OPT_LENGTH_SEGMENT(0, pcb);
   }
+#if LWIP_NETIF_LSO
+  mss_local = tcp_lso_seg_size(pcb, mss_local, optlen);
+#endif /* LWIP_NETIF_LSO */
 
 
   /*
@@ -495,8 +538,19 @@ tcp_write(struct tcp_pcb *pcb, const void *arg, u16_t len, u8_t apiflags)
 
     /* Usable space at the end of the last unsent segment */
     unsent_optlen = LWIP_TCP_OPT_LENGTH_SEGMENT(last_unsent->flags, pcb);
+#if LWIP_NETIF_LSO
+    /* the segment may have been built for a route that cut segments, and
+       a short segment put back by tcp_rexmit() is not the end of the data */
+    if ((mss_local > last_unsent->len + unsent_optlen) &&
+        (lwip_ntohl(last_unsent->tcphdr->seqno) + last_unsent->len == pcb->snd_lbb)) {
+      space = (u16_t)(mss_local - (last_unsent->len + unsent_optlen));
+    } else {
+      space = 0;
+    }
+#else /* LWIP_NETIF_LSO */
     LWIP_ASSERT("mss_local is too small", mss_local >= last_unsent->len + unsent_optlen);
     space = mss_local - (last_unsent->len + unsent_optlen);
+#endif /* LWIP_NETIF_LSO */
 
     /*
      * Phase 1: Copy data directly into an oversized pbuf.
@@ -512,6 +566,9 @@ tcp_write(struct tcp_pcb *pcb, const void *arg, u16_t len, u8_t apiflags)
                 pcb->unsent_oversize == last_unsent->oversize_left);
 #endif /* TCP_OVERSIZE_DBGCHECK */
     oversize = pcb->unsent_oversize;
+#if LWIP_NETIF_LSO
+    oversize = LWIP_MIN(oversize, space);
+#endif /* LWIP_NETIF_LSO */
     if (oversize > 0) {
       LWIP_ASSERT("inconsistent oversize vs. space", oversize <= space);
       seg = last_unsent;
@@ -868,7 +925,10 @@ tcp_split_unsent_seg(struct tcp_pcb *pcb, u16_t split)
     return ERR_OK;
   }
 
+#if !LWIP_NETIF_LSO
+  /* large send offload segments are split in multiples of the MSS */
   LWIP_ASSERT("split <= mss", split <= pcb->mss);
+#endif /* !LWIP_NETIF_LSO */
   LWIP_ASSERT("useg->len > 0", useg->len > 0);
 
   /* We should check that we don't exceed TCP_SND_QUEUELEN but we need
@@ -1314,6 +1374,10 @@ tcp_output(struct tcp_pcb *pcb)
     ip_addr_copy(pcb->local_ip, *local_ip);
   }
 
+#if LWIP_NETIF_LSO
+  tcp_lso_fit_unsent(pcb, wnd);
+#endif /* LWIP_NETIF_LSO */
+
   /* Handle the current segment not fitting within the window */
   if (lwip_ntohl(seg->tcphdr->seqno) - pcb->lastack + seg->len > wnd) {
     /* We need to start the persistent timer when the next unsent segment does not fit
@@ -1418,6 +1482,11 @@ tcp_output(struct tcp_pcb *pcb)
     } else {
       tcp_seg_free(seg);
     }
+#if LWIP_NETIF_LSO
+    if (pcb->unsent != NULL) {
+      tcp_lso_fit_unsent(pcb, wnd);
+    }
+#endif /* LWIP_NETIF_LSO */
     seg = pcb->unsent;
   }
 #if TCP_OVERSIZE
@@ -1457,6 +1526,36 @@ tcp_output_segment_busy(const struct tcp_seg *seg)
   return 0;
 }
 
+#if LWIP_NETIF_LSO
+/**
+ * Cut the first unsent segment down to the open part of the window, in
+ * multiples of the MSS, when it was built larger than the MSS for large send
+ * offload and does not fit in the window as a whole.
+ *
+ * @param pcb the tcp_pcb for the TCP connection
+ * @param wnd current send window, min(snd_wnd, cwnd)
+ */
+static void
+tcp_lso_fit_unsent(struct tcp_pcb *pcb, u32_t wnd)
+{
+  struct tcp_seg *seg = pcb->unsent;
+  u32_t segsz;
+  s32_t room;
+
+  segsz = (u32_t)pcb->mss - (u32_t)(LWIP_TCP_OPT_LENGTH_SEGMENT(seg->flags, pcb));
+  if ((seg->len <= segsz) || tcp_output_segment_busy(seg)) {
+    return;
+  }
+
+  /* a retransmitted segment may start before lastack */
+  room = (s32_t)(pcb->lastack + wnd - lwip_ntohl(seg->tcphdr->seqno));
+  if ((room >= (s32_t)seg->len) || (room < (s32_t)segsz)) {
+    return;
+  }
+  tcp_split_unsent_seg(pcb, (u16_t)((u32_t)room - ((u32_t)room % segsz)));
+}
+#endif /* LWIP_NETIF_LSO */
+
 /**
  * Called by tcp_output() to actually send a TCP segment over IP.
  *
@@ -1616,6 +1715,16 @@ tcp_output_segment(struct tcp_seg *seg, struct tcp_pcb *pcb, struct netif *netif
 #endif /* CHECKSUM_GEN_TCP */
   TCP_STATS_INC(tcp.xmit);
 
+#if LWIP_NETIF_LSO
+  /* segments larger than the MSS are cut by the MAC */
+  seg->p->lso_mss = (u16_t)(pcb->mss - (LWIP_TCP_OPT_LENGTH_SEGMENT(seg->flags, pcb)));
+  if ((seg->len > seg->p->lso_mss) && ((netif->lso_flags & NETIF_LSO_TCP) != 0)) {
+    seg->p->flags |= PBUF_FLAG_LSO;
+  } else {
+    seg->p->flags &= (u8_t)~PBUF_FLAG_LSO;
+  }
+#endif /* LWIP_NETIF_LSO */
+
   NETIF_SET_HINTS(netif, &(pcb->netif_hints));
   err = ip_output_if(seg->p, &pcb->local_ip, &pcb->remote_ip, pcb->ttl,
                      pcb->tos, IP_PROTO_TCP, netif);
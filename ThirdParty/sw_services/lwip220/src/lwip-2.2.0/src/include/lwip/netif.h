@@ -113,6 +113,13 @@ extern "C" {
 #define NETIF_ENABLE_BLOCKING_TX_FOR_PACKET 0x20
 #endif
 
+#if LWIP_NETIF_LSO
+/** If set in netif->lso_flags, the MAC cuts TCP segments (TSO) */
+#define NETIF_LSO_TCP 0x01U
+/** If set in netif->lso_flags, the MAC fragments UDP datagrams (UFO) */
+#define NETIF_LSO_UDP 0x02U
+#endif
+
 enum lwip_internal_netif_client_data_index
 {
 #if LWIP_IPV4
@@ -359,6 +366,10 @@ struct netif {
   /** flags that are used to support the feature where for UDP Tx, the adapter send routine
     * returns only when the respective packet is transmitted out */
   u8_t block_tx_till_complt;
+#endif
+#if LWIP_NETIF_LSO
+  /** large send offload capabilities (NETIF_LSO_*), set by the driver */
+  u8_t lso_flags;
 #endif
   /** descriptive abbreviation */
   char name[2];
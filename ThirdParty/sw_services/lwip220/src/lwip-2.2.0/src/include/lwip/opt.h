@@ -1622,6 +1622,15 @@
 #if !defined LWIP_PBUF_CUSTOM_DATA || defined __DOXYGEN__
 #define LWIP_PBUF_CUSTOM_DATA
 #endif
+
+/**
+ * LWIP_PBUF_CUSTOM_DATA_INIT: Initialize private data on pbufs.
+ * e.g. for a timestamp: \#define LWIP_PBUF_CUSTOM_DATA_INIT(p) (p)->ts = 0
+ * When #defined, this is called when a pbuf is allocated.
+ */
+#ifdef __DOXYGEN__
+#define LWIP_PBUF_CUSTOM_DATA_INIT(p)
+#endif
 /**
  * @}
  */
@@ -1725,6 +1734,25 @@
 #define LWIP_NETIF_TX_SINGLE_PBUF       0
 #endif /* LWIP_NETIF_TX_SINGLE_PBUF */
 
+/**
+ * LWIP_NETIF_LSO==1: Support large send offload. When the driver sets
+ * NETIF_LSO_TCP in netif->lso_flags, TCP builds IPv4 segments that carry
+ * several MSS worth of data and leaves the cutting to the MAC (TSO). When it
+ * sets NETIF_LSO_UDP, UDP datagrams larger than the MTU are not fragmented by
+ * IP but by the MAC (UFO). Such packets are marked with PBUF_FLAG_LSO and
+ * pbuf->lso_mss holds the payload size of one segment or fragment.
+ */
+#if !defined LWIP_NETIF_LSO || defined __DOXYGEN__
+#define LWIP_NETIF_LSO                  0
+#endif
+
+/**
+ * LWIP_NETIF_LSO_MAX_SIZE: Max TCP payload of one large send segment.
+ */
+#if !defined LWIP_NETIF_LSO_MAX_SIZE || defined __DOXYGEN__
+#define LWIP_NETIF_LSO_MAX_SIZE         (16 * TCP_MSS)
+#endif
+
 /**
  * LWIP_NUM_NETIF_CLIENT_DATA: Number of clients that may store
  * data in client_data member array of struct netif (max. 256).
@@ -2873,6 +2901,25 @@
 #define LWIP_HOOK_TCP_INPACKET_PCB(pcb, hdr, optlen, opt1len, opt2, p)
 #endif
 
+/**
+ * LWIP_HOOK_TCP_ACKED:
+ * Hook called by tcp_input() when new data of a pcb was acknowledged, before
+ * the sent callback of the pcb. Unlike the sent callback it cannot be replaced
+ * by the application or the netconn layer, and it is also called after the
+ * pcb was closed, while the remaining data is acknowledged.
+ * Signature:\code{.c}
+ * void my_hook_tcp_acked(struct tcp_pcb *pcb);
+ * \endcode
+ * Arguments:
+ * - pcb: tcp_pcb whose pcb->lastack has moved forward
+ *
+ * ATTENTION: don't call any tcp api functions that might change tcp state (pcb
+ * state or any pcb lists) from this callback!
+ */
+#ifdef __DOXYGEN__
+#define LWIP_HOOK_TCP_ACKED(pcb)
+#endif
+
 /**
  * LWIP_HOOK_TCP_OUT_TCPOPT_LENGTH:
  * Hook for increasing the size of the options allocated with a tcp header.
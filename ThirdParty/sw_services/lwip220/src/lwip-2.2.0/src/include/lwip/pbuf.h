@@ -181,6 +181,10 @@ typedef enum {
 #define PBUF_FLAG_LLMCAST   0x10U
 /** indicates this pbuf includes a TCP FIN flag */
 #define PBUF_FLAG_TCP_FIN   0x20U
+#if LWIP_NETIF_LSO
+/** indicates this packet is to be cut by the MAC in lso_mss sized pieces */
+#define PBUF_FLAG_LSO       0x40U
+#endif
 
 /** Main packet buffer struct */
 struct pbuf {
@@ -220,6 +224,11 @@ struct pbuf {
   /** For incoming packets, this contains the input netif's index */
   u8_t if_idx;
 
+#if LWIP_NETIF_LSO
+  /** For PBUF_FLAG_LSO packets, payload size of one segment or fragment */
+  u16_t lso_mss;
+#endif
+
   /** In case the user needs to store data custom data on a pbuf */
   LWIP_PBUF_CUSTOM_DATA
 };
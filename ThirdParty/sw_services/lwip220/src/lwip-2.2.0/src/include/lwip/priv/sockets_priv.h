@@ -132,6 +132,8 @@ struct lwip_setgetsockopt_data {
 #endif
 
 struct lwip_sock* lwip_socket_dbg_get_socket(int fd);
+struct lwip_sock* lwip_socket_get(int fd);
+void lwip_socket_done(struct lwip_sock *sock);
 
 #if LWIP_SOCKET_SELECT || LWIP_SOCKET_POLL
 
@@ -14,11 +14,32 @@ set_property(CACHE sgmii_fixed_link PROPERTY STRINGS 0 1)
 set(lwip220_n_tx_descriptors 64 CACHE STRING "Number of TX Buffer Descriptors to be used in SDMA mode")
 set(lwip220_n_rx_descriptors 64 CACHE STRING "Number of RX Buffer Descriptors to be used in SDMA mode")
 set(lwip220_n_tx_coalesce 1 CACHE STRING "Setting for TX Interrupt coalescing.")
+set(lwip220_tx_reap_low_water 5 CACHE STRING "Free TX Buffer Descriptor count at which the transmit path reclaims sent descriptors (GEM)")
+set(lwip220_tx_reap_budget 64 CACHE STRING "Maximum number of sent TX Buffer Descriptors reclaimed by the transmit path at once (GEM)")
 set(lwip220_n_rx_coalesce 1 CACHE STRING "Setting for RX Interrupt coalescing.")
 option(lwip220_temac_tcp_rx_checksum_offload "Offload TCP Receive checksum calculation (hardware support required)" OFF)
 option(lwip220_temac_tcp_tx_checksum_offload "Offload TCP Transmit checksum calculation (hardware support required)" OFF)
 option(lwip220_temac_tcp_ip_rx_checksum_offload "Offload TCP and IP Receive checksum calculation (hardware support required)" OFF)
 option(lwip220_temac_tcp_ip_tx_checksum_offload "Offload TCP and IP Transmit checksum calculation (hardware support required)" OFF)
+option(lwip220_emacps_tx_checksum_offload "Offload TCP/UDP/IP Transmit checksum calculation to GEM" ON)
+option(lwip220_emacps_rx_checksum_offload "Offload TCP/UDP/IP Receive checksum calculation to GEM" ON)
+option(lwip220_emacps_lso "Offload TCP segmentation and UDP fragmentation to GEM (hardware support required, needs Tx checksum offload)" OFF)
+option(lwip220_emacps_ptp "Capture IEEE 1588 hardware timestamps of all frames in GEM extended buffer descriptors (ZynqMP and later)" OFF)
+set(lwip220_emacps_tsu_clk_freq 250000000 CACHE STRING "Frequency in Hz of the GEM timestamp unit clock")
+option(lwip220_arch_checksum "Use the architecture optimized routines of the port for checksums computed in software (experimental, validate with lwip_example_chksum_test.c on the target first)" OFF)
+option(lwip220_gro "Merge in-order TCP segments of a flow received in one batch before lwIP processes them (GEM and AXI Ethernet)" OFF)
+set(lwip220_gro_flush_limit 8 CACHE STRING "Maximum number of TCP segments merged into one packet by GRO")
+set(lwip220_gro_flows 4 CACHE STRING "Number of TCP flows tracked by GRO per interface")
+option(lwip220_zero_copy_socket "Build the zero-copy socket send and receive API (SOCKET_API only)" OFF)
+option(lwip220_tcpip_mbox_mpsc "Use a ring read without the critical section and woken by task notification for the tcpip thread mailbox (SOCKET_API only)" OFF)
+set(lwip220_tcpip_mbox_fetch_burst 1 CACHE STRING "Maximum number of messages the tcpip thread takes from its mailbox per wake up (SOCKET_API only)")
+option(lwip220_mcdma_rx_steering "Queue received frames by a hash of their addresses and ports instead of by MCDMA channel (AXI Ethernet with MCDMA)" OFF)
+set(lwip220_mcdma_rx_budget 16 CACHE STRING "Frames taken from one MCDMA RX channel queue before the next channel is served")
+option(lwip220_coalesce_adaptive "Retune the interrupt coalescing of the DMA rings to the frame rate at run time (GEM and AXI Ethernet with AXI DMA)" OFF)
+set(lwip220_coalesce_interval_ms 10 CACHE STRING "Interval in ms between two frame rate samples of adaptive coalescing")
+set(lwip220_coalesce_irq_rate 20000 CACHE STRING "Interrupts per second and direction above which adaptive coalescing holds interrupts back")
+set(lwip220_coalesce_max_delay_us 100 CACHE STRING "Longest time in us adaptive coalescing lets a completed frame wait for its interrupt")
+set(lwip220_coalesce_axidma_timer_unit_ns 1250 CACHE STRING "Unit of the AXI DMA coalescing delay timer in ns, 125 periods of the scatter gather clock")
 set(lwip220_temac_phy_link_speed CONFIG_LINKSPEED_AUTODETECT CACHE STRING "link speed as negotiated by the PHY")
 set_property(CACHE lwip220_temac_phy_link_speed PROPERTY STRINGS CONFIG_LINKSPEED10 CONFIG_LINKSPEED100 CONFIG_LINKSPEED1000 CONFIG_LINKSPEED_AUTODETECT)
 option(lwip220_temac_use_jumbo_frames "use jumbo frames" OFF)
@@ -282,8 +303,30 @@ endif()
 
 if (${CONFIG_EMACPS})
     if (MAC_INSTANCES IN_LIST EMACPS_NUM_DRIVER_INSTANCES)
-	set(LWIP_FULL_CSUM_OFFLOAD_RX 1)
-	set(LWIP_FULL_CSUM_OFFLOAD_TX 1)
+        if (${lwip220_emacps_tx_checksum_offload})
+            set(LWIP_FULL_CSUM_OFFLOAD_TX 1)
+        else()
+            set(CHECKSUM_GEN_TCP " ")
+            set(CHECKSUM_GEN_UDP " ")
+            set(CHECKSUM_GEN_IP " ")
+        endif()
+        if (${lwip220_emacps_rx_checksum_offload})
+            set(LWIP_FULL_CSUM_OFFLOAD_RX 1)
+        else()
+            set(CHECKSUM_CHECK_TCP " ")
+            set(CHECKSUM_CHECK_UDP " ")
+            set(CHECKSUM_CHECK_IP " ")
+        endif()
+        if (${lwip220_emacps_lso})
+            if (NOT ${lwip220_emacps_tx_checksum_offload})
+                message(FATAL_ERROR "GEM TCP segmentation and UDP fragmentation offload needs Tx checksum offload")
+            endif()
+            set(LWIP_NETIF_LSO 1)
+        endif()
+        if (${lwip220_emacps_ptp})
+            set(XLWIP_CONFIG_EMACPS_PTP 1)
+            set(XLWIP_CONFIG_EMACPS_TSU_CLK_FREQ ${lwip220_emacps_tsu_clk_freq})
+        endif()
         set(index 0)
         LIST_INDEX(${index} ${MAC_INSTANCES} "${EMACPS_NUM_DRIVER_INSTANCES}")
         list(GET TOTAL_EMACPS_PROP_LIST ${index} x)
@@ -297,6 +340,14 @@ if (${CONFIG_EMACPS})
     endif()
 endif()
 
+if (${lwip220_arch_checksum})
+    set(LWIP_ARCH_CHKSUM 1)
+    # TCP data is checksummed while it is copied when no MAC computes it
+    if (DEFINED CHECKSUM_GEN_TCP)
+        set(LWIP_CHECKSUM_ON_COPY 1)
+    endif()
+endif()
+
 if(("${CMAKE_SYSTEM_PROCESSOR}" STREQUAL "microblaze") OR
    ("${CMAKE_SYSTEM_PROCESSOR}" STREQUAL "microblazeel") OR
    ("${CMAKE_SYSTEM_PROCESSOR}" STREQUAL "plm_microblaze") OR
@@ -391,6 +442,24 @@ set(XLWIP_CONFIG_N_TX_DESC ${lwip220_n_tx_descriptors})
 set(XLWIP_CONFIG_N_RX_DESC ${lwip220_n_rx_descriptors})
 set(XLWIP_CONFIG_N_TX_COALESCE ${lwip220_n_tx_coalesce})
 set(XLWIP_CONFIG_N_RX_COALESCE ${lwip220_n_rx_coalesce})
+set(XLWIP_CONFIG_TX_REAP_LOW_WATER ${lwip220_tx_reap_low_water})
+set(XLWIP_CONFIG_TX_REAP_BUDGET ${lwip220_tx_reap_budget})
+if (${lwip220_gro})
+    set(XLWIP_CONFIG_GRO 1)
+    set(XLWIP_CONFIG_GRO_FLUSH_LIMIT ${lwip220_gro_flush_limit})
+    set(XLWIP_CONFIG_GRO_FLOWS ${lwip220_gro_flows})
+endif()
+set(XLWIP_CONFIG_MCDMA_RX_BUDGET ${lwip220_mcdma_rx_budget})
+if (${lwip220_mcdma_rx_steering})
+    set(XLWIP_CONFIG_MCDMA_RX_STEERING 1)
+endif()
+if (${lwip220_coalesce_adaptive})
+    set(XLWIP_CONFIG_COALESCE 1)
+    set(XLWIP_CONFIG_COALESCE_INTERVAL ${lwip220_coalesce_interval_ms})
+    set(XLWIP_CONFIG_COALESCE_IRQ_RATE ${lwip220_coalesce_irq_rate})
+    set(XLWIP_CONFIG_COALESCE_MAX_DELAY ${lwip220_coalesce_max_delay_us})
+    set(XLWIP_CONFIG_COALESCE_AXIDMA_TIMER_UNIT ${lwip220_coalesce_axidma_timer_unit_ns})
+endif()
 
 if(("${CMAKE_SYSTEM_NAME}" STREQUAL "FreeRTOS") AND
    ("${lwip220_api_mode}" STREQUAL SOCKET_API))
@@ -419,6 +488,16 @@ if(("${CMAKE_SYSTEM_NAME}" STREQUAL "FreeRTOS") AND
     if (${lwip220_lwip_tcpip_core_locking_input})
         set(LWIP_TCPIP_CORE_LOCKING_INPUT 1)
     endif()
+    if (${lwip220_tcpip_mbox_mpsc})
+        set(XLWIP_CONFIG_MPSC_MBOX 1)
+    endif()
+    set(XLWIP_CONFIG_MBOX_FETCH_BURST ${lwip220_tcpip_mbox_fetch_burst})
+    if (${lwip220_zero_copy_socket})
+        set(XLWIP_CONFIG_ZERO_COPY_SOCKET 1)
+        set(LWIP_SUPPORT_CUSTOM_PBUF 1)
+        set(LWIP_TCP_PCB_NUM_EXT_ARGS 1)
+        set(LWIP_HOOK_FILENAME "arch/xlwip_hooks.h")
+    endif()
 endif()
 
 set(LWIP_DIR ${CMAKE_CURRENT_SOURCE_DIR}/lwip-2.2.0)
@@ -0,0 +1,459 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xaxidma_fring.c
+* @addtogroup AXIDMA Overview
+* @{
+*
+* This file implements the frame ring interface of the AXI DMA driver. Refer
+* to xaxidma_fring.h for more details.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 9.19  sb   10/19/26 First release
+* 9.19  sb   10/19/26 Use the rings of xil_fring.h
+* 9.19  sb   10/19/26 Use the rings of the fring driver, xfring.h
+* 9.19  sb   10/19/26 Added XAxiDma_FrTxSubmit() to check frames before sending
+*
+* </pre>
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xaxidma_fring.h"
+
+/************************** Function Prototypes ******************************/
+
+static u32 XAxiDma_FrRxPost(XAxiDma_FrameRing *FrPtr, const u32 *IdxPtr,
+			    u32 IdxStride, u32 Count);
+static u32 XAxiDma_FrTxComplete(XAxiDma_FrameRing *FrPtr);
+static u32 XAxiDma_FrRxReceive(XAxiDma_FrameRing *FrPtr, u32 Budget);
+static void XAxiDma_FrRxRefill(XAxiDma_FrameRing *FrPtr);
+static void XAxiDma_FrTxPost(XAxiDma_FrameRing *FrPtr);
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+* Initialize a frame ring set over the TX and RX BD rings of an AXI DMA
+* engine.
+*
+* The BD rings of both channels must have been created and started. The
+* rings start empty; the application gives the driver frames to receive into
+* by producing them to the Fill ring.
+*
+* @param	FrPtr is the frame ring set to be initialized.
+* @param	InstancePtr is the initialized AXI DMA instance, in SG mode.
+* @param	FrameBase is the address of the frame area, aligned to
+*		XAXIDMA_FR_MIN_FRAME_SIZE.
+* @param	FrameSize is the size of a frame, a power of two of at least
+*		XAXIDMA_FR_MIN_FRAME_SIZE bytes.
+* @param	FrameCount is the number of frames in the frame area.
+* @param	RingMem is the memory for the rings, XAXIDMA_FR_NUM_RINGS *
+*		RingSize descriptors.
+* @param	RingSize is the number of entries of each ring, a power of
+*		two.
+*
+* @return
+*		- XST_SUCCESS if the frame ring set was initialized.
+*		- XST_INVALID_PARAM if a size or alignment is not supported or
+*		the BD rings have not been created.
+*
+*****************************************************************************/
+s32 XAxiDma_FrInitialize(XAxiDma_FrameRing *FrPtr, XAxiDma *InstancePtr,
+			 UINTPTR FrameBase, u32 FrameSize, u32 FrameCount,
+			 XAxiDma_FrDesc *RingMem, u32 RingSize)
+{
+	XAxiDma_BdRing *RxRing;
+	XAxiDma_BdRing *TxRing;
+	u32 Shift;
+
+	Xil_AssertNonvoid(FrPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->Initialized != 0);
+	Xil_AssertNonvoid(RingMem != NULL);
+
+	RxRing = XAxiDma_GetRxRing(InstancePtr);
+	TxRing = XAxiDma_GetTxRing(InstancePtr);
+
+	if ((FrameSize < XAXIDMA_FR_MIN_FRAME_SIZE) ||
+	    ((FrameSize & (FrameSize - 1U)) != 0U) ||
+	    ((FrameBase & (XAXIDMA_FR_MIN_FRAME_SIZE - 1U)) != 0U) ||
+	    (FrameCount == 0U) ||
+	    (RingSize == 0U) || ((RingSize & (RingSize - 1U)) != 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	if (!(XAxiDma_HasSg(InstancePtr)) ||
+	    (FrameSize > RxRing->MaxTransferLen) ||
+	    (FrameSize > TxRing->MaxTransferLen) ||
+	    (RxRing->AllCnt == 0) || (TxRing->AllCnt == 0)) {
+		return XST_INVALID_PARAM;
+	}
+
+	for (Shift = 0U; (1U << Shift) < FrameSize; Shift++);
+
+	FrPtr->RxRing = RxRing;
+	FrPtr->TxRing = TxRing;
+	FrPtr->FrameBase = FrameBase;
+	FrPtr->FrameSize = FrameSize;
+	FrPtr->FrameShift = Shift;
+	FrPtr->FrameCount = FrameCount;
+
+	XFring_RingInit(&FrPtr->Fill, RingMem, RingSize);
+	XFring_RingInit(&FrPtr->Rx, RingMem + RingSize, RingSize);
+	XFring_RingInit(&FrPtr->Tx, RingMem + (2U * RingSize), RingSize);
+	XFring_RingInit(&FrPtr->Comp, RingMem + (3U * RingSize), RingSize);
+
+	memset(&FrPtr->Stats, 0, sizeof(FrPtr->Stats));
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Run the driver side of a frame ring set.
+*
+* Sent frames are moved to the Comp ring and received frames to the Rx ring,
+* then frames of the Fill ring are given to the S2MM channel and frames of
+* the Tx ring to the MM2S channel. Completed BDs stay with the hardware while
+* the ring they go to is full.
+*
+* @param	FrPtr is the frame ring set to be worked on.
+* @param	Budget is the maximum number of frames to receive.
+*
+* @return	The number of frames put on the Rx ring.
+*
+* @note		This function must not be preempted by another call for the
+*		same frame ring set.
+*
+*****************************************************************************/
+u32 XAxiDma_FrPoll(XAxiDma_FrameRing *FrPtr, u32 Budget)
+{
+	u32 Received;
+
+	(void)XAxiDma_FrTxComplete(FrPtr);
+	Received = XAxiDma_FrRxReceive(FrPtr, Budget);
+	XAxiDma_FrRxRefill(FrPtr);
+	XAxiDma_FrTxPost(FrPtr);
+
+	return Received;
+}
+
+/*****************************************************************************/
+/**
+* Hand frames reserved on the Tx ring, now filled in, to the driver.
+*
+* The frames are checked before any of them is handed over: a frame must be
+* in the frame area and its length must be at least one byte and at most
+* FrameSize.
+*
+* @param	FrPtr is the frame ring set to be worked on.
+* @param	Count is the number of frames, at most the number reserved
+*		with XAxiDma_FrRingReserve().
+*
+* @return
+*		- XST_SUCCESS if the frames were handed to the driver.
+*		- XST_INVALID_PARAM if a frame index or length is not valid.
+*		No frame was handed over then.
+*
+*****************************************************************************/
+s32 XAxiDma_FrTxSubmit(XAxiDma_FrameRing *FrPtr, u32 Count)
+{
+	XAxiDma_FrDesc *DescPtr;
+	u32 Pos;
+	u32 Index;
+
+	Xil_AssertNonvoid(FrPtr != NULL);
+	Xil_AssertNonvoid(Count <= XAxiDma_FrRingFree(&FrPtr->Tx));
+
+	Pos = FrPtr->Tx.Prod;
+
+	for (Index = 0U; Index < Count; Index++) {
+		DescPtr = XAxiDma_FrRingDesc(&FrPtr->Tx, Pos + Index);
+		if ((DescPtr->Idx >= FrPtr->FrameCount) ||
+		    (DescPtr->Len == 0U) || (DescPtr->Len > FrPtr->FrameSize)) {
+			return XST_INVALID_PARAM;
+		}
+	}
+
+	XAxiDma_FrRingSubmit(&FrPtr->Tx, Count);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/*
+* Give frames to the S2MM channel to receive into.
+*
+* @param	FrPtr is the frame ring set to be worked on.
+* @param	IdxPtr points to the first frame index.
+* @param	IdxStride is the distance between frame indexes, in words.
+* @param	Count is the number of frames, at most the number of free BDs.
+*
+* @return	The number of frames given to the channel.
+*
+*****************************************************************************/
+static u32 XAxiDma_FrRxPost(XAxiDma_FrameRing *FrPtr, const u32 *IdxPtr,
+			    u32 IdxStride, u32 Count)
+{
+	XAxiDma_BdRing *RingPtr = FrPtr->RxRing;
+	XAxiDma_Bd *BdPtr;
+	XAxiDma_Bd *BdCurPtr;
+	UINTPTR Addr;
+	u32 Index;
+
+	if (XAxiDma_BdRingAlloc(RingPtr, (int)Count, &BdPtr) != XST_SUCCESS) {
+		return 0U;
+	}
+
+	BdCurPtr = BdPtr;
+	for (Index = 0U; Index < Count; Index++) {
+		Addr = XAxiDma_FrAddr(FrPtr, *IdxPtr);
+		Xil_DCacheInvalidateRange(Addr, FrPtr->FrameSize);
+
+		(void)XAxiDma_BdSetBufAddr(BdCurPtr, Addr);
+		(void)XAxiDma_BdSetLength(BdCurPtr, FrPtr->FrameSize,
+					  RingPtr->MaxTransferLen);
+		XAxiDma_BdWrite(BdCurPtr, XAXIDMA_BD_STS_OFFSET, 0U);
+		XAxiDma_BdSetCtrl(BdCurPtr, 0U);
+		XAxiDma_BdSetId(BdCurPtr, *IdxPtr);
+
+		IdxPtr += IdxStride;
+		BdCurPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(RingPtr, BdCurPtr);
+	}
+
+	(void)XAxiDma_BdRingToHw(RingPtr, (int)Count, BdPtr);
+
+	return Count;
+}
+
+/*****************************************************************************/
+/*
+* Move the frames of completed MM2S BDs to the Comp ring.
+*
+* @param	FrPtr is the frame ring set to be worked on.
+*
+* @return	The number of frames moved.
+*
+*****************************************************************************/
+static u32 XAxiDma_FrTxComplete(XAxiDma_FrameRing *FrPtr)
+{
+	XAxiDma_BdRing *RingPtr = FrPtr->TxRing;
+	XAxiDma_Bd *BdPtr;
+	XAxiDma_Bd *BdCurPtr;
+	XAxiDma_FrDesc *DescPtr;
+	u32 BdCount;
+	u32 Pos;
+	u32 Index;
+
+	BdCount = XAxiDma_FrRingReserve(&FrPtr->Comp, (u32)RingPtr->HwCnt,
+					&Pos);
+	if (BdCount == 0U) {
+		return 0U;
+	}
+
+	BdCount = (u32)XAxiDma_BdRingFromHw(RingPtr, (int)BdCount, &BdPtr);
+	if (BdCount == 0U) {
+		return 0U;
+	}
+
+	BdCurPtr = BdPtr;
+	for (Index = 0U; Index < BdCount; Index++) {
+		if ((XAxiDma_BdGetSts(BdCurPtr) &
+		     XAXIDMA_BD_STS_ALL_ERR_MASK) != 0U) {
+			FrPtr->Stats.TxErrors++;
+		}
+		DescPtr = XAxiDma_FrRingDesc(&FrPtr->Comp, Pos + Index);
+		DescPtr->Idx = (u32)XAxiDma_BdGetId(BdCurPtr);
+		DescPtr->Len = XAxiDma_BdGetLength(BdCurPtr,
+						   RingPtr->MaxTransferLen);
+		BdCurPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(RingPtr, BdCurPtr);
+	}
+
+	(void)XAxiDma_BdRingFree(RingPtr, (int)BdCount, BdPtr);
+	XAxiDma_FrRingSubmit(&FrPtr->Comp, BdCount);
+	FrPtr->Stats.TxFrames += BdCount;
+
+	return BdCount;
+}
+
+/*****************************************************************************/
+/*
+* Move the frames of completed S2MM BDs to the Rx ring. Frames received with
+* an error or not fitting in one frame are given back to the S2MM channel.
+*
+* @param	FrPtr is the frame ring set to be worked on.
+* @param	Budget is the maximum number of frames to move.
+*
+* @return	The number of frames moved.
+*
+*****************************************************************************/
+static u32 XAxiDma_FrRxReceive(XAxiDma_FrameRing *FrPtr, u32 Budget)
+{
+	XAxiDma_BdRing *RingPtr = FrPtr->RxRing;
+	XAxiDma_Bd *BdPtr;
+	XAxiDma_Bd *BdCurPtr;
+	XAxiDma_FrDesc *DescPtr;
+	u32 Drop[XAXIDMA_FR_RX_BATCH];
+	u32 NumDrop;
+	u32 Received = 0U;
+	u32 BdCount;
+	u32 Limit;
+	u32 Pos;
+	u32 Index;
+	u32 Sts;
+	u32 Idx;
+
+	while (Received < Budget) {
+		Limit = XAxiDma_FrRingReserve(&FrPtr->Rx, Budget - Received,
+					      &Pos);
+		if (Limit > XAXIDMA_FR_RX_BATCH) {
+			Limit = XAXIDMA_FR_RX_BATCH;
+		}
+		if (Limit == 0U) {
+			break;
+		}
+
+		BdCount = (u32)XAxiDma_BdRingFromHw(RingPtr, (int)Limit, &BdPtr);
+		if (BdCount == 0U) {
+			break;
+		}
+
+		NumDrop = 0U;
+		BdCurPtr = BdPtr;
+		for (Index = 0U; Index < BdCount; Index++) {
+			Sts = XAxiDma_BdGetSts(BdCurPtr);
+			Idx = (u32)XAxiDma_BdGetId(BdCurPtr);
+			if (((Sts & XAXIDMA_BD_STS_ALL_ERR_MASK) != 0U) ||
+			    ((Sts & XAXIDMA_BD_STS_RXSOF_MASK) == 0U) ||
+			    ((Sts & XAXIDMA_BD_STS_RXEOF_MASK) == 0U)) {
+				Drop[NumDrop++] = Idx;
+			} else {
+				/* Drop lines speculatively fetched while the
+				 * DMA wrote the frame
+				 */
+				Xil_DCacheInvalidateRange(
+					XAxiDma_FrAddr(FrPtr, Idx),
+					FrPtr->FrameSize);
+				DescPtr = XAxiDma_FrRingDesc(&FrPtr->Rx, Pos);
+				DescPtr->Idx = Idx;
+				DescPtr->Len = XAxiDma_BdGetActualLength(BdCurPtr,
+							RingPtr->MaxTransferLen);
+				Pos++;
+			}
+			BdCurPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(RingPtr,
+								   BdCurPtr);
+		}
+
+		(void)XAxiDma_BdRingFree(RingPtr, (int)BdCount, BdPtr);
+		XAxiDma_FrRingSubmit(&FrPtr->Rx, BdCount - NumDrop);
+		Received += BdCount - NumDrop;
+
+		if (NumDrop != 0U) {
+			FrPtr->Stats.RxErrors += NumDrop;
+			(void)XAxiDma_FrRxPost(FrPtr, Drop, 1U, NumDrop);
+		}
+	}
+
+	FrPtr->Stats.RxFrames += Received;
+
+	return Received;
+}
+
+/*****************************************************************************/
+/*
+* Give the frames of the Fill ring to the S2MM channel, as far as it has
+* free BDs.
+*
+* @param	FrPtr is the frame ring set to be worked on.
+*
+* @return	None.
+*
+*****************************************************************************/
+static void XAxiDma_FrRxRefill(XAxiDma_FrameRing *FrPtr)
+{
+	XAxiDma_FrRing *FillPtr = &FrPtr->Fill;
+	u32 Count;
+	u32 Chunk;
+	u32 Pos;
+
+	Count = XAxiDma_FrRingPeek(FillPtr,
+				   (u32)XAxiDma_BdRingGetFreeCnt(FrPtr->RxRing),
+				   &Pos);
+
+	while (Count > 0U) {
+		/* The ring entries are contiguous up to its end */
+		Chunk = FillPtr->Mask + 1U - (Pos & FillPtr->Mask);
+		if (Chunk > Count) {
+			Chunk = Count;
+		}
+
+		(void)XAxiDma_FrRxPost(FrPtr, &XAxiDma_FrRingDesc(FillPtr, Pos)->Idx,
+				       sizeof(XAxiDma_FrDesc) / sizeof(u32),
+				       Chunk);
+		XAxiDma_FrRingRelease(FillPtr, Chunk);
+		Pos += Chunk;
+		Count -= Chunk;
+	}
+}
+
+/*****************************************************************************/
+/*
+* Give the frames of the Tx ring to the MM2S channel, as far as it has free
+* BDs. The frames have been checked by XAxiDma_FrTxSubmit().
+*
+* @param	FrPtr is the frame ring set to be worked on.
+*
+* @return	None.
+*
+*****************************************************************************/
+static void XAxiDma_FrTxPost(XAxiDma_FrameRing *FrPtr)
+{
+	XAxiDma_BdRing *RingPtr = FrPtr->TxRing;
+	XAxiDma_FrDesc *DescPtr;
+	XAxiDma_Bd *BdPtr;
+	XAxiDma_Bd *BdCurPtr;
+	UINTPTR Addr;
+	u32 Count;
+	u32 Pos;
+	u32 Index;
+
+	Count = XAxiDma_FrRingPeek(&FrPtr->Tx,
+				   (u32)XAxiDma_BdRingGetFreeCnt(RingPtr), &Pos);
+	if (Count == 0U) {
+		return;
+	}
+
+	if (XAxiDma_BdRingAlloc(RingPtr, (int)Count, &BdPtr) != XST_SUCCESS) {
+		return;
+	}
+
+	BdCurPtr = BdPtr;
+	for (Index = 0U; Index < Count; Index++) {
+		DescPtr = XAxiDma_FrRingDesc(&FrPtr->Tx, Pos + Index);
+		Addr = XAxiDma_FrAddr(FrPtr, DescPtr->Idx);
+		Xil_DCacheFlushRange(Addr, DescPtr->Len);
+
+		(void)XAxiDma_BdSetBufAddr(BdCurPtr, Addr);
+		(void)XAxiDma_BdSetLength(BdCurPtr, DescPtr->Len,
+					  RingPtr->MaxTransferLen);
+		XAxiDma_BdSetCtrl(BdCurPtr, XAXIDMA_BD_CTRL_TXSOF_MASK |
+				  XAXIDMA_BD_CTRL_TXEOF_MASK);
+		XAxiDma_BdSetId(BdCurPtr, DescPtr->Idx);
+
+		BdCurPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(RingPtr, BdCurPtr);
+	}
+
+	XAxiDma_FrRingRelease(&FrPtr->Tx, Count);
+	(void)XAxiDma_BdRingToHw(RingPtr, (int)Count, BdPtr);
+}
+/** @} */
@@ -0,0 +1,139 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xaxidma_fring.h
+* @addtogroup AXIDMA Overview
+* @{
+*
+* Frame ring interface of the AXI DMA driver, for applications that process
+* raw Ethernet frames (from AXI Ethernet or 10G/25G Ethernet) without a
+* network stack. It is the same interface as the MCDMA driver provides in
+* xmcdma_fring.h.
+*
+* The frame area and the Fill, Rx, Tx and Comp rings are those of
+* xfring.h, which describes how frames move between application and
+* driver. The ring types and calls below are aliases of the xfring.h ones.
+*
+* The driver side runs in XAxiDma_FrPoll(), which reaps completed BDs of the
+* TX and RX rings into the Rx and Comp rings and turns Fill and Tx entries
+* into BDs. It may be called from a loop or from the DMA interrupt handlers,
+* but from one context only. The application side uses
+* XAxiDma_FrRingReserve()/XAxiDma_FrRingSubmit() to produce and
+* XAxiDma_FrRingPeek()/XAxiDma_FrRingRelease() to consume ring entries, except
+* that frames to send are handed over with XAxiDma_FrTxSubmit(), which
+* rejects frames longer than FrameSize.
+*
+* The BD rings of both channels must have been created with
+* XAxiDma_BdRingCreate() and started before XAxiDma_FrInitialize(). A frame
+* always uses one BD, so FrameSize must fit the maximum transfer length of
+* the channels and received frames longer than FrameSize are dropped.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 9.19  sb   10/19/26 First release
+* 9.19  sb   10/19/26 Moved the ring types and calls to xil_fring.h
+* 9.19  sb   10/19/26 Use the rings of the fring driver, xfring.h
+* 9.19  sb   10/19/26 Added XAxiDma_FrTxSubmit() to check frames before sending
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef XAXIDMA_FRING_H_
+#define XAXIDMA_FRING_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+
+#include "xaxidma.h"
+#include "xfring.h"
+
+/************************** Constant Definitions *****************************/
+
+/** Number of rings a frame ring set uses, see XAxiDma_FrInitialize() */
+#define XAXIDMA_FR_NUM_RINGS		XFRING_NUM_RINGS
+
+/** Minimum frame size, one cache line */
+#define XAXIDMA_FR_MIN_FRAME_SIZE	XFRING_MIN_FRAME_SIZE
+
+/** Maximum number of RX BDs reaped at once by XAxiDma_FrPoll() */
+#define XAXIDMA_FR_RX_BATCH		XFRING_RX_BATCH
+
+/**************************** Type Definitions *******************************/
+
+typedef XFring_Desc XAxiDma_FrDesc;	/**< Frame descriptor */
+typedef XFring_Ring XAxiDma_FrRing;	/**< Ring of frame descriptors */
+typedef XFring_Stats XAxiDma_FrStats;	/**< Frame ring statistics */
+
+/**
+ * Frame ring set of an AXI DMA engine.
+ */
+typedef struct {
+	XAxiDma_BdRing *RxRing;		/**< S2MM BD ring */
+	XAxiDma_BdRing *TxRing;		/**< MM2S BD ring */
+	UINTPTR FrameBase;		/**< Frame area */
+	u32 FrameSize;			/**< Bytes per frame */
+	u32 FrameShift;			/**< log2(FrameSize) */
+	u32 FrameCount;			/**< Frames in the frame area */
+	XAxiDma_FrRing Fill;		/**< Free frames to receive into */
+	XAxiDma_FrRing Rx;		/**< Received frames */
+	XAxiDma_FrRing Tx;		/**< Frames to send */
+	XAxiDma_FrRing Comp;		/**< Sent frames */
+	XAxiDma_FrStats Stats;		/**< Statistics */
+} XAxiDma_FrameRing;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/*****************************************************************************/
+/**
+* Return the address of a frame of the frame area.
+*
+* @param	FrPtr is the frame ring set to be worked on.
+* @param	Idx is the frame index.
+*
+* @return	The frame address.
+*
+* @note		C-style signature:
+*		UINTPTR XAxiDma_FrAddr(XAxiDma_FrameRing *FrPtr, u32 Idx)
+*
+******************************************************************************/
+#define XAxiDma_FrAddr(FrPtr, Idx) \
+	((FrPtr)->FrameBase + ((UINTPTR)(Idx) << (FrPtr)->FrameShift))
+
+/** Ring calls, see xfring.h */
+#define XAxiDma_FrRingDesc(RingPtr, Pos)	XFring_RingDesc(RingPtr, Pos)
+#define XAxiDma_FrRingUsed(RingPtr)		XFring_RingUsed(RingPtr)
+#define XAxiDma_FrRingFree(RingPtr)		XFring_RingFree(RingPtr)
+#define XAxiDma_FrRingReserve(RingPtr, Count, PosPtr) \
+	XFring_RingReserve(RingPtr, Count, PosPtr)
+#define XAxiDma_FrRingSubmit(RingPtr, Count) \
+	XFring_RingSubmit(RingPtr, Count)
+#define XAxiDma_FrRingPeek(RingPtr, Count, PosPtr) \
+	XFring_RingPeek(RingPtr, Count, PosPtr)
+#define XAxiDma_FrRingRelease(RingPtr, Count) \
+	XFring_RingRelease(RingPtr, Count)
+
+/************************** Function Prototypes ******************************/
+
+s32 XAxiDma_FrInitialize(XAxiDma_FrameRing *FrPtr, XAxiDma *InstancePtr,
+			 UINTPTR FrameBase, u32 FrameSize, u32 FrameCount,
+			 XAxiDma_FrDesc *RingMem, u32 RingSize);
+u32 XAxiDma_FrPoll(XAxiDma_FrameRing *FrPtr, u32 Budget);
+s32 XAxiDma_FrTxSubmit(XAxiDma_FrameRing *FrPtr, u32 Count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XAXIDMA_FRING_H_ */
+/** @} */
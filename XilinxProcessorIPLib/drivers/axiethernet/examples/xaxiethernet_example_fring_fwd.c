@@ -0,0 +1,568 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/**
+*
+* @file xaxiethernet_example_fring_fwd.c
+*
+* Implements an L2 forwarder on the AXI DMA frame ring interface
+* (xaxidma_fring.h) and measures its rate in frames per second.
+*
+* The PHY is put in loopback and a number of frames is injected into the TX
+* ring. Every received frame has its MAC addresses swapped and is sent again
+* from the buffer it was received into, so the frames circulate through AXI
+* DMA and Axi Ethernet for as long as the example runs. Sent frames are
+* recycled from the Comp ring to the Fill ring. No frame is allocated or
+* copied by software, and the DMA channels are polled, not interrupt driven.
+*
+* HW must be setup for SGDMA mode.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 5.16  sb   10/19/26 First release
+* 5.16  sb   10/19/26 Send frames with XAxiDma_FrTxSubmit()
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xaxiethernet_example.h"
+#include "xaxidma.h"
+#include "xaxidma_fring.h"
+#include "xil_cache.h"
+#include "xiltimer.h"
+#include "stdio.h"		/* stdio */
+
+#if defined __aarch64__
+#include "xil_mmu.h"
+#endif
+
+/*************************** Constant Definitions ****************************/
+
+/*
+ * The following constants map to the XPAR parameters created in the
+ * xparameters.h file. They are defined here such that a user can easily
+ * change all the needed parameters in one place.
+ */
+#ifndef TESTAPP_GEN
+#ifdef SDT
+#define XAXIETHERNET_BASEADDRESS XPAR_XAXIETHERNET_0_BASEADDR
+#else
+#define AXIETHERNET_DEVICE_ID	XPAR_AXIETHERNET_0_DEVICE_ID
+#define AXIDMA_DEVICE_ID	XPAR_AXIDMA_0_DEVICE_ID
+#endif
+#endif
+
+#define BD_CNT			512	/* Number of BDs per direction */
+#define BD_ALIGNMENT		XAXIDMA_BD_MINIMUM_ALIGNMENT*2
+					/* Byte alignment of BDs */
+
+#define FRAME_SIZE		2048	/* Bytes per frame of the frame area */
+#define FRAME_COUNT		1024	/* Frames in the frame area */
+#define RING_SIZE		1024	/* Entries per ring, >= FRAME_COUNT */
+
+#define INJECT_FRAMES		256	/* Frames circulating in the loop */
+#define FRAME_PAYLOAD		46	/* Payload of injected frames, so that
+					 * they have the minimum length
+					 */
+#define POLL_BUDGET		64	/* Frames received per poll */
+#define RUN_SECONDS		10	/* Duration of the measurement */
+
+/*
+ * Number of bytes to reserve for BD space for the number of BDs desired
+ */
+#define BD_SPACE_BYTES (XAxiDma_BdRingMemCalc(BD_ALIGNMENT, BD_CNT))
+
+/*************************** Variable Definitions ****************************/
+
+XAxiEthernet AxiEthernetInstance;
+XAxiDma DmaInstance;
+XAxiDma_FrameRing FrameRing;
+
+/*
+ * Aligned memory segments to be used for buffer descriptors
+ */
+char RxBdSpace[BD_SPACE_BYTES] __attribute__ ((aligned(BD_ALIGNMENT)));
+char TxBdSpace[BD_SPACE_BYTES] __attribute__ ((aligned(BD_ALIGNMENT)));
+
+/*
+ * Frame area shared by application and DMA, and the memory of its rings
+ */
+u8 FrameArea[FRAME_COUNT * FRAME_SIZE] __attribute__ ((aligned(FRAME_SIZE)));
+XAxiDma_FrDesc RingMem[XAXIDMA_FR_NUM_RINGS * RING_SIZE];
+
+volatile int Padding;	/* For 1588 Packets we need to pad 8 bytes time stamp value */
+volatile int ExternalLoopback; /* Variable for External loopback */
+
+/*************************** Function Prototypes *****************************/
+
+#ifndef SDT
+int AxiEthernetFrameRingExample(XAxiEthernet *AxiEthernetInstancePtr,
+				XAxiDma *DmaInstancePtr,
+				u16 AxiEthernetDeviceId,
+				u16 AxiDmaDeviceId);
+#else
+int AxiEthernetFrameRingExample(XAxiEthernet *AxiEthernetInstancePtr,
+				XAxiDma *DmaInstancePtr,
+				UINTPTR AxiEthernetBaseAddress);
+#endif
+static int FrameRingSetup(XAxiDma *DmaInstancePtr, XAxiDma_FrameRing *FrPtr);
+static int FrameRingInject(XAxiDma_FrameRing *FrPtr);
+static u32 FrameRingForward(XAxiDma_FrameRing *FrPtr);
+static void FrameRingRecycle(XAxiDma_FrameRing *FrPtr);
+
+/*****************************************************************************/
+/**
+*
+* This is the main function for the Axi Ethernet frame ring example. This
+* function is not included if the example is generated from the TestAppGen
+* test tool.
+*
+* @param	None.
+*
+* @return
+*		- XST_SUCCESS to indicate success.
+*		- XST_FAILURE to indicate failure
+*
+* @note		None.
+*
+****************************************************************************/
+#ifndef TESTAPP_GEN
+int main(void)
+{
+	int Status;
+
+	AxiEthernetUtilErrorTrap("\r\n--- Enter main() ---");
+#ifndef SDT
+	Status = AxiEthernetFrameRingExample(&AxiEthernetInstance,
+					     &DmaInstance,
+					     AXIETHERNET_DEVICE_ID,
+					     AXIDMA_DEVICE_ID);
+#else
+	Status = AxiEthernetFrameRingExample(&AxiEthernetInstance,
+					     &DmaInstance,
+					     XAXIETHERNET_BASEADDRESS);
+#endif
+	if (Status != XST_SUCCESS) {
+		AxiEthernetUtilErrorTrap("Axiethernet frame ring forwarder Example Failed\r\n");
+		AxiEthernetUtilErrorTrap("--- Exiting main() ---");
+		return XST_FAILURE;
+	}
+
+	AxiEthernetUtilErrorTrap("Successfully ran Axiethernet frame ring forwarder Example\r\n");
+	AxiEthernetUtilErrorTrap("--- Exiting main() ---");
+
+	return XST_SUCCESS;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* This function runs the L2 forwarder over the AXI DMA frame ring interface
+* with the Axi Ethernet PHY in loopback and prints the forwarding rate every
+* second.
+*
+* @param	AxiEthernetInstancePtr is a pointer to the instance of the
+*		AxiEthernet component.
+* @param	DmaInstancePtr is a pointer to the instance of the AXIDMA
+*		component.
+* @param	AxiEthernetDeviceId is Device ID of the Axi Ethernet Device ,
+*		typically XPAR_<AXIETHERNET_instance>_DEVICE_ID value from
+*		xparameters.h.
+* @param	AxiDmaDeviceId is Device ID of the Axi DMAA Device ,
+*		typically XPAR_<AXIDMA_instance>_DEVICE_ID value from
+*		xparameters.h.
+*
+* @return	-XST_SUCCESS to indicate success
+*		-XST_FAILURE to indicate failure
+*
+* @note		AxiDma hardware must be initialized before initializing
+*		AxiEthernet, see xaxiethernet_example_intr_sgdma.c.
+*
+******************************************************************************/
+#ifndef SDT
+int AxiEthernetFrameRingExample(XAxiEthernet *AxiEthernetInstancePtr,
+				XAxiDma *DmaInstancePtr,
+				u16 AxiEthernetDeviceId,
+				u16 AxiDmaDeviceId)
+#else
+int AxiEthernetFrameRingExample(XAxiEthernet *AxiEthernetInstancePtr,
+				XAxiDma *DmaInstancePtr,
+				UINTPTR AxiEthernetBaseAddress)
+#endif
+{
+	int Status;
+	int LoopbackSpeed;
+	XAxiEthernet_Config *MacCfgPtr;
+	XAxiDma_Config *DmaConfig;
+	XAxiDma_FrameRing *FrPtr = &FrameRing;
+	XTime Start, Now, Last;
+	u32 Forwarded = 0;
+	u32 Total = 0;
+	u32 Seconds = 0;
+#ifdef SDT
+	int AxiDevType;
+	UINTPTR AxiDmaBaseAddress;
+#endif
+
+	/*
+	 *  Get the configuration of AxiEthernet hardware.
+	 */
+#ifndef SDT
+	MacCfgPtr = XAxiEthernet_LookupConfig(AxiEthernetDeviceId);
+#else
+	MacCfgPtr = XAxiEthernet_LookupConfig(AxiEthernetBaseAddress);
+	AxiDevType = MacCfgPtr->AxiDevBaseAddress &
+					XAE_AXIDEVTYPE_MASK;
+	AxiDmaBaseAddress = MacCfgPtr->AxiDevBaseAddress &
+					XAE_AXIBASEADDR_MASK;
+#endif
+
+	/*
+	 * Check whether DMA is present or not
+	 */
+#ifndef SDT
+	if(MacCfgPtr->AxiDevType != XPAR_AXI_DMA) {
+#else
+	if(AxiDevType != XPAR_AXI_DMA) {
+#endif
+		AxiEthernetUtilErrorTrap
+			("Device HW not configured for SGDMA mode\r\n");
+		return XST_FAILURE;
+	}
+
+#ifndef SDT
+	DmaConfig = XAxiDma_LookupConfig(AxiDmaDeviceId);
+#else
+	DmaConfig = XAxiDma_LookupConfig(AxiDmaBaseAddress);
+#endif
+
+	/*
+	 * Initialize AXIDMA engine first, its reset also resets AxiEthernet.
+	 */
+	Status = XAxiDma_CfgInitialize(DmaInstancePtr, DmaConfig);
+	if(Status != XST_SUCCESS) {
+		AxiEthernetUtilErrorTrap("Error initializing DMA\r\n");
+		return XST_FAILURE;
+	}
+
+	Status = XAxiEthernet_CfgInitialize(AxiEthernetInstancePtr, MacCfgPtr,
+					MacCfgPtr->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		AxiEthernetUtilErrorTrap("Error in initialize");
+		return XST_FAILURE;
+	}
+
+	Status = XAxiEthernet_SetMacAddress(AxiEthernetInstancePtr,
+							AxiEthernetMAC);
+	if (Status != XST_SUCCESS) {
+		AxiEthernetUtilErrorTrap("Error setting MAC address");
+		return XST_FAILURE;
+	}
+
+#if defined(__aarch64__)
+	Xil_SetTlbAttributes((UINTPTR) TxBdSpace, NORM_NONCACHE | INNER_SHAREABLE);
+	Xil_SetTlbAttributes((UINTPTR) RxBdSpace, NORM_NONCACHE | INNER_SHAREABLE);
+#endif
+
+	Status = FrameRingSetup(DmaInstancePtr, FrPtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Set PHY to loopback, speed depends on phy type.
+	 * MII is 100 and all others are 1000.
+	 */
+#ifndef SDT
+	if (XAxiEthernet_GetPhysicalInterface(AxiEthernetInstancePtr) ==
+#else
+	if (XAxiEthernet_Get_Phy_Interface(AxiEthernetInstancePtr) ==
+#endif
+						XAE_PHY_TYPE_MII) {
+		LoopbackSpeed = AXIETHERNET_LOOPBACK_SPEED;
+	} else {
+		LoopbackSpeed = AXIETHERNET_LOOPBACK_SPEED_1G;
+	}
+	AxiEthernetUtilEnterLoopback(AxiEthernetInstancePtr, LoopbackSpeed);
+
+	/*
+	 * Set PHY<-->MAC data clock
+	 */
+	Status =  XAxiEthernet_SetOperatingSpeed(AxiEthernetInstancePtr,
+							(u16)LoopbackSpeed);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Setting the operating speed of the MAC needs a delay.
+	 */
+	AxiEthernetUtilPhyDelay(2);
+
+	Status = XAxiEthernet_SetOptions(AxiEthernetInstancePtr,
+				     XAE_RECEIVER_ENABLE_OPTION |
+				     XAE_TRANSMITTER_ENABLE_OPTION);
+	if (Status != XST_SUCCESS) {
+		AxiEthernetUtilErrorTrap("Error setting options");
+		return XST_FAILURE;
+	}
+
+	XAxiEthernet_Start(AxiEthernetInstancePtr);
+
+	Status = FrameRingInject(FrPtr);
+	if (Status != XST_SUCCESS) {
+		XAxiEthernet_Stop(AxiEthernetInstancePtr);
+		return XST_FAILURE;
+	}
+
+	XTime_GetTime(&Start);
+	Last = Start;
+	while (Seconds < RUN_SECONDS) {
+		(void)XAxiDma_FrPoll(FrPtr, POLL_BUDGET);
+		Forwarded += FrameRingForward(FrPtr);
+		FrameRingRecycle(FrPtr);
+
+		XTime_GetTime(&Now);
+		if ((Now - Last) >= COUNTS_PER_SECOND) {
+			Seconds++;
+			xil_printf("%d s: %d frames/s, rx errors %d, tx errors %d\r\n",
+				   Seconds, Forwarded,
+				   FrPtr->Stats.RxErrors, FrPtr->Stats.TxErrors);
+			Total += Forwarded;
+			Forwarded = 0;
+			Last = Now;
+		}
+	}
+
+	/*
+	 * Stop the device
+	 */
+	XAxiEthernet_Stop(AxiEthernetInstancePtr);
+
+	xil_printf("Forwarded %d frames, average %d frames/s\r\n",
+		   Total, Total / RUN_SECONDS);
+
+	/*
+	 * Frames are only lost on errors; any error or a stalled loop fails
+	 * the example.
+	 */
+	if ((Total == 0) || (FrPtr->Stats.RxErrors != 0) ||
+	    (FrPtr->Stats.TxErrors != 0)) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function creates and starts the BD rings of both channels with
+* interrupts disabled, sets up the frame ring set over them and gives the
+* frames not injected to the Fill ring.
+*
+* @param	DmaInstancePtr is a pointer to the instance of the AXIDMA
+*		component.
+* @param	FrPtr is the frame ring set to be set up.
+*
+* @return	-XST_SUCCESS to indicate success
+*		-XST_FAILURE to indicate failure
+*
+* @note		None.
+*
+******************************************************************************/
+static int FrameRingSetup(XAxiDma *DmaInstancePtr, XAxiDma_FrameRing *FrPtr)
+{
+	XAxiDma_BdRing *RxRingPtr = XAxiDma_GetRxRing(DmaInstancePtr);
+	XAxiDma_BdRing *TxRingPtr = XAxiDma_GetTxRing(DmaInstancePtr);
+	XAxiDma_Bd BdTemplate;
+	u32 Count, Pos, i;
+	int Status;
+
+	XAxiDma_BdRingIntDisable(RxRingPtr, XAXIDMA_IRQ_ALL_MASK);
+	XAxiDma_BdRingIntDisable(TxRingPtr, XAXIDMA_IRQ_ALL_MASK);
+
+	Status = XAxiDma_BdRingCreate(RxRingPtr, (UINTPTR) &RxBdSpace,
+				     (UINTPTR) &RxBdSpace, BD_ALIGNMENT, BD_CNT);
+	if (Status != XST_SUCCESS) {
+		AxiEthernetUtilErrorTrap("Error setting up RxBD space");
+		return XST_FAILURE;
+	}
+
+	Status = XAxiDma_BdRingCreate(TxRingPtr, (UINTPTR) &TxBdSpace,
+				(UINTPTR) &TxBdSpace, BD_ALIGNMENT, BD_CNT);
+	if (Status != XST_SUCCESS) {
+		AxiEthernetUtilErrorTrap("Error setting up TxBD space");
+		return XST_FAILURE;
+	}
+
+	XAxiDma_BdClear(&BdTemplate);
+	Status = XAxiDma_BdRingClone(RxRingPtr, &BdTemplate);
+	if (Status != XST_SUCCESS) {
+		AxiEthernetUtilErrorTrap("Error initializing RxBD space");
+		return XST_FAILURE;
+	}
+
+	Status = XAxiDma_BdRingClone(TxRingPtr, &BdTemplate);
+	if (Status != XST_SUCCESS) {
+		AxiEthernetUtilErrorTrap("Error initializing TxBD space");
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Start both channels with no BD posted, the frame ring set posts
+	 * BDs from XAxiDma_FrPoll()
+	 */
+	Status = XAxiDma_BdRingStart(RxRingPtr);
+	if (Status != XST_SUCCESS) {
+		AxiEthernetUtilErrorTrap("Error starting RxBD ring");
+		return XST_FAILURE;
+	}
+
+	Status = XAxiDma_BdRingStart(TxRingPtr);
+	if (Status != XST_SUCCESS) {
+		AxiEthernetUtilErrorTrap("Error starting TxBD ring");
+		return XST_FAILURE;
+	}
+
+	Status = XAxiDma_FrInitialize(FrPtr, DmaInstancePtr, (UINTPTR)FrameArea,
+				      FRAME_SIZE, FRAME_COUNT, RingMem,
+				      RING_SIZE);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Frame ring initialize failed with %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	/* Frames from INJECT_FRAMES on receive, the others are injected */
+	Count = XAxiDma_FrRingReserve(&FrPtr->Fill, FRAME_COUNT - INJECT_FRAMES,
+				      &Pos);
+	for (i = 0; i < Count; i++) {
+		XAxiDma_FrRingDesc(&FrPtr->Fill, Pos + i)->Idx = INJECT_FRAMES + i;
+	}
+	XAxiDma_FrRingSubmit(&FrPtr->Fill, Count);
+
+	/* Post the receive frames before anything is sent */
+	(void)XAxiDma_FrPoll(FrPtr, 0);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function builds INJECT_FRAMES minimum length frames addressed to the
+* local MAC in place and gives them to the TX ring.
+*
+* @param	FrPtr is the frame ring set to be worked on.
+*
+* @return	-XST_SUCCESS to indicate success
+*		-XST_FAILURE to indicate failure
+*
+* @note		None.
+*
+******************************************************************************/
+static int FrameRingInject(XAxiDma_FrameRing *FrPtr)
+{
+	XAxiDma_FrDesc *DescPtr;
+	EthernetFrame *FramePtr;
+	u32 Count, Pos, i;
+
+	Count = XAxiDma_FrRingReserve(&FrPtr->Tx, INJECT_FRAMES, &Pos);
+	if (Count != INJECT_FRAMES) {
+		return XST_FAILURE;
+	}
+
+	for (i = 0; i < Count; i++) {
+		/* Frames are FRAME_SIZE apart, only the header area is used */
+		FramePtr = (EthernetFrame *)XAxiDma_FrAddr(FrPtr, i);
+		AxiEthernetUtilFrameHdrFormatMAC(FramePtr, AxiEthernetMAC);
+		AxiEthernetUtilFrameHdrFormatType(FramePtr, FRAME_PAYLOAD);
+
+		DescPtr = XAxiDma_FrRingDesc(&FrPtr->Tx, Pos + i);
+		DescPtr->Idx = i;
+		DescPtr->Len = XAE_HDR_SIZE + FRAME_PAYLOAD;
+	}
+
+	return XAxiDma_FrTxSubmit(FrPtr, Count);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function forwards received frames: the MAC addresses of each frame
+* are swapped and its descriptor moves from the Rx ring to the Tx ring.
+*
+* @param	FrPtr is the frame ring set to be worked on.
+*
+* @return	The number of frames forwarded.
+*
+* @note		Frames that do not fit the Tx ring stay on the Rx ring until
+*		the next call.
+*
+******************************************************************************/
+static u32 FrameRingForward(XAxiDma_FrameRing *FrPtr)
+{
+	XAxiDma_FrDesc *RxDescPtr;
+	u32 RxPos, TxPos, Count, i, j;
+	u8 *Frame;
+	u8 Tmp;
+
+	Count = XAxiDma_FrRingPeek(&FrPtr->Rx, RING_SIZE, &RxPos);
+	Count = XAxiDma_FrRingReserve(&FrPtr->Tx, Count, &TxPos);
+
+	for (i = 0; i < Count; i++) {
+		RxDescPtr = XAxiDma_FrRingDesc(&FrPtr->Rx, RxPos + i);
+
+		Frame = (u8 *)XAxiDma_FrAddr(FrPtr, RxDescPtr->Idx);
+		for (j = 0; j < XAE_MAC_ADDR_SIZE; j++) {
+			Tmp = Frame[j];
+			Frame[j] = Frame[XAE_MAC_ADDR_SIZE + j];
+			Frame[XAE_MAC_ADDR_SIZE + j] = Tmp;
+		}
+
+		*XAxiDma_FrRingDesc(&FrPtr->Tx, TxPos + i) = *RxDescPtr;
+	}
+
+	XAxiDma_FrRingRelease(&FrPtr->Rx, Count);
+	/* Received frames always fit FrameSize, so they pass the check */
+	(void)XAxiDma_FrTxSubmit(FrPtr, Count);
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function gives the frames of the Comp ring back to the Fill ring.
+*
+* @param	FrPtr is the frame ring set to be worked on.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void FrameRingRecycle(XAxiDma_FrameRing *FrPtr)
+{
+	u32 CompPos, FillPos, Count, i;
+
+	Count = XAxiDma_FrRingPeek(&FrPtr->Comp, RING_SIZE, &CompPos);
+	Count = XAxiDma_FrRingReserve(&FrPtr->Fill, Count, &FillPos);
+
+	for (i = 0; i < Count; i++) {
+		XAxiDma_FrRingDesc(&FrPtr->Fill, FillPos + i)->Idx =
+			XAxiDma_FrRingDesc(&FrPtr->Comp, CompPos + i)->Idx;
+	}
+
+	XAxiDma_FrRingRelease(&FrPtr->Comp, Count);
+	XAxiDma_FrRingSubmit(&FrPtr->Fill, Count);
+}
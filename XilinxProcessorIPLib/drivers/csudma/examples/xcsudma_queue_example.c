@@ -0,0 +1,279 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+*
+* @file xcsudma_queue_example.c
+*
+* This file contains an example using the request queue of the XCsuDma
+* driver in polled mode.
+*
+* The buffer is split in chunks; all DST and SRC chunk transfers are queued
+* at once in loop back mode and the queue chains them, the example then waits
+* for the completion token of the last DST chunk and verifies the data.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.16  sb      10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xcsudma.h"
+#include "xparameters.h"
+
+/************************** Function Prototypes ******************************/
+
+/*
+ * The following constants map to the XPAR parameters created in the
+ * xparameters.h file. They are defined here such that a user can easily
+ * change all the needed parameters in one place.
+ */
+#ifndef SDT
+#define CSUDMA_DEVICE_ID 	XPAR_XCSUDMA_0_DEVICE_ID /* CSU DMA device Id */
+#else
+#define CSUDMA_BASEADDR		XPAR_XCSUDMA_0_BASEADDR /* CSU DMA Baseaddress */
+#endif
+#define CSU_SSS_CONFIG_OFFSET	0x008		/**< CSU SSS_CFG Offset */
+#define CSUDMA_LOOPBACK_CFG	0x00000050	/**< LOOP BACK configuration
+						  *  macro */
+#define PMC_SSS_CONFIG_OFFSET	0x500		/**< CSU SSS_CFG Offset */
+#define PMCDMA0_LOOPBACK_CFG	0x0000000D	/**< LOOP BACK configuration
+						  *  macro for PMCDMA0*/
+#define PMCDMA1_LOOPBACK_CFG	0x00000090	/**< LOOP BACK configuration
+						  *  macro for PMCDMA1*/
+
+#define SIZE		0x400			/**< Size of the data to be
+						  *  transfered */
+#define CHUNKS		4			/**< Number of queued chunks */
+#define CHUNK_SIZE	(SIZE / CHUNKS)		/**< Words per chunk */
+
+#if defined(__ICCARM__)
+#pragma data_alignment = 64
+u32 SrcBuf[SIZE]; /**< Source buffer */
+#pragma data_alignment = 64
+u32 DstBuf[SIZE]; /**< Destination buffer */
+#else
+u32 SrcBuf[SIZE] __attribute__ ((aligned (64)));	/**< Source buffer */
+u32 DstBuf[SIZE] __attribute__ ((aligned (64)));	/**< Destination buffer */
+#endif
+
+/**************************** Type Definitions *******************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+
+#ifndef SDT
+int XCsuDma_QueueExample(u16 DeviceId);
+#else
+int XCsuDma_QueueExample(UINTPTR BaseAddress);
+#endif
+static void ChunkDone(void *CallBackRef, XCsuDma_Req *ReqPtr);
+
+/************************** Variable Definitions *****************************/
+
+
+XCsuDma CsuDma;		/**<Instance of the Csu_Dma Device */
+XCsuDma_Req SrcReq[CHUNKS];	/**< Queued SRC transfers */
+XCsuDma_Req DstReq[CHUNKS];	/**< Queued DST transfers */
+volatile u32 ChunksDone;	/**< Completed DST chunks */
+
+/*****************************************************************************/
+/**
+*
+* Main function to call the example.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	int Status;
+
+	/* Run the queue example */
+#ifndef SDT
+	Status = XCsuDma_QueueExample((u16)CSUDMA_DEVICE_ID);
+#else
+	Status = XCsuDma_QueueExample(CSUDMA_BASEADDR);
+#endif
+	if (Status != XST_SUCCESS) {
+		xil_printf("CSU_DMA Queue Example Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran CSU_DMA Queue Example\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues the chunk transfers of a buffer in loop back mode,
+* waits for the last one and verifies the data.
+*
+* @param	DeviceId is the XPAR_<CSUDMA Instance>_DEVICE_ID value from
+*		xparameters.h.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None.
+*
+******************************************************************************/
+#ifndef SDT
+int XCsuDma_QueueExample(u16 DeviceId)
+#else
+int XCsuDma_QueueExample(UINTPTR BaseAddress)
+#endif
+{
+	int Status;
+	XCsuDma_Config *Config;
+	u32 Index = 0;
+	u32 Chunk;
+	u32 Test_Data = 0xABCD1234;
+
+	/*
+	 * Initialize the CsuDma driver so that it's ready to use
+	 * look up the configuration in the config table,
+	 * then initialize it.
+	 */
+#ifndef SDT
+	Config = XCsuDma_LookupConfig(DeviceId);
+#else
+	Config = XCsuDma_LookupConfig(BaseAddress);
+#endif
+	if (NULL == Config) {
+		return XST_FAILURE;
+	}
+
+	Status = XCsuDma_CfgInitialize(&CsuDma, Config, Config->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+#if defined (versal)
+	if (Config->DmaType != XCSUDMA_DMATYPEIS_CSUDMA) {
+		XCsuDma_PmcReset(Config->DmaType);
+	}
+#endif
+
+	/*
+	 * Setting CSU_DMA in loop back mode.
+	 */
+	if (Config->DmaType == XCSUDMA_DMATYPEIS_CSUDMA) {
+		Xil_Out32(XCSU_BASEADDRESS + CSU_SSS_CONFIG_OFFSET,
+			  ((Xil_In32(XCSU_BASEADDRESS + CSU_SSS_CONFIG_OFFSET) & 0xF0000) |
+			   CSUDMA_LOOPBACK_CFG));
+#if defined (versal)
+	} else if (Config->DmaType == XCSUDMA_DMATYPEIS_PMCDMA0) {
+		Xil_Out32(XPS_PMC_GLOBAL_BASEADDRESS + PMC_SSS_CONFIG_OFFSET,
+			  ((Xil_In32(XPS_PMC_GLOBAL_BASEADDRESS + PMC_SSS_CONFIG_OFFSET) & 0xFF000000) |
+			   PMCDMA0_LOOPBACK_CFG));
+	} else {
+		Xil_Out32(XPS_PMC_GLOBAL_BASEADDRESS + PMC_SSS_CONFIG_OFFSET,
+			  ((Xil_In32(XPS_PMC_GLOBAL_BASEADDRESS + PMC_SSS_CONFIG_OFFSET) & 0xFF000000) |
+			   PMCDMA1_LOOPBACK_CFG));
+#endif
+	}
+
+	/* Data writing at source address location */
+	for (Index = 0; Index < SIZE; Index++) {
+		SrcBuf[Index] = Test_Data;
+		DstBuf[Index] = 0;
+		Test_Data += 0x1;
+	}
+
+	/*
+	 * Queue every chunk on both channels, the queue programs the next
+	 * chunk when the previous one is done
+	 */
+	ChunksDone = 0;
+	for (Chunk = 0; Chunk < CHUNKS; Chunk++) {
+		DstReq[Chunk].Addr = (UINTPTR)&DstBuf[Chunk * CHUNK_SIZE];
+		DstReq[Chunk].Size = CHUNK_SIZE;
+		DstReq[Chunk].EnDataLast = 0;
+		DstReq[Chunk].Handler = ChunkDone;
+		DstReq[Chunk].CallBackRef = NULL;
+		(void)XCsuDma_QueueSubmit(&CsuDma, XCSUDMA_DST_CHANNEL, &DstReq[Chunk]);
+
+		SrcReq[Chunk].Addr = (UINTPTR)&SrcBuf[Chunk * CHUNK_SIZE];
+		SrcReq[Chunk].Size = CHUNK_SIZE;
+		SrcReq[Chunk].EnDataLast = 0;
+		SrcReq[Chunk].Handler = NULL;
+		SrcReq[Chunk].CallBackRef = NULL;
+		(void)XCsuDma_QueueSubmit(&CsuDma, XCSUDMA_SRC_CHANNEL, &SrcReq[Chunk]);
+	}
+
+	/*
+	 * Both channels advance independently, wait for the last chunk of
+	 * each of them
+	 */
+	while ((XCsuDma_QueueIsDone(&CsuDma, XCSUDMA_SRC_CHANNEL,
+				    SrcReq[CHUNKS - 1].Token) == FALSE) ||
+	       (XCsuDma_QueueIsDone(&CsuDma, XCSUDMA_DST_CHANNEL,
+				    DstReq[CHUNKS - 1].Token) == FALSE)) {
+		(void)XCsuDma_QueueProcess(&CsuDma, XCSUDMA_SRC_CHANNEL);
+		(void)XCsuDma_QueueProcess(&CsuDma, XCSUDMA_DST_CHANNEL);
+	}
+
+	if (ChunksDone != CHUNKS) {
+		return XST_FAILURE;
+	}
+
+	/* Cache Operations after transfer completion
+	 * No action required for PSU_PMU.
+	 * Perform cache operations on ARM64 and R5
+	 */
+#if defined(ARMR52)
+	Xil_DCacheInvalidateRange((INTPTR)DstBuf, SIZE * 4);
+#elif defined(ARMR5)
+	Xil_DCacheFlushRange((INTPTR)DstBuf, SIZE * 4);
+#endif
+#if defined(__aarch64__)
+	Xil_DCacheInvalidateRange((INTPTR)DstBuf, SIZE * 4);
+#endif
+
+	for (Index = 0; Index < SIZE; Index++) {
+		if (SrcBuf[Index] != DstBuf[Index]) {
+			return XST_FAILURE;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Completion callback of the DST chunks, counts the completed chunks.
+*
+* @param	CallBackRef is the callback reference, unused.
+* @param	ReqPtr is the completed request.
+*
+* @return	None.
+*
+******************************************************************************/
+static void ChunkDone(void *CallBackRef, XCsuDma_Req *ReqPtr)
+{
+	(void)CallBackRef;
+	(void)ReqPtr;
+
+	ChunksDone++;
+}
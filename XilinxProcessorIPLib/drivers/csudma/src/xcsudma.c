@@ -44,6 +44,7 @@
 * 1.14	ab	01/16/23 Added Xil_WaitForEvent() to XcsuDma_WaitForDoneTimeout.
 * 1.14	ab	01/18/23 Added byte-aligned transfer API for VERSAL_NET devices.
 * 1.14	bm	05/01/23 Fixed Assert condition in XCsuDma_Transfer for VERSAL_NET.
+* 1.16	sb	10/19/26 Initialize the request queues in XCsuDma_CfgInitialize.
 * </pre>
 *
 ******************************************************************************/
@@ -98,6 +99,7 @@ s32 XCsuDma_CfgInitialize(XCsuDma *InstancePtr, XCsuDma_Config *CfgPtr,
 	(void)memcpy((void *) & (InstancePtr->Config), (const void *)CfgPtr,
 		     sizeof(XCsuDma_Config));
 	InstancePtr->Config.BaseAddress = EffectiveAddr;
+	(void)memset((void *)InstancePtr->Queue, 0, sizeof(InstancePtr->Queue));
 
 	/* Verify the DMA type  */
 	if (InstancePtr->Config.DmaType == (u8)XCSUDMA_DMATYPEIS_CSUDMA) {
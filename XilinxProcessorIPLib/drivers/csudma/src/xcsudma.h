@@ -49,6 +49,8 @@
 * 1.14	ab	01/16/23 Added Xil_PlmStubHandler() to XCsuDma_WaitForDone.
 * 1.14	ab	01/18/23 Added byte-aligned transfer API for VERSAL_NET devices.
 * 1.14  adk     04/14/23 Added support for system device-tree flow.
+* 1.16  sb      10/19/26 Added per channel request queue with completion
+*                        tokens, chained from the done interrupt.
 * </pre>
 *
 ******************************************************************************/
@@ -299,6 +301,40 @@ typedef enum {
 
 /**************************** Type Definitions *******************************/
 
+typedef struct XCsuDma_Req XCsuDma_Req;
+
+/**
+* Completion callback of a queued request. It is invoked from
+* XCsuDma_QueueProcess(), normally in the context of the DMA interrupt, after
+* the next queued request of the channel has been started.
+*/
+typedef void (*XCsuDma_ReqHandler)(void *CallBackRef, XCsuDma_Req *ReqPtr);
+
+/**
+* This typedef describes one queued transfer of a channel. The request and
+* its buffer are owned by the caller and must stay valid until the request
+* completes.
+*/
+struct XCsuDma_Req {
+	u64 Addr;		/**< Memory address, as in XCsuDma_Transfer */
+	u32 Size;		/**< Size, as in XCsuDma_Transfer */
+	u8 EnDataLast;		/**< Asserts data_inp_last at the end, SRC only */
+	XCsuDma_ReqHandler Handler;	/**< Completion callback, may be NULL */
+	void *CallBackRef;	/**< Argument passed to the callback */
+	u32 Token;		/**< Completion token, set on submit */
+	XCsuDma_Req *Next;	/**< Queue link, maintained by the driver */
+};
+
+/**
+* Request queue of one channel.
+*/
+typedef struct {
+	XCsuDma_Req *Head;	/**< Transfer in progress */
+	XCsuDma_Req *Tail;	/**< Last queued request */
+	u32 NextToken;		/**< Token of the next submitted request */
+	volatile u32 DoneToken;	/**< Token of the last completed request */
+} XCsuDma_Queue;
+
 /**
 * This typedef contains configuration information for a CSU_DMA core.
 * Each CSU_DMA core should have an associated configuration structure.
@@ -336,6 +372,8 @@ typedef struct {
 	XCsuDma_Config Config;		/**< Hardware configuration */
 	u32 IsReady;			/**< Device and the driver instance
 					  *  are initialized */
+	XCsuDma_Queue Queue[2];		/**< Request queue of the SRC and DST
+					  *  channels */
 }XCsuDma;
 
 
@@ -421,6 +459,16 @@ u32 XCsuDma_GetIntrMask(XCsuDma *InstancePtr, XCsuDma_Channel Channel);
 
 s32 XCsuDma_SelfTest(XCsuDma *InstancePtr);
 
+/* Request queue APIs */
+s32 XCsuDma_QueueSubmit(XCsuDma *InstancePtr, XCsuDma_Channel Channel,
+			XCsuDma_Req *ReqPtr);
+u32 XCsuDma_QueueProcess(XCsuDma *InstancePtr, XCsuDma_Channel Channel);
+void XCsuDma_QueueIntrHandler(void *CallBackRef);
+s32 XCsuDma_QueueIsDone(XCsuDma *InstancePtr, XCsuDma_Channel Channel,
+			u32 Token);
+s32 XCsuDma_QueueWait(XCsuDma *InstancePtr, XCsuDma_Channel Channel,
+			u32 Token);
+
 /******************************************************************************/
 
 #ifdef __cplusplus
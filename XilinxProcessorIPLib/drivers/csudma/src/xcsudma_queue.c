@@ -0,0 +1,300 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+*
+* @file xcsudma_queue.c
+* @addtogroup csuma_api CSUDMA APIs
+* @{
+*
+* The xcsudma_queue.c file contains the request queue of the CSU_DMA/PMC_DMA
+* driver.
+*
+* Each channel owns a software queue of caller allocated requests. The
+* first request is programmed as soon as it is submitted; the others wait in
+* the queue and are programmed by XCsuDma_QueueProcess() when the done event
+* of the previous one is seen, which is normally done from the DMA interrupt
+* through XCsuDma_QueueIntrHandler(). The SRC and DST channels are queued
+* independently, so a SRC channel feeding the SHA engine and a DST channel
+* draining the AES engine keep running while the processor works on
+* something else. Every request gets a completion token that can be polled
+* with XCsuDma_QueueIsDone() or waited for with XCsuDma_QueueWait().
+*
+* A channel that uses the queue must not be programmed with
+* XCsuDma_Transfer() while requests are pending on it. In polled mode,
+* XCsuDma_QueueWait() or XCsuDma_QueueProcess() must be called to advance
+* the queue.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ---------------------------------------------------
+* 1.16  sb     10/19/26  First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xcsudma.h"
+
+/************************** Function Prototypes ******************************/
+
+static void XCsuDma_QueueStart(XCsuDma *InstancePtr, XCsuDma_Channel Channel,
+			       const XCsuDma_Req *ReqPtr);
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function queues a transfer on a channel. The transfer is programmed
+* right away if the channel queue is empty, otherwise it is programmed when
+* the transfers queued before it are done.
+*
+* @param	InstancePtr Pointer to XCsuDma instance to be worked on.
+* @param	Channel Type of channel
+*		Source channel      - XCSUDMA_SRC_CHANNEL
+*		Destination Channel - XCSUDMA_DST_CHANNEL
+* @param	ReqPtr Pointer to the request. Addr, Size, EnDataLast, Handler
+*		and CallBackRef must be filled by the caller; Token is set by
+*		this function.
+*
+* @return
+*		- XST_SUCCESS if the request is queued.
+*
+* @note		The done interrupt of the channel is masked while the queue is
+*		updated, so this function can be called while the queue is
+*		processed from the interrupt handler.
+*
+******************************************************************************/
+s32 XCsuDma_QueueSubmit(XCsuDma *InstancePtr, XCsuDma_Channel Channel,
+			XCsuDma_Req *ReqPtr)
+{
+	XCsuDma_Queue *QueuePtr;
+	u32 IntrEnabled;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((Channel == (XCSUDMA_SRC_CHANNEL)) ||
+			  (Channel == (XCSUDMA_DST_CHANNEL)));
+	Xil_AssertNonvoid(ReqPtr != NULL);
+	Xil_AssertNonvoid(ReqPtr->Size <= (u32)(XCSUDMA_SIZE_MAX));
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)(XIL_COMPONENT_IS_READY));
+
+	QueuePtr = &InstancePtr->Queue[Channel];
+
+	IntrEnabled = ~XCsuDma_GetIntrMask(InstancePtr, Channel) &
+		      (u32)(XCSUDMA_IXR_DONE_MASK);
+	XCsuDma_DisableIntr(InstancePtr, Channel, XCSUDMA_IXR_DONE_MASK);
+
+	QueuePtr->NextToken++;
+	ReqPtr->Token = QueuePtr->NextToken;
+	ReqPtr->Next = NULL;
+
+	if (QueuePtr->Head == NULL) {
+		QueuePtr->Head = ReqPtr;
+		QueuePtr->Tail = ReqPtr;
+		/* Drop a done event left by an earlier transfer */
+		XCsuDma_IntrClear(InstancePtr, Channel, XCSUDMA_IXR_DONE_MASK);
+		XCsuDma_QueueStart(InstancePtr, Channel, ReqPtr);
+	} else {
+		QueuePtr->Tail->Next = ReqPtr;
+		QueuePtr->Tail = ReqPtr;
+	}
+
+	if (IntrEnabled != 0U) {
+		XCsuDma_EnableIntr(InstancePtr, Channel, XCSUDMA_IXR_DONE_MASK);
+	}
+
+	return (s32)(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function retires the transfer in progress on a channel if it is done:
+* it programs the next queued transfer, then updates the completion token
+* and invokes the completion callback of the retired request.
+*
+* @param	InstancePtr Pointer to XCsuDma instance to be worked on.
+* @param	Channel Type of channel
+*		Source channel      - XCSUDMA_SRC_CHANNEL
+*		Destination Channel - XCSUDMA_DST_CHANNEL
+*
+* @return	Number of retired requests, 0 or 1.
+*
+* @note		Other interrupt events of the channel are left pending for the
+*		application.
+*
+******************************************************************************/
+u32 XCsuDma_QueueProcess(XCsuDma *InstancePtr, XCsuDma_Channel Channel)
+{
+	XCsuDma_Queue *QueuePtr;
+	XCsuDma_Req *ReqPtr;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((Channel == (XCSUDMA_SRC_CHANNEL)) ||
+			  (Channel == (XCSUDMA_DST_CHANNEL)));
+
+	QueuePtr = &InstancePtr->Queue[Channel];
+	ReqPtr = QueuePtr->Head;
+	if (ReqPtr == NULL) {
+		return 0U;
+	}
+
+	if ((XCsuDma_IntrGetStatus(InstancePtr, Channel) &
+	     (u32)(XCSUDMA_IXR_DONE_MASK)) == 0U) {
+		return 0U;
+	}
+	XCsuDma_IntrClear(InstancePtr, Channel, XCSUDMA_IXR_DONE_MASK);
+
+	/* Keep the channel busy before running the callback */
+	QueuePtr->Head = ReqPtr->Next;
+	if (QueuePtr->Head != NULL) {
+		XCsuDma_QueueStart(InstancePtr, Channel, QueuePtr->Head);
+	} else {
+		QueuePtr->Tail = NULL;
+	}
+
+	ReqPtr->Next = NULL;
+	QueuePtr->DoneToken = ReqPtr->Token;
+	if (ReqPtr->Handler != NULL) {
+		ReqPtr->Handler(ReqPtr->CallBackRef, ReqPtr);
+	}
+
+	return 1U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the interrupt handler of the request queues. It retires
+* the done transfers of both channels and chains the next ones. It can be
+* connected to the DMA interrupt directly with the XCsuDma instance as
+* callback reference, or called from the application handler.
+*
+* @param	CallBackRef Pointer to the XCsuDma instance.
+*
+* @return	None.
+*
+* @note		The done interrupt of the channels using the queue must be
+*		enabled with XCsuDma_EnableIntr().
+*
+******************************************************************************/
+void XCsuDma_QueueIntrHandler(void *CallBackRef)
+{
+	XCsuDma *InstancePtr = (XCsuDma *)CallBackRef;
+
+	/* Verify arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == (u32)(XIL_COMPONENT_IS_READY));
+
+	(void)XCsuDma_QueueProcess(InstancePtr, XCSUDMA_SRC_CHANNEL);
+	(void)XCsuDma_QueueProcess(InstancePtr, XCSUDMA_DST_CHANNEL);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks whether a queued request has completed.
+*
+* @param	InstancePtr Pointer to XCsuDma instance to be worked on.
+* @param	Channel Type of channel
+*		Source channel      - XCSUDMA_SRC_CHANNEL
+*		Destination Channel - XCSUDMA_DST_CHANNEL
+* @param	Token Completion token returned in the request by
+*		XCsuDma_QueueSubmit().
+*
+* @return
+*		- TRUE if the request and all requests queued before it on
+*		the channel have completed.
+*		- FALSE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XCsuDma_QueueIsDone(XCsuDma *InstancePtr, XCsuDma_Channel Channel,
+			u32 Token)
+{
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((Channel == (XCSUDMA_SRC_CHANNEL)) ||
+			  (Channel == (XCSUDMA_DST_CHANNEL)));
+
+	/* Tokens are increasing modulo 2^32 */
+	return ((s32)(InstancePtr->Queue[Channel].DoneToken - Token) >= 0) ?
+	       (s32)TRUE : (s32)FALSE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function waits until a queued request has completed, advancing the
+* queue in polled mode.
+*
+* @param	InstancePtr Pointer to XCsuDma instance to be worked on.
+* @param	Channel Type of channel
+*		Source channel      - XCSUDMA_SRC_CHANNEL
+*		Destination Channel - XCSUDMA_DST_CHANNEL
+* @param	Token Completion token returned in the request by
+*		XCsuDma_QueueSubmit().
+*
+* @return
+*		- XST_SUCCESS if the request has completed.
+*
+* @note		When the done interrupt of the channel is enabled the queue is
+*		left to the interrupt handler and this function only waits.
+*
+******************************************************************************/
+s32 XCsuDma_QueueWait(XCsuDma *InstancePtr, XCsuDma_Channel Channel,
+		      u32 Token)
+{
+	u32 IntrEnabled;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((Channel == (XCSUDMA_SRC_CHANNEL)) ||
+			  (Channel == (XCSUDMA_DST_CHANNEL)));
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)(XIL_COMPONENT_IS_READY));
+
+	IntrEnabled = ~XCsuDma_GetIntrMask(InstancePtr, Channel) &
+		      (u32)(XCSUDMA_IXR_DONE_MASK);
+
+	while (XCsuDma_QueueIsDone(InstancePtr, Channel, Token) == (s32)FALSE) {
+		if (IntrEnabled == 0U) {
+			(void)XCsuDma_QueueProcess(InstancePtr, Channel);
+		}
+#ifdef VERSAL_PLM
+		Xil_PlmStubHandler();
+#endif
+	}
+
+	return (s32)(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function programs a queued request on a channel.
+*
+* @param	InstancePtr Pointer to XCsuDma instance to be worked on.
+* @param	Channel Type of channel
+* @param	ReqPtr Pointer to the request.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XCsuDma_QueueStart(XCsuDma *InstancePtr, XCsuDma_Channel Channel,
+			       const XCsuDma_Req *ReqPtr)
+{
+	XCsuDma_Transfer(InstancePtr, Channel, ReqPtr->Addr, ReqPtr->Size,
+			 ReqPtr->EnDataLast);
+}
+/** @} */
@@ -310,6 +310,10 @@
  * 3.9   hk   01/23/19 Add RX watermark support
  * 3.11  sd   02/14/20 Add clock support
  * 3.13  nsk  12/14/20 Updated the tcl to not to use the instance names.
+ * 3.21  sb   10/19/26 Add extended BD timestamping and timestamp unit
+ *                     functions in xemacps_ptp.c.
+ * 3.21  sb   10/19/26 Add XEmacPs_SetIntrModeration() and
+ *                     XEmacPs_GetIntrModeration().
  *
  * </pre>
  *
@@ -505,6 +509,15 @@ typedef void (*XEmacPs_ErrHandler) (void *CallBackRef, u8 Direction,
 
 /*@}*/
 
+/**
+ * Time of the IEEE 1588 timestamp unit (TSU), and of timestamps captured in
+ * extended BDs.
+ */
+typedef struct {
+	u64 Seconds;		/**< Seconds, 48 bits on GEM versions above 2 */
+	u32 NanoSeconds;	/**< Nanoseconds, below 10^9 */
+} XEmacPs_TsuTime;
+
 /**
  * This typedef contains configuration information for a device.
  */
@@ -876,6 +889,20 @@ LONG XEmacPs_SetTypeIdCheck(XEmacPs *InstancePtr, u32 Id_Check, u8 Index);
 
 LONG XEmacPs_SendPausePacket(XEmacPs *InstancePtr);
 void XEmacPs_DMABLengthUpdate(XEmacPs *InstancePtr, s32 BLength);
+LONG XEmacPs_SetIntrModeration(XEmacPs *InstancePtr, u32 Direction, u32 Units);
+u32 XEmacPs_GetIntrModeration(XEmacPs *InstancePtr, u32 Direction);
+
+/*
+ * IEEE 1588 timestamping functions in xemacps_ptp.c
+ */
+LONG XEmacPs_SetTimestampMode(XEmacPs *InstancePtr, u32 TxMode, u32 RxMode);
+void XEmacPs_GetTsuTime(XEmacPs *InstancePtr, XEmacPs_TsuTime *TimePtr);
+void XEmacPs_SetTsuTime(XEmacPs *InstancePtr, const XEmacPs_TsuTime *TimePtr);
+void XEmacPs_AdjustTsuTime(XEmacPs *InstancePtr, s32 NanoSeconds);
+void XEmacPs_SetTsuIncrement(XEmacPs *InstancePtr, u32 NanoSeconds,
+			     u32 SubNanoSeconds);
+void XEmacPs_BdGetTimestamp(XEmacPs_Bd *BdPtr, const XEmacPs_TsuTime *NowPtr,
+			    XEmacPs_TsuTime *TimePtr);
 
 #ifdef __cplusplus
 }
@@ -47,6 +47,7 @@
  * 3.8   hk   08/18/18 Remove duplicate definition of XEmacPs_BdSetLength
  * 3.8   mus  11/05/18 Support 64 bit DMA addresses for Microblaze-X platform.
  * 3.9   aj   22/03/24 Add mask for XEmaPs_BdGetBufAddr
+ * 3.21  sb   10/19/26 Add extended BD timestamp accessors.
  *
  * </pre>
  *
@@ -84,6 +85,18 @@ extern "C" {
  */
 typedef u32 XEmacPs_Bd[XEMACPS_BD_NUM_WORDS];
 
+/*
+ * In extended BD mode every BD is followed by two timestamp words, which the
+ * hardware fills in when it captures a timestamp for the frame. Rings of
+ * such BDs are created with XEmacPs_BdRingCreateExt().
+ */
+#define XEMACPS_BD_TS_LO_OFFSET	((u32)sizeof(XEmacPs_Bd))
+					/**< Timestamp word 0 of an extended BD */
+#define XEMACPS_BD_TS_HI_OFFSET	((u32)sizeof(XEmacPs_Bd) + 4U)
+					/**< Timestamp word 1 of an extended BD */
+#define XEMACPS_BD_EXT_SIZE	((u32)sizeof(XEmacPs_Bd) + 8U)
+					/**< Size of an extended BD */
+
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
@@ -754,6 +767,63 @@ typedef u32 XEmacPs_Bd[XEMACPS_BD_NUM_WORDS];
     XEMACPS_RXBUF_SOF_MASK)!=0U ? TRUE : FALSE)
 
 
+/*****************************************************************************/
+/**
+ * Determine whether the hardware captured a timestamp in the given TX BD.
+ * The timestamp is written to the first BD of a frame. Only valid for rings
+ * created with XEmacPs_BdRingCreateExt().
+ *
+ * @param  BdPtr is the BD pointer to operate on
+ *
+ * @note
+ * C-style signature:
+ *    u32 XEmacPs_BdIsTxTs(XEmacPs_Bd* BdPtr)
+ *
+ *****************************************************************************/
+#define XEmacPs_BdIsTxTs(BdPtr)                                    \
+    ((XEmacPs_BdRead((BdPtr), XEMACPS_BD_STAT_OFFSET) &           \
+    XEMACPS_TXBUF_TS_MASK)!=0U ? TRUE : FALSE)
+
+
+/*****************************************************************************/
+/**
+ * Determine whether the hardware captured a timestamp in the given RX BD.
+ * Only valid for rings created with XEmacPs_BdRingCreateExt().
+ *
+ * @param  BdPtr is the BD pointer to operate on
+ *
+ * @note
+ * C-style signature:
+ *    u32 XEmacPs_BdIsRxTs(XEmacPs_Bd* BdPtr)
+ *
+ *****************************************************************************/
+#define XEmacPs_BdIsRxTs(BdPtr)                                    \
+    ((XEmacPs_BdRead((BdPtr), XEMACPS_BD_ADDR_OFFSET) &           \
+    XEMACPS_RXBUF_TS_MASK)!=0U ? TRUE : FALSE)
+
+
+/*****************************************************************************/
+/**
+ * Retrieve the timestamp words of an extended BD. They hold the nanoseconds
+ * and the 6 least significant bits of the seconds of the timestamp unit when
+ * the frame was sent or received. XEmacPs_BdGetTimestamp() converts them
+ * into a full timestamp.
+ *
+ * @param  BdPtr is the BD pointer to operate on
+ *
+ * @note
+ * C-style signatures:
+ *    u32 XEmacPs_BdGetTsLo(XEmacPs_Bd* BdPtr)
+ *    u32 XEmacPs_BdGetTsHi(XEmacPs_Bd* BdPtr)
+ *
+ *****************************************************************************/
+#define XEmacPs_BdGetTsLo(BdPtr)                                   \
+    XEmacPs_BdRead((BdPtr), XEMACPS_BD_TS_LO_OFFSET)
+
+#define XEmacPs_BdGetTsHi(BdPtr)                                   \
+    XEmacPs_BdRead((BdPtr), XEMACPS_BD_TS_HI_OFFSET)
+
+
 /************************** Function Prototypes ******************************/
 
 #ifdef __cplusplus
@@ -34,6 +34,7 @@
 * 3.0   kvn  02/13/15 Modified code for MISRA-C:2012 compliance.
 * 3.6   rb   09/08/17 Add XEmacPs_BdRingPtrReset() API to reset BD ring
 * 		      pointers
+* 3.21  sb   10/19/26 Add XEmacPs_BdRingCreateExt() for extended BD rings
 *
 * </pre>
 ******************************************************************************/
@@ -138,6 +139,9 @@
 
 static void XEmacPs_BdSetRxWrap(UINTPTR BdPtr);
 static void XEmacPs_BdSetTxWrap(UINTPTR BdPtr);
+static LONG XEmacPs_BdRingSetup(XEmacPs_BdRing * RingPtr, UINTPTR PhysAddr,
+				UINTPTR VirtAddr, u32 Alignment, u32 BdCount,
+				u32 Separation);
 
 /************************** Variable Definitions *****************************/
 
@@ -176,6 +180,45 @@ static void XEmacPs_BdSetTxWrap(UINTPTR BdPtr);
  *****************************************************************************/
 LONG XEmacPs_BdRingCreate(XEmacPs_BdRing * RingPtr, UINTPTR PhysAddr,
 			  UINTPTR VirtAddr, u32 Alignment, u32 BdCount)
+{
+	return XEmacPs_BdRingSetup(RingPtr, PhysAddr, VirtAddr, Alignment,
+				   BdCount, (u32)sizeof(XEmacPs_Bd));
+}
+
+/*****************************************************************************/
+/**
+ * Same as XEmacPs_BdRingCreate(), but creates a ring of extended BDs. Each
+ * BD is followed by two words the hardware writes the frame timestamp to,
+ * so the memory region must hold XEmacPs_BdRingExtMemCalc() bytes.
+ *
+ * The ring must be used with extended BD mode enabled for its direction,
+ * see XEmacPs_SetTimestampMode().
+ *
+ * @param RingPtr is the instance to be worked on.
+ * @param PhysAddr is the physical base address of user memory region.
+ * @param VirtAddr is the virtual base address of the user memory region.
+ * @param Alignment governs the byte alignment of individual BDs.
+ * @param BdCount is the number of BDs to setup in the user memory region.
+ *
+ * @return Same as XEmacPs_BdRingCreate().
+ *
+ *****************************************************************************/
+LONG XEmacPs_BdRingCreateExt(XEmacPs_BdRing * RingPtr, UINTPTR PhysAddr,
+			     UINTPTR VirtAddr, u32 Alignment, u32 BdCount)
+{
+	return XEmacPs_BdRingSetup(RingPtr, PhysAddr, VirtAddr, Alignment,
+				   BdCount, XEMACPS_BD_EXT_SIZE);
+}
+
+/*****************************************************************************/
+/**
+ * Create and setup a BD list of BDs that are Separation bytes apart, see
+ * XEmacPs_BdRingCreate().
+ *
+ *****************************************************************************/
+static LONG XEmacPs_BdRingSetup(XEmacPs_BdRing * RingPtr, UINTPTR PhysAddr,
+				UINTPTR VirtAddr, u32 Alignment, u32 BdCount,
+				u32 Separation)
 {
 	u32 i;
 	UINTPTR BdVirtAddr;
@@ -213,7 +256,7 @@ LONG XEmacPs_BdRingCreate(XEmacPs_BdRing * RingPtr, UINTPTR PhysAddr,
 	}
 
 	/* Figure out how many bytes will be between the start of adjacent BDs */
-	RingPtr->Separation = ((u32)sizeof(XEmacPs_Bd));
+	RingPtr->Separation = Separation;
 
 	/* Must make sure the ring doesn't span address 0x00000000. If it does,
 	 * then the next/prev BD traversal macros will fail.
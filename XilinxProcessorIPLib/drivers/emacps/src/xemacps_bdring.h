@@ -24,6 +24,7 @@
 * 3.0   kvn  02/13/15 Modified code for MISRA-C:2012 compliance.
 * 3.6   rb   09/08/17 HwCnt variable (in XEmacPs_BdRing structure) is
 *		      changed to volatile.
+* 3.21  sb   10/19/26 Add extended BD ring create and memory size macros.
 *
 * </pre>
 *
@@ -110,6 +111,23 @@ typedef struct {
 #define XEmacPs_BdRingMemCalc(Alignment, NumBd)                    \
     (u32)(sizeof(XEmacPs_Bd) * (NumBd))
 
+/*****************************************************************************/
+/**
+* Same as XEmacPs_BdRingCntCalc() and XEmacPs_BdRingMemCalc(), for rings
+* created with XEmacPs_BdRingCreateExt().
+*
+* @note
+* C-style signatures:
+*    u32 XEmacPs_BdRingExtCntCalc(u32 Alignment, u32 Bytes)
+*    u32 XEmacPs_BdRingExtMemCalc(u32 Alignment, u32 NumBd)
+*
+******************************************************************************/
+#define XEmacPs_BdRingExtCntCalc(Alignment, Bytes)                 \
+    (u32)((Bytes) / XEMACPS_BD_EXT_SIZE)
+
+#define XEmacPs_BdRingExtMemCalc(Alignment, NumBd)                 \
+    (u32)(XEMACPS_BD_EXT_SIZE * (NumBd))
+
 /****************************************************************************/
 /**
 * Return the total number of BDs allocated by this channel with
@@ -189,6 +207,8 @@ typedef struct {
  */
 LONG XEmacPs_BdRingCreate(XEmacPs_BdRing * RingPtr, UINTPTR PhysAddr,
 			  UINTPTR VirtAddr, u32 Alignment, u32 BdCount);
+LONG XEmacPs_BdRingCreateExt(XEmacPs_BdRing * RingPtr, UINTPTR PhysAddr,
+			     UINTPTR VirtAddr, u32 Alignment, u32 BdCount);
 LONG XEmacPs_BdRingClone(XEmacPs_BdRing * RingPtr, XEmacPs_Bd * SrcBdPtr,
 			 u8 Direction);
 LONG XEmacPs_BdRingAlloc(XEmacPs_BdRing * RingPtr, u32 NumBd,
@@ -27,6 +27,7 @@
  * 3.0   kvn  02/13/15 Modified code for MISRA-C:2012 compliance.
  * 3.0   hk   02/20/15 Added support for jumbo frames.
  * 3.2   hk   02/22/16 Added SGMII support for Zynq Ultrascale+ MPSoC.
+ * 3.21  sb   10/19/26 Added APIs to set and get the interrupt moderation.
  * </pre>
  *****************************************************************************/
 
@@ -1131,4 +1132,87 @@ void XEmacPs_DMABLengthUpdate(XEmacPs *InstancePtr, s32 BLength)
 	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress, XEMACPS_DMACR_OFFSET,
 																	Reg);
 }
+
+/*****************************************************************************/
+/**
+* Set the interrupt moderation time of a direction. After a frame has been
+* received or sent, the GEM holds the receive complete or transmit complete
+* interrupt of that direction until the moderation time has passed, so that
+* the frames completing meanwhile are reported by one interrupt. The time can
+* be changed while the device is started.
+*
+* @param InstancePtr is a pointer to the XEmacPs instance to be worked on.
+* @param Direction is XEMACPS_SEND or XEMACPS_RECV.
+* @param Units is the moderation time in units of 800 ns at 1 Gb/s, 8 us at
+*        100 Mb/s and 80 us at 10 Mb/s, at most XEMACPS_INTMOD_MAX. 0
+*        disables moderation.
+*
+* @return
+* - XST_SUCCESS if the moderation time was set.
+* - XST_NO_FEATURE if the GEM has no interrupt moderation (Zynq).
+*
+******************************************************************************/
+LONG XEmacPs_SetIntrModeration(XEmacPs *InstancePtr, u32 Direction, u32 Units)
+{
+	u32 Reg;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid((Direction == XEMACPS_SEND) ||
+			  (Direction == XEMACPS_RECV));
+	Xil_AssertNonvoid(Units <= XEMACPS_INTMOD_MAX);
+
+	if (InstancePtr->Version <= 2U) {
+		return (LONG)(XST_NO_FEATURE);
+	}
+
+	Reg = XEmacPs_ReadReg(InstancePtr->Config.BaseAddress,
+			      XEMACPS_INTMOD_OFFSET);
+	if (Direction == XEMACPS_SEND) {
+		Reg &= ~XEMACPS_INTMOD_TX_MASK;
+		Reg |= Units << XEMACPS_INTMOD_TX_SHIFT;
+	} else {
+		Reg &= ~XEMACPS_INTMOD_RX_MASK;
+		Reg |= Units;
+	}
+	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			 XEMACPS_INTMOD_OFFSET, Reg);
+
+	return (LONG)(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* Get the interrupt moderation time of a direction.
+*
+* @param InstancePtr is a pointer to the XEmacPs instance to be worked on.
+* @param Direction is XEMACPS_SEND or XEMACPS_RECV.
+*
+* @return The moderation time in the units of XEmacPs_SetIntrModeration(),
+*         0 if the GEM has no interrupt moderation.
+*
+******************************************************************************/
+u32 XEmacPs_GetIntrModeration(XEmacPs *InstancePtr, u32 Direction)
+{
+	u32 Reg;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid((Direction == XEMACPS_SEND) ||
+			  (Direction == XEMACPS_RECV));
+
+	if (InstancePtr->Version <= 2U) {
+		return 0U;
+	}
+
+	Reg = XEmacPs_ReadReg(InstancePtr->Config.BaseAddress,
+			      XEMACPS_INTMOD_OFFSET);
+	if (Direction == XEMACPS_SEND) {
+		Reg = (Reg & XEMACPS_INTMOD_TX_MASK) >> XEMACPS_INTMOD_TX_SHIFT;
+	} else {
+		Reg &= XEMACPS_INTMOD_RX_MASK;
+	}
+
+	return Reg;
+}
 /** @} */
@@ -40,6 +40,11 @@
 * 3.9  hk   01/23/19 Add RX watermark support
 * 3.10 hk   05/16/19 Clear status registers properly in reset
 * 3.18  sne 01/11/23 Add PCS control and status registers information.
+* 3.21  sb  10/19/26 Add large send offload (TSO/UFO) TX descriptor and
+*                    design configuration bits.
+* 3.21  sb  10/19/26 Add timestamp unit and extended BD timestamp registers
+*                    and bits.
+* 3.21  sb  10/19/26 Add interrupt moderation register.
 * </pre>
 *
 ******************************************************************************/
@@ -133,6 +138,9 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 
 #define XEMACPS_JUMBOMAXLEN_OFFSET   0x00000048U /**< Jumbo max length reg */
 
+#define XEMACPS_INTMOD_OFFSET        0x0000005CU /**< Interrupt moderation
+						      reg, ZynqMP and later */
+
 #define XEMACPS_RXWATERMARK_OFFSET   0x0000007CU /**< RX watermark reg */
 
 #define XEMACPS_HASHL_OFFSET         0x00000080U /**< Hash Low address reg */
@@ -254,6 +262,11 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 #define XEMACPS_LAST_OFFSET          0x000001B4U /**< Last statistic counter
 						      offset, for clearing */
 
+#define XEMACPS_1588_SUBNS_INC_OFFSET 0x000001BCU /**< 1588 sub-nanosecond
+						      increment */
+#define XEMACPS_1588_MSB_SEC_OFFSET  0x000001C0U /**< 1588 second counter,
+						      bits [47:32] */
+
 #define XEMACPS_1588_SEC_OFFSET      0x000001D0U /**< 1588 second counter */
 #define XEMACPS_1588_NANOSEC_OFFSET  0x000001D4U /**< 1588 nanosecond counter */
 #define XEMACPS_1588_ADJ_OFFSET      0x000001D8U /**< 1588 nanosecond
@@ -280,6 +293,8 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 #define XEMACPS_PCS_STATUS_OFFSET	0x00000204U /** PCS status register */
 
 #define XEMACPS_DCFG6_OFFSET		0x00000294U /** designcfg_debug6 register */
+#define XEMACPS_DCFG6_LSO_MASK		0x08000000U /**< TCP/UDP large send
+							offload present */
 
 #define XEMACPS_INTQ1_STS_OFFSET     0x00000400U /**< Interrupt Q1 Status
 							reg */
@@ -291,6 +306,10 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 							reg */
 #define XEMACPS_MSBBUF_TXQBASE_OFFSET  0x000004C8U /**< MSB Buffer TX Q Base
 							reg */
+#define XEMACPS_TXBDCTRL_OFFSET        0x000004CCU /**< TX BD timestamp
+							control reg */
+#define XEMACPS_RXBDCTRL_OFFSET        0x000004D0U /**< RX BD timestamp
+							control reg */
 #define XEMACPS_MSBBUF_RXQBASE_OFFSET  0x000004D4U /**< MSB Buffer RX Q Base
 							reg */
 #define XEMACPS_SCREEN_TYPE2_REG0       0x00000540U /** Screening Type2 Reg0 **/
@@ -552,6 +571,45 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 #define XEMACPS_RXWM_LOW_SHFT_MSK	16U	/**< Shift for RXWM low */
 /*@}*/
 
+/** @name Interrupt moderation bit definitions
+ * @{
+ */
+#define XEMACPS_INTMOD_RX_MASK		0x000000FFU	/**< RX moderation */
+#define XEMACPS_INTMOD_TX_MASK		0x00FF0000U	/**< TX moderation */
+#define XEMACPS_INTMOD_TX_SHIFT		16U	/**< Shift for TX moderation */
+#define XEMACPS_INTMOD_MAX		0xFFU	/**< Maximum moderation time,
+						     in moderation units */
+#define XEMACPS_INTMOD_UNIT_NS_1000	800U	/**< Moderation unit at
+						     1 Gb/s, in ns */
+/*@}*/
+
+/** @name Timestamp unit bit definitions
+ * @{
+ */
+#define XEMACPS_1588_ADJ_SUB_MASK	0x80000000U	/**< Subtract adjustment */
+#define XEMACPS_1588_ADJ_NS_MASK	0x3FFFFFFFU	/**< Adjustment in ns */
+#define XEMACPS_1588_INC_NS_MASK	0x000000FFU	/**< ns per TSU clock */
+#define XEMACPS_1588_SUBNS_MSB_MASK	0x0000FFFFU	/**< Sub-ns increment
+							     bits [23:8] */
+#define XEMACPS_1588_SUBNS_LSB_SHIFT	24U	/**< Shift for sub-ns
+						     increment bits [7:0] */
+#define XEMACPS_1588_SUBNS_WIDTH	24U	/**< Sub-ns increment width */
+#define XEMACPS_1588_MSB_SEC_MASK	0x0000FFFFU	/**< Seconds [47:32] */
+#define XEMACPS_1588_NSEC_MAX		1000000000U	/**< ns per second */
+/*@}*/
+
+/** @name TX/RX BD control bit definitions
+ * @{
+ */
+#define XEMACPS_BDCTRL_TSMODE_MASK	0x00000030U	/**< Timestamp mode */
+#define XEMACPS_BDCTRL_TSMODE_SHIFT	4U	/**< Shift for timestamp
+						     mode */
+#define XEMACPS_BDCTRL_TS_NONE		0U	/**< No timestamps */
+#define XEMACPS_BDCTRL_TS_PTP_EVENT	1U	/**< PTP event frames */
+#define XEMACPS_BDCTRL_TS_PTP_ALL	2U	/**< All PTP frames */
+#define XEMACPS_BDCTRL_TS_ALL		3U	/**< All frames */
+/*@}*/
+
 /** @name Screening Type2 bit definitions
  * @{
  */
@@ -566,6 +624,18 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 #define XEMACPS_BD_STAT_OFFSET  0x00000004U /**< word 1/status of BDs */
 #define XEMACPS_BD_ADDR_HI_OFFSET  0x00000008U /**< word 2/addr of BDs */
 
+/* The two timestamp words of an extended BD follow the BD words, see
+ * XEMACPS_BD_TS_LO_OFFSET and XEMACPS_BD_TS_HI_OFFSET in xemacps_bd.h.
+ */
+#define XEMACPS_BD_TS_NSEC_MASK   0x3FFFFFFFU /**< Timestamp word 0, ns */
+#define XEMACPS_BD_TS_SECL_MASK   0xC0000000U /**< Timestamp word 0,
+                                                   seconds [1:0] */
+#define XEMACPS_BD_TS_SECL_SHIFT  30U         /**< Shift for seconds [1:0] */
+#define XEMACPS_BD_TS_SECH_MASK   0x0000000FU /**< Timestamp word 1,
+                                                   seconds [5:2] */
+#define XEMACPS_BD_TS_SECH_SHIFT  2U          /**< Shift for seconds [5:2] */
+#define XEMACPS_BD_TS_SEC_MASK    0x0000003FU /**< Seconds held in a BD */
+
 /*
  * @}
  */
@@ -588,6 +658,15 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 #define XEMACPS_TXBUF_NOCRC_MASK 0x00010000U /**< No CRC */
 #define XEMACPS_TXBUF_LAST_MASK  0x00008000U /**< Last buffer */
 #define XEMACPS_TXBUF_LEN_MASK   0x00003FFFU /**< Mask for length field */
+#define XEMACPS_TXBUF_LSO_MASK   0x00060000U /**< Large send offload type,
+                                                  header BD of a frame */
+#define XEMACPS_TXBUF_LSO_UFO    0x00020000U /**< UDP fragmentation offload */
+#define XEMACPS_TXBUF_LSO_TSO    0x00040000U /**< TCP segmentation offload */
+#define XEMACPS_TXBUF_MSS_MASK   0x3FFF0000U /**< TSO MSS or UFO max frame
+                                                  size, payload BDs */
+#define XEMACPS_TXBUF_MSS_SHIFT  16U         /**< Shift for MSS field */
+#define XEMACPS_TXBUF_TS_MASK    0x00800000U /**< Timestamp captured,
+                                                  extended BD mode */
 /*
  * @}
  */
@@ -622,6 +701,8 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 
 #define XEMACPS_RXBUF_WRAP_MASK      0x00000002U /**< Wrap bit, last BD */
 #define XEMACPS_RXBUF_NEW_MASK       0x00000001U /**< Used bit.. */
+#define XEMACPS_RXBUF_TS_MASK        0x00000004U /**< Timestamp captured,
+                                                      extended BD mode */
 #define XEMACPS_RXBUF_ADD_MASK       0xFFFFFFFCU /**< Mask for address */
 /*
  * @}
@@ -0,0 +1,312 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xemacps_ptp.c
+* @addtogroup emacps Overview
+* @{
+ *
+ * Functions in this file implement IEEE 1588 timestamping with extended
+ * buffer descriptors and access to the timestamp unit (TSU).
+ *
+ * In extended BD mode the GEM writes the time at which a frame was sent or
+ * received to two words that follow each BD. The timestamps are read
+ * straight from the BD ring when the frame is processed, so every frame can
+ * be timestamped, not only the last PTP event frame held in the PTP event
+ * registers. Extended BD mode is available on GEM versions above 2 (Zynq
+ * UltraScale+ MPSoC and later).
+ *
+ * To use it:
+ * - Reset the device, then enable timestamping with
+ *   XEmacPs_SetTimestampMode() while the device is stopped.
+ * - Create the TX and/or RX rings with XEmacPs_BdRingCreateExt().
+ * - Start the TSU with XEmacPs_SetTsuIncrement() and XEmacPs_SetTsuTime().
+ * - When a frame is done, check XEmacPs_BdIsTxTs()/XEmacPs_BdIsRxTs() on its
+ *   first (TX) or only (RX) BD and get the timestamp with
+ *   XEmacPs_BdGetTimestamp().
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 3.21  sb   10/19/26 First release
+ * </pre>
+ *****************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xemacps.h"
+
+/************************** Constant Definitions *****************************/
+
+
+/**************************** Type Definitions *******************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+
+/************************** Function Prototypes ******************************/
+
+
+/************************** Variable Definitions *****************************/
+
+
+/*****************************************************************************/
+/**
+ * Enable or disable extended BD mode and select the frames that are
+ * timestamped, for each direction. The device must be stopped and this
+ * function must be called again after XEmacPs_Reset(), which disables
+ * extended BD mode.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param TxMode is the TX timestamp mode, one of XEMACPS_BDCTRL_TS_NONE,
+ *        XEMACPS_BDCTRL_TS_PTP_EVENT, XEMACPS_BDCTRL_TS_PTP_ALL or
+ *        XEMACPS_BDCTRL_TS_ALL. Any mode but XEMACPS_BDCTRL_TS_NONE enables
+ *        extended TX BDs.
+ * @param RxMode is the RX timestamp mode, same values as TxMode.
+ *
+ * @return
+ * - XST_SUCCESS if the mode was set successfully
+ * - XST_DEVICE_IS_STARTED if the device has not yet been stopped
+ * - XST_NO_FEATURE if the GEM does not support extended BD mode
+ *
+ * @note
+ * Rings used in a direction with extended BD mode enabled must be created
+ * with XEmacPs_BdRingCreateExt().
+ *
+ *****************************************************************************/
+LONG XEmacPs_SetTimestampMode(XEmacPs *InstancePtr, u32 TxMode, u32 RxMode)
+{
+	u32 Reg;
+	LONG Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(TxMode <= XEMACPS_BDCTRL_TS_ALL);
+	Xil_AssertNonvoid(RxMode <= XEMACPS_BDCTRL_TS_ALL);
+
+	/* Be sure device has been stopped */
+	if (InstancePtr->IsStarted == (u32)XIL_COMPONENT_IS_STARTED) {
+		Status = (LONG)(XST_DEVICE_IS_STARTED);
+	} else if (InstancePtr->Version <= 2U) {
+		Status = (LONG)(XST_NO_FEATURE);
+	} else {
+		Reg = XEmacPs_ReadReg(InstancePtr->Config.BaseAddress,
+				      XEMACPS_DMACR_OFFSET);
+		Reg &= ~((u32)XEMACPS_DMACR_TXEXTEND_MASK |
+			 (u32)XEMACPS_DMACR_RXEXTEND_MASK);
+		if (TxMode != XEMACPS_BDCTRL_TS_NONE) {
+			Reg |= (u32)XEMACPS_DMACR_TXEXTEND_MASK;
+		}
+		if (RxMode != XEMACPS_BDCTRL_TS_NONE) {
+			Reg |= (u32)XEMACPS_DMACR_RXEXTEND_MASK;
+		}
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 XEMACPS_DMACR_OFFSET, Reg);
+
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 XEMACPS_TXBDCTRL_OFFSET,
+				 (TxMode << XEMACPS_BDCTRL_TSMODE_SHIFT) &
+				 XEMACPS_BDCTRL_TSMODE_MASK);
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 XEMACPS_RXBDCTRL_OFFSET,
+				 (RxMode << XEMACPS_BDCTRL_TSMODE_SHIFT) &
+				 XEMACPS_BDCTRL_TSMODE_MASK);
+		Status = (LONG)(XST_SUCCESS);
+	}
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * Read the current time of the timestamp unit.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param TimePtr is where the time is returned.
+ *
+ * @return None.
+ *
+ * @note
+ * The seconds are read between two reads of the nanoseconds, and read
+ * again if the nanoseconds wrapped in between.
+ *
+ *****************************************************************************/
+void XEmacPs_GetTsuTime(XEmacPs *InstancePtr, XEmacPs_TsuTime *TimePtr)
+{
+	u32 First;
+	u32 Second;
+	u32 SecLo;
+	u32 SecHi = 0U;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(TimePtr != NULL);
+
+	First = XEmacPs_ReadReg(InstancePtr->Config.BaseAddress,
+				XEMACPS_1588_NANOSEC_OFFSET);
+	SecLo = XEmacPs_ReadReg(InstancePtr->Config.BaseAddress,
+				XEMACPS_1588_SEC_OFFSET);
+	if (InstancePtr->Version > 2U) {
+		SecHi = XEmacPs_ReadReg(InstancePtr->Config.BaseAddress,
+					XEMACPS_1588_MSB_SEC_OFFSET);
+	}
+	Second = XEmacPs_ReadReg(InstancePtr->Config.BaseAddress,
+				 XEMACPS_1588_NANOSEC_OFFSET);
+
+	if (Second < First) {
+		/* The seconds may be before or after the wrap, read them again */
+		First = Second;
+		SecLo = XEmacPs_ReadReg(InstancePtr->Config.BaseAddress,
+					XEMACPS_1588_SEC_OFFSET);
+		if (InstancePtr->Version > 2U) {
+			SecHi = XEmacPs_ReadReg(InstancePtr->Config.BaseAddress,
+						XEMACPS_1588_MSB_SEC_OFFSET);
+		}
+	}
+
+	TimePtr->Seconds = ((u64)(SecHi & XEMACPS_1588_MSB_SEC_MASK) << 32U) |
+			   (u64)SecLo;
+	TimePtr->NanoSeconds = First;
+}
+
+/*****************************************************************************/
+/**
+ * Set the time of the timestamp unit.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param TimePtr is the time to set.
+ *
+ * @return None.
+ *
+ *****************************************************************************/
+void XEmacPs_SetTsuTime(XEmacPs *InstancePtr, const XEmacPs_TsuTime *TimePtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(TimePtr != NULL);
+	Xil_AssertVoid(TimePtr->NanoSeconds < XEMACPS_1588_NSEC_MAX);
+
+	/* Clear the nanoseconds first so the seconds do not wrap meanwhile */
+	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			 XEMACPS_1588_NANOSEC_OFFSET, 0U);
+	if (InstancePtr->Version > 2U) {
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 XEMACPS_1588_MSB_SEC_OFFSET,
+				 (u32)(TimePtr->Seconds >> 32U) &
+				 XEMACPS_1588_MSB_SEC_MASK);
+	}
+	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			 XEMACPS_1588_SEC_OFFSET, (u32)TimePtr->Seconds);
+	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			 XEMACPS_1588_NANOSEC_OFFSET, TimePtr->NanoSeconds);
+}
+
+/*****************************************************************************/
+/**
+ * Step the time of the timestamp unit by less than a second, without
+ * stopping it.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param NanoSeconds is the step, in ns, negative to step backwards.
+ *
+ * @return None.
+ *
+ * @note
+ * Larger steps are made with XEmacPs_GetTsuTime() and XEmacPs_SetTsuTime().
+ *
+ *****************************************************************************/
+void XEmacPs_AdjustTsuTime(XEmacPs *InstancePtr, s32 NanoSeconds)
+{
+	u32 Reg;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid((NanoSeconds > -(s32)XEMACPS_1588_NSEC_MAX) &&
+		       (NanoSeconds < (s32)XEMACPS_1588_NSEC_MAX));
+
+	if (NanoSeconds < 0) {
+		Reg = XEMACPS_1588_ADJ_SUB_MASK |
+		      ((u32)(-NanoSeconds) & XEMACPS_1588_ADJ_NS_MASK);
+	} else {
+		Reg = (u32)NanoSeconds & XEMACPS_1588_ADJ_NS_MASK;
+	}
+	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			 XEMACPS_1588_ADJ_OFFSET, Reg);
+}
+
+/*****************************************************************************/
+/**
+ * Set the amount of time the timestamp unit advances by on every TSU clock
+ * cycle. Fine tuning the sub-nanosecond part is how a PTP servo adjusts the
+ * frequency of the clock.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param NanoSeconds is the whole number of ns per TSU clock cycle.
+ * @param SubNanoSeconds is the fractional part in units of 2^-24 ns. It is
+ *        ignored on GEM versions 2 and below.
+ *
+ * @return None.
+ *
+ *****************************************************************************/
+void XEmacPs_SetTsuIncrement(XEmacPs *InstancePtr, u32 NanoSeconds,
+			     u32 SubNanoSeconds)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(NanoSeconds <= XEMACPS_1588_INC_NS_MASK);
+	Xil_AssertVoid(SubNanoSeconds < ((u32)1U << XEMACPS_1588_SUBNS_WIDTH));
+
+	if (InstancePtr->Version > 2U) {
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 XEMACPS_1588_SUBNS_INC_OFFSET,
+				 (SubNanoSeconds << XEMACPS_1588_SUBNS_LSB_SHIFT) |
+				 ((SubNanoSeconds >> 8U) &
+				  XEMACPS_1588_SUBNS_MSB_MASK));
+	}
+	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			 XEMACPS_1588_INC_OFFSET, NanoSeconds);
+}
+
+/*****************************************************************************/
+/**
+ * Get the timestamp captured in an extended BD.
+ *
+ * The BD only holds the 6 least significant bits of the seconds. The upper
+ * bits are taken from a TSU time read after the frame was sent or received,
+ * which must be less than 64 seconds later. Reading the TSU once with
+ * XEmacPs_GetTsuTime() serves all the BDs processed by an interrupt.
+ *
+ * @param BdPtr is the first TX BD or the RX BD of the frame. The caller
+ *        checks the timestamp is valid with XEmacPs_BdIsTxTs() or
+ *        XEmacPs_BdIsRxTs().
+ * @param NowPtr is the TSU time read after the frame completed.
+ * @param TimePtr is where the timestamp is returned.
+ *
+ * @return None.
+ *
+ *****************************************************************************/
+void XEmacPs_BdGetTimestamp(XEmacPs_Bd *BdPtr, const XEmacPs_TsuTime *NowPtr,
+			    XEmacPs_TsuTime *TimePtr)
+{
+	u32 TsLo;
+	u32 TsHi;
+	u32 Sec;
+
+	Xil_AssertVoid(BdPtr != NULL);
+	Xil_AssertVoid(NowPtr != NULL);
+	Xil_AssertVoid(TimePtr != NULL);
+
+	TsLo = XEmacPs_BdGetTsLo(BdPtr);
+	TsHi = XEmacPs_BdGetTsHi(BdPtr);
+	Sec = ((TsHi & XEMACPS_BD_TS_SECH_MASK) << XEMACPS_BD_TS_SECH_SHIFT) |
+	      ((TsLo & XEMACPS_BD_TS_SECL_MASK) >> XEMACPS_BD_TS_SECL_SHIFT);
+
+	/* Go back from the current time by the seconds elapsed since */
+	TimePtr->Seconds = NowPtr->Seconds -
+			   ((NowPtr->Seconds - (u64)Sec) &
+			    (u64)XEMACPS_BD_TS_SEC_MASK);
+	TimePtr->NanoSeconds = TsLo & XEMACPS_BD_TS_NSEC_MASK;
+}
+/** @} */
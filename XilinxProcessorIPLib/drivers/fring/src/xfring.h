@@ -0,0 +1,266 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xfring.h
+* @addtogroup fring Overview
+* @{
+*
+* Frame descriptor rings shared by the frame ring interfaces of the DMA
+* drivers (xaxidma_fring.h, xmcdma_fring.h), for applications that process
+* raw Ethernet frames without a network stack.
+*
+* The application owns a frame area: FrameCount frames of FrameSize bytes
+* each, FrameSize being a power of two. Frames are named by their index in
+* the area and are handed between application and driver through four
+* single-producer, single-consumer rings of frame descriptors:
+*
+* - Fill: application -> driver, free frames to receive into.
+* - Rx: driver -> application, received frames with their length.
+* - Tx: application -> driver, frames to send with their length.
+* - Comp: driver -> application, frames that have been sent.
+*
+* A frame belongs to whoever holds its index, so a forwarder sends a received
+* frame by moving its descriptor from Rx to Tx and refills from Comp. No
+* buffer is allocated or copied per frame.
+*
+* <pre>
+*        Fill           Rx             Tx            Comp
+* App ---------> Drv ---------> App ---------> Drv ---------> App
+*                 |                             |
+*                 +-> S2MM BDs                  +-> MM2S BDs
+* </pre>
+*
+* A producer reserves entries with XFring_RingReserve(), fills them in
+* through XFring_RingDesc() and hands them over with XFring_RingSubmit(). A
+* consumer looks at entries with XFring_RingPeek() and gives them back with
+* XFring_RingRelease(). Each side of a ring must be used from one context
+* only.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.0   sb   10/19/26 First release, moved from xil_fring.h of the
+*                     standalone BSP
+*
+* </pre>
+*
+******************************************************************************/
+
+#ifndef XFRING_H_
+#define XFRING_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+
+#include "xil_types.h"
+#include "xil_io.h"
+
+/************************** Constant Definitions *****************************/
+
+/** Number of rings a frame ring set uses */
+#define XFRING_NUM_RINGS		4U
+
+/** Minimum frame size, one cache line */
+#define XFRING_MIN_FRAME_SIZE		64U
+
+/** Maximum number of RX BDs a driver reaps at once */
+#define XFRING_RX_BATCH			32U
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Frame descriptor, the entry of all rings.
+ */
+typedef struct {
+	u32 Idx;	/**< Frame index in the frame area */
+	u32 Len;	/**< Frame length in bytes */
+} XFring_Desc;
+
+/**
+ * Single-producer, single-consumer ring of frame descriptors. Prod and Cons
+ * run freely and are masked when indexing Desc.
+ */
+typedef struct {
+	XFring_Desc *Desc;	/**< Ring entries */
+	u32 Mask;		/**< Number of entries - 1 */
+	volatile u32 Prod;	/**< Entries produced */
+	volatile u32 Cons;	/**< Entries consumed */
+} XFring_Ring;
+
+/**
+ * Frame ring statistics, updated by the driver.
+ */
+typedef struct {
+	u32 RxFrames;		/**< Frames put on the Rx ring */
+	u32 RxErrors;		/**< Frames dropped, DMA error or too long */
+	u32 TxFrames;		/**< Frames put on the Comp ring */
+	u32 TxErrors;		/**< Sent frames with a DMA error */
+} XFring_Stats;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/*****************************************************************************/
+/**
+* Return the descriptor at a position of a ring, as returned by
+* XFring_RingReserve() or XFring_RingPeek() plus an offset.
+*
+* @param	RingPtr is the ring to be worked on.
+* @param	Pos is the position.
+*
+* @return	Pointer to the descriptor.
+*
+* @note		C-style signature:
+*		XFring_Desc *XFring_RingDesc(XFring_Ring *RingPtr, u32 Pos)
+*
+******************************************************************************/
+#define XFring_RingDesc(RingPtr, Pos) \
+	(&(RingPtr)->Desc[(Pos) & (RingPtr)->Mask])
+
+/*****************************************************************************/
+/**
+* Return the number of entries that can be consumed from a ring.
+*
+* @param	RingPtr is the ring to be worked on.
+*
+* @return	Number of produced entries not consumed yet.
+*
+* @note		C-style signature:
+*		u32 XFring_RingUsed(XFring_Ring *RingPtr)
+*
+******************************************************************************/
+#define XFring_RingUsed(RingPtr) \
+	((u32)((RingPtr)->Prod - (RingPtr)->Cons))
+
+/*****************************************************************************/
+/**
+* Return the number of entries that can be produced to a ring.
+*
+* @param	RingPtr is the ring to be worked on.
+*
+* @return	Number of free entries.
+*
+* @note		C-style signature:
+*		u32 XFring_RingFree(XFring_Ring *RingPtr)
+*
+******************************************************************************/
+#define XFring_RingFree(RingPtr) \
+	((RingPtr)->Mask + 1U - XFring_RingUsed(RingPtr))
+
+/*****************************************************************************/
+/**
+* Initialize an empty ring.
+*
+* @param	RingPtr is the ring to be initialized.
+* @param	Desc is the memory of the ring entries.
+* @param	RingSize is the number of entries, a power of two.
+*
+* @return	None.
+*
+******************************************************************************/
+static INLINE void XFring_RingInit(XFring_Ring *RingPtr,
+				   XFring_Desc *Desc, u32 RingSize)
+{
+	RingPtr->Desc = Desc;
+	RingPtr->Mask = RingSize - 1U;
+	RingPtr->Prod = 0U;
+	RingPtr->Cons = 0U;
+}
+
+/*****************************************************************************/
+/**
+* Reserve entries of a ring to produce.
+*
+* @param	RingPtr is the ring to be worked on.
+* @param	Count is the number of entries wanted.
+* @param	PosPtr returns the position of the first entry, for
+*		XFring_RingDesc().
+*
+* @return	The number of entries reserved, at most Count.
+*
+******************************************************************************/
+static INLINE u32 XFring_RingReserve(XFring_Ring *RingPtr, u32 Count,
+				     u32 *PosPtr)
+{
+	u32 Free = XFring_RingFree(RingPtr);
+
+	*PosPtr = RingPtr->Prod;
+
+	return (Count < Free) ? Count : Free;
+}
+
+/*****************************************************************************/
+/**
+* Hand reserved entries of a ring, now filled in, to the consumer.
+*
+* @param	RingPtr is the ring to be worked on.
+* @param	Count is the number of entries, at most the number reserved.
+*
+* @return	None.
+*
+******************************************************************************/
+static INLINE void XFring_RingSubmit(XFring_Ring *RingPtr, u32 Count)
+{
+	/* Descriptors must be visible before the producer index */
+	DATA_SYNC;
+	RingPtr->Prod += Count;
+}
+
+/*****************************************************************************/
+/**
+* Look at entries of a ring to consume.
+*
+* @param	RingPtr is the ring to be worked on.
+* @param	Count is the number of entries wanted.
+* @param	PosPtr returns the position of the first entry, for
+*		XFring_RingDesc().
+*
+* @return	The number of entries available, at most Count.
+*
+******************************************************************************/
+static INLINE u32 XFring_RingPeek(XFring_Ring *RingPtr, u32 Count,
+				  u32 *PosPtr)
+{
+	u32 Used = XFring_RingUsed(RingPtr);
+
+	*PosPtr = RingPtr->Cons;
+	/* Descriptors must not be read before the producer index */
+	DATA_SYNC;
+
+	return (Count < Used) ? Count : Used;
+}
+
+/*****************************************************************************/
+/**
+* Give consumed entries of a ring back to the producer.
+*
+* @param	RingPtr is the ring to be worked on.
+* @param	Count is the number of entries, at most the number peeked.
+*
+* @return	None.
+*
+******************************************************************************/
+static INLINE void XFring_RingRelease(XFring_Ring *RingPtr, u32 Count)
+{
+	/* Descriptors must have been read before they can be overwritten */
+	DATA_SYNC;
+	RingPtr->Cons += Count;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XFRING_H_ */
+/**
+* @} End of "addtogroup fring".
+*/
@@ -2476,6 +2476,11 @@ static int mpModExp_windowed(u32 y[], const u32 x[], const u32 n[], u32 d[], siz
 int mpModExp(u32 y[], const u32 x[], const u32 n[], u32 d[], size_t ndigits)
 	/* Computes y = x^n mod d */
 {
+#ifdef USE_MONT
+	/* [HDCP 2.2] Montgomery backend for odd moduli, see bigdigits_mont.c */
+	if (mpISODD(d, ndigits))
+		return mpModExpMont(y, x, n, d, ndigits);
+#endif
 #ifdef NO_ALLOCS
 	return mpModExp_1(y, x, n, d, ndigits);
 #else
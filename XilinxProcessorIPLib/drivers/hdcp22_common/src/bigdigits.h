@@ -61,6 +61,14 @@ typedef uint16_t HALF_DIGIT_T;
 #define MAX_FIXED_DIGITS (MAX_FIXED_BIT_LENGTH / BITS_PER_DIGIT)
 #endif
 
+/* [HDCP 2.2] Define BD_USE_MONT to use the Montgomery backend of
+   bigdigits_mont.c in mpModExp for odd moduli. Off by default; run
+   XHdcp22Tx_TestMpModExp (_XHDCP22_TX_TEST_) on the target before
+   enabling it. */
+#ifdef BD_USE_MONT
+#define USE_MONT
+#endif
+
 /**** END OF USER CONFIGURABLE SECTION ****/
 
 /**** OPTIONAL PREPROCESSOR DEFINITIONS ****/
@@ -204,6 +212,11 @@ int mpModExp(u32 y[], const u32 x[], const u32 e[], u32 m[], size_t ndigits);
  */
 int mpModExp_ct(u32 yout[], const u32 x[], const u32 e[], u32 m[], size_t ndigits);
 
+/**	Computes y = x^e mod m for odd m using Montgomery multiplication
+ *  @remark Used by mpModExp() when built with BD_USE_MONT. See bigdigits_mont.c.
+ */
+int mpModExpMont(u32 y[], const u32 x[], const u32 e[], u32 m[], size_t ndigits);
+
 /** Computes a = (x * y) mod m */
 int mpModMult(u32 a[], const u32 x[], const u32 y[], u32 m[], size_t ndigits);
 
@@ -0,0 +1,402 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+* @file bigdigits_mont.c
+*
+* This file contains the Montgomery backend of the BigDigits modular
+* exponentiation. When the library is built with BD_USE_MONT defined,
+* mpModExp() uses mpModExpMont() for odd moduli, which covers all RSA
+* operations of the HDCP 2.2 drivers. The backend is off by default;
+* XHdcp22Tx_TestMpModExp() checks it against mpModExp_ct() and should pass on
+* the target before it is enabled.
+*
+* The modular multiplications use the Finely Integrated Product Scanning
+* (FIPS) Montgomery method. Every column of the product and of the reduction
+* is summed in a three limb (Comba) accumulator, so no division is needed
+* after the conversion into the Montgomery domain. On AArch64 the limbs are
+* 64 bits wide and the products are 128 bits; on 32-bit processors (Cortex-A9,
+* Cortex-R5, MicroBlaze) the limbs are 32 bits wide and every product is a
+* single 32x32->64 multiply, e.g. UMULL/UMLAL on ARM.
+*
+* Reference:
+* Analyzing and Comparing Montgomery Multiplication Algorithms
+* IEEE Micro, 16(3):26-33,June 1996
+* By: Cetin Koc, Tolga Acar, and Burton Kaliski
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 2.3   sb   10/19/26 First release
+*</pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+#include <string.h>
+#include <assert.h>
+#include "bigdigits.h"
+
+/************************** Constant Definitions ****************************/
+#if defined(__aarch64__)
+typedef u64 MontLimb;
+typedef unsigned __int128 MontDLimb;
+#define MONT_LIMB_BITS 64
+#else
+typedef u32 MontLimb;
+typedef u64 MontDLimb;
+#define MONT_LIMB_BITS 32
+#endif
+
+/** Number of BigDigits per limb */
+#define MONT_DIGITS_PER_LIMB (MONT_LIMB_BITS / BITS_PER_DIGIT)
+
+/** Maximum number of limbs of an operand */
+#define MONT_MAX_LIMBS \
+	((MAX_FIXED_DIGITS + MONT_DIGITS_PER_LIMB - 1) / MONT_DIGITS_PER_LIMB)
+
+/**************************** Type Definitions ******************************/
+
+/**
+* Montgomery context of a modulus N, with R = 2^(Limbs*MONT_LIMB_BITS).
+*/
+typedef struct {
+	MontLimb N[MONT_MAX_LIMBS];	/**< Modulus */
+	MontLimb R2[MONT_MAX_LIMBS];	/**< R^2 mod N */
+	MontLimb NPrime0;		/**< -N^(-1) mod 2^MONT_LIMB_BITS */
+	size_t Limbs;			/**< Length of N in limbs */
+} MontCtx;
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/** Moves to the next lower bit of a BigDigits integer, as in bigdigits.c */
+#define mpNEXTBITMASK(mask, n) \
+do { \
+	if (mask == 1) { \
+		mask = HIBITMASK; \
+		n--; \
+	} else { \
+		mask >>= 1; \
+	} \
+} while (0)
+
+/** Comba accumulator (T2,T1,T0) += X*Y */
+#define MONT_MULADD(T0, T1, T2, X, Y) \
+do { \
+	MontDLimb P_ = (MontDLimb)(X) * (Y); \
+	MontDLimb S_ = (MontDLimb)(T0) + (MontLimb)P_; \
+	(T0) = (MontLimb)S_; \
+	S_ = (MontDLimb)(T1) + (MontLimb)(P_ >> MONT_LIMB_BITS) + \
+	     (MontLimb)(S_ >> MONT_LIMB_BITS); \
+	(T1) = (MontLimb)S_; \
+	(T2) += (MontLimb)(S_ >> MONT_LIMB_BITS); \
+} while (0)
+
+/************************** Function Prototypes *****************************/
+static void mpMontToLimbs(MontLimb a[], const u32 d[], size_t ndigits,
+	size_t limbs);
+static void mpMontFromLimbs(u32 d[], size_t ndigits, const MontLimb a[]);
+static MontLimb mpMontSub(MontLimb w[], const MontLimb u[],
+	const MontLimb v[], size_t limbs);
+static void mpMontDouble(MontLimb a[], const MontCtx *Ctx);
+static void mpMontMult(MontLimb u[], const MontLimb a[], const MontLimb b[],
+	const MontCtx *Ctx);
+static void mpMontInit(MontCtx *Ctx, u32 m[], size_t ndigits);
+
+/************************** Function Definitions ****************************/
+
+/*****************************************************************************/
+/**
+* This function converts a BigDigits integer into limbs.
+*
+* @param	a is the integer in limbs.
+* @param	d is the integer in BigDigits.
+* @param	ndigits is the length of d.
+* @param	limbs is the length of a, digits beyond ndigits are zero.
+*
+* @return	None.
+*
+* @note		None.
+******************************************************************************/
+static void mpMontToLimbs(MontLimb a[], const u32 d[], size_t ndigits,
+	size_t limbs)
+{
+	size_t i, j;
+
+	for (i = 0; i < limbs; i++) {
+		a[i] = 0;
+		for (j = 0; j < MONT_DIGITS_PER_LIMB; j++) {
+			if (i * MONT_DIGITS_PER_LIMB + j < ndigits) {
+				a[i] |= (MontLimb)d[i * MONT_DIGITS_PER_LIMB + j] <<
+					(j * BITS_PER_DIGIT);
+			}
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function converts limbs into a BigDigits integer.
+*
+* @param	d is the integer in BigDigits.
+* @param	ndigits is the length of d.
+* @param	a is the integer in limbs, at least ndigits digits long.
+*
+* @return	None.
+*
+* @note		None.
+******************************************************************************/
+static void mpMontFromLimbs(u32 d[], size_t ndigits, const MontLimb a[])
+{
+	size_t i;
+
+	for (i = 0; i < ndigits; i++) {
+		d[i] = (u32)(a[i / MONT_DIGITS_PER_LIMB] >>
+			((i % MONT_DIGITS_PER_LIMB) * BITS_PER_DIGIT));
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function computes w = u - v.
+*
+* @param	w is the difference, it may overlap u or v.
+* @param	u is the minuend.
+* @param	v is the subtrahend.
+* @param	limbs is the length of the operands.
+*
+* @return	The borrow, 1 if u < v.
+*
+* @note		None.
+******************************************************************************/
+static MontLimb mpMontSub(MontLimb w[], const MontLimb u[],
+	const MontLimb v[], size_t limbs)
+{
+	MontLimb Borrow = 0;
+	MontLimb t, Next;
+	size_t i;
+
+	for (i = 0; i < limbs; i++) {
+		t = u[i] - v[i];
+		Next = (u[i] < v[i]) | (t < Borrow);
+		w[i] = t - Borrow;
+		Borrow = Next;
+	}
+
+	return Borrow;
+}
+
+/*****************************************************************************/
+/**
+* This function computes a = 2*a mod N.
+*
+* @param	a is the operand, a < N.
+* @param	Ctx is the Montgomery context.
+*
+* @return	None.
+*
+* @note		None.
+******************************************************************************/
+static void mpMontDouble(MontLimb a[], const MontCtx *Ctx)
+{
+	MontLimb Carry = 0;
+	MontLimb t[MONT_MAX_LIMBS];
+	MontLimb Next;
+	size_t i;
+
+	for (i = 0; i < Ctx->Limbs; i++) {
+		Next = a[i] >> (MONT_LIMB_BITS - 1);
+		a[i] = (a[i] << 1) | Carry;
+		Carry = Next;
+	}
+
+	/* Keep 2a - N unless it borrows from the carry */
+	if (mpMontSub(t, a, Ctx->N, Ctx->Limbs) <= Carry) {
+		memcpy(a, t, Ctx->Limbs * sizeof(MontLimb));
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function computes the Montgomery product u = a*b*R^(-1) mod N with
+* the FIPS method. Column i of a*b + m*N is summed in the accumulator, m[i]
+* is chosen to clear its low limb, and the accumulator is shifted one limb.
+*
+* @param	u is the product, it may overlap a or b.
+* @param	a is an operand, a < R.
+* @param	b is an operand, b < N.
+* @param	Ctx is the Montgomery context.
+*
+* @return	None.
+*
+* @note		None.
+******************************************************************************/
+static void mpMontMult(MontLimb u[], const MontLimb a[], const MontLimb b[],
+	const MontCtx *Ctx)
+{
+	const MontLimb *n = Ctx->N;
+	size_t s = Ctx->Limbs;
+	MontLimb m[MONT_MAX_LIMBS];
+	MontLimb t[MONT_MAX_LIMBS + 1];
+	MontLimb t0 = 0, t1 = 0, t2 = 0;
+	size_t i, j;
+
+	for (i = 0; i < s; i++) {
+		for (j = 0; j < i; j++) {
+			MONT_MULADD(t0, t1, t2, a[j], b[i - j]);
+			MONT_MULADD(t0, t1, t2, m[j], n[i - j]);
+		}
+		MONT_MULADD(t0, t1, t2, a[i], b[0]);
+		m[i] = t0 * Ctx->NPrime0;
+		MONT_MULADD(t0, t1, t2, m[i], n[0]);
+		/* t0 is zero here */
+		t0 = t1;
+		t1 = t2;
+		t2 = 0;
+	}
+
+	for (i = s; i < 2 * s; i++) {
+		for (j = i - s + 1; j < s; j++) {
+			MONT_MULADD(t0, t1, t2, a[j], b[i - j]);
+			MONT_MULADD(t0, t1, t2, m[j], n[i - j]);
+		}
+		t[i - s] = t0;
+		t0 = t1;
+		t1 = t2;
+		t2 = 0;
+	}
+	t[s] = t0;
+
+	/* t < 2N, one subtraction brings it below N */
+	if (mpMontSub(m, t, n, s) <= t[s]) {
+		memcpy(u, m, s * sizeof(MontLimb));
+	} else {
+		memcpy(u, t, s * sizeof(MontLimb));
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function sets up the Montgomery context of a modulus. R mod N is the
+* only remainder computed by division. R^2 mod N is then derived from it:
+* doubling R mod N k times gives 2^k*R, the Montgomery form of 2^k, and
+* every Montgomery square doubles the exponent, until it reaches
+* Limbs*MONT_LIMB_BITS.
+*
+* @param	Ctx is the Montgomery context.
+* @param	m is the modulus, it must be odd.
+* @param	ndigits is the length of m.
+*
+* @return	None.
+*
+* @note		None.
+******************************************************************************/
+static void mpMontInit(MontCtx *Ctx, u32 m[], size_t ndigits)
+{
+	u32 d[MONT_MAX_LIMBS * MONT_DIGITS_PER_LIMB];
+	MontLimb Inv;
+	size_t Bits, Squares;
+	size_t i;
+
+	Ctx->Limbs = (ndigits + MONT_DIGITS_PER_LIMB - 1) / MONT_DIGITS_PER_LIMB;
+	mpMontToLimbs(Ctx->N, m, ndigits, Ctx->Limbs);
+
+	/* Newton iteration, every step doubles the number of correct bits */
+	Inv = Ctx->N[0];
+	for (i = 0; i < 5; i++) {
+		Inv *= 2 - Ctx->N[0] * Inv;
+	}
+	Ctx->NPrime0 = (MontLimb)0 - Inv;
+
+	/* R mod N = (R - N) mod N, R - N fits in Limbs limbs */
+	memset(Ctx->R2, 0, sizeof(Ctx->R2));
+	mpMontSub(Ctx->R2, Ctx->R2, Ctx->N, Ctx->Limbs);
+	mpMontFromLimbs(d, Ctx->Limbs * MONT_DIGITS_PER_LIMB, Ctx->R2);
+	mpModulo(d, d, Ctx->Limbs * MONT_DIGITS_PER_LIMB, m, ndigits);
+	mpMontToLimbs(Ctx->R2, d, ndigits, Ctx->Limbs);
+
+	Bits = Ctx->Limbs * MONT_LIMB_BITS;
+	Squares = 0;
+	while ((Bits % 2) == 0 && Bits > MONT_LIMB_BITS) {
+		Bits /= 2;
+		Squares++;
+	}
+	for (i = 0; i < Bits; i++) {
+		mpMontDouble(Ctx->R2, Ctx);
+	}
+	for (i = 0; i < Squares; i++) {
+		mpMontMult(Ctx->R2, Ctx->R2, Ctx->R2, Ctx);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function computes y = x^e mod m with Montgomery multiplications,
+* using the binary left-to-right method.
+*
+* @param	y is the result, it may overlap x.
+* @param	x is the base.
+* @param	e is the exponent.
+* @param	m is the modulus, it must be odd.
+* @param	ndigits is the length of y, x, e and m.
+*
+* @return	0.
+*
+* @note		The run time depends on the exponent, use it for public
+*		key operations.
+******************************************************************************/
+int mpModExpMont(u32 y[], const u32 x[], const u32 e[], u32 m[],
+	size_t ndigits)
+{
+	MontCtx Ctx;
+	MontLimb Base[MONT_MAX_LIMBS];
+	MontLimb Acc[MONT_MAX_LIMBS];
+	size_t n;
+	u32 mask;
+
+	assert(ndigits != 0 && ndigits <= MAX_FIXED_DIGITS);
+	assert(mpISODD(m, ndigits));
+
+	n = mpSizeof(e, ndigits);
+	/* Catch e==0 => x^0=1 */
+	if (0 == n) {
+		mpSetDigit(y, 1, ndigits);
+		return 0;
+	}
+
+	mpMontInit(&Ctx, m, ndigits);
+
+	/* Base = x*R mod N */
+	mpMontToLimbs(Acc, x, ndigits, Ctx.Limbs);
+	mpMontMult(Base, Acc, Ctx.R2, &Ctx);
+	memcpy(Acc, Base, Ctx.Limbs * sizeof(MontLimb));
+
+	/* Find second-most significant bit in e */
+	for (mask = HIBITMASK; mask > 0; mask >>= 1) {
+		if (e[n-1] & mask)
+			break;
+	}
+	mpNEXTBITMASK(mask, n);
+
+	/* For bit j = k-2 downto 0 */
+	while (n) {
+		mpMontMult(Acc, Acc, Acc, &Ctx);
+		if (e[n-1] & mask) {
+			mpMontMult(Acc, Acc, Base, &Ctx);
+		}
+		mpNEXTBITMASK(mask, n);
+	}
+
+	/* y = Acc*R^(-1) mod N */
+	memset(Base, 0, Ctx.Limbs * sizeof(MontLimb));
+	Base[0] = 1;
+	mpMontMult(Acc, Acc, Base, &Ctx);
+	mpMontFromLimbs(y, ndigits, Acc);
+
+	return 0;
+}
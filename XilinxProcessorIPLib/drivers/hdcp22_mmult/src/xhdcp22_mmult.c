@@ -22,6 +22,7 @@
 * ----- ------ -------- --------------------------------------------------
 * 1.00  MH     12/07/15 Initial release.
 * 1.01  MH     08/04/16 Added 64 bit address support.
+* 1.5   sb     10/19/26 Added XHdcp22_mmult_Copy_U_Words.
 * </pre>
 *
 ******************************************************************************/
@@ -573,6 +574,27 @@ u32 XHdcp22_mmult_Read_NPrime_Bytes(XHdcp22_mmult *InstancePtr, int offset, char
     return length;
 }
 
+u32 XHdcp22_mmult_Copy_U_Words(XHdcp22_mmult *InstancePtr, u32 Operands, int length) {
+    Xil_AssertNonvoid(InstancePtr != NULL);
+    Xil_AssertNonvoid(InstancePtr -> IsReady == XIL_COMPONENT_IS_READY);
+
+    int i;
+    int data;
+
+    if (length*4 > (XHDCP22_MMULT_CTRL_ADDR_U_HIGH - XHDCP22_MMULT_CTRL_ADDR_U_BASE + 1))
+        return 0;
+
+    /* Result becomes the operand of the next run without leaving the core */
+    for (i = 0; i < length; i++) {
+        data = *(int *)(InstancePtr->Config.BaseAddress + XHDCP22_MMULT_CTRL_ADDR_U_BASE + i*4);
+        if (Operands & XHDCP22_MMULT_OPERAND_A)
+            *(int *)(InstancePtr->Config.BaseAddress + XHDCP22_MMULT_CTRL_ADDR_A_BASE + i*4) = data;
+        if (Operands & XHDCP22_MMULT_OPERAND_B)
+            *(int *)(InstancePtr->Config.BaseAddress + XHDCP22_MMULT_CTRL_ADDR_B_BASE + i*4) = data;
+    }
+    return length;
+}
+
 void XHdcp22_mmult_InterruptGlobalEnable(XHdcp22_mmult *InstancePtr) {
     Xil_AssertVoid(InstancePtr != NULL);
     Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
@@ -22,6 +22,7 @@
 * ----- ------ -------- --------------------------------------------------
 * 1.00  MH     12/07/15 Initial release.
 * 1.01  MH     08/04/16 Added 64 bit address support.
+* 1.5   sb     10/19/26 Added XHdcp22_mmult_Copy_U_Words.
 * </pre>
 *
 ******************************************************************************/
@@ -53,6 +54,11 @@ extern "C" {
 #endif
 #include "xhdcp22_mmult_hw.h"
 
+/************************** Constant Definitions ****************************/
+/** Operand selection of XHdcp22_mmult_Copy_U_Words */
+#define XHDCP22_MMULT_OPERAND_A 0x1
+#define XHDCP22_MMULT_OPERAND_B 0x2
+
 /**************************** Type Definitions ******************************/
 #ifdef __linux__
 typedef uint8_t u8;
@@ -167,6 +173,7 @@ u32 XHdcp22_mmult_Write_NPrime_Words(XHdcp22_mmult *InstancePtr, int offset, int
 u32 XHdcp22_mmult_Read_NPrime_Words(XHdcp22_mmult *InstancePtr, int offset, int *data, int length);
 u32 XHdcp22_mmult_Write_NPrime_Bytes(XHdcp22_mmult *InstancePtr, int offset, char *data, int length);
 u32 XHdcp22_mmult_Read_NPrime_Bytes(XHdcp22_mmult *InstancePtr, int offset, char *data, int length);
+u32 XHdcp22_mmult_Copy_U_Words(XHdcp22_mmult *InstancePtr, u32 Operands, int length);
 
 void XHdcp22_mmult_InterruptGlobalEnable(XHdcp22_mmult *InstancePtr);
 void XHdcp22_mmult_InterruptGlobalDisable(XHdcp22_mmult *InstancePtr);
@@ -77,6 +77,7 @@
 *                     to array. Added function XHDCP22Rx_GetVersion.
 * 2.00  MH   04/14/16 Updated for repeater upstream support.
 * 2.01  MH   02/28/17 Fixed compiler warnings.
+* 3.2   sb   10/19/26 Added the AKE latency to the test instance.
 *</pre>
 *
 *****************************************************************************/
@@ -262,6 +263,8 @@ typedef struct
 	u8                     Rrx[8];
 	u8                     RxCaps[3];
 	u8                     Verbose;
+	u32                    AkeStartTime;
+	u32                    AkeTime;
 } XHdcp22_Rx_Test;
 
 /**
@@ -23,6 +23,11 @@
 * 1.00  MH   10/30/15 First Release
 * 2.00  MH   04/14/16 Updated for repeater upstream support.
 * 2.20  MH   06/21/17 Updated for 64 bit support.
+* 3.2   sb   10/19/26 Sliding window exponentiation, intermediate results of
+*                     the Montgomery multiplier are kept in the core.
+* 3.2   sb   10/19/26 Fixed window exponentiation with a masked table
+*                     lookup, the private exponents do not change the
+*                     sequence of operations.
 *</pre>
 *
 *****************************************************************************/
@@ -37,6 +42,10 @@
 #include "xhdcp22_common.h"
 
 /************************** Constant Definitions ****************************/
+/** Window width in bits of the modular exponentiation, a divisor of 32 */
+#define XHDCP22_RX_MONTEXP_WINDOW         4
+/** Number of precomputed powers of the base, 2^WINDOW */
+#define XHDCP22_RX_MONTEXP_TABLE_SIZE     (1 << XHDCP22_RX_MONTEXP_WINDOW)
 
 /**************************** Type Definitions ******************************/
 
@@ -65,6 +74,10 @@ static void XHdcp22Rx_Pkcs1MontMultFiosStub(u32 *U, u32 *A, u32 *B, u32 *N,
 	            const u32 *NPrime, int NDigits);
 static void XHdcp22Rx_Pkcs1MontMultAdd(u32 *A, u32 C, int SDigit, int NDigits);
 #endif
+static void XHdcp22Rx_Pkcs1MontExpMult(XHdcp22_Rx *InstancePtr, u32 *X,
+	            u8 *InCore, u32 *B, u32 *N, const u32 *NPrime, int NDigits);
+static void XHdcp22Rx_Pkcs1MontExpSelect(u32 *X,
+	            u32 Table[][XHDCP22_RX_P_SIZE/4], u32 Digit, int NDigits);
 static int  XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx *InstancePtr, u32 *C, u32 *A, u32 *E,
 	            u32 *N, const u32 *NPrime, int NDigits);
 
@@ -838,10 +851,14 @@ static void XHdcp22Rx_Pkcs1MontMultFiosInit(XHdcp22_Rx *InstancePtr, u32 *N,
 *
 * U = MontMult(A,B,N)
 *
+* An operand passed as NULL is not written, the core uses the value left in
+* its operand register by the previous run. A NULL result is not read back,
+* it stays in the core for the next run.
+*
 * @param	InstancePtr is a pointer to the MMULT instance.
-* @param	U is the MMM result
-* @param	A is the n-residue input, A' = A*R mod N
-* @param	B is the n-residue input, B' = B*R mod N
+* @param	U is the MMM result, or NULL
+* @param	A is the n-residue input, A' = A*R mod N, or NULL
+* @param	B is the n-residue input, B' = B*R mod N, or NULL
 * @param	NDigits is the integer precision of the arguments (C,A,B,N,NPrime)
 *
 * @return	None.
@@ -853,38 +870,139 @@ static void XHdcp22Rx_Pkcs1MontMultFios(XHdcp22_Rx *InstancePtr, u32 *U,
 {
 	/* Verify arguments */
 	Xil_AssertVoid(InstancePtr != NULL);
-	Xil_AssertVoid(U != NULL);
-	Xil_AssertVoid(A != NULL);
-	Xil_AssertVoid(B != NULL);
 	Xil_AssertVoid(NDigits == 16);
 
-	/* Check Ready */
-	while(XHdcp22_mmult_IsReady(&InstancePtr->MmultInst) == 0);
-
 	/* Write Register A */
-	XHdcp22_mmult_Write_A_Words(&InstancePtr->MmultInst, 0, (int *)A, NDigits);
+	if(A != NULL)
+	{
+		XHdcp22_mmult_Write_A_Words(&InstancePtr->MmultInst, 0, (int *)A, NDigits);
+	}
 
 	/* Write Register B */
-	XHdcp22_mmult_Write_B_Words(&InstancePtr->MmultInst, 0, (int *)B, NDigits);
+	if(B != NULL)
+	{
+		XHdcp22_mmult_Write_B_Words(&InstancePtr->MmultInst, 0, (int *)B, NDigits);
+	}
 
 	/* Run MontMult */
 	XHdcp22_mmult_Start(&InstancePtr->MmultInst);
 
-	/* Poll Result */
+	/* Poll Result, the core is ready again once it is done */
 	while(XHdcp22_mmult_IsDone(&InstancePtr->MmultInst) == 0);
 
 	/* Read Register U */
-	XHdcp22_mmult_Read_U_Words(&InstancePtr->MmultInst, 0, (int *)U, NDigits);
+	if(U != NULL)
+	{
+		XHdcp22_mmult_Read_U_Words(&InstancePtr->MmultInst, 0, (int *)U, NDigits);
+	}
 }
 #endif
 
+/****************************************************************************/
+/**
+* This function multiplies the accumulator of the modular exponentiation.
+*
+* X = MontMult(X,B,N), or X = MontMult(X,X,N) if B is NULL
+*
+* With the MMULT hardware the result is kept in the core. The next call
+* copies it to the operand registers inside the core instead of reading it
+* back and writing it again from memory. X is only read when the accumulator
+* is not yet in the core.
+*
+* @param	InstancePtr is a pointer to the MMULT instance.
+* @param	X is the accumulator in memory.
+* @param	InCore is TRUE if the accumulator is held by the core, it is set
+* 			by this function.
+* @param	B is the n-residue multiplier, or NULL to square.
+* @param	N is the modulus
+* @param	NPrime is a pre-computed constant, NPrime = (1-R*Rbar)/N
+* @param	NDigits is the integer precision of the arguments (X,B,N,NPrime)
+*
+* @return	None.
+*
+* @note		None.
+*****************************************************************************/
+static void XHdcp22Rx_Pkcs1MontExpMult(XHdcp22_Rx *InstancePtr, u32 *X,
+	u8 *InCore, u32 *B, u32 *N, const u32 *NPrime, int NDigits)
+{
+#ifndef _XHDCP22_RX_SW_MMULT_
+	if(*InCore == FALSE)
+	{
+		XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, NULL, X,
+			(B == NULL) ? X : B, NDigits);
+		*InCore = TRUE;
+	}
+	else if(B == NULL)
+	{
+		XHdcp22_mmult_Copy_U_Words(&InstancePtr->MmultInst,
+			XHDCP22_MMULT_OPERAND_A | XHDCP22_MMULT_OPERAND_B, NDigits);
+		XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, NULL, NULL, NULL, NDigits);
+	}
+	else
+	{
+		XHdcp22_mmult_Copy_U_Words(&InstancePtr->MmultInst,
+			XHDCP22_MMULT_OPERAND_A, NDigits);
+		XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, NULL, NULL, B, NDigits);
+	}
+#else
+	XHdcp22Rx_Pkcs1MontMultFiosStub(X, X, (B == NULL) ? X : B, N, NPrime, NDigits);
+	*InCore = FALSE;
+#endif
+}
+
+/****************************************************************************/
+/**
+* This function selects an entry of the table of powers of the modular
+* exponentiation without a secret dependent branch or memory access.
+*
+* Every entry is read and masked, only the entry Digit passes the mask. The
+* time and the addresses read do not depend on Digit.
+*
+* @param	X is the selected entry.
+* @param	Table is the table of XHDCP22_RX_MONTEXP_TABLE_SIZE entries.
+* @param	Digit is the index of the entry to select.
+* @param	NDigits is the integer precision of the entries.
+*
+* @return	None.
+*
+* @note		None.
+*****************************************************************************/
+static void XHdcp22Rx_Pkcs1MontExpSelect(u32 *X,
+	u32 Table[][XHDCP22_RX_P_SIZE/4], u32 Digit, int NDigits)
+{
+	u32 Index;
+	u32 Mask;
+	int Word;
+
+	memset(X, 0, 4*NDigits);
+	for(Index=0; Index<XHDCP22_RX_MONTEXP_TABLE_SIZE; Index++)
+	{
+		/* All ones when Index equals Digit, else zero */
+		Mask = (u32)0 - (((Index ^ Digit) - 1) >> 31);
+		for(Word=0; Word<NDigits; Word++)
+		{
+			X[Word] |= Table[Index][Word] & Mask;
+		}
+	}
+}
+
 /****************************************************************************/
 /**
 * This function performs the modular exponentation operation using the
-* binary square and multiply method.
+* fixed window method.
 *
 * C = ModExp(A, E, N) = A^E*mod(N)
 *
+* The powers A^0, A^1, ..., A^(2^WINDOW-1) are precomputed. The exponent is
+* then scanned from the most significant bit in windows of
+* XHDCP22_RX_MONTEXP_WINDOW bits, every window costs WINDOW squares and one
+* multiplication by the table entry it selects, a zero window included. The
+* entry is selected with XHdcp22Rx_Pkcs1MontExpSelect(). The sequence of
+* multiplier runs, operand transfers and table reads is the same for every
+* exponent of NDigits words, so neither the time nor the memory accesses
+* reveal the private exponents dP and dQ. For a 512 bit exponent this takes
+* 128 multiplications instead of 256 for the binary method.
+*
 * @param	C is result of the modular exponentiation
 * @param	A is the base
 * @param	E is the exponent
@@ -901,9 +1019,15 @@ static int XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx *InstancePtr, u32 *C, u32 *A,
 	u32 *E, u32 *N, const u32 *NPrime, int NDigits)
 {
 	int Offset;
+	int Bit;
+	u32 Index;
+	u32 Digit;
+	u8 InCore = FALSE;
 	u32 R[XHDCP22_RX_N_SIZE/4];
 	u32 Abar[XHDCP22_RX_N_SIZE/4];
 	u32 Xbar[XHDCP22_RX_N_SIZE/4];
+	u32 Tbar[XHDCP22_RX_P_SIZE/4];
+	u32 Table[XHDCP22_RX_MONTEXP_TABLE_SIZE][XHDCP22_RX_P_SIZE/4];
 
 	memset(R, 0, sizeof(R));
 	memset(Abar, 0, sizeof(Abar));
@@ -923,33 +1047,56 @@ static int XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx *InstancePtr, u32 *C, u32 *A,
 	/* Step 2: Abar = A*R*mod(N) */
 	mpModMult(Abar, A, Xbar, N, 2*NDigits);
 
-	/* Step 3: Binary square and multiply */
-	for(Offset=32*NDigits-1; Offset>=0; Offset--)
-	{
+	/* Step 3: Table[i] = Abar^i, Abar stays in register B */
+	memcpy(Table[0], Xbar, 4*NDigits);
+	memcpy(Table[1], Abar, 4*NDigits);
 #ifndef _XHDCP22_RX_SW_MMULT_
-		XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Xbar, Xbar, Xbar, NDigits);
+	XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Table[2], Table[1], Abar, NDigits);
+	for(Index=3; Index<XHDCP22_RX_MONTEXP_TABLE_SIZE; Index++)
+	{
+		XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Table[Index],
+			Table[Index-1], NULL, NDigits);
+	}
 #else
-		XHdcp22Rx_Pkcs1MontMultFiosStub(Xbar, Xbar, Xbar, N, NPrime, NDigits);
+	for(Index=2; Index<XHDCP22_RX_MONTEXP_TABLE_SIZE; Index++)
+	{
+		XHdcp22Rx_Pkcs1MontMultFiosStub(Table[Index], Table[Index-1], Abar,
+			N, NPrime, NDigits);
+	}
 #endif
 
-		if(mpGetBit(E, NDigits, Offset) == TRUE)
+	/* Step 4: Fixed window square and multiply over all exponent bits.
+	 * Windows do not straddle words since 32 is a multiple of WINDOW. */
+	Offset = 32*NDigits - XHDCP22_RX_MONTEXP_WINDOW;
+	Digit = (E[Offset/32] >> (Offset%32)) & (XHDCP22_RX_MONTEXP_TABLE_SIZE-1);
+	XHdcp22Rx_Pkcs1MontExpSelect(Xbar, Table, Digit, NDigits);
+
+	for(Offset-=XHDCP22_RX_MONTEXP_WINDOW; Offset>=0;
+		Offset-=XHDCP22_RX_MONTEXP_WINDOW)
+	{
+		for(Bit=0; Bit<XHDCP22_RX_MONTEXP_WINDOW; Bit++)
 		{
-#ifndef _XHDCP22_RX_SW_MMULT_
-			XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Xbar, Xbar, Abar, NDigits);
-#else
-			XHdcp22Rx_Pkcs1MontMultFiosStub(Xbar, Xbar, Abar, N, NPrime, NDigits);
-#endif
+			XHdcp22Rx_Pkcs1MontExpMult(InstancePtr, Xbar, &InCore, NULL,
+				N, NPrime, NDigits);
 		}
+
+		Digit = (E[Offset/32] >> (Offset%32)) &
+			(XHDCP22_RX_MONTEXP_TABLE_SIZE-1);
+		XHdcp22Rx_Pkcs1MontExpSelect(Tbar, Table, Digit, NDigits);
+		XHdcp22Rx_Pkcs1MontExpMult(InstancePtr, Xbar, &InCore, Tbar, N,
+			NPrime, NDigits);
 	}
 
-	/* Step 4: C=MonPro(Xbar,1) */
+	/* Step 5: C=MonPro(Xbar,1) */
 	memset(R, 0, sizeof(R));
 	R[0] = 1;
+	XHdcp22Rx_Pkcs1MontExpMult(InstancePtr, Xbar, &InCore, R, N, NPrime,
+		NDigits);
 
 #ifndef _XHDCP22_RX_SW_MMULT_
-	XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, C, Xbar, R, NDigits);
+	XHdcp22_mmult_Read_U_Words(&InstancePtr->MmultInst, 0, (int *)C, NDigits);
 #else
-	XHdcp22Rx_Pkcs1MontMultFiosStub(C, Xbar, R, N, NPrime, NDigits);
+	memcpy(C, Xbar, 4*NDigits);
 #endif
 
 	return XST_SUCCESS;
@@ -446,6 +446,7 @@ u8   XHdcp22Rx_TestIsFinished(XHdcp22_Rx *InstancePtr);
 u8   XHdcp22Rx_TestIsPassed(XHdcp22_Rx *InstancePtr);
 int  XHdcp22Rx_TestLoadKeys(XHdcp22_Rx *InstancePtr);
 void XHdcp22Rx_TestSetVerbose(XHdcp22_Rx *InstancePtr, u8 Verbose);
+u32  XHdcp22Rx_TestGetAkeTime(XHdcp22_Rx *InstancePtr);
 
 /* Internal functions used for self-testing */
 int  XHdcp22Rx_TestDdcWriteReg(XHdcp22_Rx *InstancePtr, u8 DeviceAddress, int Size, u8 *Data, u8 Stop);
@@ -24,6 +24,8 @@
 * ----- ---- -------- -----------------------------------------------
 * 1.00  MH   10/30/15 First Release
 * 2.00  MH   04/14/16 Updated for repeater upstream support.
+* 3.2   sb   10/19/26 Measure the AKE latency, from AKE_No_Stored_km or
+*                     AKE_Stored_km to AKE_Send_H_prime.
 *</pre>
 *
 *****************************************************************************/
@@ -737,6 +739,7 @@ int XHdcp22Rx_TestSetMode(XHdcp22_Rx *InstancePtr, XHdcp22_Rx_TestMode TestMode,
 	memset(&InstancePtr->Test.ReadMessageBuffer, 0, sizeof(InstancePtr->Test.ReadMessageBuffer));
 	InstancePtr->Test.TestReturnCode = XST_DEVICE_BUSY;
 	InstancePtr->Test.Verbose = FALSE;
+	InstancePtr->Test.AkeTime = 0;
 
 	/* Set the callback functions */
 	Status = XHdcp22Rx_SetCallback(InstancePtr,  XHDCP22_RX_HANDLER_DDC_SETREGADDR,
@@ -955,6 +958,28 @@ void XHdcp22Rx_TestSetVerbose(XHdcp22_Rx *InstancePtr, u8 Verbose)
 	InstancePtr->Test.Verbose = Verbose;
 }
 
+/****************************************************************************/
+/**
+* This function returns the AKE latency of the last test run, the time from
+* writing AKE_No_Stored_km or AKE_Stored_km to reading AKE_Send_H_prime.
+* It is dominated by the RSA decryption of km for AKE_No_Stored_km, and is
+* used to compare builds of the receiver, e.g. with and without
+* _XHDCP22_RX_SW_MMULT_.
+*
+* @param	InstancePtr is a pointer to an XHdcp22_Rx instance.
+*
+* @return	AKE latency in microseconds, measured with the log timer.
+*
+* @note		The log timer must run, see XHdcp22Rx_LogReset.
+*****************************************************************************/
+u32 XHdcp22Rx_TestGetAkeTime(XHdcp22_Rx *InstancePtr)
+{
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	return InstancePtr->Test.AkeTime;
+}
+
 /****************************************************************************/
 /**
 * This function performs the test DDC write transaction. This function
@@ -1682,7 +1707,8 @@ static int XHdcp22Rx_TestSendAKENoStoredKm(XHdcp22_Rx *InstancePtr)
 		sizeof(XHdcp22_Rx_Test_Ekm[InstancePtr->Test.TestReceiver]));
 	WriteMsgPtr->AKENoStoredKm.MsgId = XHDCP22_RX_MSG_ID_AKENOSTOREDKM;
 
-	/* Write message */
+	/* Write message, the AKE latency starts here */
+	InstancePtr->Test.AkeStartTime = XHdcp22Rx_LogGetTimeUSecs(InstancePtr);
 	MessageBuffer[0] = XHDCP22_RX_DDC_WRITE_REG;
 	Status = XHdcp22Rx_TestDdcWriteReg(InstancePtr, XHDCP22_RX_TEST_DDC_BASE_ADDRESS,
 				sizeof(XHdcp22_Rx_AKENoStoredKm)+1, MessageBuffer, FALSE);
@@ -1724,7 +1750,8 @@ static int XHdcp22Rx_TestSendAKEStoredKm(XHdcp22_Rx *InstancePtr)
 		sizeof(XHdcp22_Rx_Test_EKh[InstancePtr->Test.TestReceiver]));
 	memcpy(WriteMsgPtr->AKEStoredKm.M, M, sizeof(M));
 
-	/* Write message */
+	/* Write message, the AKE latency starts here */
+	InstancePtr->Test.AkeStartTime = XHdcp22Rx_LogGetTimeUSecs(InstancePtr);
 	MessageBuffer[0] = XHDCP22_RX_DDC_WRITE_REG;
 	Status = XHdcp22Rx_TestDdcWriteReg(InstancePtr, XHDCP22_RX_TEST_DDC_BASE_ADDRESS,
 				sizeof(XHdcp22_Rx_AKEStoredKm)+1, MessageBuffer, FALSE);
@@ -2008,6 +2035,9 @@ static int XHdcp22Rx_TestReceiveAKESendHPrime(XHdcp22_Rx *InstancePtr)
 
 			if(ReadMsgPtr->MsgId == XHDCP22_RX_MSG_ID_AKESENDHPRIME)
 			{
+				InstancePtr->Test.AkeTime = XHdcp22Rx_LogGetTimeUSecs(InstancePtr) -
+					InstancePtr->Test.AkeStartTime;
+				xil_printf("AKE latency: %d us\r\n", InstancePtr->Test.AkeTime);
 				XHdcp22Rx_TestPrintMessage(InstancePtr, ReadMsgPtr, XHDCP22_RX_MSG_ID_AKESENDHPRIME);
 				Status = XHdcp22Rx_TestCompare(InstancePtr, "HPrime",
 							XHdcp22_Rx_Test_HPrime[InstancePtr->Test.TestReceiver],
@@ -27,6 +27,7 @@
 * 2.01  MH     02/13/17 1. Updated maximum locality check count
 *                       from 128 to 8 to avoid delays in re-auth.
 *                       2. Added log events for failures.
+* 3.1   sb     10/19/26 Added Montgomery modular exponentiation tests.
 * </pre>
 *
 ******************************************************************************/
@@ -514,6 +515,8 @@ void XHdcp22Tx_TestGenerateRiv(XHdcp22_Tx *InstancePtr, u8* RivPtr);
 void XHdcp22Tx_TestGenerateKs(XHdcp22_Tx *InstancePtr, u8* KsPtr);
 const u8* XHdcp22Tx_TestGetKPubDpc(XHdcp22_Tx *InstancePtr);
 const u8* XHdcp22Tx_TestGetSrm(XHdcp22_Tx *InstancePtr, u8 Select);
+int  XHdcp22Tx_TestMpModExp(XHdcp22_Tx *InstancePtr);
+void XHdcp22Tx_TestMpBenchmark(XHdcp22_Tx *InstancePtr, u32 Count);
 void XHdcp22Tx_LogDisplayUnitTest(XHdcp22_Tx *InstancePtr);
 #endif
 
@@ -29,6 +29,8 @@
 * ----- ------ -------- --------------------------------------------------
 * 1.00  JO     06/17/15 Initial release.
 * 2.00  MH     06/28/16 Updated for repeater downstream support.
+* 3.1   sb     10/19/26 Added known answer test and benchmark of the
+*                       Montgomery modular exponentiation.
 * </pre>
 *
 ******************************************************************************/
@@ -36,6 +38,7 @@
 
 /***************************** Include Files *********************************/
 #include "xhdcp22_tx_i.h"
+#include "xhdcp22_common.h"
 #include "string.h"
 #include "stdlib.h"
 
@@ -43,6 +46,9 @@
 #define XHDCP22_TX_TEST_VECTOR_R1_INDEX 0
 #define XHDCP22_TX_TEST_VECTOR_R2_INDEX 1
 
+/** Size in BigDigits of the largest modulus, the 3072-bit DCP LLC key */
+#define XHDCP22_TX_TEST_BD_SIZE (XHDCP22_TX_KPUB_DCP_LLC_N_SIZE/sizeof(u32))
+
 
 /*
  * All described testvectors are for testing purposes only and can be found in
@@ -453,6 +459,8 @@ static const u8 XHdcp22_Tx_Test_SrmDCPSiteProduction[] = {
 /************************** Function Prototypes ******************************/
 
 static void XHdcp22Tx_TestReadMsg(u8* BufferPtr, u32 TestFlags);
+static void XHdcp22Tx_TestMpLoadKey(u32 Idx, u32 *n, u32 *e, u32 *x,
+                                    size_t *nd);
 
 /************************** Variable Definitions *****************************/
 
@@ -1150,6 +1158,173 @@ const u8* XHdcp22Tx_TestGetSrm(XHdcp22_Tx *InstancePtr, u8 Select)
 	}
 }
 
+/*****************************************************************************/
+/**
+*
+* This function loads one of the modular exponentiation test cases:
+*  - 0 : Signature of receiver certificate R1 with the DCP LLC public key.
+*  - 1 : Signature of receiver certificate R2 with the DCP LLC public key.
+*  - 2 : Public key of receiver R1, message taken from its signature.
+*  - 3 : Public key of receiver R2, message taken from its signature.
+*  - 4 : Receiver R1 modulus with a full length exponent.
+*
+* @param  Idx is the test case.
+* @param  n is the modulus.
+* @param  e is the exponent.
+* @param  x is the base, reduced modulo n.
+* @param  nd is the length of the test case in BigDigits.
+*
+* @return None.
+*
+* @note   None.
+*
+******************************************************************************/
+static void XHdcp22Tx_TestMpLoadKey(u32 Idx, u32 *n, u32 *e, u32 *x,
+                                    size_t *nd)
+{
+	const u8 *CertPtr = XHdcp22_Tx_Test_CertRx[Idx & 1];
+	const u8 *SignPtr = &CertPtr[XHDCP22_TX_CERT_RCVID_SIZE +
+	                             XHDCP22_TX_CERT_PUB_KEY_N_SIZE +
+	                             XHDCP22_TX_CERT_PUB_KEY_E_SIZE +
+	                             XHDCP22_TX_CERT_RSVD_SIZE];
+	size_t Size = XHDCP22_TX_TEST_BD_SIZE;
+
+	if (Idx < 2) {
+		mpConvFromOctets(n, Size, XHdcp22_Tx_Test_Kpubdcp,
+		                 XHDCP22_TX_KPUB_DCP_LLC_N_SIZE);
+		mpConvFromOctets(e, Size,
+		                 &XHdcp22_Tx_Test_Kpubdcp[XHDCP22_TX_KPUB_DCP_LLC_N_SIZE],
+		                 XHDCP22_TX_KPUB_DCP_LLC_E_SIZE);
+		mpConvFromOctets(x, Size, SignPtr, XHDCP22_TX_CERT_SIGNATURE_SIZE);
+	} else {
+		Size = XHDCP22_TX_CERT_PUB_KEY_N_SIZE/sizeof(u32);
+		mpConvFromOctets(n, Size, &CertPtr[XHDCP22_TX_CERT_RCVID_SIZE],
+		                 XHDCP22_TX_CERT_PUB_KEY_N_SIZE);
+		if (Idx < 4) {
+			mpConvFromOctets(e, Size,
+			                 &CertPtr[XHDCP22_TX_CERT_RCVID_SIZE +
+			                          XHDCP22_TX_CERT_PUB_KEY_N_SIZE],
+			                 XHDCP22_TX_CERT_PUB_KEY_E_SIZE);
+		} else {
+			mpConvFromOctets(e, Size,
+			                 &SignPtr[XHDCP22_TX_CERT_PUB_KEY_N_SIZE],
+			                 XHDCP22_TX_CERT_PUB_KEY_N_SIZE);
+		}
+		mpConvFromOctets(x, Size, SignPtr, XHDCP22_TX_CERT_PUB_KEY_N_SIZE);
+	}
+	mpModulo(x, x, Size, n, Size);
+
+	*nd = Size;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is a known answer test of the Montgomery modular
+* exponentiation that mpModExp uses when built with BD_USE_MONT. The results
+* of mpModExpMont are compared with the division based mpModExp_ct for the
+* DCP LLC and receiver keys of the test vectors. It does not depend on
+* BD_USE_MONT, so it can be run before the backend is enabled.
+*
+* @param  InstancePtr is a pointer to the XHdcp22_Tx core instance.
+*
+* @return
+*         - XST_SUCCESS if all results match.
+*         - XST_FAILURE otherwise.
+*
+* @note   None.
+*
+******************************************************************************/
+int XHdcp22Tx_TestMpModExp(XHdcp22_Tx *InstancePtr)
+{
+	u32 n[XHDCP22_TX_TEST_BD_SIZE], e[XHDCP22_TX_TEST_BD_SIZE],
+	    x[XHDCP22_TX_TEST_BD_SIZE], y[XHDCP22_TX_TEST_BD_SIZE],
+	    Ref[XHDCP22_TX_TEST_BD_SIZE];
+	size_t nd;
+	int Status = XST_SUCCESS;
+	u32 Idx;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	for (Idx = 0; Idx < 5; Idx++) {
+		XHdcp22Tx_TestMpLoadKey(Idx, n, e, x, &nd);
+		mpModExp_ct(Ref, x, e, n, nd);
+		mpModExpMont(y, x, e, n, nd);
+		if (!mpEqual(y, Ref, nd)) {
+			xil_printf("mpModExpMont test %d: FAILED\r\n", Idx);
+			Status = XST_FAILURE;
+		}
+	}
+
+	if (Status == XST_SUCCESS) {
+		xil_printf("mpModExpMont: PASSED\r\n");
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function measures the modular exponentiations of the test vectors with
+* mpModExp_ct and mpModExpMont. The time per operation is printed in ticks
+* of the logging timer, which runs at the AXI clock of the timer core, and in
+* microseconds.
+*
+* @param  InstancePtr is a pointer to the XHdcp22_Tx core instance.
+* @param  Count is the number of operations per measurement.
+*
+* @return None.
+*
+* @note   The logging timer wraps after 2^32 ticks, the full length
+*         exponent with mpModExp_ct may take longer at low clock rates.
+*
+******************************************************************************/
+void XHdcp22Tx_TestMpBenchmark(XHdcp22_Tx *InstancePtr, u32 Count)
+{
+	u32 n[XHDCP22_TX_TEST_BD_SIZE], e[XHDCP22_TX_TEST_BD_SIZE],
+	    x[XHDCP22_TX_TEST_BD_SIZE], y[XHDCP22_TX_TEST_BD_SIZE];
+	u32 TicksCt, TicksMont, Start, Loop;
+	u32 TicksPerUsec;
+	size_t nd;
+	u32 Idx;
+
+	/* Verify arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->Timer.TmrCtr.IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(Count > 0);
+
+	TicksPerUsec = InstancePtr->Timer.TmrCtr.Config.SysClockFreqHz / 1000000;
+
+	for (Idx = 0; Idx < 5; Idx += 2) {
+		XHdcp22Tx_TestMpLoadKey(Idx, n, e, x, &nd);
+
+		Start = XTmrCtr_GetValue(&InstancePtr->Timer.TmrCtr,
+		                         XHDCP22_TX_TIMER_CNTR_1);
+		for (Loop = 0; Loop < Count; Loop++) {
+			mpModExp_ct(y, x, e, n, nd);
+		}
+		TicksCt = (XTmrCtr_GetValue(&InstancePtr->Timer.TmrCtr,
+		                            XHDCP22_TX_TIMER_CNTR_1) - Start) / Count;
+
+		Start = XTmrCtr_GetValue(&InstancePtr->Timer.TmrCtr,
+		                         XHDCP22_TX_TIMER_CNTR_1);
+		for (Loop = 0; Loop < Count; Loop++) {
+			mpModExpMont(y, x, e, n, nd);
+		}
+		TicksMont = (XTmrCtr_GetValue(&InstancePtr->Timer.TmrCtr,
+		                              XHDCP22_TX_TIMER_CNTR_1) - Start) / Count;
+
+		xil_printf("%d-bit modulus, %d-bit exponent:\r\n",
+		           (int)(nd * BITS_PER_DIGIT), (int)mpBitLength(e, nd));
+		xil_printf("  mpModExp_ct  %d ticks (%d us)\r\n",
+		           TicksCt, TicksCt / TicksPerUsec);
+		xil_printf("  mpModExpMont %d ticks (%d us)\r\n",
+		           TicksMont, TicksMont / TicksPerUsec);
+	}
+}
+
 /*****************************************************************************/
 /**
 *
@@ -0,0 +1,424 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xmcdma_fring.c
+* @addtogroup mcdma Overview
+* @{
+*
+* This file implements the frame ring interface of the MCDMA driver. Refer to
+* xmcdma_fring.h for more details.
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.11  sb   10/19/26 First release
+* 1.11  sb   10/19/26 Use the rings of xil_fring.h
+* 1.11  sb   10/19/26 Use the rings of the fring driver, xfring.h
+* 1.11  sb   10/19/26 Added XMcdma_FrTxSubmit() to check frames before sending
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xmcdma_fring.h"
+
+/************************** Function Prototypes ******************************/
+
+static void XMcdma_FrRxPost(XMcdma_FrameRing *FrPtr, u32 Idx);
+static u32 XMcdma_FrTxComplete(XMcdma_FrameRing *FrPtr);
+static u32 XMcdma_FrRxReceive(XMcdma_FrameRing *FrPtr, u32 Budget);
+static void XMcdma_FrRxRefill(XMcdma_FrameRing *FrPtr);
+static void XMcdma_FrTxPost(XMcdma_FrameRing *FrPtr);
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+* Initialize a frame ring set over one MCDMA channel pair.
+*
+* The BD chains of both channels must have been created. The rings start
+* empty; the application gives the driver frames to receive into by
+* producing them to the Fill ring.
+*
+* @param	FrPtr is the frame ring set to be initialized.
+* @param	InstancePtr is the initialized MCDMA instance.
+* @param	ChanId is the channel of both directions to use.
+* @param	FrameBase is the address of the frame area, aligned to
+*		XMCDMA_FR_MIN_FRAME_SIZE.
+* @param	FrameSize is the size of a frame, a power of two of at least
+*		XMCDMA_FR_MIN_FRAME_SIZE bytes.
+* @param	FrameCount is the number of frames in the frame area.
+* @param	RingMem is the memory for the rings, XMCDMA_FR_NUM_RINGS *
+*		RingSize descriptors.
+* @param	RingSize is the number of entries of each ring, a power of
+*		two.
+*
+* @return
+*		- XST_SUCCESS if the frame ring set was initialized.
+*		- XST_INVALID_PARAM if a size or alignment is not supported or
+*		the BD chains have not been created.
+*
+*****************************************************************************/
+s32 XMcdma_FrInitialize(XMcdma_FrameRing *FrPtr, XMcdma *InstancePtr,
+			u16 ChanId, UINTPTR FrameBase, u32 FrameSize,
+			u32 FrameCount, XMcdma_FrDesc *RingMem, u32 RingSize)
+{
+	XMcdma_ChanCtrl *RxChan;
+	XMcdma_ChanCtrl *TxChan;
+	u32 Shift;
+
+	Xil_AssertNonvoid(FrPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady != 0U);
+	Xil_AssertNonvoid(ChanId < XMCDMA_MAX_CHAN_PER_DEVICE);
+	Xil_AssertNonvoid(RingMem != NULL);
+
+	RxChan = XMcdma_GetMcdmaRxChan(InstancePtr, ChanId);
+	TxChan = XMcdma_GetMcdmaTxChan(InstancePtr, ChanId);
+
+	if ((FrameSize < XMCDMA_FR_MIN_FRAME_SIZE) ||
+	    ((FrameSize & (FrameSize - 1U)) != 0U) ||
+	    ((FrameBase & (XMCDMA_FR_MIN_FRAME_SIZE - 1U)) != 0U) ||
+	    (FrameCount == 0U) ||
+	    (RingSize == 0U) || ((RingSize & (RingSize - 1U)) != 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	if ((FrameSize > RxChan->MaxTransferLen) ||
+	    (FrameSize > TxChan->MaxTransferLen) ||
+	    (RxChan->FirstBdAddr == 0U) || (TxChan->FirstBdAddr == 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	for (Shift = 0U; (1U << Shift) < FrameSize; Shift++);
+
+	FrPtr->RxChan = RxChan;
+	FrPtr->TxChan = TxChan;
+	FrPtr->FrameBase = FrameBase;
+	FrPtr->FrameSize = FrameSize;
+	FrPtr->FrameShift = Shift;
+	FrPtr->FrameCount = FrameCount;
+	FrPtr->IsRxCacheCoherent = InstancePtr->Config.IsRxCacheCoherent;
+	FrPtr->IsTxCacheCoherent = InstancePtr->Config.IsTxCacheCoherent;
+
+	XFring_RingInit(&FrPtr->Fill, RingMem, RingSize);
+	XFring_RingInit(&FrPtr->Rx, RingMem + RingSize, RingSize);
+	XFring_RingInit(&FrPtr->Tx, RingMem + (2U * RingSize), RingSize);
+	XFring_RingInit(&FrPtr->Comp, RingMem + (3U * RingSize), RingSize);
+
+	memset(&FrPtr->Stats, 0, sizeof(FrPtr->Stats));
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Run the driver side of a frame ring set.
+*
+* Sent frames are moved to the Comp ring and received frames to the Rx ring,
+* then frames of the Fill ring are given to the S2MM channel and frames of
+* the Tx ring to the MM2S channel. Completed BDs stay with the hardware while
+* the ring they go to is full.
+*
+* @param	FrPtr is the frame ring set to be worked on.
+* @param	Budget is the maximum number of frames to receive.
+*
+* @return	The number of frames put on the Rx ring.
+*
+* @note		This function must not be preempted by another call for the
+*		same frame ring set.
+*
+*****************************************************************************/
+u32 XMcdma_FrPoll(XMcdma_FrameRing *FrPtr, u32 Budget)
+{
+	u32 Received;
+
+	(void)XMcdma_FrTxComplete(FrPtr);
+	Received = XMcdma_FrRxReceive(FrPtr, Budget);
+	XMcdma_FrRxRefill(FrPtr);
+	XMcdma_FrTxPost(FrPtr);
+
+	return Received;
+}
+
+/*****************************************************************************/
+/**
+* Hand frames reserved on the Tx ring, now filled in, to the driver.
+*
+* The frames are checked before any of them is handed over: a frame must be
+* in the frame area and its length must be at least one byte and at most
+* FrameSize.
+*
+* @param	FrPtr is the frame ring set to be worked on.
+* @param	Count is the number of frames, at most the number reserved
+*		with XMcdma_FrRingReserve().
+*
+* @return
+*		- XST_SUCCESS if the frames were handed to the driver.
+*		- XST_INVALID_PARAM if a frame index or length is not valid.
+*		No frame was handed over then.
+*
+*****************************************************************************/
+s32 XMcdma_FrTxSubmit(XMcdma_FrameRing *FrPtr, u32 Count)
+{
+	XMcdma_FrDesc *DescPtr;
+	u32 Pos;
+	u32 Index;
+
+	Xil_AssertNonvoid(FrPtr != NULL);
+	Xil_AssertNonvoid(Count <= XMcdma_FrRingFree(&FrPtr->Tx));
+
+	Pos = FrPtr->Tx.Prod;
+
+	for (Index = 0U; Index < Count; Index++) {
+		DescPtr = XMcdma_FrRingDesc(&FrPtr->Tx, Pos + Index);
+		if ((DescPtr->Idx >= FrPtr->FrameCount) ||
+		    (DescPtr->Len == 0U) || (DescPtr->Len > FrPtr->FrameSize)) {
+			return XST_INVALID_PARAM;
+		}
+	}
+
+	XMcdma_FrRingSubmit(&FrPtr->Tx, Count);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/*
+* Prepare an S2MM BD to receive into a frame. The caller commits the BDs
+* with XMcDma_ChanToHw().
+*
+* @param	FrPtr is the frame ring set to be worked on.
+* @param	Idx is the frame index.
+*
+* @return	None.
+*
+*****************************************************************************/
+static void XMcdma_FrRxPost(XMcdma_FrameRing *FrPtr, u32 Idx)
+{
+	XMcdma_ChanCtrl *Chan = FrPtr->RxChan;
+	UINTPTR Addr = XMcdma_FrAddr(FrPtr, Idx);
+
+	if (!FrPtr->IsRxCacheCoherent) {
+		Xil_DCacheInvalidateRange(Addr, FrPtr->FrameSize);
+	}
+
+	(void)XMcDma_ChanSubmit(Chan, Addr, FrPtr->FrameSize);
+	XMcdma_BdSetSwId(Chan->BdTail, Idx);
+	XMCDMA_CACHE_FLUSH((UINTPTR)Chan->BdTail);
+}
+
+/*****************************************************************************/
+/*
+* Move the frames of completed MM2S BDs to the Comp ring.
+*
+* @param	FrPtr is the frame ring set to be worked on.
+*
+* @return	The number of frames moved.
+*
+*****************************************************************************/
+static u32 XMcdma_FrTxComplete(XMcdma_FrameRing *FrPtr)
+{
+	XMcdma_ChanCtrl *Chan = FrPtr->TxChan;
+	XMcdma_Bd *BdPtr;
+	XMcdma_Bd *BdCurPtr;
+	XMcdma_FrDesc *DescPtr;
+	u32 BdCount;
+	u32 Pos;
+	u32 Index;
+
+	BdCount = XMcdma_FrRingReserve(&FrPtr->Comp, Chan->BdSubmitCnt, &Pos);
+	if (BdCount == 0U) {
+		return 0U;
+	}
+
+	BdCount = (u32)XMcdma_BdChainFromHW(Chan, BdCount, &BdPtr);
+	if (BdCount == 0U) {
+		return 0U;
+	}
+
+	BdCurPtr = BdPtr;
+	for (Index = 0U; Index < BdCount; Index++) {
+		if ((XMcDma_TxBdGetSts(BdCurPtr) &
+		     XMCDMA_BD_STS_ALL_ERR_MASK) != 0U) {
+			FrPtr->Stats.TxErrors++;
+		}
+		DescPtr = XMcdma_FrRingDesc(&FrPtr->Comp, Pos + Index);
+		DescPtr->Idx = XMcdma_BdGetSwId(BdCurPtr);
+		DescPtr->Len = XMcdma_BdRead(BdCurPtr, XMCDMA_BD_CTRL_OFFSET) &
+			       Chan->MaxTransferLen;
+		BdCurPtr = (XMcdma_Bd *)XMcdma_BdChainNextBd(Chan, BdCurPtr);
+	}
+
+	(void)XMcdma_BdChainFree(Chan, (int)BdCount, BdPtr);
+	XMcdma_FrRingSubmit(&FrPtr->Comp, BdCount);
+	FrPtr->Stats.TxFrames += BdCount;
+
+	return BdCount;
+}
+
+/*****************************************************************************/
+/*
+* Move the frames of completed S2MM BDs to the Rx ring. Frames received with
+* an error or not fitting in one frame are given back to the S2MM channel.
+*
+* @param	FrPtr is the frame ring set to be worked on.
+* @param	Budget is the maximum number of frames to move.
+*
+* @return	The number of frames moved.
+*
+*****************************************************************************/
+static u32 XMcdma_FrRxReceive(XMcdma_FrameRing *FrPtr, u32 Budget)
+{
+	XMcdma_ChanCtrl *Chan = FrPtr->RxChan;
+	XMcdma_Bd *BdPtr;
+	XMcdma_Bd *BdCurPtr;
+	XMcdma_FrDesc *DescPtr;
+	u32 Drop[XMCDMA_FR_RX_BATCH];
+	u32 NumDrop;
+	u32 Received = 0U;
+	u32 BdCount;
+	u32 Limit;
+	u32 Pos;
+	u32 Index;
+	u32 Sts;
+	u32 Idx;
+
+	while (Received < Budget) {
+		Limit = XMcdma_FrRingReserve(&FrPtr->Rx, Budget - Received, &Pos);
+		if (Limit > XMCDMA_FR_RX_BATCH) {
+			Limit = XMCDMA_FR_RX_BATCH;
+		}
+		if (Limit == 0U) {
+			break;
+		}
+
+		BdCount = (u32)XMcdma_BdChainFromHW(Chan, Limit, &BdPtr);
+		if (BdCount == 0U) {
+			break;
+		}
+
+		NumDrop = 0U;
+		BdCurPtr = BdPtr;
+		for (Index = 0U; Index < BdCount; Index++) {
+			Sts = XMcDma_BdGetSts(BdCurPtr);
+			Idx = XMcdma_BdGetSwId(BdCurPtr);
+			if (((Sts & XMCDMA_BD_STS_ALL_ERR_MASK) != 0U) ||
+			    ((Sts & XMCDMA_BD_STS_RXSOF_MASK) == 0U) ||
+			    ((Sts & XMCDMA_BD_STS_RXEOF_MASK) == 0U)) {
+				Drop[NumDrop++] = Idx;
+			} else {
+				if (!FrPtr->IsRxCacheCoherent) {
+					/* Drop lines speculatively fetched
+					 * while the DMA wrote the frame
+					 */
+					Xil_DCacheInvalidateRange(
+						XMcdma_FrAddr(FrPtr, Idx),
+						FrPtr->FrameSize);
+				}
+				DescPtr = XMcdma_FrRingDesc(&FrPtr->Rx, Pos);
+				DescPtr->Idx = Idx;
+				DescPtr->Len = XMcDma_BdGetActualLength(BdCurPtr,
+							Chan->MaxTransferLen);
+				Pos++;
+			}
+			BdCurPtr = (XMcdma_Bd *)XMcdma_BdChainNextBd(Chan,
+								     BdCurPtr);
+		}
+
+		(void)XMcdma_BdChainFree(Chan, (int)BdCount, BdPtr);
+		XMcdma_FrRingSubmit(&FrPtr->Rx, BdCount - NumDrop);
+		Received += BdCount - NumDrop;
+
+		if (NumDrop != 0U) {
+			FrPtr->Stats.RxErrors += NumDrop;
+			for (Index = 0U; Index < NumDrop; Index++) {
+				XMcdma_FrRxPost(FrPtr, Drop[Index]);
+			}
+			(void)XMcDma_ChanToHw(Chan);
+		}
+	}
+
+	FrPtr->Stats.RxFrames += Received;
+
+	return Received;
+}
+
+/*****************************************************************************/
+/*
+* Give the frames of the Fill ring to the S2MM channel, as far as it has
+* free BDs.
+*
+* @param	FrPtr is the frame ring set to be worked on.
+*
+* @return	None.
+*
+*****************************************************************************/
+static void XMcdma_FrRxRefill(XMcdma_FrameRing *FrPtr)
+{
+	u32 Count;
+	u32 Pos;
+	u32 Index;
+
+	Count = XMcdma_FrRingPeek(&FrPtr->Fill, FrPtr->RxChan->BdCnt, &Pos);
+	if (Count == 0U) {
+		return;
+	}
+
+	for (Index = 0U; Index < Count; Index++) {
+		XMcdma_FrRxPost(FrPtr,
+				XMcdma_FrRingDesc(&FrPtr->Fill, Pos + Index)->Idx);
+	}
+
+	XMcdma_FrRingRelease(&FrPtr->Fill, Count);
+	(void)XMcDma_ChanToHw(FrPtr->RxChan);
+}
+
+/*****************************************************************************/
+/*
+* Give the frames of the Tx ring to the MM2S channel, as far as it has free
+* BDs. The frames have been checked by XMcdma_FrTxSubmit().
+*
+* @param	FrPtr is the frame ring set to be worked on.
+*
+* @return	None.
+*
+*****************************************************************************/
+static void XMcdma_FrTxPost(XMcdma_FrameRing *FrPtr)
+{
+	XMcdma_ChanCtrl *Chan = FrPtr->TxChan;
+	XMcdma_FrDesc *DescPtr;
+	UINTPTR Addr;
+	u32 Count;
+	u32 Pos;
+	u32 Index;
+
+	Count = XMcdma_FrRingPeek(&FrPtr->Tx, Chan->BdCnt, &Pos);
+	if (Count == 0U) {
+		return;
+	}
+
+	for (Index = 0U; Index < Count; Index++) {
+		DescPtr = XMcdma_FrRingDesc(&FrPtr->Tx, Pos + Index);
+		Addr = XMcdma_FrAddr(FrPtr, DescPtr->Idx);
+		if (!FrPtr->IsTxCacheCoherent) {
+			Xil_DCacheFlushRange(Addr, DescPtr->Len);
+		}
+
+		(void)XMcDma_ChanSubmit(Chan, Addr, DescPtr->Len);
+		XMcDma_BdSetCtrl(Chan->BdTail, XMCDMA_BD_CTRL_SOF_MASK |
+				 XMCDMA_BD_CTRL_EOF_MASK);
+		XMcdma_BdSetSwId(Chan->BdTail, DescPtr->Idx);
+		XMCDMA_CACHE_FLUSH((UINTPTR)Chan->BdTail);
+	}
+
+	XMcdma_FrRingRelease(&FrPtr->Tx, Count);
+	(void)XMcDma_ChanToHw(Chan);
+}
@@ -0,0 +1,139 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xmcdma_fring.h
+* @addtogroup mcdma Overview
+* @{
+*
+* Frame ring interface of the MCDMA driver, for applications that process raw
+* Ethernet frames (from AXI Ethernet or 10G/25G Ethernet) without a network
+* stack.
+*
+* The frame area and the Fill, Rx, Tx and Comp rings are those of
+* xfring.h, which describes how frames move between application and
+* driver. The ring types and calls below are aliases of the xfring.h ones.
+*
+* The driver side runs in XMcdma_FrPoll(), which reaps completed BDs of the
+* channel pair into the Rx and Comp rings and turns Fill and Tx entries into
+* BDs. It may be called from a loop or from the MCDMA done callbacks, but
+* from one context only. The application side uses
+* XMcdma_FrRingReserve()/XMcdma_FrRingSubmit() to produce and
+* XMcdma_FrRingPeek()/XMcdma_FrRingRelease() to consume ring entries, except
+* that frames to send are handed over with XMcdma_FrTxSubmit(), which
+* rejects frames longer than FrameSize.
+*
+* The BD chains of both channels must have been created with
+* XMcDma_ChanBdCreate() before XMcdma_FrInitialize(). A frame always uses
+* one BD, so FrameSize must fit the maximum transfer length of the channels
+* and received frames longer than FrameSize are dropped.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.11  sb   10/19/26 First release
+* 1.11  sb   10/19/26 Moved the ring types and calls to xil_fring.h
+* 1.11  sb   10/19/26 Use the rings of the fring driver, xfring.h
+* 1.11  sb   10/19/26 Added XMcdma_FrTxSubmit() to check frames before sending
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef XMCDMA_FRING_H_
+#define XMCDMA_FRING_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+
+#include "xmcdma.h"
+#include "xfring.h"
+
+/************************** Constant Definitions *****************************/
+
+/** Number of rings a frame ring set uses, see XMcdma_FrInitialize() */
+#define XMCDMA_FR_NUM_RINGS		XFRING_NUM_RINGS
+
+/** Minimum frame size, one cache line */
+#define XMCDMA_FR_MIN_FRAME_SIZE	XFRING_MIN_FRAME_SIZE
+
+/** Maximum number of RX BDs reaped at once by XMcdma_FrPoll() */
+#define XMCDMA_FR_RX_BATCH		XFRING_RX_BATCH
+
+/**************************** Type Definitions *******************************/
+
+typedef XFring_Desc XMcdma_FrDesc;	/**< Frame descriptor */
+typedef XFring_Ring XMcdma_FrRing;	/**< Ring of frame descriptors */
+typedef XFring_Stats XMcdma_FrStats;	/**< Frame ring statistics */
+
+/**
+ * Frame ring set of one MCDMA channel pair.
+ */
+typedef struct {
+	XMcdma_ChanCtrl *RxChan;	/**< S2MM channel */
+	XMcdma_ChanCtrl *TxChan;	/**< MM2S channel */
+	UINTPTR FrameBase;		/**< Frame area */
+	u32 FrameSize;			/**< Bytes per frame */
+	u32 FrameShift;			/**< log2(FrameSize) */
+	u32 FrameCount;			/**< Frames in the frame area */
+	u8 IsRxCacheCoherent;		/**< No cache maintenance for RX */
+	u8 IsTxCacheCoherent;		/**< No cache maintenance for TX */
+	XMcdma_FrRing Fill;		/**< Free frames to receive into */
+	XMcdma_FrRing Rx;		/**< Received frames */
+	XMcdma_FrRing Tx;		/**< Frames to send */
+	XMcdma_FrRing Comp;		/**< Sent frames */
+	XMcdma_FrStats Stats;		/**< Statistics */
+} XMcdma_FrameRing;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/*****************************************************************************/
+/**
+* Return the address of a frame of the frame area.
+*
+* @param	FrPtr is the frame ring set to be worked on.
+* @param	Idx is the frame index.
+*
+* @return	The frame address.
+*
+* @note		C-style signature:
+*		UINTPTR XMcdma_FrAddr(XMcdma_FrameRing *FrPtr, u32 Idx)
+*
+******************************************************************************/
+#define XMcdma_FrAddr(FrPtr, Idx) \
+	((FrPtr)->FrameBase + ((UINTPTR)(Idx) << (FrPtr)->FrameShift))
+
+/** Ring calls, see xfring.h */
+#define XMcdma_FrRingDesc(RingPtr, Pos)	XFring_RingDesc(RingPtr, Pos)
+#define XMcdma_FrRingUsed(RingPtr)		XFring_RingUsed(RingPtr)
+#define XMcdma_FrRingFree(RingPtr)		XFring_RingFree(RingPtr)
+#define XMcdma_FrRingReserve(RingPtr, Count, PosPtr) \
+	XFring_RingReserve(RingPtr, Count, PosPtr)
+#define XMcdma_FrRingSubmit(RingPtr, Count) \
+	XFring_RingSubmit(RingPtr, Count)
+#define XMcdma_FrRingPeek(RingPtr, Count, PosPtr) \
+	XFring_RingPeek(RingPtr, Count, PosPtr)
+#define XMcdma_FrRingRelease(RingPtr, Count) \
+	XFring_RingRelease(RingPtr, Count)
+
+/************************** Function Prototypes ******************************/
+
+s32 XMcdma_FrInitialize(XMcdma_FrameRing *FrPtr, XMcdma *InstancePtr,
+			u16 ChanId, UINTPTR FrameBase, u32 FrameSize,
+			u32 FrameCount, XMcdma_FrDesc *RingMem, u32 RingSize);
+u32 XMcdma_FrPoll(XMcdma_FrameRing *FrPtr, u32 Budget);
+s32 XMcdma_FrTxSubmit(XMcdma_FrameRing *FrPtr, u32 Count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XMCDMA_FRING_H_ */
@@ -47,6 +47,12 @@
 * 1.10	akm  02/06/24 Increase the delay after device reset.
 * 1.10	sb   02/09/24 Add support for Infineon flash part S28HS02G.
 * 1.11  ng  08/20/24 Add spartanup device support
+* 1.12  sb  10/19/26 Moved chip select helpers to xospipsv_control.h and
+*                    added linear read path hook in PollTransfer.
+* 1.12  sb  10/19/26 Sync the linear read path on completion of polled,
+*                    interrupt and DMA transfers.
+* 1.12  sb  10/19/26 Sync the linear read path when a transfer starts, so the
+*                    read cache is dropped before a program or erase.
 *
 * </pre>
 *
@@ -71,8 +77,6 @@
 
 /************************** Function Prototypes ******************************/
 
-static inline void XOspiPsv_AssertCS(const XOspiPsv *InstancePtr);
-static inline void XOspiPsv_DeAssertCS(const XOspiPsv *InstancePtr);
 static inline void StubStatusHandler(void *CallBackRef, u32 StatusEvent);
 
 /************************** Variable Definitions *****************************/
@@ -131,6 +135,9 @@ u32 XOspiPsv_CfgInitialize(XOspiPsv *InstancePtr,
 		InstancePtr->Extra_DummyCycle = 0U;
 		InstancePtr->DllMode = XOSPIPSV_DLL_BYPASS_MODE;
 		InstancePtr->DualByteOpcodeEn = 0U;
+		InstancePtr->LinearActive = 0U;
+		InstancePtr->LinearDirty = 0U;
+		InstancePtr->LinearCache = NULL;
 
 #if defined (versal) && !defined (VERSAL_NET) && !defined (SPARTANUP)
 		if (XGetPSVersion_Info() != SILICON_VERSION_1) {
@@ -314,58 +321,6 @@ RETURN_PATH:
 	return Status;
 }
 
-/*****************************************************************************/
-/**
-* @brief
-* Asserts the chip select line.
-*
-* @param	InstancePtr Pointer to the XOspiPsv instance.
-*
-* @return	None
-*
-******************************************************************************/
-static inline void XOspiPsv_AssertCS(const XOspiPsv *InstancePtr)
-{
-	u32 Cfg;
-	u32 Cs;
-
-	Cfg = XOspiPsv_ReadReg(InstancePtr->Config.BaseAddress,
-			XOSPIPSV_CONFIG_REG);
-	Cfg &= ~(XOSPIPSV_CONFIG_REG_PERIPH_CS_LINES_FLD_MASK);
-	/* Set Peripheral select lines */
-	Cs = (~((u32)1U << (u32)InstancePtr->ChipSelect)) & (u32)0xFU;
-	Cfg |= ((Cs) << XOSPIPSV_CONFIG_REG_PERIPH_CS_LINES_FLD_SHIFT);
-	XOspiPsv_WriteReg(InstancePtr->Config.BaseAddress,
-			XOSPIPSV_CONFIG_REG, Cfg);
-}
-
-/*****************************************************************************/
-/**
-* @brief
-* De-asserts the chip select line.
-*
-* @param	InstancePtr Pointer to the XOspiPsv instance.
-*
-* @return	None
-*
-******************************************************************************/
-static inline void XOspiPsv_DeAssertCS(const XOspiPsv *InstancePtr)
-{
-	u32 Cfg;
-
-	Cfg = XOspiPsv_ReadReg(InstancePtr->Config.BaseAddress,
-			XOSPIPSV_CONFIG_REG);
-
-	/* Clear Peripheral select bit and Peripheral select lines, meaning one of
-	 * CS will be used
-	 */
-	Cfg &= ~(XOSPIPSV_CONFIG_REG_PERIPH_CS_LINES_FLD_MASK);
-	/* Set Peripheral select lines */
-	Cfg |= (u32)(XOSPIPSV_CONFIG_REG_PERIPH_CS_LINES_FLD_MASK);
-	XOspiPsv_WriteReg(InstancePtr->Config.BaseAddress,
-			XOSPIPSV_CONFIG_REG, Cfg);
-}
-
 /*****************************************************************************/
 /**
 * @brief
@@ -408,6 +363,11 @@ u32 XOspiPsv_PollTransfer(XOspiPsv *InstancePtr, XOspiPsv_Msg *Msg)
 	InstancePtr->IsBusy = (u32)TRUE;
 	InstancePtr->Msg = Msg;
 
+	/* Command mode transfer, resync the linear read path */
+	if (InstancePtr->LinearActive != 0U) {
+		XOspiPsv_LinearSync(InstancePtr, Msg);
+	}
+
 	XOspiPsv_AssertCS(InstancePtr);
 
 	Status = XOspiPsv_CheckOspiIdle(InstancePtr);
@@ -463,9 +423,7 @@ u32 XOspiPsv_PollTransfer(XOspiPsv *InstancePtr, XOspiPsv_Msg *Msg)
 		Status = XOspiPsv_CheckOspiIdle(InstancePtr);
 	}
 
-	XOspiPsv_DeAssertCS(InstancePtr);
-
-	InstancePtr->IsBusy = (u32)FALSE;
+	XOspiPsv_XferDone(InstancePtr);
 
 ERROR_PATH:
 	return Status;
@@ -513,6 +471,11 @@ u32 XOspiPsv_StartDmaTransfer(XOspiPsv *InstancePtr, XOspiPsv_Msg *Msg)
 	InstancePtr->IsBusy = (u32)TRUE;
 	InstancePtr->Msg = Msg;
 
+	/* Command mode transfer, resync the linear read path */
+	if (InstancePtr->LinearActive != 0U) {
+		XOspiPsv_LinearSync(InstancePtr, Msg);
+	}
+
 	XOspiPsv_AssertCS(InstancePtr);
 
 	Status = XOspiPsv_CheckOspiIdle(InstancePtr);
@@ -593,9 +556,7 @@ u32 XOspiPsv_CheckDmaDone(XOspiPsv *InstancePtr)
 
 	Status = XOspiPsv_CheckOspiIdle(InstancePtr);
 
-	XOspiPsv_DeAssertCS(InstancePtr);
-
-	InstancePtr->IsBusy = (u32)FALSE;
+	XOspiPsv_XferDone(InstancePtr);
 
 ERROR_PATH:
 	return Status;
@@ -650,6 +611,11 @@ u32 XOspiPsv_IntrTransfer(XOspiPsv *InstancePtr, XOspiPsv_Msg *Msg)
 	InstancePtr->IsBusy = (u32)TRUE;
 	InstancePtr->Msg = Msg;
 
+	/* Command mode transfer, resync the linear read path */
+	if (InstancePtr->LinearActive != 0U) {
+		XOspiPsv_LinearSync(InstancePtr, Msg);
+	}
+
 	XOspiPsv_AssertCS(InstancePtr);
 
 	Status = XOspiPsv_CheckOspiIdle(InstancePtr);
@@ -787,8 +753,7 @@ u32 XOspiPsv_IntrHandler(XOspiPsv *InstancePtr)
 				InstancePtr->RxBytes = 0U;
 				InstancePtr->StatusHandler(InstancePtr->StatusRef,
 						XST_SPI_TRANSFER_DONE);
-				XOspiPsv_DeAssertCS(InstancePtr);
-				InstancePtr->IsBusy = (u32)FALSE;
+				XOspiPsv_XferDone(InstancePtr);
 			}
 		}
 	} else {
@@ -821,8 +786,7 @@ u32 XOspiPsv_IntrHandler(XOspiPsv *InstancePtr)
 		}
 
 		InstancePtr->StatusHandler(InstancePtr->StatusRef, StatusReg);
-		XOspiPsv_DeAssertCS(InstancePtr);
-		InstancePtr->IsBusy = (u32)FALSE;
+		XOspiPsv_XferDone(InstancePtr);
 	}
 
 	return XST_SUCCESS;
@@ -59,6 +59,8 @@
 * 1.10	akm  02/01/24 Update OSPI TX tap delay element to 0x26 for DDR mode.
 * 1.11	akm  05/15/24 Added support for x2/x4 operations.
 * 1.11  ng  08/20/24 Add spartanup device support
+* 1.12  sb  10/19/26 Added linear (XIP) read path with read cache and
+*                    prefetch.
 *
 * </pre>
 *
@@ -118,6 +120,34 @@ typedef struct {
 	u8 ExtendedOpcode; /**< Extended opcode in dual-byte opcode mode */
 } XOspiPsv_Msg;
 
+/**
+ * Number of lines in the linear read cache, can be overridden from the
+ * compiler flags.
+ */
+#ifndef XOSPIPSV_LINEAR_CACHE_LINES
+#define XOSPIPSV_LINEAR_CACHE_LINES	8U
+#endif
+
+/**
+ * Size of a linear read cache line in bytes, must be a power of two and a
+ * multiple of 4.
+ */
+#ifndef XOSPIPSV_LINEAR_LINE_SIZE
+#define XOSPIPSV_LINEAR_LINE_SIZE	256U
+#endif
+
+/**
+ * Direct mapped read cache used in front of the linear window. The memory
+ * is supplied by the user through XOspiPsv_LinearEnable().
+ */
+typedef struct {
+	u32 Tag[XOSPIPSV_LINEAR_CACHE_LINES];	/**< Line address, CS and valid bit */
+	u32 Hits;		/**< Reads served from the cache */
+	u32 Misses;		/**< Lines fetched on demand */
+	u32 Prefetches;	/**< Lines fetched through prefetch hints */
+	u32 Data[XOSPIPSV_LINEAR_CACHE_LINES][XOSPIPSV_LINEAR_LINE_SIZE / 4U]; /**< Line data */
+} XOspiPsv_LinearCache;
+
 /**
  * This typedef contains configuration information for the device.
  */
@@ -166,6 +196,11 @@ typedef struct {
 				* 0 - DualByte opcode is disabled
 				* 1 - DualByte opcode is enabled with inverted opcode
 				* 2 - DualByte opcode is enabled with same opcode */
+	u8 LinearActive;	/**< Linear read path is enabled */
+	u8 LinearDirty;		/**< Read instruction has to be reloaded */
+	u32 LinearPrevMode;	/**< Operating mode before linear enable */
+	XOspiPsv_Msg LinearMsg;	/**< Read command template for linear reads */
+	XOspiPsv_LinearCache *LinearCache;	/**< Linear read cache, can be NULL */
 #ifdef __ICCARM__
 #pragma pack(push, 8)
 	u8 UnalignReadBuffer[4];	/**< Buffer used to read the unaligned bytes in DMA */
@@ -436,6 +471,13 @@ u32 XOspiPsv_StartDmaTransfer(XOspiPsv *InstancePtr, XOspiPsv_Msg *Msg);
 u32 XOspiPsv_CheckDmaDone(XOspiPsv *InstancePtr);
 u32 XOspiPsv_SetDllDelay(XOspiPsv *InstancePtr);
 u32 XOspiPsv_ConfigDualByteOpcode(XOspiPsv *InstancePtr, u8 Enable);
+u32 XOspiPsv_LinearEnable(XOspiPsv *InstancePtr, const XOspiPsv_Msg *ReadMsg,
+		XOspiPsv_LinearCache *Cache);
+u32 XOspiPsv_LinearDisable(XOspiPsv *InstancePtr);
+u32 XOspiPsv_LinearRead(XOspiPsv *InstancePtr, u32 Addr, u8 *ReadBfrPtr,
+		u32 ByteCount);
+u32 XOspiPsv_LinearPrefetch(XOspiPsv *InstancePtr, u32 Addr, u32 ByteCount);
+void XOspiPsv_LinearInvalidate(XOspiPsv *InstancePtr);
 #ifdef __cplusplus
 }
 #endif
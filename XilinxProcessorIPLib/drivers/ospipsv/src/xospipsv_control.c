@@ -27,6 +27,7 @@
 * 1.8   sk   11/29/22 Added support for Indirect Non-Dma write.
 * 1.8   akm  01/03/23 Use Xil_WaitForEvent() API for register bit polling.
 * 1.9   sb   26/04/23 Updated address calculation logic in DAC read and write API's
+* 1.12  sb   10/19/26 Added XOspiPsv_XferDone().
 *
 * </pre>
 *
@@ -387,6 +388,23 @@ u32 XOspiPsv_ConfigureTaps(const XOspiPsv *InstancePtr, u32 RxTap, u32 TxTap)
 
 	return Status;
 }
+/*****************************************************************************/
+/**
+* @brief
+* Ends a transfer. De-asserts the chip select and clears the busy flag. Used
+* on the completion path of polled, interrupt and DMA transfers.
+*
+* @param	InstancePtr Pointer to the XOspiPsv instance.
+*
+* @return	None
+*
+******************************************************************************/
+void XOspiPsv_XferDone(XOspiPsv *InstancePtr)
+{
+	XOspiPsv_DeAssertCS(InstancePtr);
+	InstancePtr->IsBusy = (u32)FALSE;
+}
+
 /*****************************************************************************/
 /**
 * @brief
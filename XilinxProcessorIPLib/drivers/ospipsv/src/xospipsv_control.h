@@ -25,6 +25,9 @@
 * 1.8   akm  01/03/23 Use Xil_WaitForEvent() API for register bit polling.
 * 1.9   sb   26/04/23 Updated address calculation logic in DAC read and write API's
 * 1.11  ng  08/20/24 Add spartanup device support
+* 1.12  sb  10/19/26 Moved chip select helpers from xospipsv.c, added
+*                   XOspiPsv_LinearSync().
+* 1.12  sb  10/19/26 Added XOspiPsv_XferDone().
 *
 * </pre>
 *
@@ -156,6 +159,58 @@ static inline void XOspiPsv_ConfigureMux_Dma(const XOspiPsv *InstancePtr)
 	XOspiPsv_Enable(InstancePtr);
 }
 
+/*****************************************************************************/
+/**
+* @brief
+* Asserts the chip select line.
+*
+* @param	InstancePtr Pointer to the XOspiPsv instance.
+*
+* @return	None
+*
+******************************************************************************/
+static inline void XOspiPsv_AssertCS(const XOspiPsv *InstancePtr)
+{
+	u32 Cfg;
+	u32 Cs;
+
+	Cfg = XOspiPsv_ReadReg(InstancePtr->Config.BaseAddress,
+			XOSPIPSV_CONFIG_REG);
+	Cfg &= ~(XOSPIPSV_CONFIG_REG_PERIPH_CS_LINES_FLD_MASK);
+	/* Set Peripheral select lines */
+	Cs = (~((u32)1U << (u32)InstancePtr->ChipSelect)) & (u32)0xFU;
+	Cfg |= ((Cs) << XOSPIPSV_CONFIG_REG_PERIPH_CS_LINES_FLD_SHIFT);
+	XOspiPsv_WriteReg(InstancePtr->Config.BaseAddress,
+			XOSPIPSV_CONFIG_REG, Cfg);
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* De-asserts the chip select line.
+*
+* @param	InstancePtr Pointer to the XOspiPsv instance.
+*
+* @return	None
+*
+******************************************************************************/
+static inline void XOspiPsv_DeAssertCS(const XOspiPsv *InstancePtr)
+{
+	u32 Cfg;
+
+	Cfg = XOspiPsv_ReadReg(InstancePtr->Config.BaseAddress,
+			XOSPIPSV_CONFIG_REG);
+
+	/* Clear Peripheral select bit and Peripheral select lines, meaning one of
+	 * CS will be used
+	 */
+	Cfg &= ~(XOSPIPSV_CONFIG_REG_PERIPH_CS_LINES_FLD_MASK);
+	/* Set Peripheral select lines */
+	Cfg |= (u32)(XOSPIPSV_CONFIG_REG_PERIPH_CS_LINES_FLD_MASK);
+	XOspiPsv_WriteReg(InstancePtr->Config.BaseAddress,
+			XOSPIPSV_CONFIG_REG, Cfg);
+}
+
 /************************** Function Prototypes ******************************/
 
 u32 XOspiPsv_Stig_Read(XOspiPsv *InstancePtr, XOspiPsv_Msg *Msg);
@@ -190,6 +245,8 @@ u32 XOspiPsv_CalculateRxTap(XOspiPsv *InstancePtr, XOspiPsv_Msg *FlashMsg,
 		u8 *AvgRXTap, u8 *MaxWindowSize, u8 DummyIncr, u32 TXTap);
 u32 XOspiPsv_ConfigureTaps(const XOspiPsv *InstancePtr, u32 RxTap, u32 TxTap);
 u32 XOspiPsv_IDac_Write(const XOspiPsv *InstancePtr, const XOspiPsv_Msg *Msg);
+void XOspiPsv_LinearSync(XOspiPsv *InstancePtr, const XOspiPsv_Msg *Msg);
+void XOspiPsv_XferDone(XOspiPsv *InstancePtr);
 
 #ifdef __cplusplus
 }
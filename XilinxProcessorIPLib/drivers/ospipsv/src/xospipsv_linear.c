@@ -0,0 +1,507 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xospipsv_linear.c
+* @addtogroup ospipsv_api OSPIPSV APIs
+* @{
+*
+* The xospipsv_linear.c file implements the linear (XIP) read path of the
+* OSPIPSV driver. Once enabled, reads are served by copying from the memory
+* mapped flash window instead of building a command for every read. A small
+* direct mapped read cache supplied by the user sits in front of the window
+* and can be filled ahead of use through prefetch hints.
+*
+* Command mode transfers stay allowed while the linear path is enabled. When
+* a polled, interrupt or DMA transfer starts, the read instruction is marked
+* for reload on the next linear read and the cache is dropped for TX
+* messages, i.e. program and erase. Linear reads, cache hits included, fail
+* with XST_DEVICE_BUSY while a transfer is in progress, so reads never return
+* stale data.
+* The user still has to wait for the flash to finish the program or erase
+* before reading again. DMA and interrupt transfers require INDAC mode, call
+* XOspiPsv_LinearDisable() or switch the options before using them.
+*
+* The linear window is expected to be mapped as device or non-cacheable
+* memory, the driver does not invalidate the CPU caches for it.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who Date     Changes
+* ----- --- -------- -----------------------------------------------
+* 1.12  sb  10/19/26 First release
+*       sb  10/19/26 Check the state before serving reads from the cache and
+*                    drop the cache when a program or erase starts.
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xospipsv.h"
+#include "xospipsv_control.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XOSPIPSV_LINEAR_TAG_VALID	0x1U	/**< Cache line holds data */
+#define XOSPIPSV_LINEAR_TAG_CS_SHIFT	1U	/**< Chip select bit in the tag */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/**
+ * Returns the cache tag of the line holding LineAddr for the selected flash.
+ */
+#define XOspiPsv_LinearTag(InstancePtr, LineAddr) \
+	((LineAddr) | ((u32)(InstancePtr)->ChipSelect << \
+		XOSPIPSV_LINEAR_TAG_CS_SHIFT) | XOSPIPSV_LINEAR_TAG_VALID)
+
+/**
+ * Returns the cache line index used for LineAddr.
+ */
+#define XOspiPsv_LinearIndex(LineAddr) \
+	(((LineAddr) / XOSPIPSV_LINEAR_LINE_SIZE) % XOSPIPSV_LINEAR_CACHE_LINES)
+
+/************************** Function Prototypes ******************************/
+
+static u32 XOspiPsv_LinearCheck(const XOspiPsv *InstancePtr, u32 Addr,
+		u32 ByteCount);
+static u32 XOspiPsv_LinearFetch(XOspiPsv *InstancePtr, u32 Addr, u8 *Dst,
+		u32 ByteCount);
+static u32 XOspiPsv_LinearFill(XOspiPsv *InstancePtr, u32 LineAddr,
+		u32 *IsHit);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+* @brief
+* Enables the linear read path. The controller is switched to DAC mode and the
+* given read command is used as template for the read instruction of the
+* linear window.
+*
+* @param	InstancePtr Pointer to the XOspiPsv instance.
+* @param	ReadMsg Read command template. Opcode, Addrsize, Dummy, Proto,
+*		IsDDROpCode and ExtendedOpcode are used, the buffer, address and
+*		byte count fields are ignored.
+* @param	Cache Pointer to the read cache, NULL to read the window
+*		directly on every call.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_DEVICE_BUSY if a transfer is in progress.
+*		- XST_FAILURE if the mode could not be switched.
+*
+******************************************************************************/
+u32 XOspiPsv_LinearEnable(XOspiPsv *InstancePtr, const XOspiPsv_Msg *ReadMsg,
+		XOspiPsv_LinearCache *Cache)
+{
+	u32 Status;
+	u32 Options;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ReadMsg != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (InstancePtr->IsBusy == (u32)TRUE) {
+		Status = (u32)XST_DEVICE_BUSY;
+		goto ERROR_PATH;
+	}
+
+	if (InstancePtr->LinearActive == 0U) {
+		InstancePtr->LinearPrevMode = InstancePtr->OpMode;
+	}
+
+	InstancePtr->LinearMsg = *ReadMsg;
+	InstancePtr->LinearMsg.Flags = XOSPIPSV_MSG_FLAG_RX;
+	InstancePtr->LinearMsg.Addrvalid = 1U;
+	InstancePtr->LinearMsg.TxBfrPtr = NULL;
+	InstancePtr->LinearMsg.RxBfrPtr = NULL;
+	InstancePtr->LinearMsg.ByteCount = 0U;
+	InstancePtr->LinearMsg.Xfer64bit = 0U;
+	InstancePtr->LinearCache = Cache;
+
+	if (InstancePtr->OpMode != XOSPIPSV_DAC_MODE) {
+		Options = XOspiPsv_GetOptions(InstancePtr);
+		Options &= ~XOSPIPSV_IDAC_EN_OPTION;
+		Status = XOspiPsv_SetOptions(InstancePtr,
+				Options | XOSPIPSV_DAC_EN_OPTION);
+		if (Status != (u32)XST_SUCCESS) {
+			goto ERROR_PATH;
+		}
+	}
+
+	InstancePtr->LinearDirty = 1U;
+	InstancePtr->LinearActive = 1U;
+	XOspiPsv_LinearInvalidate(InstancePtr);
+
+	Status = (u32)XST_SUCCESS;
+ERROR_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Disables the linear read path, drops the read cache and restores INDAC mode
+* if it was in use before XOspiPsv_LinearEnable().
+*
+* @param	InstancePtr Pointer to the XOspiPsv instance.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_DEVICE_BUSY if a transfer is in progress.
+*		- XST_FAILURE if the mode could not be restored.
+*
+******************************************************************************/
+u32 XOspiPsv_LinearDisable(XOspiPsv *InstancePtr)
+{
+	u32 Status = (u32)XST_SUCCESS;
+	u32 Options;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (InstancePtr->LinearActive == 0U) {
+		goto ERROR_PATH;
+	}
+
+	if (InstancePtr->IsBusy == (u32)TRUE) {
+		Status = (u32)XST_DEVICE_BUSY;
+		goto ERROR_PATH;
+	}
+
+	XOspiPsv_LinearInvalidate(InstancePtr);
+	InstancePtr->LinearActive = 0U;
+	InstancePtr->LinearCache = NULL;
+
+	if ((InstancePtr->LinearPrevMode == XOSPIPSV_IDAC_MODE) &&
+			(InstancePtr->OpMode != XOSPIPSV_IDAC_MODE)) {
+		Options = XOspiPsv_GetOptions(InstancePtr);
+		Options &= ~XOSPIPSV_DAC_EN_OPTION;
+		Status = XOspiPsv_SetOptions(InstancePtr,
+				Options | XOSPIPSV_IDAC_EN_OPTION);
+	}
+
+ERROR_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Reads from the selected flash through the linear window. Reads smaller than
+* the read cache are served line by line from the cache, larger reads and
+* reads without a cache are copied straight from the window.
+*
+* @param	InstancePtr Pointer to the XOspiPsv instance.
+* @param	Addr Flash address to read from.
+* @param	ReadBfrPtr Pointer to the destination buffer.
+* @param	ByteCount Number of bytes to read.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_DEVICE_BUSY if a transfer is in progress.
+*		- XST_FAILURE if the linear path is not enabled or the range is
+*		outside the linear window.
+*
+******************************************************************************/
+u32 XOspiPsv_LinearRead(XOspiPsv *InstancePtr, u32 Addr, u8 *ReadBfrPtr,
+		u32 ByteCount)
+{
+	XOspiPsv_LinearCache *Cache;
+	u32 Status;
+	u32 LineAddr;
+	u32 Offset;
+	u32 Len;
+	u32 IsHit;
+	u32 Index;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ReadBfrPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	/* Also for cache hits, the cache may be stale during a transfer */
+	Status = XOspiPsv_LinearCheck(InstancePtr, Addr, ByteCount);
+	if (Status != (u32)XST_SUCCESS) {
+		goto ERROR_PATH;
+	}
+
+	Cache = InstancePtr->LinearCache;
+	if ((Cache == NULL) || (ByteCount >=
+			(XOSPIPSV_LINEAR_CACHE_LINES * XOSPIPSV_LINEAR_LINE_SIZE))) {
+		Status = XOspiPsv_LinearFetch(InstancePtr, Addr, ReadBfrPtr,
+				ByteCount);
+		goto ERROR_PATH;
+	}
+
+	Status = (u32)XST_SUCCESS;
+	while (ByteCount != 0U) {
+		LineAddr = Addr & ~(XOSPIPSV_LINEAR_LINE_SIZE - 1U);
+		Offset = Addr - LineAddr;
+		Len = XOSPIPSV_LINEAR_LINE_SIZE - Offset;
+		if (Len > ByteCount) {
+			Len = ByteCount;
+		}
+
+		Status = XOspiPsv_LinearFill(InstancePtr, LineAddr, &IsHit);
+		if (Status != (u32)XST_SUCCESS) {
+			goto ERROR_PATH;
+		}
+		if (IsHit != 0U) {
+			Cache->Hits++;
+		} else {
+			Cache->Misses++;
+		}
+
+		Index = XOspiPsv_LinearIndex(LineAddr);
+		Xil_MemCpy(ReadBfrPtr, (u8 *)Cache->Data[Index] + Offset, Len);
+		ReadBfrPtr += Len;
+		Addr += Len;
+		ByteCount -= Len;
+	}
+
+ERROR_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Prefetch hint, loads the lines covering the given range into the read cache
+* so that following reads of the range are served without flash access. At
+* most one cache worth of lines is loaded.
+*
+* @param	InstancePtr Pointer to the XOspiPsv instance.
+* @param	Addr Start of the flash range.
+* @param	ByteCount Size of the flash range in bytes.
+*
+* @return
+*		- XST_SUCCESS if successful or no cache is attached.
+*		- XST_DEVICE_BUSY if a transfer is in progress.
+*		- XST_FAILURE if the linear path is not enabled or the range is
+*		outside the linear window.
+*
+******************************************************************************/
+u32 XOspiPsv_LinearPrefetch(XOspiPsv *InstancePtr, u32 Addr, u32 ByteCount)
+{
+	XOspiPsv_LinearCache *Cache;
+	u32 Status = (u32)XST_SUCCESS;
+	u32 LineAddr;
+	u32 EndAddr;
+	u32 Lines = 0U;
+	u32 IsHit;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	Cache = InstancePtr->LinearCache;
+	if ((Cache == NULL) || (ByteCount == 0U)) {
+		goto ERROR_PATH;
+	}
+
+	Status = XOspiPsv_LinearCheck(InstancePtr, Addr, ByteCount);
+	if (Status != (u32)XST_SUCCESS) {
+		goto ERROR_PATH;
+	}
+
+	LineAddr = Addr & ~(XOSPIPSV_LINEAR_LINE_SIZE - 1U);
+	EndAddr = Addr + ByteCount;
+	while ((LineAddr < EndAddr) && (Lines < XOSPIPSV_LINEAR_CACHE_LINES)) {
+		Status = XOspiPsv_LinearFill(InstancePtr, LineAddr, &IsHit);
+		if (Status != (u32)XST_SUCCESS) {
+			goto ERROR_PATH;
+		}
+		if (IsHit == 0U) {
+			Cache->Prefetches++;
+		}
+		LineAddr += XOSPIPSV_LINEAR_LINE_SIZE;
+		Lines++;
+	}
+
+ERROR_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Drops all lines of the linear read cache. Has to be called after the flash
+* was modified by other means than a transfer of this driver instance, for
+* example by another master.
+*
+* @param	InstancePtr Pointer to the XOspiPsv instance.
+*
+* @return	None
+*
+******************************************************************************/
+void XOspiPsv_LinearInvalidate(XOspiPsv *InstancePtr)
+{
+	u32 Index;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	if (InstancePtr->LinearCache != NULL) {
+		for (Index = 0U; Index < XOSPIPSV_LINEAR_CACHE_LINES; Index++) {
+			InstancePtr->LinearCache->Tag[Index] = 0U;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Called by the transfer APIs when a command mode transfer starts while the
+* linear path is enabled. The message reprograms the read instruction and
+* devsize registers, so they are reloaded on the next linear read. TX
+* messages program or erase the flash, the read cache is dropped for them
+* before the flash changes.
+*
+* @param	InstancePtr Pointer to the XOspiPsv instance.
+* @param	Msg Pointer to the message about to be transferred.
+*
+* @return	None
+*
+******************************************************************************/
+void XOspiPsv_LinearSync(XOspiPsv *InstancePtr, const XOspiPsv_Msg *Msg)
+{
+	InstancePtr->LinearDirty = 1U;
+	if ((Msg->Flags & XOSPIPSV_MSG_FLAG_TX) != 0U) {
+		XOspiPsv_LinearInvalidate(InstancePtr);
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Checks that a linear read of the given range can be served now, from the
+* window or from the read cache.
+*
+* @param	InstancePtr Pointer to the XOspiPsv instance.
+* @param	Addr Flash address to read from.
+* @param	ByteCount Number of bytes to read.
+*
+* @return
+*		- XST_SUCCESS if the read can be served.
+*		- XST_DEVICE_BUSY if a transfer is in progress.
+*		- XST_FAILURE if the linear path is not enabled, the controller
+*		left DAC mode or the range is outside the linear window.
+*
+******************************************************************************/
+static u32 XOspiPsv_LinearCheck(const XOspiPsv *InstancePtr, u32 Addr,
+		u32 ByteCount)
+{
+	u32 Status;
+
+	if ((InstancePtr->LinearActive == 0U) ||
+			(InstancePtr->OpMode != XOSPIPSV_DAC_MODE) ||
+			(Addr >= SIZE_512MB) || (ByteCount > (SIZE_512MB - Addr))) {
+		Status = (u32)XST_FAILURE;
+	} else if (InstancePtr->IsBusy == (u32)TRUE) {
+		Status = (u32)XST_DEVICE_BUSY;
+	} else {
+		Status = (u32)XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Copies data from the linear window of the selected flash, reloading the read
+* instruction first if a command mode transfer changed it.
+*
+* @param	InstancePtr Pointer to the XOspiPsv instance.
+* @param	Addr Flash address to read from.
+* @param	Dst Pointer to the destination buffer.
+* @param	ByteCount Number of bytes to read.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_DEVICE_BUSY if a transfer is in progress.
+*		- XST_FAILURE if the linear path is not enabled, the range is
+*		outside the linear window or the controller is not idle.
+*
+******************************************************************************/
+static u32 XOspiPsv_LinearFetch(XOspiPsv *InstancePtr, u32 Addr, u8 *Dst,
+		u32 ByteCount)
+{
+	u32 Status;
+
+	Status = XOspiPsv_LinearCheck(InstancePtr, Addr, ByteCount);
+	if (Status != (u32)XST_SUCCESS) {
+		goto ERROR_PATH;
+	}
+
+	InstancePtr->IsBusy = (u32)TRUE;
+	XOspiPsv_AssertCS(InstancePtr);
+
+	if (InstancePtr->LinearDirty != 0U) {
+		Status = XOspiPsv_CheckOspiIdle(InstancePtr);
+		if (Status != (u32)XST_SUCCESS) {
+			goto CS_PATH;
+		}
+		XOspiPsv_Setup_Devsize(InstancePtr, &InstancePtr->LinearMsg);
+		XOspiPsv_Setup_Dev_Read_Instr_Reg(InstancePtr,
+				&InstancePtr->LinearMsg);
+		InstancePtr->LinearDirty = 0U;
+	}
+
+	Xil_MemCpy(Dst, (u8 *)(UINTPTR)(XOSPIPSV_LINEAR_ADDR_BASE + Addr),
+			ByteCount);
+	Status = (u32)XST_SUCCESS;
+
+CS_PATH:
+	XOspiPsv_DeAssertCS(InstancePtr);
+	InstancePtr->IsBusy = (u32)FALSE;
+ERROR_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Makes sure the cache line of LineAddr holds the data of the selected flash.
+*
+* @param	InstancePtr Pointer to the XOspiPsv instance.
+* @param	LineAddr Line aligned flash address.
+* @param	IsHit Set to 1 if the line was already cached, 0 if fetched.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_DEVICE_BUSY or XST_FAILURE if the line fetch failed.
+*
+******************************************************************************/
+static u32 XOspiPsv_LinearFill(XOspiPsv *InstancePtr, u32 LineAddr,
+		u32 *IsHit)
+{
+	XOspiPsv_LinearCache *Cache = InstancePtr->LinearCache;
+	u32 Index = XOspiPsv_LinearIndex(LineAddr);
+	u32 Tag = XOspiPsv_LinearTag(InstancePtr, LineAddr);
+	u32 Status = (u32)XST_SUCCESS;
+
+	if (Cache->Tag[Index] == Tag) {
+		*IsHit = 1U;
+		goto ERROR_PATH;
+	}
+
+	*IsHit = 0U;
+	Cache->Tag[Index] = 0U;
+	Status = XOspiPsv_LinearFetch(InstancePtr, LineAddr,
+			(u8 *)Cache->Data[Index], XOSPIPSV_LINEAR_LINE_SIZE);
+	if (Status == (u32)XST_SUCCESS) {
+		Cache->Tag[Index] = Tag;
+	}
+
+ERROR_PATH:
+	return Status;
+}
+/** @} */
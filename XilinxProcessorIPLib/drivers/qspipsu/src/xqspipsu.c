@@ -85,6 +85,8 @@
  * 1.18 sb  08/29/23 Updated PolledTransfer and InterruptHandler functions as modular.
  * 1.18 sb  09/11/23 Fix MISRA-C violation 8.13.
  * 1.19 sb  01/12/24 Added support for baud rate divisior
+ * 1.21 sb  10/19/26 Switch back to GQSPI for transfers while the LQSPI linear
+ *                   read path is enabled.
  *
  * </pre>
  *
@@ -179,6 +181,11 @@ s32 XQspiPsu_CfgInitialize(XQspiPsu *InstancePtr,
 		InstancePtr->GenFifoBus = XQSPIPSU_GENFIFO_BUS_LOWER;
 		InstancePtr->IsUnaligned = 0;
 		InstancePtr->IsManualstart = (u8)TRUE;
+#if !defined (versal)
+		InstancePtr->LinearActive = 0U;
+		InstancePtr->LinearDirty = 0U;
+		InstancePtr->LinearCache = NULL;
+#endif
 
 		/* Select QSPIPSU */
 		XQspiPsu_Select(InstancePtr, XQSPIPSU_SEL_GQSPI_MASK);
@@ -461,6 +468,12 @@ s32 XQspiPsu_PolledTransfer(XQspiPsu *InstancePtr, XQspiPsu_Msg *Msg,
 			goto END;
 		}
 	}
+#if !defined (versal)
+	/* Command mode transfer, switch from LQSPI back to GQSPI */
+	if (InstancePtr->LinearActive != 0U) {
+		XQspiPsu_LinearSync(InstancePtr, Msg, NumMsg);
+	}
+#endif
 	/*
 	 * Set the busy flag, which will be cleared when the transfer is
 	 * entirely done.
@@ -539,6 +552,12 @@ s32 XQspiPsu_InterruptTransfer(XQspiPsu *InstancePtr, XQspiPsu_Msg *Msg,
 		Status = (s32)XST_DEVICE_BUSY;
 		goto END;
 	}
+#if !defined (versal)
+	/* Command mode transfer, switch from LQSPI back to GQSPI */
+	if (InstancePtr->LinearActive != 0U) {
+		XQspiPsu_LinearSync(InstancePtr, Msg, NumMsg);
+	}
+#endif
 #if defined  (XCLOCKING)
 	Xil_ClockEnable(InstancePtr->Config.RefClk);
 #endif
@@ -783,6 +802,13 @@ s32 XQspiPsu_StartDmaTransfer(XQspiPsu *InstancePtr, XQspiPsu_Msg *Msg,
 		}
 	}
 
+#if !defined (versal)
+	/* Command mode transfer, switch from LQSPI back to GQSPI */
+	if (InstancePtr->LinearActive != 0U) {
+		XQspiPsu_LinearSync(InstancePtr, Msg, NumMsg);
+	}
+#endif
+
 	/*
 	 * Set the busy flag, which will be cleared when the transfer is
 	 * entirely done.
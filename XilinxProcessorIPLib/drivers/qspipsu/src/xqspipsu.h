@@ -129,6 +129,8 @@
  * 1.18 sb  08/01/23 Added support for Feed back clock
  * 1.19 sb  01/12/24 Added support for baud rate divisior
  * 1.20 ht  09/27/24 Fix IAR warning.
+ * 1.21 sb  10/19/26 Added LQSPI linear read path with read cache and
+ *                   prefetch (ZynqMP only).
  *
  * </pre>
  *
@@ -218,6 +220,36 @@ typedef struct {
 	u8 BaudRateDiv;		/**< Baud rate divisor to set QSPI clock */
 } XQspiPsu_Config;
 
+#if !defined (versal)
+/**
+ * Number of lines in the linear read cache, can be overridden from the
+ * compiler flags.
+ */
+#ifndef XQSPIPSU_LINEAR_CACHE_LINES
+#define XQSPIPSU_LINEAR_CACHE_LINES	8U
+#endif
+
+/**
+ * Size of a linear read cache line in bytes, must be a power of two and a
+ * multiple of 4.
+ */
+#ifndef XQSPIPSU_LINEAR_LINE_SIZE
+#define XQSPIPSU_LINEAR_LINE_SIZE	256U
+#endif
+
+/**
+ * Direct mapped read cache used in front of the LQSPI linear window. The
+ * memory is supplied by the user through XQspiPsu_LinearEnable().
+ */
+typedef struct {
+	u32 Tag[XQSPIPSU_LINEAR_CACHE_LINES];	/**< Line address and valid bit */
+	u32 Hits;		/**< Reads served from the cache */
+	u32 Misses;		/**< Lines fetched on demand */
+	u32 Prefetches;	/**< Lines fetched through prefetch hints */
+	u32 Data[XQSPIPSU_LINEAR_CACHE_LINES][XQSPIPSU_LINEAR_LINE_SIZE / 4U]; /**< Line data */
+} XQspiPsu_LinearCache;
+#endif
+
 /**
  * The XQspiPsu driver instance data. The user is required to allocate a
  * variable of this type for every QSPIPSU device in the system. A pointer
@@ -245,6 +277,11 @@ typedef struct {
 	XQspiPsu_Msg *Msg;	/**< Message */
 	XQspiPsu_StatusHandler StatusHandler;	/**< Status Handler */
 	void *StatusRef;	/**< Callback reference for status handler */
+#if !defined (versal)
+	u8 LinearActive;	/**< LQSPI linear read path is enabled */
+	u8 LinearDirty;		/**< GQSPI selected, LQSPI has to be re-selected */
+	XQspiPsu_LinearCache *LinearCache;	/**< Linear read cache, can be NULL */
+#endif
 } XQspiPsu;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -526,6 +563,15 @@ s32 XQspiPsu_SetReadMode(XQspiPsu *InstancePtr, u32 Mode);
 void XQspiPsu_SetWP(const XQspiPsu *InstancePtr, u8 Value);
 void XQspiPsu_WriteProtectToggle(const XQspiPsu *InstancePtr, u32 Toggle);
 void XQspiPsu_Idle(const XQspiPsu *InstancePtr);
+#if !defined (versal)
+s32 XQspiPsu_LinearEnable(XQspiPsu *InstancePtr, u32 Options,
+			  XQspiPsu_LinearCache *Cache);
+s32 XQspiPsu_LinearDisable(XQspiPsu *InstancePtr);
+s32 XQspiPsu_LinearRead(XQspiPsu *InstancePtr, u32 Addr, u8 *ReadBfrPtr,
+			u32 ByteCount);
+s32 XQspiPsu_LinearPrefetch(XQspiPsu *InstancePtr, u32 Addr, u32 ByteCount);
+void XQspiPsu_LinearInvalidate(XQspiPsu *InstancePtr);
+#endif
 
 /************************** Variable Prototypes ******************************/
 
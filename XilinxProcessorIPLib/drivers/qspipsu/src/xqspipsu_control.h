@@ -32,6 +32,7 @@
  * 1.18   sb   08/29/23 Added function prototypes for XQspiPsu_PolledMessageTransfer, XQspiPsu_PolledRecvData
  *                      XQspiPsu_PolledSendData, XQspiPsu_IntrDataTransfer, XQspiPsu_IntrSendData,
  *                      XQspiPsu_IntrRecvData and XQspiPsu_IntrDummyDataTransfer.
+ * 1.21   sb   10/19/26 Added XQspiPsu_LinearSync().
  *
  * </pre>
  *
@@ -103,6 +104,10 @@ void XQspiPsu_IntrRecvData(XQspiPsu *InstancePtr,
 			   u32 QspiPsuStatusReg, u32 DmaIntrStatusReg, u8 *DeltaMsgCnt);
 void XQspiPsu_IntrDummyDataTransfer(XQspiPsu *InstancePtr, u32 QspiPsuStatusReg,
 				    u8 DeltaMsgCnt);
+#if !defined (versal)
+void XQspiPsu_LinearSync(XQspiPsu *InstancePtr, const XQspiPsu_Msg *Msg,
+			 u32 NumMsg);
+#endif
 
 #if defined (ARMR5) || defined (__aarch64__) || defined (__MICROBLAZE__) || defined (__riscv)
 s32 XQspipsu_Set_TapDelay(const XQspiPsu *InstancePtr, u32 TapdelayBypass,
@@ -31,6 +31,7 @@
 *                  in safety mode .Done changes such as added U suffix
 * 1.11	akm 11/07/19 Removed LQSPI register access in Versal.
 * 1.15	akm 12/02/21 Fix Doxygen warnings.
+* 1.21	sb  10/19/26 Added LQSPI linear window definitions.
 *
 * </pre>
 *
@@ -72,6 +73,17 @@ extern "C" {
 #define XQSPIPSU_OFFSET     0x100U
 /** @} */
 
+#if !defined (versal)
+/**
+ * @name LQSPI linear window
+ * Flash contents are mapped here while the LQSPI controller is selected.
+ * @{
+ */
+#define XQSPIPSU_LINEAR_ADDR_BASE	0xC0000000U
+#define XQSPIPSU_LINEAR_ADDR_SIZE	0x20000000U
+/** @} */
+#endif
+
 /**
  * @name XQSPIPS Enable Register information
  * QSPIPSU Enable Register
@@ -0,0 +1,505 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xqspipsu_linear.c
+ * @addtogroup qspipsu_api QSPIPSU APIs
+ * @{
+ *
+ * The xqspipsu_linear.c file implements the linear (XIP) read path of the
+ * QSPIPSU driver. Once enabled, the LQSPI controller maps the flash at
+ * XQSPIPSU_LINEAR_ADDR_BASE and reads are served by copying from the window
+ * instead of pushing GENFIFO entries for every read. A small direct mapped
+ * read cache supplied by the user sits in front of the window and can be
+ * filled ahead of use through prefetch hints.
+ *
+ * Transfers issued through the GQSPI APIs stay allowed while the linear path
+ * is enabled: the driver selects GQSPI before the transfer and re-selects
+ * LQSPI on the next linear read. Message lists without an RX message (write
+ * enable, program, erase, register writes) drop the read cache before they
+ * start, and linear reads, cache hits included, fail with XST_DEVICE_BUSY
+ * while a transfer is in progress, so reads after a program or erase never
+ * return stale data. The user still has to
+ * wait for the flash to finish the program or erase before reading again.
+ *
+ * The LQSPI controller is only present on ZynqMP, this file is empty for
+ * Versal. The linear window is expected to be mapped as device or
+ * non-cacheable memory, the driver does not invalidate the CPU caches for it.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who Date     Changes
+ * ----- --- -------- -----------------------------------------------
+ * 1.21  sb  10/19/26 First release
+ *       sb  10/19/26 Check the state before serving reads from the cache.
+ *
+ * </pre>
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xqspipsu.h"
+#include "xqspipsu_control.h"
+
+#if !defined (versal)
+/************************** Constant Definitions *****************************/
+
+#define XQSPIPSU_LINEAR_TAG_VALID	0x1U	/**< Cache line holds data */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/**
+ * Returns the cache line index used for LineAddr.
+ */
+#define XQspiPsu_LinearIndex(LineAddr) \
+	(((LineAddr) / XQSPIPSU_LINEAR_LINE_SIZE) % XQSPIPSU_LINEAR_CACHE_LINES)
+
+/************************** Function Prototypes ******************************/
+
+static s32 XQspiPsu_LinearCheck(const XQspiPsu *InstancePtr, u32 Addr,
+				u32 ByteCount);
+static s32 XQspiPsu_LinearFetch(XQspiPsu *InstancePtr, u32 Addr, u8 *Dst,
+				u32 ByteCount);
+static s32 XQspiPsu_LinearFill(XQspiPsu *InstancePtr, u32 LineAddr,
+			       u32 *IsHit);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+ *
+ * Enables the linear read path. The LQSPI controller is configured for linear
+ * mode and selected.
+ *
+ * @param	InstancePtr Pointer to the XQspiPsu instance.
+ * @param	Options XQSPIPSU_LQSPI_LESS_THEN_SIXTEENMB for flashes up to
+ *		16MB (3-byte addressing), 0 for 4-byte addressing.
+ * @param	Cache Pointer to the read cache, NULL to read the window
+ *		directly on every call.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_DEVICE_BUSY if a transfer is in progress.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+s32 XQspiPsu_LinearEnable(XQspiPsu *InstancePtr, u32 Options,
+			  XQspiPsu_LinearCache *Cache)
+{
+	s32 Status;
+	u32 QspiOptions;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (InstancePtr->IsBusy == (u32)TRUE) {
+		Status = (s32)XST_DEVICE_BUSY;
+		goto END;
+	}
+
+	QspiOptions = XQspiPsu_GetOptions(InstancePtr) |
+		      XQSPIPSU_LQSPI_MODE_OPTION |
+		      (Options & XQSPIPSU_LQSPI_LESS_THEN_SIXTEENMB);
+	Status = XQspiPsu_SetOptions(InstancePtr, QspiOptions);
+	if (Status != (s32)XST_SUCCESS) {
+		goto END;
+	}
+
+	XQspiPsu_Select(InstancePtr, XQSPIPSU_SEL_LQSPI_MASK);
+	InstancePtr->LinearCache = Cache;
+	InstancePtr->LinearDirty = 0U;
+	InstancePtr->LinearActive = 1U;
+	XQspiPsu_LinearInvalidate(InstancePtr);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Disables the linear read path, drops the read cache, takes the LQSPI
+ * controller out of linear mode and selects GQSPI.
+ *
+ * @param	InstancePtr Pointer to the XQspiPsu instance.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_DEVICE_BUSY if a transfer is in progress.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+s32 XQspiPsu_LinearDisable(XQspiPsu *InstancePtr)
+{
+	s32 Status = (s32)XST_SUCCESS;
+	u32 ConfigReg;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (InstancePtr->LinearActive == 0U) {
+		goto END;
+	}
+
+	if (InstancePtr->IsBusy == (u32)TRUE) {
+		Status = (s32)XST_DEVICE_BUSY;
+		goto END;
+	}
+
+	XQspiPsu_LinearInvalidate(InstancePtr);
+	InstancePtr->LinearActive = 0U;
+	InstancePtr->LinearDirty = 0U;
+	InstancePtr->LinearCache = NULL;
+
+	ConfigReg = XQspiPsu_ReadReg(XQSPIPS_BASEADDR, XQSPIPSU_LQSPI_CR_OFFSET);
+	ConfigReg &= ~(XQSPIPSU_LQSPI_CR_LINEAR_MASK);
+	XQspiPsu_WriteReg(XQSPIPS_BASEADDR, XQSPIPSU_LQSPI_CR_OFFSET, ConfigReg);
+	XQspiPsu_Select(InstancePtr, XQSPIPSU_SEL_GQSPI_MASK);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Reads from the flash through the linear window. Reads smaller than the read
+ * cache are served line by line from the cache, larger reads and reads
+ * without a cache are copied straight from the window.
+ *
+ * @param	InstancePtr Pointer to the XQspiPsu instance.
+ * @param	Addr Flash address to read from.
+ * @param	ReadBfrPtr Pointer to the destination buffer.
+ * @param	ByteCount Number of bytes to read.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_DEVICE_BUSY if a transfer is in progress.
+ *		- XST_FAILURE if the linear path is not enabled or the range is
+ *		outside the linear window.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+s32 XQspiPsu_LinearRead(XQspiPsu *InstancePtr, u32 Addr, u8 *ReadBfrPtr,
+			u32 ByteCount)
+{
+	XQspiPsu_LinearCache *Cache;
+	s32 Status;
+	u32 LineAddr;
+	u32 Offset;
+	u32 Len;
+	u32 IsHit;
+	u32 Index;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ReadBfrPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	/* Also for cache hits, the cache may be stale during a transfer */
+	Status = XQspiPsu_LinearCheck(InstancePtr, Addr, ByteCount);
+	if (Status != (s32)XST_SUCCESS) {
+		goto END;
+	}
+
+	Cache = InstancePtr->LinearCache;
+	if ((Cache == NULL) || (ByteCount >=
+				(XQSPIPSU_LINEAR_CACHE_LINES * XQSPIPSU_LINEAR_LINE_SIZE))) {
+		Status = XQspiPsu_LinearFetch(InstancePtr, Addr, ReadBfrPtr,
+					      ByteCount);
+		goto END;
+	}
+
+	Status = (s32)XST_SUCCESS;
+	while (ByteCount != 0U) {
+		LineAddr = Addr & ~(XQSPIPSU_LINEAR_LINE_SIZE - 1U);
+		Offset = Addr - LineAddr;
+		Len = XQSPIPSU_LINEAR_LINE_SIZE - Offset;
+		if (Len > ByteCount) {
+			Len = ByteCount;
+		}
+
+		Status = XQspiPsu_LinearFill(InstancePtr, LineAddr, &IsHit);
+		if (Status != (s32)XST_SUCCESS) {
+			goto END;
+		}
+		if (IsHit != 0U) {
+			Cache->Hits++;
+		} else {
+			Cache->Misses++;
+		}
+
+		Index = XQspiPsu_LinearIndex(LineAddr);
+		Xil_MemCpy(ReadBfrPtr, (u8 *)Cache->Data[Index] + Offset, Len);
+		ReadBfrPtr += Len;
+		Addr += Len;
+		ByteCount -= Len;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Prefetch hint, loads the lines covering the given range into the read cache
+ * so that following reads of the range are served without flash access. At
+ * most one cache worth of lines is loaded.
+ *
+ * @param	InstancePtr Pointer to the XQspiPsu instance.
+ * @param	Addr Start of the flash range.
+ * @param	ByteCount Size of the flash range in bytes.
+ *
+ * @return
+ *		- XST_SUCCESS if successful or no cache is attached.
+ *		- XST_DEVICE_BUSY if a transfer is in progress.
+ *		- XST_FAILURE if the linear path is not enabled or the range is
+ *		outside the linear window.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+s32 XQspiPsu_LinearPrefetch(XQspiPsu *InstancePtr, u32 Addr, u32 ByteCount)
+{
+	XQspiPsu_LinearCache *Cache;
+	s32 Status = (s32)XST_SUCCESS;
+	u32 LineAddr;
+	u32 EndAddr;
+	u32 Lines = 0U;
+	u32 IsHit;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	Cache = InstancePtr->LinearCache;
+	if ((Cache == NULL) || (ByteCount == 0U)) {
+		goto END;
+	}
+
+	Status = XQspiPsu_LinearCheck(InstancePtr, Addr, ByteCount);
+	if (Status != (s32)XST_SUCCESS) {
+		goto END;
+	}
+
+	LineAddr = Addr & ~(XQSPIPSU_LINEAR_LINE_SIZE - 1U);
+	EndAddr = Addr + ByteCount;
+	while ((LineAddr < EndAddr) && (Lines < XQSPIPSU_LINEAR_CACHE_LINES)) {
+		Status = XQspiPsu_LinearFill(InstancePtr, LineAddr, &IsHit);
+		if (Status != (s32)XST_SUCCESS) {
+			goto END;
+		}
+		if (IsHit == 0U) {
+			Cache->Prefetches++;
+		}
+		LineAddr += XQSPIPSU_LINEAR_LINE_SIZE;
+		Lines++;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Drops all lines of the linear read cache. Has to be called after the flash
+ * was modified by other means than the transfer APIs of this instance.
+ *
+ * @param	InstancePtr Pointer to the XQspiPsu instance.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+void XQspiPsu_LinearInvalidate(XQspiPsu *InstancePtr)
+{
+	u32 Index;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	if (InstancePtr->LinearCache != NULL) {
+		for (Index = 0U; Index < XQSPIPSU_LINEAR_CACHE_LINES; Index++) {
+			InstancePtr->LinearCache->Tag[Index] = 0U;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Called by the transfer APIs for every message list while the linear path is
+ * enabled. Selects GQSPI for the transfer and drops the read cache if the
+ * list has no RX message, i.e. may program, erase or write a register of the
+ * flash.
+ *
+ * @param	InstancePtr Pointer to the XQspiPsu instance.
+ * @param	Msg Pointer to the message list about to be transferred.
+ * @param	NumMsg Number of messages in the list.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+void XQspiPsu_LinearSync(XQspiPsu *InstancePtr, const XQspiPsu_Msg *Msg,
+			 u32 NumMsg)
+{
+	u32 Index;
+	u32 HasRx = 0U;
+
+	if (InstancePtr->LinearDirty == 0U) {
+		XQspiPsu_Select(InstancePtr, XQSPIPSU_SEL_GQSPI_MASK);
+		InstancePtr->LinearDirty = 1U;
+	}
+
+	for (Index = 0U; Index < NumMsg; Index++) {
+		if ((Msg[Index].Flags & XQSPIPSU_MSG_FLAG_RX) != (u32)FALSE) {
+			HasRx = 1U;
+		}
+	}
+	if (HasRx == 0U) {
+		XQspiPsu_LinearInvalidate(InstancePtr);
+	}
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Checks that a linear read of the given range can be served now, from the
+ * window or from the read cache.
+ *
+ * @param	InstancePtr Pointer to the XQspiPsu instance.
+ * @param	Addr Flash address to read from.
+ * @param	ByteCount Number of bytes to read.
+ *
+ * @return
+ *		- XST_SUCCESS if the read can be served.
+ *		- XST_DEVICE_BUSY if a transfer is in progress.
+ *		- XST_FAILURE if the linear path is not enabled, LQSPI was taken
+ *		out of linear mode or the range is outside the linear window.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static s32 XQspiPsu_LinearCheck(const XQspiPsu *InstancePtr, u32 Addr,
+				u32 ByteCount)
+{
+	s32 Status;
+
+	if ((InstancePtr->LinearActive == 0U) ||
+	    (Addr >= XQSPIPSU_LINEAR_ADDR_SIZE) ||
+	    (ByteCount > (XQSPIPSU_LINEAR_ADDR_SIZE - Addr))) {
+		Status = (s32)XST_FAILURE;
+	} else if (InstancePtr->IsBusy == (u32)TRUE) {
+		Status = (s32)XST_DEVICE_BUSY;
+	} else if ((InstancePtr->LinearDirty != 0U) &&
+		   ((XQspiPsu_GetLqspiConfigReg(InstancePtr) &
+		     XQSPIPSU_LQSPI_CR_LINEAR_MASK) == 0U)) {
+		Status = (s32)XST_FAILURE;
+	} else {
+		Status = (s32)XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Copies data from the linear window, re-selecting LQSPI first if a GQSPI
+ * transfer ran since the last linear read.
+ *
+ * @param	InstancePtr Pointer to the XQspiPsu instance.
+ * @param	Addr Flash address to read from.
+ * @param	Dst Pointer to the destination buffer.
+ * @param	ByteCount Number of bytes to read.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_DEVICE_BUSY if a transfer is in progress.
+ *		- XST_FAILURE if the linear path is not enabled, LQSPI was taken
+ *		out of linear mode or the range is outside the linear window.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static s32 XQspiPsu_LinearFetch(XQspiPsu *InstancePtr, u32 Addr, u8 *Dst,
+				u32 ByteCount)
+{
+	s32 Status;
+
+	Status = XQspiPsu_LinearCheck(InstancePtr, Addr, ByteCount);
+	if (Status != (s32)XST_SUCCESS) {
+		goto END;
+	}
+
+	if (InstancePtr->LinearDirty != 0U) {
+		XQspiPsu_Select(InstancePtr, XQSPIPSU_SEL_LQSPI_MASK);
+		InstancePtr->LinearDirty = 0U;
+	}
+
+	InstancePtr->IsBusy = (u32)TRUE;
+	Xil_MemCpy(Dst, (u8 *)(UINTPTR)(XQSPIPSU_LINEAR_ADDR_BASE + Addr),
+		   ByteCount);
+	InstancePtr->IsBusy = (u32)FALSE;
+
+	Status = (s32)XST_SUCCESS;
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Makes sure the cache line of LineAddr holds the flash data.
+ *
+ * @param	InstancePtr Pointer to the XQspiPsu instance.
+ * @param	LineAddr Line aligned flash address.
+ * @param	IsHit Set to 1 if the line was already cached, 0 if fetched.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_DEVICE_BUSY or XST_FAILURE if the line fetch failed.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static s32 XQspiPsu_LinearFill(XQspiPsu *InstancePtr, u32 LineAddr,
+			       u32 *IsHit)
+{
+	XQspiPsu_LinearCache *Cache = InstancePtr->LinearCache;
+	u32 Index = XQspiPsu_LinearIndex(LineAddr);
+	u32 Tag = LineAddr | XQSPIPSU_LINEAR_TAG_VALID;
+	s32 Status = (s32)XST_SUCCESS;
+
+	if (Cache->Tag[Index] == Tag) {
+		*IsHit = 1U;
+		goto END;
+	}
+
+	*IsHit = 0U;
+	Cache->Tag[Index] = 0U;
+	Status = XQspiPsu_LinearFetch(InstancePtr, LineAddr,
+				      (u8 *)Cache->Data[Index],
+				      XQSPIPSU_LINEAR_LINE_SIZE);
+	if (Status == (s32)XST_SUCCESS) {
+		Cache->Tag[Index] = Tag;
+	}
+
+END:
+	return Status;
+}
+#endif
+/** @} */
@@ -0,0 +1,437 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file xrfdc_regcache_example.c
+*
+* This example measures the device accesses saved by the shadow register
+* cache and the register transactions of the RFdc driver.
+*
+* It does not need the hardware. The driver is attached to a libmetal I/O
+* region backed by memory, whose read and write operations count the device
+* accesses. The mixer, QMC and coarse delay settings of all blocks of
+* ADC tile 0 and DAC tile 0 are programmed three times:
+*	- without a cache,
+*	- with a cache,
+*	- with a cache, one transaction per tile.
+* Each time the example prints the device reads and writes per API call and
+* checks that the resulting register image is the one written without a
+* cache.
+*
+* Each run first programs one set of settings to warm the cache up and then
+* measures the programming of a second set, as done when retuning a running
+* system.
+*
+* <pre>
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- -----  -------- -----------------------------------------------------
+* 12.3  sb     10/19/26 First release
+*
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+#include <string.h>
+#include "xrfdc.h"
+
+/************************** Constant Definitions ****************************/
+
+#define RFDC_REGCACHE_TILE 0U
+#define RFDC_REGCACHE_BLOCKS 4U
+#define RFDC_REGCACHE_APIS 3U
+#define RFDC_REGCACHE_MIXER 0U
+#define RFDC_REGCACHE_QMC 1U
+#define RFDC_REGCACHE_DELAY 2U
+
+#define RFDC_REGCACHE_MODE_NONE 0U
+#define RFDC_REGCACHE_MODE_CACHE 1U
+#define RFDC_REGCACHE_MODE_TRANSACTION 2U
+#define RFDC_REGCACHE_MODES 3U
+
+/**************************** Type Definitions ******************************/
+
+/*
+ * Device accesses of one API.
+ */
+typedef struct {
+	u32 Calls;
+	u32 Reads;
+	u32 Writes;
+} RFdcRegCacheCount;
+
+/***************** Macros (Inline Functions) Definitions ********************/
+#ifdef __BAREMETAL__
+#define printf xil_printf
+#endif
+
+/************************** Function Prototypes *****************************/
+
+static int RFdcRegCacheExample(void);
+static u32 RFdcRegCacheRun(u32 Mode, RFdcRegCacheCount *Counts, u32 *TileReadsPtr, u32 *TileWritesPtr);
+static u32 RFdcRegCacheProgram(u32 Type, u32 Mode, u32 Set, RFdcRegCacheCount *Counts);
+static void RFdcRegCacheMockReset(void);
+static uint64_t RFdcRegCacheMockRead(struct metal_io_region *io, unsigned long offset, memory_order order,
+				     int width);
+static void RFdcRegCacheMockWrite(struct metal_io_region *io, unsigned long offset, uint64_t value,
+				  memory_order order, int width);
+
+/************************** Variable Definitions ****************************/
+
+static XRFdc RFdcInst; /* RFdc driver instance */
+static XRFdc_Config RFdcConfig; /* Configuration of the simulated IP */
+static XRFdc_RegCache RFdcRegCache; /* Shadow register cache */
+static struct metal_io_region MockIo; /* Simulated register space */
+static metal_phys_addr_t MockPhys;
+static u32 MockRegs[XRFDC_REGION_SIZE / sizeof(u32)];
+static u32 MockImage[XRFDC_REGION_SIZE / sizeof(u32)];
+static u32 MockReads;
+static u32 MockWrites;
+
+static const struct metal_io_ops MockOps = {
+	.read = RFdcRegCacheMockRead,
+	.write = RFdcRegCacheMockWrite,
+};
+
+static const char *RFdcRegCacheApiName[RFDC_REGCACHE_APIS] = {
+	"XRFdc_SetMixerSettings", "XRFdc_SetQMCSettings", "XRFdc_SetCoarseDelaySettings"
+};
+
+static const char *RFdcRegCacheModeName[RFDC_REGCACHE_MODES] = { "no cache", "cache", "cache + transaction" };
+
+/****************************************************************************/
+/**
+*
+* Main function that invokes the example in this file.
+*
+* @param	None.
+*
+* @return
+*		- XRFDC_SUCCESS if the example has completed successfully.
+*		- XRFDC_FAILURE if the example has failed.
+*
+* @note		None.
+*
+*****************************************************************************/
+int main(void)
+{
+	int Status;
+
+	printf("RFdc Register Cache Example Test\r\n");
+
+	Status = RFdcRegCacheExample();
+	if (Status != XRFDC_SUCCESS) {
+		printf("Register Cache Example Test failed\r\n");
+		return XRFDC_FAILURE;
+	}
+
+	printf("Successfully ran Register Cache Example\r\n");
+	return XRFDC_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* This function programs the simulated device in each mode, prints the
+* device accesses and compares the register images.
+*
+* @param	None.
+*
+* @return
+*		- XRFDC_SUCCESS if the example has completed successfully.
+*		- XRFDC_FAILURE if the example has failed.
+*
+* @note		None.
+*
+****************************************************************************/
+static int RFdcRegCacheExample(void)
+{
+	RFdcRegCacheCount Counts[RFDC_REGCACHE_APIS];
+	u32 TileReads;
+	u32 TileWrites;
+	u32 Mode;
+	u32 Api;
+	struct metal_init_params init_param = METAL_INIT_DEFAULTS;
+
+	if (metal_init(&init_param)) {
+		printf("ERROR: Failed to run metal initialization\n");
+		return XRFDC_FAILURE;
+	}
+
+	for (Mode = RFDC_REGCACHE_MODE_NONE; Mode < RFDC_REGCACHE_MODES; Mode++) {
+		if (RFdcRegCacheRun(Mode, Counts, &TileReads, &TileWrites) != XRFDC_SUCCESS) {
+			printf("ERROR: Programming failed with %s\r\n", RFdcRegCacheModeName[Mode]);
+			return XRFDC_FAILURE;
+		}
+
+		printf("\r\n%s:\r\n", RFdcRegCacheModeName[Mode]);
+		if (Mode != RFDC_REGCACHE_MODE_TRANSACTION) {
+			for (Api = 0U; Api < RFDC_REGCACHE_APIS; Api++) {
+				printf("  %-30s %4u reads %4u writes per call\r\n", RFdcRegCacheApiName[Api],
+				       Counts[Api].Reads / Counts[Api].Calls, Counts[Api].Writes / Counts[Api].Calls);
+			}
+		}
+		printf("  %-30s %4u reads %4u writes\r\n", "ADC and DAC tile", TileReads, TileWrites);
+		if (Mode != RFDC_REGCACHE_MODE_NONE) {
+			printf("  cache: %u reads, %u hits, %u writes, %u merged, %u flushes\r\n",
+			       RFdcRegCache.Stats.Reads, RFdcRegCache.Stats.Hits, RFdcRegCache.Stats.Writes,
+			       RFdcRegCache.Stats.Merged, RFdcRegCache.Stats.Flushes);
+		}
+
+		/* The uncached run gives the reference image */
+		if (Mode == RFDC_REGCACHE_MODE_NONE) {
+			memcpy(MockImage, MockRegs, sizeof(MockImage));
+		} else if (memcmp(MockImage, MockRegs, sizeof(MockImage)) != 0) {
+			printf("ERROR: Register image differs with %s\r\n", RFdcRegCacheModeName[Mode]);
+			return XRFDC_FAILURE;
+		}
+	}
+
+	return XRFDC_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* This function initializes the driver on a fresh simulated device and
+* programs ADC and DAC tile 0 twice in one mode, counting the device
+* accesses of the second time.
+*
+* @param	Mode is RFDC_REGCACHE_MODE_NONE, RFDC_REGCACHE_MODE_CACHE or
+*		RFDC_REGCACHE_MODE_TRANSACTION.
+* @param	Counts are the accesses per API.
+* @param	TileReadsPtr is where the device reads of both tiles are
+*		returned.
+* @param	TileWritesPtr is where the device writes of both tiles are
+*		returned.
+*
+* @return
+*		- XRFDC_SUCCESS if successful.
+*		- XRFDC_FAILURE if a driver call failed.
+*
+* @note		None.
+*
+****************************************************************************/
+static u32 RFdcRegCacheRun(u32 Mode, RFdcRegCacheCount *Counts, u32 *TileReadsPtr, u32 *TileWritesPtr)
+{
+	u32 Status;
+	u32 Reads;
+	u32 Writes;
+
+	RFdcRegCacheMockReset();
+
+	memset(&RFdcInst, 0, sizeof(RFdcInst));
+	RFdcInst.io = &MockIo;
+	Status = XRFdc_CfgInitialize(&RFdcInst, &RFdcConfig);
+	if (Status != XRFDC_SUCCESS) {
+		goto RETURN_PATH;
+	}
+	if (Mode != RFDC_REGCACHE_MODE_NONE) {
+		Status = XRFdc_RegCacheEnable(&RFdcInst, &RFdcRegCache);
+		if (Status != XRFDC_SUCCESS) {
+			goto RETURN_PATH;
+		}
+	}
+
+	/* Warm up */
+	Status = RFdcRegCacheProgram(XRFDC_ADC_TILE, Mode, 0U, Counts);
+	Status |= RFdcRegCacheProgram(XRFDC_DAC_TILE, Mode, 0U, Counts);
+	if (Status != XRFDC_SUCCESS) {
+		goto RETURN_PATH;
+	}
+	if (Mode != RFDC_REGCACHE_MODE_NONE) {
+		memset(&RFdcRegCache.Stats, 0, sizeof(RFdcRegCache.Stats));
+	}
+
+	/* Measure */
+	memset(Counts, 0, RFDC_REGCACHE_APIS * sizeof(RFdcRegCacheCount));
+	Reads = MockReads;
+	Writes = MockWrites;
+	Status = RFdcRegCacheProgram(XRFDC_ADC_TILE, Mode, 1U, Counts);
+	Status |= RFdcRegCacheProgram(XRFDC_DAC_TILE, Mode, 1U, Counts);
+	*TileReadsPtr = MockReads - Reads;
+	*TileWritesPtr = MockWrites - Writes;
+
+RETURN_PATH:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* This function programs the mixer, QMC and coarse delay settings of all
+* blocks of tile 0.
+*
+* @param	Type is ADC or DAC. 0 for ADC and 1 for DAC.
+* @param	Mode is RFDC_REGCACHE_MODE_NONE, RFDC_REGCACHE_MODE_CACHE or
+*		RFDC_REGCACHE_MODE_TRANSACTION.
+* @param	Set selects one of two sets of settings.
+* @param	Counts are the accesses per API, updated.
+*
+* @return
+*		- XRFDC_SUCCESS if successful.
+*		- XRFDC_FAILURE if a driver call failed.
+*
+* @note		None.
+*
+****************************************************************************/
+static u32 RFdcRegCacheProgram(u32 Type, u32 Mode, u32 Set, RFdcRegCacheCount *Counts)
+{
+	u32 Status = XRFDC_SUCCESS;
+	u32 Block;
+	u32 Api;
+	u32 Reads;
+	u32 Writes;
+	XRFdc_Mixer_Settings MixerSettings = { 0 };
+	XRFdc_QMC_Settings QMCSettings = { 0 };
+	XRFdc_CoarseDelay_Settings CoarseDelaySettings = { 0 };
+
+	MixerSettings.Freq = (Set == 0U) ? 100.0 : -250.0;
+	MixerSettings.PhaseOffset = (Set == 0U) ? 0.0 : 22.5;
+	MixerSettings.EventSource = XRFDC_EVNT_SRC_TILE;
+	MixerSettings.CoarseMixFreq = XRFDC_COARSE_MIX_BYPASS;
+	MixerSettings.MixerMode = (Type == XRFDC_ADC_TILE) ? XRFDC_MIXER_MODE_R2C : XRFDC_MIXER_MODE_C2R;
+	MixerSettings.FineMixerScale = XRFDC_MIXER_SCALE_AUTO;
+	MixerSettings.MixerType = XRFDC_MIXER_TYPE_FINE;
+
+	QMCSettings.EnableGain = 1U;
+	QMCSettings.EnablePhase = 0U;
+	QMCSettings.GainCorrectionFactor = (Set == 0U) ? 0.9 : 0.75;
+	QMCSettings.OffsetCorrectionFactor = (Set == 0U) ? 5 : -7;
+	QMCSettings.EventSource = XRFDC_EVNT_SRC_TILE;
+
+	CoarseDelaySettings.CoarseDelay = (Set == 0U) ? 3U : 5U;
+	CoarseDelaySettings.EventSource = XRFDC_EVNT_SRC_TILE;
+
+	if (Mode == RFDC_REGCACHE_MODE_TRANSACTION) {
+		Status = XRFdc_BeginTransaction(&RFdcInst);
+	}
+
+	for (Block = 0U; Block < RFDC_REGCACHE_BLOCKS; Block++) {
+		for (Api = 0U; Api < RFDC_REGCACHE_APIS; Api++) {
+			Reads = MockReads;
+			Writes = MockWrites;
+			if (Api == RFDC_REGCACHE_MIXER) {
+				Status |= XRFdc_SetMixerSettings(&RFdcInst, Type, RFDC_REGCACHE_TILE, Block,
+								 &MixerSettings);
+			} else if (Api == RFDC_REGCACHE_QMC) {
+				Status |= XRFdc_SetQMCSettings(&RFdcInst, Type, RFDC_REGCACHE_TILE, Block,
+							       &QMCSettings);
+			} else {
+				Status |= XRFdc_SetCoarseDelaySettings(&RFdcInst, Type, RFDC_REGCACHE_TILE, Block,
+								       &CoarseDelaySettings);
+			}
+			Counts[Api].Calls++;
+			Counts[Api].Reads += MockReads - Reads;
+			Counts[Api].Writes += MockWrites - Writes;
+		}
+	}
+
+	/* Apply the settings of all blocks with one tile event */
+	Status |= XRFdc_UpdateEvent(&RFdcInst, Type, RFDC_REGCACHE_TILE, 0U, XRFDC_EVENT_MIXER);
+
+	if (Mode == RFDC_REGCACHE_MODE_TRANSACTION) {
+		Status |= XRFdc_CommitTransaction(&RFdcInst);
+	}
+
+	return (Status == XRFDC_SUCCESS) ? XRFDC_SUCCESS : XRFDC_FAILURE;
+}
+
+/****************************************************************************/
+/**
+*
+* This function clears the simulated device and the access counters, and
+* sets up the IP registers and the configuration of a Gen 3 device with all
+* tiles and blocks enabled.
+*
+* @param	None.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+static void RFdcRegCacheMockReset(void)
+{
+	u32 Tile;
+
+	memset(MockRegs, 0, sizeof(MockRegs));
+	MockRegs[XRFDC_TILES_ENABLED_OFFSET / sizeof(u32)] = 0xFFU;
+	MockRegs[XRFDC_ADC_PATHS_ENABLED_OFFSET / sizeof(u32)] = 0xFFFFFFFFU;
+	MockRegs[XRFDC_DAC_PATHS_ENABLED_OFFSET / sizeof(u32)] = 0xFFFFFFFFU;
+	MockReads = 0U;
+	MockWrites = 0U;
+
+	metal_io_init(&MockIo, MockRegs, &MockPhys, XRFDC_REGION_SIZE, (unsigned)(-1), 0, &MockOps);
+
+	memset(&RFdcConfig, 0, sizeof(RFdcConfig));
+	RFdcConfig.IPType = XRFDC_GEN3;
+	for (Tile = 0U; Tile < XRFDC_TILE_ID4; Tile++) {
+		RFdcConfig.ADCTile_Config[Tile].Enable = 1U;
+		RFdcConfig.ADCTile_Config[Tile].SamplingRate = 2000.0;
+		RFdcConfig.ADCTile_Config[Tile].MaxSampleRate = 2500.0;
+		RFdcConfig.DACTile_Config[Tile].Enable = 1U;
+		RFdcConfig.DACTile_Config[Tile].SamplingRate = 6000.0;
+		RFdcConfig.DACTile_Config[Tile].MaxSampleRate = 10000.0;
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Read operation of the simulated register space.
+*
+* @param	io is the I/O region.
+* @param	offset is the register offset.
+* @param	order is the memory order, not used.
+* @param	width is the access width in bytes.
+*
+* @return	The register value.
+*
+* @note		None.
+*
+****************************************************************************/
+static uint64_t RFdcRegCacheMockRead(struct metal_io_region *io, unsigned long offset, memory_order order,
+				     int width)
+{
+	u8 *Ptr = (u8 *)io->virt + offset;
+	uint64_t Value = 0U;
+
+	(void)order;
+	MockReads++;
+	memcpy(&Value, Ptr, (size_t)width);
+	return Value;
+}
+
+/****************************************************************************/
+/**
+*
+* Write operation of the simulated register space.
+*
+* @param	io is the I/O region.
+* @param	offset is the register offset.
+* @param	value is the value to be written.
+* @param	order is the memory order, not used.
+* @param	width is the access width in bytes.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+static void RFdcRegCacheMockWrite(struct metal_io_region *io, unsigned long offset, uint64_t value,
+				  memory_order order, int width)
+{
+	u8 *Ptr = (u8 *)io->virt + offset;
+
+	(void)order;
+	MockWrites++;
+	memcpy(Ptr, &value, (size_t)width);
+}
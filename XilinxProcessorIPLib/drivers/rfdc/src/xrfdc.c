@@ -291,6 +291,7 @@ u32 XRFdc_CfgInitialize(XRFdc *InstancePtr, XRFdc_Config *ConfigPtr)
 	InstancePtr->RFdc_Config = *ConfigPtr;
 	InstancePtr->ADC4GSPS = ConfigPtr->ADCType;
 	InstancePtr->StatusHandler = StubHandler;
+	InstancePtr->RegCache = NULL;
 
 	/*
 	 * Indicate the instance is now ready to use.
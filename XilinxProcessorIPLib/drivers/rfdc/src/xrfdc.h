@@ -293,6 +293,9 @@
 *       cog    07/14/23 Fix issues with SDT flow.
 *       cog    07/27/23 Add NCO frequency to config structures.
 * 12.3  cog    07/09/24 Corrected GEN3 maximum ADC VCO frequency.
+*       sb     10/19/26 Added shadow register cache and register
+*                       transactions.
+*       sb     10/19/26 Added NCO frequency hopping tables.
 *
 * </pre>
 *
@@ -769,6 +772,54 @@ typedef struct {
 	XRFdc_ADCBlock_DigitalDataPath ADCBlock_Digital_Datapath[4];
 } XRFdc_ADC_Tile;
 
+/**
+ * Shadow register cache statistics.
+ */
+typedef struct {
+	u32 Reads; /* 16-bit register reads of the driver */
+	u32 Hits; /* Reads served from the cache */
+	u32 Writes; /* 16-bit register writes of the driver */
+	u32 Merged; /* Writes merged into a pending write of a transaction */
+	u32 Flushes; /* Flushes of pending writes */
+} XRFdc_RegCache_Stats;
+
+/**
+ * Shadow register cache of the tile DRP windows, allocated by the user.
+ * See XRFdc_RegCacheEnable().
+ */
+typedef struct {
+	u16 Value[XRFDC_REGCACHE_REGS]; /* Register images */
+	u32 Valid[XRFDC_REGCACHE_REGS / 32U]; /* Set if Value holds the register */
+	u32 Dirty[XRFDC_REGCACHE_REGS / 32U]; /* Set if Value is a pending write */
+	u16 Journal[XRFDC_REGCACHE_PENDING_MAX]; /* Pending writes in program order */
+	u32 Pending; /* Number of pending writes */
+	u8 InTransaction; /* Set between begin and commit of a transaction */
+	XRFdc_RegCache_Stats Stats; /* Statistics */
+} XRFdc_RegCache;
+
+#define XRFDC_HOP_ENTRIES_MAX 64U
+#define XRFDC_HOP_NCO_REGS 5U
+
+/**
+ * NCO frequency hopping table, allocated by the user. It holds the NCO
+ * register values of each hop for each converter block, computed up front.
+ * See XRFdc_HopTableInit().
+ */
+typedef struct {
+	u32 Type; /* ADC or DAC */
+	u32 Tile_Id; /* Tile of the blocks */
+	u32 EventSource; /* Event that applies a hop */
+	u32 TriggerAddr; /* Tile common base for the tile event, 0 if external */
+	u32 NumBlocks; /* Converter blocks written by a hop */
+	u32 Block_Id[4]; /* Block number of each converter block */
+	u32 Index[4]; /* Index of each converter block in the tile */
+	u32 BaseAddr[4]; /* Base address of each converter block */
+	u32 NumEntries; /* Number of hops */
+	double Freq[XRFDC_HOP_ENTRIES_MAX]; /* NCO frequency of each hop */
+	double PhaseOffset[XRFDC_HOP_ENTRIES_MAX]; /* NCO phase offset of each hop */
+	u16 Image[XRFDC_HOP_ENTRIES_MAX][4][XRFDC_HOP_NCO_REGS]; /* NCO register values */
+} XRFdc_HopTable;
+
 /**
  * RFdc Structure.
  */
@@ -784,6 +835,7 @@ typedef struct {
 	XRFdc_StatusHandler StatusHandler; /* Event handler function */
 	void *CallBackRef; /* Callback reference for event handler */
 	u8 UpdateMixerScale; /* Set to 1, if user overwrite mixer scale */
+	XRFdc_RegCache *RegCache; /* Shadow register cache, NULL if not used */
 } XRFdc;
 #ifndef __BAREMETAL__
 #pragma pack()
@@ -929,6 +981,13 @@ typedef struct {
 
 #define XRFDC_MIXER_PHASE_OFFSET_UP_LIMIT 180.0
 #define XRFDC_MIXER_PHASE_OFFSET_LOW_LIMIT (-180.0)
+
+#define XRFDC_HOP_BLOCK_MASK 0xFU
+#define XRFDC_HOP_FQWD_LOW 0U
+#define XRFDC_HOP_FQWD_MID 1U
+#define XRFDC_HOP_FQWD_UPP 2U
+#define XRFDC_HOP_PHASE_LOW 3U
+#define XRFDC_HOP_PHASE_UPP 4U
 #define XRFDC_UPDATE_THRESHOLD_0 0x1U
 #define XRFDC_UPDATE_THRESHOLD_1 0x2U
 #define XRFDC_UPDATE_THRESHOLD_BOTH 0x4U
@@ -1392,6 +1451,10 @@ u32 XRFdc_SetDecoderMode(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id, u32 Deco
 u32 XRFdc_UpdateEvent(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, u32 Event);
 u32 XRFdc_GetDecoderMode(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id, u32 *DecoderModePtr);
 u32 XRFdc_ResetNCOPhase(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id);
+u32 XRFdc_HopTableInit(XRFdc *InstancePtr, XRFdc_HopTable *TablePtr, u32 Type, u32 Tile_Id, u32 BlockMask,
+		       u32 EventSource);
+u32 XRFdc_HopTableSetEntry(XRFdc *InstancePtr, XRFdc_HopTable *TablePtr, u32 Entry, double Freq, double PhaseOffset);
+u32 XRFdc_Hop(XRFdc *InstancePtr, const XRFdc_HopTable *TablePtr, u32 Entry);
 void XRFdc_DumpRegs(XRFdc *InstancePtr, u32 Type, int Tile_Id);
 u32 XRFdc_MultiBand(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u8 DigitalDataPathMask, u32 MixerInOutDataType,
 		    u32 DataConverterMask);
@@ -1463,6 +1526,15 @@ void XRFdc_ClrSetReg(XRFdc *InstancePtr, u32 BaseAddr, u32 RegAddr, u16 Mask, u1
 void XRFdc_ClrReg(XRFdc *InstancePtr, u32 BaseAddr, u32 RegAddr, u16 Mask);
 u16 XRFdc_RDReg(XRFdc *InstancePtr, u32 BaseAddr, u32 RegAddr, u16 Mask);
 u32 XRFdc_IsHighSpeedADC(XRFdc *InstancePtr, u32 Tile);
+u32 XRFdc_RegCacheEnable(XRFdc *InstancePtr, XRFdc_RegCache *CachePtr);
+void XRFdc_RegCacheInvalidate(XRFdc *InstancePtr, u32 Type, int Tile_Id);
+void XRFdc_RegCacheInvalidateReg(XRFdc *InstancePtr, u32 BaseAddr, u32 RegAddr);
+u32 XRFdc_BeginTransaction(XRFdc *InstancePtr);
+u32 XRFdc_CommitTransaction(XRFdc *InstancePtr);
+u16 XRFdc_RegCacheRead16(XRFdc *InstancePtr, u32 Addr);
+void XRFdc_RegCacheWrite16(XRFdc *InstancePtr, u32 Addr, u16 Value);
+u32 XRFdc_RegCacheRead32(XRFdc *InstancePtr, u32 Addr);
+void XRFdc_RegCacheWrite32(XRFdc *InstancePtr, u32 Addr, u32 Value);
 u32 XRFdc_IsDACBlockEnabled(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id);
 u32 XRFdc_IsADCBlockEnabled(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id);
 u32 XRFdc_IsDACDigitalPathEnabled(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id);
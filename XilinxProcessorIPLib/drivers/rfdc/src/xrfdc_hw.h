@@ -110,6 +110,8 @@
 *                       the config structure.
 * 12.0  cog    01/07/23 Added VOP support for DC coupled DACs and removed VOP
 *                       support for ES1 Parts.
+* 12.3  sb     10/19/26 16 and 32-bit register accesses go through the
+*                       shadow register cache when it is enabled.
 *
 *</pre>
 *
@@ -2229,6 +2231,12 @@ extern "C" {
 #define XRFDC_HSCOM_ADDR 0x1C00U
 #define XRFDC_BLOCK_ADDR_OFFSET(X) (X * 0x400U)
 #define XRFDC_TILE_DRP_OFFSET 0x2000U
+#define XRFDC_TILE_ADDR_SIZE 0x4000U /**< Address space of a tile */
+
+#define XRFDC_REGCACHE_TILES 8U /**< DAC and ADC tiles in the register cache */
+#define XRFDC_REGCACHE_TILE_REGS 0x1000U /**< 16-bit registers of a tile DRP window */
+#define XRFDC_REGCACHE_REGS (XRFDC_REGCACHE_TILES * XRFDC_REGCACHE_TILE_REGS)
+#define XRFDC_REGCACHE_PENDING_MAX 256U /**< Pending writes of a transaction */
 
 /***************** Macros (Inline Functions) Definitions *********************/
 #define XRFdc_In64 metal_io_read64
@@ -2297,7 +2305,9 @@ extern "C" {
 *
 ******************************************************************************/
 #define XRFdc_ReadReg(InstancePtr, BaseAddress, RegOffset)                                                             \
-	XRFdc_In32((InstancePtr->io), ((u32)BaseAddress + (u32)RegOffset))
+	(((InstancePtr)->RegCache == NULL) ?                                                                           \
+		 XRFdc_In32((InstancePtr->io), ((u32)BaseAddress + (u32)RegOffset)) :                                   \
+		 XRFdc_RegCacheRead32((InstancePtr), ((u32)BaseAddress + (u32)RegOffset)))
 
 /***************************************************************************/
 /**
@@ -2317,7 +2327,9 @@ extern "C" {
 *
 ******************************************************************************/
 #define XRFdc_WriteReg(InstancePtr, BaseAddress, RegOffset, RegisterValue)                                             \
-	XRFdc_Out32((InstancePtr->io), ((u32)RegOffset + (u32)BaseAddress), (u32)(RegisterValue))
+	(((InstancePtr)->RegCache == NULL) ?                                                                           \
+		 XRFdc_Out32((InstancePtr->io), ((u32)RegOffset + (u32)BaseAddress), (u32)(RegisterValue)) :            \
+		 XRFdc_RegCacheWrite32((InstancePtr), ((u32)RegOffset + (u32)BaseAddress), (u32)(RegisterValue)))
 
 /****************************************************************************/
 /**
@@ -2335,7 +2347,9 @@ extern "C" {
 *
 ******************************************************************************/
 #define XRFdc_ReadReg16(InstancePtr, BaseAddress, RegOffset)                                                           \
-	XRFdc_In16((InstancePtr->io), ((u32)RegOffset + (u32)BaseAddress))
+	(((InstancePtr)->RegCache == NULL) ?                                                                           \
+		 XRFdc_In16((InstancePtr->io), ((u32)RegOffset + (u32)BaseAddress)) :                                   \
+		 XRFdc_RegCacheRead16((InstancePtr), ((u32)RegOffset + (u32)BaseAddress)))
 
 /***************************************************************************/
 /**
@@ -2355,7 +2369,9 @@ extern "C" {
 *
 ******************************************************************************/
 #define XRFdc_WriteReg16(InstancePtr, BaseAddress, RegOffset, RegisterValue)                                           \
-	XRFdc_Out16((InstancePtr->io), ((u32)RegOffset + (u32)BaseAddress), (u32)(RegisterValue))
+	(((InstancePtr)->RegCache == NULL) ?                                                                           \
+		 XRFdc_Out16((InstancePtr->io), ((u32)RegOffset + (u32)BaseAddress), (u32)(RegisterValue)) :            \
+		 XRFdc_RegCacheWrite16((InstancePtr), ((u32)RegOffset + (u32)BaseAddress), (u16)(RegisterValue)))
 
 /****************************************************************************/
 /**
@@ -56,6 +56,7 @@
 * 11.0  cog    05/31/21 Upversion.
 * 11.1  cog    11/16/21 Upversion.
 *       cog    01/18/22 Added safety checks.
+* 12.3  sb     10/19/26 Added NCO frequency hopping tables.
 * </pre>
 *
 ******************************************************************************/
@@ -74,6 +75,9 @@ static void XRFdc_SetCoarseMixer(XRFdc *InstancePtr, u32 Type, u32 BaseAddr, u32
 static u32 XRFdc_MixerRangeCheck(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id,
 				 XRFdc_Mixer_Settings *MixerSettingsPtr);
 static void XRFdc_MixersOff(XRFdc *InstancePtr, u32 BaseAddr);
+static u32 XRFdc_MixerBWDivisor(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, u32 *BWDivPtr);
+static u32 XRFdc_MixerFreqWord(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, double SamplingRate,
+			       double NCOFreq, s64 *FreqPtr);
 
 /************************** Function Prototypes ******************************/
 
@@ -118,9 +122,7 @@ u32 XRFdc_SetMixerSettings(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_
 	u8 CalibrationMode = 0U;
 	u32 CoarseMixFreq;
 	double NCOFreq;
-	u32 NyquistZone = 0U;
 	u32 Offset;
-	u32 DatapathMode;
 	u32 BWDiv = XRFDC_FULL_BW_DIVISOR;
 
 	Xil_AssertNonvoid(InstancePtr != NULL);
@@ -131,26 +133,9 @@ u32 XRFdc_SetMixerSettings(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_
 	if (Status != XRFDC_SUCCESS) {
 		goto RETURN_PATH;
 	}
-	if (InstancePtr->RFdc_Config.IPType >= XRFDC_GEN3) {
-		if (Type == XRFDC_DAC_TILE) {
-			DatapathMode = XRFdc_RDReg(InstancePtr, XRFDC_BLOCK_BASE(XRFDC_DAC_TILE, Tile_Id, Block_Id),
-						   XRFDC_DAC_DATAPATH_OFFSET, XRFDC_DATAPATH_MODE_MASK);
-			switch (DatapathMode) {
-			case XRFDC_DAC_INT_MODE_FULL_BW_BYPASS:
-				Status = XRFDC_FAILURE;
-				metal_log(METAL_LOG_ERROR,
-					  "\n Can't set mixer as DAC %u DUC %u is in bypass mode in %s\r\n", Tile_Id,
-					  Block_Id, __func__);
-				goto RETURN_PATH;
-			case XRFDC_DAC_INT_MODE_HALF_BW_IMR:
-				BWDiv = XRFDC_HALF_BW_DIVISOR;
-				break;
-			case XRFDC_DAC_INT_MODE_FULL_BW:
-			default:
-				BWDiv = XRFDC_FULL_BW_DIVISOR;
-				break;
-			}
-		}
+	Status = XRFdc_MixerBWDivisor(InstancePtr, Type, Tile_Id, Block_Id, &BWDiv);
+	if (Status != XRFDC_SUCCESS) {
+		goto RETURN_PATH;
 	}
 
 	Status = XRFdc_MixerRangeCheck(InstancePtr, Type, Tile_Id, Block_Id, MixerSettingsPtr);
@@ -271,27 +256,11 @@ u32 XRFdc_SetMixerSettings(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_
 			}
 		}
 
-		if ((NCOFreq < -(SamplingRate / 2.0)) || (NCOFreq > (SamplingRate / 2.0))) {
-			Status = XRFdc_GetNyquistZone(InstancePtr, Type, Tile_Id, Block_Id, &NyquistZone);
-			if (Status != XRFDC_SUCCESS) {
-				return XRFDC_FAILURE;
-			}
-			do {
-				if (NCOFreq < -(SamplingRate / 2.0)) {
-					NCOFreq += SamplingRate;
-				}
-				if (NCOFreq > (SamplingRate / 2.0)) {
-					NCOFreq -= SamplingRate;
-				}
-			} while ((NCOFreq < -(SamplingRate / 2.0)) || (NCOFreq > (SamplingRate / 2.0)));
-
-			if ((NyquistZone == XRFDC_EVEN_NYQUIST_ZONE) && (NCOFreq != 0)) {
-				NCOFreq *= -1;
-			}
-		}
-
 		/* NCO Frequency */
-		Freq = ((NCOFreq * XRFDC_NCO_FREQ_MULTIPLIER) / SamplingRate);
+		Status = XRFdc_MixerFreqWord(InstancePtr, Type, Tile_Id, Block_Id, SamplingRate, NCOFreq, &Freq);
+		if (Status != XRFDC_SUCCESS) {
+			return XRFDC_FAILURE;
+		}
 		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_NCO_FQWD_LOW_OFFSET, (u16)Freq);
 		ReadReg = (Freq >> XRFDC_NCO_FQWD_MID_SHIFT) & XRFDC_NCO_FQWD_MID_MASK;
 		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_NCO_FQWD_MID_OFFSET, (u16)ReadReg);
@@ -512,6 +481,110 @@ RETURN_PATH:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* Static API used to get the divisor of the sampling rate that gives the rate
+* the NCO runs at. The IMR datapath modes of Gen 3 DACs run it at half rate.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    Tile_Id Valid values are 0-3.
+* @param    Block_Id is ADC/DAC block number inside the tile.
+* @param    BWDivPtr is where the divisor is returned.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if the DAC datapath is in bypass mode.
+*
+* @note     Static API
+*
+******************************************************************************/
+static u32 XRFdc_MixerBWDivisor(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, u32 *BWDivPtr)
+{
+	u32 Status;
+	u32 DatapathMode;
+
+	*BWDivPtr = XRFDC_FULL_BW_DIVISOR;
+	if (InstancePtr->RFdc_Config.IPType >= XRFDC_GEN3) {
+		if (Type == XRFDC_DAC_TILE) {
+			DatapathMode = XRFdc_RDReg(InstancePtr, XRFDC_BLOCK_BASE(XRFDC_DAC_TILE, Tile_Id, Block_Id),
+						   XRFDC_DAC_DATAPATH_OFFSET, XRFDC_DATAPATH_MODE_MASK);
+			switch (DatapathMode) {
+			case XRFDC_DAC_INT_MODE_FULL_BW_BYPASS:
+				Status = XRFDC_FAILURE;
+				metal_log(METAL_LOG_ERROR,
+					  "\n Can't set mixer as DAC %u DUC %u is in bypass mode in %s\r\n", Tile_Id,
+					  Block_Id, __func__);
+				goto RETURN_PATH;
+			case XRFDC_DAC_INT_MODE_HALF_BW_IMR:
+				*BWDivPtr = XRFDC_HALF_BW_DIVISOR;
+				break;
+			case XRFDC_DAC_INT_MODE_FULL_BW:
+			default:
+				*BWDivPtr = XRFDC_FULL_BW_DIVISOR;
+				break;
+			}
+		}
+	}
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* Static API used to get the NCO frequency word of a frequency. Frequencies
+* outside the first Nyquist zone are folded into it, and their sign follows
+* the Nyquist zone of the block.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    Tile_Id Valid values are 0-3.
+* @param    Block_Id is ADC/DAC block number inside the tile.
+* @param    SamplingRate is the rate the NCO runs at, in MHz.
+* @param    NCOFreq is the NCO frequency, in MHz.
+* @param    FreqPtr is where the frequency word is returned.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if the Nyquist zone could not be read.
+*
+* @note     Static API
+*
+******************************************************************************/
+static u32 XRFdc_MixerFreqWord(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, double SamplingRate,
+			       double NCOFreq, s64 *FreqPtr)
+{
+	u32 Status;
+	u32 NyquistZone = 0U;
+
+	if ((NCOFreq < -(SamplingRate / 2.0)) || (NCOFreq > (SamplingRate / 2.0))) {
+		Status = XRFdc_GetNyquistZone(InstancePtr, Type, Tile_Id, Block_Id, &NyquistZone);
+		if (Status != XRFDC_SUCCESS) {
+			goto RETURN_PATH;
+		}
+		do {
+			if (NCOFreq < -(SamplingRate / 2.0)) {
+				NCOFreq += SamplingRate;
+			}
+			if (NCOFreq > (SamplingRate / 2.0)) {
+				NCOFreq -= SamplingRate;
+			}
+		} while ((NCOFreq < -(SamplingRate / 2.0)) || (NCOFreq > (SamplingRate / 2.0)));
+
+		if ((NyquistZone == XRFDC_EVEN_NYQUIST_ZONE) && (NCOFreq != 0)) {
+			NCOFreq *= -1;
+		}
+	}
+
+	*FreqPtr = ((NCOFreq * XRFDC_NCO_FREQ_MULTIPLIER) / SamplingRate);
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 * Static API used to turn off Fine & Coarse Mixers.
@@ -1156,4 +1229,315 @@ u32 XRFdc_GetDataType(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id)
 	return MixerInputDataType;
 }
 
+/*****************************************************************************/
+/**
+*
+* This API prepares a frequency hopping table for a group of blocks of one
+* tile. The blocks must be enabled and use the fine mixer, set up with
+* XRFdc_SetMixerSettings(). The NCO update event of the blocks is set to
+* EventSource, so that a hop updates all of them at once.
+*
+* The hops are added with XRFdc_HopTableSetEntry() and applied with
+* XRFdc_Hop().
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    TablePtr is a pointer to the table, allocated by the user.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    Tile_Id Valid values are 0-3.
+* @param    BlockMask selects the blocks, bit n for block n. Valid bits are
+*           0-3 in DAC/ADC-2GSPS and 0-1 in ADC-4GSPS.
+* @param    EventSource is the event that applies a hop: XRFDC_EVNT_SRC_TILE
+*           for a tile event issued by XRFdc_Hop(), XRFDC_EVNT_SRC_SYSREF,
+*           XRFDC_EVNT_SRC_PL or, for DACs, XRFDC_EVNT_SRC_MARKER for an
+*           event external to the driver.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if error occurs.
+*
+* @note     None.
+*
+******************************************************************************/
+u32 XRFdc_HopTableInit(XRFdc *InstancePtr, XRFdc_HopTable *TablePtr, u32 Type, u32 Tile_Id, u32 BlockMask,
+		       u32 EventSource)
+{
+	u32 Status;
+	u32 Block_Id;
+	u32 Index;
+	u32 NoOfBlocks;
+	XRFdc_Mixer_Settings *MixerConfigPtr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(TablePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	if ((BlockMask == 0U) || (BlockMask > XRFDC_HOP_BLOCK_MASK)) {
+		metal_log(METAL_LOG_ERROR, "\n Invalid block mask (0x%x) in %s\r\n", BlockMask, __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+	if ((EventSource != XRFDC_EVNT_SRC_TILE) && (EventSource != XRFDC_EVNT_SRC_SYSREF) &&
+	    (EventSource != XRFDC_EVNT_SRC_PL) &&
+	    ((EventSource != XRFDC_EVNT_SRC_MARKER) || (Type != XRFDC_DAC_TILE))) {
+		metal_log(METAL_LOG_ERROR, "\n Invalid event source selection (%u) for %s %u in %s\r\n", EventSource,
+			  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id, __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	TablePtr->NumBlocks = 0U;
+	for (Block_Id = XRFDC_BLK_ID0; Block_Id < XRFDC_BLK_ID4; Block_Id++) {
+		if ((BlockMask & (1U << Block_Id)) == 0U) {
+			continue;
+		}
+		Status = XRFdc_CheckDigitalPathEnabled(InstancePtr, Type, Tile_Id, Block_Id);
+		if (Status != XRFDC_SUCCESS) {
+			metal_log(METAL_LOG_ERROR, "\n %s %u digital path %u not enabled in %s\r\n",
+				  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id, Block_Id, __func__);
+			goto RETURN_PATH;
+		}
+
+		Index = Block_Id;
+		if ((XRFdc_IsHighSpeedADC(InstancePtr, Tile_Id) == 1) && (Type == XRFDC_ADC_TILE)) {
+			NoOfBlocks = XRFDC_NUM_OF_BLKS2;
+			if (Block_Id == XRFDC_BLK_ID1) {
+				Index = XRFDC_BLK_ID2;
+				NoOfBlocks = XRFDC_NUM_OF_BLKS4;
+			}
+		} else {
+			NoOfBlocks = Block_Id + 1U;
+		}
+
+		for (; Index < NoOfBlocks; Index++) {
+			if (Type == XRFDC_ADC_TILE) {
+				MixerConfigPtr =
+					&InstancePtr->ADC_Tile[Tile_Id].ADCBlock_Digital_Datapath[Index].Mixer_Settings;
+			} else {
+				MixerConfigPtr =
+					&InstancePtr->DAC_Tile[Tile_Id].DACBlock_Digital_Datapath[Index].Mixer_Settings;
+			}
+			if (MixerConfigPtr->MixerType != XRFDC_MIXER_TYPE_FINE) {
+				metal_log(METAL_LOG_ERROR, "\n Fine mixer not in use for %s %u block %u in %s\r\n",
+					  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id, Block_Id, __func__);
+				Status = XRFDC_FAILURE;
+				goto RETURN_PATH;
+			}
+			TablePtr->Block_Id[TablePtr->NumBlocks] = Block_Id;
+			TablePtr->Index[TablePtr->NumBlocks] = Index;
+			TablePtr->BaseAddr[TablePtr->NumBlocks] = XRFDC_BLOCK_BASE(Type, Tile_Id, Index);
+			TablePtr->NumBlocks++;
+		}
+	}
+
+	for (Index = 0U; Index < TablePtr->NumBlocks; Index++) {
+		XRFdc_ClrSetReg(InstancePtr, TablePtr->BaseAddr[Index], XRFDC_NCO_UPDT_OFFSET,
+				XRFDC_NCO_UPDT_MODE_MASK, EventSource);
+		if (Type == XRFDC_ADC_TILE) {
+			InstancePtr->ADC_Tile[Tile_Id]
+				.ADCBlock_Digital_Datapath[TablePtr->Index[Index]]
+				.Mixer_Settings.EventSource = EventSource;
+		} else {
+			InstancePtr->DAC_Tile[Tile_Id]
+				.DACBlock_Digital_Datapath[TablePtr->Index[Index]]
+				.Mixer_Settings.EventSource = EventSource;
+		}
+	}
+
+	TablePtr->Type = Type;
+	TablePtr->Tile_Id = Tile_Id;
+	TablePtr->EventSource = EventSource;
+	if (EventSource == XRFDC_EVNT_SRC_TILE) {
+		TablePtr->TriggerAddr = ((Type == XRFDC_ADC_TILE) ? XRFDC_ADC_TILE_DRP_ADDR(Tile_Id) :
+								     XRFDC_DAC_TILE_DRP_ADDR(Tile_Id)) +
+					XRFDC_HSCOM_ADDR;
+	} else {
+		TablePtr->TriggerAddr = 0U;
+	}
+	TablePtr->NumEntries = 0U;
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API computes the NCO register values of a hop and stores them in the
+* table. Entries are added in order or overwritten.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    TablePtr is a pointer to a table set up with
+*           XRFdc_HopTableInit().
+* @param    Entry is the hop number, up to the number of entries in the
+*           table and below XRFDC_HOP_ENTRIES_MAX.
+* @param    Freq is the NCO frequency in MHz, as in XRFdc_Mixer_Settings.
+* @param    PhaseOffset is the NCO phase offset, as in XRFdc_Mixer_Settings.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if error occurs.
+*
+* @note     The values depend on the sampling rate, the Nyquist zone and the
+*           datapath mode of the blocks. Recompute the entries after
+*           changing them.
+*
+******************************************************************************/
+u32 XRFdc_HopTableSetEntry(XRFdc *InstancePtr, XRFdc_HopTable *TablePtr, u32 Entry, double Freq, double PhaseOffset)
+{
+	u32 Status;
+	u32 Index;
+	u32 Block_Id;
+	u32 BWDiv;
+	u8 CalibrationMode = 0U;
+	double SamplingRate;
+	double NCOFreq;
+	s64 FreqWord;
+	s32 PhaseWord;
+	u16 *ImagePtr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(TablePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	if ((Entry > TablePtr->NumEntries) || (Entry >= XRFDC_HOP_ENTRIES_MAX)) {
+		metal_log(METAL_LOG_ERROR, "\n Invalid hop table entry (%u) in %s\r\n", Entry, __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+	if ((PhaseOffset >= XRFDC_MIXER_PHASE_OFFSET_UP_LIMIT) || (PhaseOffset <= XRFDC_MIXER_PHASE_OFFSET_LOW_LIMIT)) {
+		metal_log(METAL_LOG_ERROR, "\n Invalid phase offset value (%lf) in %s\r\n", PhaseOffset, __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	PhaseWord = ((PhaseOffset * XRFDC_NCO_PHASE_MULTIPLIER) / XRFDC_MIXER_PHASE_OFFSET_UP_LIMIT);
+
+	for (Index = 0U; Index < TablePtr->NumBlocks; Index++) {
+		Block_Id = TablePtr->Block_Id[Index];
+		if (TablePtr->Type == XRFDC_ADC_TILE) {
+			SamplingRate = InstancePtr->ADC_Tile[TablePtr->Tile_Id].PLL_Settings.SampleRate;
+		} else {
+			Status = XRFdc_MixerBWDivisor(InstancePtr, TablePtr->Type, TablePtr->Tile_Id, Block_Id, &BWDiv);
+			if (Status != XRFDC_SUCCESS) {
+				goto RETURN_PATH;
+			}
+			SamplingRate = InstancePtr->DAC_Tile[TablePtr->Tile_Id].PLL_Settings.SampleRate / BWDiv;
+		}
+		if (SamplingRate <= 0) {
+			metal_log(METAL_LOG_ERROR, "\n Incorrect Sampling rate (%2.4f GHz) for %s %u in %s\r\n",
+				  SamplingRate, (TablePtr->Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", TablePtr->Tile_Id,
+				  __func__);
+			Status = XRFDC_FAILURE;
+			goto RETURN_PATH;
+		}
+		SamplingRate *= XRFDC_MILLI;
+
+		NCOFreq = Freq;
+		if ((InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) && (TablePtr->Type == XRFDC_ADC_TILE)) {
+			Status = XRFdc_GetCalibrationMode(InstancePtr, TablePtr->Tile_Id, Block_Id, &CalibrationMode);
+			if (Status != XRFDC_SUCCESS) {
+				goto RETURN_PATH;
+			}
+			if (CalibrationMode == XRFDC_CALIB_MODE1) {
+				NCOFreq -= SamplingRate / 2.0;
+			}
+		}
+
+		Status = XRFdc_MixerFreqWord(InstancePtr, TablePtr->Type, TablePtr->Tile_Id, Block_Id, SamplingRate,
+					     NCOFreq, &FreqWord);
+		if (Status != XRFDC_SUCCESS) {
+			goto RETURN_PATH;
+		}
+
+		ImagePtr = TablePtr->Image[Entry][Index];
+		ImagePtr[XRFDC_HOP_FQWD_LOW] = (u16)FreqWord;
+		ImagePtr[XRFDC_HOP_FQWD_MID] = (u16)((FreqWord >> XRFDC_NCO_FQWD_MID_SHIFT) & XRFDC_NCO_FQWD_MID_MASK);
+		ImagePtr[XRFDC_HOP_FQWD_UPP] = (u16)((FreqWord >> XRFDC_NCO_FQWD_UPP_SHIFT) & XRFDC_NCO_FQWD_UPP_MASK);
+		ImagePtr[XRFDC_HOP_PHASE_LOW] = (u16)PhaseWord;
+		ImagePtr[XRFDC_HOP_PHASE_UPP] = (u16)((PhaseWord >> XRFDC_NCO_PHASE_UPP_SHIFT) & XRFDC_NCO_PHASE_UPP_MASK);
+	}
+
+	TablePtr->Freq[Entry] = Freq;
+	TablePtr->PhaseOffset[Entry] = PhaseOffset;
+	if (Entry == TablePtr->NumEntries) {
+		TablePtr->NumEntries++;
+	}
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API hops the blocks of a hopping table to one of its entries. It
+* writes the precomputed NCO registers of all blocks and, for the tile event
+* source, issues the tile event. With the other event sources the new
+* frequency takes effect on the next event.
+*
+* It only copies values: no floating point math and no register reads, and
+* none of the checks of XRFdc_SetMixerSettings(), which were made when the
+* table was set up.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    TablePtr is a pointer to the table.
+* @param    Entry is the hop number.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if the entry is not in the table.
+*
+* @note     None.
+*
+******************************************************************************/
+u32 XRFdc_Hop(XRFdc *InstancePtr, const XRFdc_HopTable *TablePtr, u32 Entry)
+{
+	u32 Status;
+	u32 Index;
+	u32 BaseAddr;
+	const u16 *ImagePtr;
+	XRFdc_Mixer_Settings *MixerConfigPtr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(TablePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	if (Entry >= TablePtr->NumEntries) {
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	for (Index = 0U; Index < TablePtr->NumBlocks; Index++) {
+		BaseAddr = TablePtr->BaseAddr[Index];
+		ImagePtr = TablePtr->Image[Entry][Index];
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_NCO_FQWD_LOW_OFFSET, ImagePtr[XRFDC_HOP_FQWD_LOW]);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_NCO_FQWD_MID_OFFSET, ImagePtr[XRFDC_HOP_FQWD_MID]);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_NCO_FQWD_UPP_OFFSET, ImagePtr[XRFDC_HOP_FQWD_UPP]);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_NCO_PHASE_LOW_OFFSET, ImagePtr[XRFDC_HOP_PHASE_LOW]);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_NCO_PHASE_UPP_OFFSET, ImagePtr[XRFDC_HOP_PHASE_UPP]);
+
+		if (TablePtr->Type == XRFDC_ADC_TILE) {
+			MixerConfigPtr = &InstancePtr->ADC_Tile[TablePtr->Tile_Id]
+						  .ADCBlock_Digital_Datapath[TablePtr->Index[Index]]
+						  .Mixer_Settings;
+		} else {
+			MixerConfigPtr = &InstancePtr->DAC_Tile[TablePtr->Tile_Id]
+						  .DACBlock_Digital_Datapath[TablePtr->Index[Index]]
+						  .Mixer_Settings;
+		}
+		MixerConfigPtr->Freq = TablePtr->Freq[Entry];
+		MixerConfigPtr->PhaseOffset = TablePtr->PhaseOffset[Entry];
+	}
+
+	if (TablePtr->TriggerAddr != 0U) {
+		XRFdc_WriteReg16(InstancePtr, TablePtr->TriggerAddr, XRFDC_HSCOM_UPDT_DYN_OFFSET, 0x1);
+	}
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
 /** @} */
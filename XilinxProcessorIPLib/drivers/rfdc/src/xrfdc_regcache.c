@@ -0,0 +1,523 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xrfdc_regcache.c
+* @addtogroup Overview
+* @{
+*
+* Contains the shadow register cache and the register transactions of the
+* XRFdc driver. See xrfdc.h for a detailed description of the device and
+* driver.
+*
+* The cache holds the 16-bit registers of the tile DRP windows, where the
+* converter, mixer, data path and clocking settings live. It is write
+* allocated: a register is cached once the driver has written it, so the
+* read-modify-write helpers of the driver read it from the cache instead
+* of the device. Registers that the driver only reads are not cached, and
+* registers that the IP changes on its own (interrupt status, update
+* triggers, observation and calibration status registers) are never
+* cached. The control and status windows of the tiles and the IP registers
+* are not cached either.
+*
+* Tile restarts invalidate the cache of the tile. Registers changed by other
+* masters, or by the IP in ways the driver does not know of, must be
+* invalidated with XRFdc_RegCacheInvalidate() or
+* XRFdc_RegCacheInvalidateReg().
+*
+* Between XRFdc_BeginTransaction() and XRFdc_CommitTransaction() writes to
+* cached registers are gathered and written to the device when the
+* transaction is committed, in the order of their first write. Several
+* writes to one register become a single device write of the last value.
+* Any access to a register that is not cached first writes out the pending
+* writes, so accesses with side effects keep their order.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 12.3  sb     10/19/26 Initial release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xrfdc.h"
+
+/************************** Constant Definitions *****************************/
+#define XRFDC_REGCACHE_NONE 0xFFFFFFFFU
+#define XRFDC_REGCACHE_BLOCKS_SIZE 0x1000U
+#define XRFDC_REGCACHE_BLOCK_MASK 0x3FFU
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Range of registers the IP changes on its own, as offsets into a block or
+ * into the tile common (HSCOM) window.
+ */
+typedef struct {
+	u16 First;
+	u16 Last;
+} XRFdc_RegCache_Range;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define XRFDC_REGCACHE_BIT_IS_SET(Map, Idx) (((Map)[(Idx) >> 5U] & (1U << ((Idx)&0x1FU))) != 0U)
+#define XRFDC_REGCACHE_BIT_SET(Map, Idx) ((Map)[(Idx) >> 5U] |= (1U << ((Idx)&0x1FU)))
+#define XRFDC_REGCACHE_BIT_CLR(Map, Idx) ((Map)[(Idx) >> 5U] &= ~(1U << ((Idx)&0x1FU)))
+#define XRFDC_REGCACHE_TILE_INDEX(Addr) ((((Addr) / XRFDC_TILE_ADDR_SIZE) - 1U) * XRFDC_REGCACHE_TILE_REGS)
+
+/************************** Function Prototypes ******************************/
+static u32 XRFdc_RegCacheIndex(u32 Addr);
+static void XRFdc_RegCacheFlush(XRFdc *InstancePtr);
+static void XRFdc_RegCacheInvalidateTile(XRFdc_RegCache *CachePtr, u32 Index);
+
+/************************** Variable Definitions *****************************/
+
+/* Block registers changed by the IP */
+static const XRFdc_RegCache_Range XRFdc_RegCacheBlockVolatile[] = {
+	{ XRFDC_ADC_FABRIC_ISR_OFFSET, XRFDC_DAC_FABRIC_ISR_OFFSET },
+	{ XRFDC_ADC_UPDATE_DYN_OFFSET, XRFDC_DAC_UPDATE_DYN_OFFSET },
+	{ XRFDC_ADC_DEC_ISR_OFFSET, XRFDC_ADC_DEC_ISR_OFFSET },
+	{ XRFDC_DATPATH_ISR_OFFSET, XRFDC_DATPATH_ISR_OFFSET },
+	{ XRFDC_ADC_DECI_CONFIG_OBS_OFFSET, XRFDC_ADC_FIFO_LTNC_CRL_OBS_OFFSET },
+	{ XRFDC_NCO_RST_OFFSET, XRFDC_NCO_RST_OFFSET },
+	{ XRFDC_ADC_TRSHD0_CFG_OFFSET, XRFDC_ADC_TRSHD0_CFG_OFFSET },
+	{ XRFDC_ADC_TRSHD1_CFG_OFFSET, XRFDC_ADC_TRSHD1_CFG_OFFSET },
+	{ XRFDC_CAL_TSCB_OFFSET_COEFF0_ALT, XRFDC_CAL_TSCB_OFFSET_COEFF7 },
+	{ XRFDC_ADC_TI_DCBSTS0_BG_OFFSET, XRFDC_CAL_GCB_OFFSET_COEFF3_ALT },
+	{ XRFDC_DSA_UPDT_OFFSET, XRFDC_DSA_UPDT_OFFSET },
+};
+
+/* Tile common registers changed by the IP */
+static const XRFdc_RegCache_Range XRFdc_RegCacheHscomVolatile[] = {
+	{ XRFDC_HSCOM_PWR_STATE_OFFSET, XRFDC_HSCOM_FIFO_START_OBS_OFFSET },
+};
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This API attaches a shadow register cache to the driver instance, or
+* detaches it. The cache starts empty.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    CachePtr is a pointer to the cache, allocated by the user, or
+*           NULL to stop using a cache.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if a transaction is open.
+*
+* @note     Call it after XRFdc_CfgInitialize().
+*
+******************************************************************************/
+u32 XRFdc_RegCacheEnable(XRFdc *InstancePtr, XRFdc_RegCache *CachePtr)
+{
+	u32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	if ((InstancePtr->RegCache != NULL) && (InstancePtr->RegCache->InTransaction != 0U)) {
+		metal_log(METAL_LOG_ERROR, "\n Transaction open in %s\r\n", __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	if (CachePtr != NULL) {
+		memset(CachePtr, 0, sizeof(XRFdc_RegCache));
+	}
+	InstancePtr->RegCache = CachePtr;
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API invalidates the cached registers of a tile, or of all tiles.
+* Pending writes are written to the device first.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC.
+* @param    Tile_Id Valid values are 0-3, and -1 for all tiles.
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+void XRFdc_RegCacheInvalidate(XRFdc *InstancePtr, u32 Type, int Tile_Id)
+{
+	u32 Index;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	if (InstancePtr->RegCache == NULL) {
+		return;
+	}
+
+	XRFdc_RegCacheFlush(InstancePtr);
+	if (Tile_Id == XRFDC_SELECT_ALL_TILES) {
+		for (Index = 0U; Index <= XRFDC_TILE_ID_MAX; Index++) {
+			XRFdc_RegCacheInvalidateTile(InstancePtr->RegCache,
+						     XRFDC_REGCACHE_TILE_INDEX(XRFDC_DRP_BASE(Type, Index)));
+		}
+	} else {
+		XRFdc_RegCacheInvalidateTile(InstancePtr->RegCache,
+					     XRFDC_REGCACHE_TILE_INDEX(XRFDC_DRP_BASE(Type, (u32)Tile_Id)));
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API invalidates a cached register. A pending write of the register is
+* written to the device first.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    BaseAddr is address of a block.
+* @param    RegAddr is register offset value.
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+void XRFdc_RegCacheInvalidateReg(XRFdc *InstancePtr, u32 BaseAddr, u32 RegAddr)
+{
+	XRFdc_RegCache *CachePtr;
+	u32 Index;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	CachePtr = InstancePtr->RegCache;
+	if (CachePtr == NULL) {
+		return;
+	}
+
+	Index = XRFdc_RegCacheIndex(BaseAddr + RegAddr);
+	if (Index == XRFDC_REGCACHE_NONE) {
+		return;
+	}
+	if (XRFDC_REGCACHE_BIT_IS_SET(CachePtr->Dirty, Index)) {
+		XRFdc_RegCacheFlush(InstancePtr);
+	}
+	XRFDC_REGCACHE_BIT_CLR(CachePtr->Valid, Index);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API opens a register transaction. Writes to cached registers are held
+* back until XRFdc_CommitTransaction() is called.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if no cache is attached or a transaction is
+*             already open.
+*
+* @note     None.
+*
+******************************************************************************/
+u32 XRFdc_BeginTransaction(XRFdc *InstancePtr)
+{
+	u32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	if (InstancePtr->RegCache == NULL) {
+		metal_log(METAL_LOG_ERROR, "\n No register cache in %s\r\n", __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+	if (InstancePtr->RegCache->InTransaction != 0U) {
+		metal_log(METAL_LOG_ERROR, "\n Transaction already open in %s\r\n", __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	InstancePtr->RegCache->InTransaction = 1U;
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API closes a register transaction and writes the pending writes to
+* the device.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if no transaction is open.
+*
+* @note     None.
+*
+******************************************************************************/
+u32 XRFdc_CommitTransaction(XRFdc *InstancePtr)
+{
+	u32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	if ((InstancePtr->RegCache == NULL) || (InstancePtr->RegCache->InTransaction == 0U)) {
+		metal_log(METAL_LOG_ERROR, "\n No open transaction in %s\r\n", __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	XRFdc_RegCacheFlush(InstancePtr);
+	InstancePtr->RegCache->InTransaction = 0U;
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* Read a 16-bit register through the cache. Used by XRFdc_ReadReg16() when a
+* cache is attached.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Addr is the register address.
+*
+* @return   The register value.
+*
+******************************************************************************/
+u16 XRFdc_RegCacheRead16(XRFdc *InstancePtr, u32 Addr)
+{
+	XRFdc_RegCache *CachePtr = InstancePtr->RegCache;
+	u32 Index;
+
+	CachePtr->Stats.Reads++;
+
+	Index = XRFdc_RegCacheIndex(Addr);
+	if (Index == XRFDC_REGCACHE_NONE) {
+		/* The register may depend on pending writes */
+		XRFdc_RegCacheFlush(InstancePtr);
+	} else if (XRFDC_REGCACHE_BIT_IS_SET(CachePtr->Valid, Index)) {
+		CachePtr->Stats.Hits++;
+		return CachePtr->Value[Index];
+	}
+
+	return XRFdc_In16(InstancePtr->io, Addr);
+}
+
+/*****************************************************************************/
+/**
+*
+* Write a 16-bit register through the cache. Used by XRFdc_WriteReg16() when
+* a cache is attached.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Addr is the register address.
+* @param    Value is the value to be written.
+*
+* @return   None.
+*
+******************************************************************************/
+void XRFdc_RegCacheWrite16(XRFdc *InstancePtr, u32 Addr, u16 Value)
+{
+	XRFdc_RegCache *CachePtr = InstancePtr->RegCache;
+	u32 Index;
+
+	CachePtr->Stats.Writes++;
+
+	Index = XRFdc_RegCacheIndex(Addr);
+	if (Index == XRFDC_REGCACHE_NONE) {
+		XRFdc_RegCacheFlush(InstancePtr);
+		XRFdc_Out16(InstancePtr->io, Addr, Value);
+		return;
+	}
+
+	CachePtr->Value[Index] = Value;
+	XRFDC_REGCACHE_BIT_SET(CachePtr->Valid, Index);
+
+	if (CachePtr->InTransaction == 0U) {
+		XRFdc_Out16(InstancePtr->io, Addr, Value);
+	} else if (XRFDC_REGCACHE_BIT_IS_SET(CachePtr->Dirty, Index)) {
+		CachePtr->Stats.Merged++;
+	} else {
+		if (CachePtr->Pending == XRFDC_REGCACHE_PENDING_MAX) {
+			XRFdc_RegCacheFlush(InstancePtr);
+		}
+		CachePtr->Journal[CachePtr->Pending++] = (u16)Index;
+		XRFDC_REGCACHE_BIT_SET(CachePtr->Dirty, Index);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Read a 32-bit register with a cache attached. Used by XRFdc_ReadReg().
+* 32-bit registers are not cached, pending writes are written first unless
+* the register is one of the read only design parameters that the driver
+* checks in every API call.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Addr is the register address.
+*
+* @return   The register value.
+*
+******************************************************************************/
+u32 XRFdc_RegCacheRead32(XRFdc *InstancePtr, u32 Addr)
+{
+	if ((Addr < XRFDC_TILES_ENABLED_OFFSET) || (Addr > XRFDC_DAC_PATHS_ENABLED_OFFSET)) {
+		XRFdc_RegCacheFlush(InstancePtr);
+	}
+
+	return XRFdc_In32(InstancePtr->io, Addr);
+}
+
+/*****************************************************************************/
+/**
+*
+* Write a 32-bit register with a cache attached. Used by XRFdc_WriteReg().
+* Pending writes are written first, cached 16-bit registers that overlap the
+* register are invalidated, and a tile restart invalidates the tile.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Addr is the register address.
+* @param    Value is the value to be written.
+*
+* @return   None.
+*
+******************************************************************************/
+void XRFdc_RegCacheWrite32(XRFdc *InstancePtr, u32 Addr, u32 Value)
+{
+	XRFdc_RegCache *CachePtr = InstancePtr->RegCache;
+	u32 Index;
+
+	XRFdc_RegCacheFlush(InstancePtr);
+	XRFdc_Out32(InstancePtr->io, Addr, Value);
+
+	Index = XRFdc_RegCacheIndex(Addr);
+	if (Index != XRFDC_REGCACHE_NONE) {
+		XRFDC_REGCACHE_BIT_CLR(CachePtr->Valid, Index);
+		XRFDC_REGCACHE_BIT_CLR(CachePtr->Valid, Index + 1U);
+	} else if (((Addr & (XRFDC_TILE_ADDR_SIZE - 1U)) == XRFDC_RESTART_OFFSET) &&
+		   (Addr >= XRFDC_TILE_ADDR_SIZE) && ((Addr / XRFDC_TILE_ADDR_SIZE) <= XRFDC_REGCACHE_TILES)) {
+		/* Tile restart, the DRP registers go back to their defaults */
+		XRFdc_RegCacheInvalidateTile(CachePtr, XRFDC_REGCACHE_TILE_INDEX(Addr));
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Get the cache index of a register.
+*
+* @param    Addr is the register address.
+*
+* @return   The index, or XRFDC_REGCACHE_NONE if the register is not cached.
+*
+* @note     Static API.
+*
+******************************************************************************/
+static u32 XRFdc_RegCacheIndex(u32 Addr)
+{
+	const XRFdc_RegCache_Range *Ranges;
+	u32 NumRanges;
+	u32 Window;
+	u32 Offset;
+	u32 Index;
+
+	Window = Addr / XRFDC_TILE_ADDR_SIZE;
+	if (((Addr & XRFDC_TILE_DRP_OFFSET) == 0U) || (Window == 0U) || (Window > XRFDC_REGCACHE_TILES)) {
+		return XRFDC_REGCACHE_NONE;
+	}
+
+	Offset = Addr & (XRFDC_TILE_DRP_OFFSET - 1U);
+	if (Offset < XRFDC_REGCACHE_BLOCKS_SIZE) {
+		Ranges = XRFdc_RegCacheBlockVolatile;
+		NumRanges = sizeof(XRFdc_RegCacheBlockVolatile) / sizeof(XRFdc_RegCache_Range);
+	} else if (Offset >= XRFDC_HSCOM_ADDR) {
+		Ranges = XRFdc_RegCacheHscomVolatile;
+		NumRanges = sizeof(XRFdc_RegCacheHscomVolatile) / sizeof(XRFdc_RegCache_Range);
+	} else {
+		NumRanges = 0U;
+		Ranges = NULL;
+	}
+	for (Index = 0U; Index < NumRanges; Index++) {
+		if (((Offset & XRFDC_REGCACHE_BLOCK_MASK) >= Ranges[Index].First) &&
+		    ((Offset & XRFDC_REGCACHE_BLOCK_MASK) <= Ranges[Index].Last)) {
+			return XRFDC_REGCACHE_NONE;
+		}
+	}
+
+	return ((Window - 1U) * XRFDC_REGCACHE_TILE_REGS) + (Offset >> 1U);
+}
+
+/*****************************************************************************/
+/**
+*
+* Write the pending writes of a transaction to the device.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+*
+* @return   None.
+*
+* @note     Static API.
+*
+******************************************************************************/
+static void XRFdc_RegCacheFlush(XRFdc *InstancePtr)
+{
+	XRFdc_RegCache *CachePtr = InstancePtr->RegCache;
+	u32 Index;
+	u32 Entry;
+	u32 Addr;
+
+	if (CachePtr->Pending == 0U) {
+		return;
+	}
+
+	for (Entry = 0U; Entry < CachePtr->Pending; Entry++) {
+		Index = CachePtr->Journal[Entry];
+		Addr = (((Index / XRFDC_REGCACHE_TILE_REGS) + 1U) * XRFDC_TILE_ADDR_SIZE) + XRFDC_TILE_DRP_OFFSET +
+		       ((Index % XRFDC_REGCACHE_TILE_REGS) << 1U);
+		XRFdc_Out16(InstancePtr->io, Addr, CachePtr->Value[Index]);
+		XRFDC_REGCACHE_BIT_CLR(CachePtr->Dirty, Index);
+	}
+	CachePtr->Pending = 0U;
+	CachePtr->Stats.Flushes++;
+}
+
+/*****************************************************************************/
+/**
+*
+* Invalidate the cached registers of a tile.
+*
+* @param    CachePtr is a pointer to the cache.
+* @param    Index is the cache index of the first register of the tile.
+*
+* @return   None.
+*
+* @note     Static API. Pending writes must have been flushed.
+*
+******************************************************************************/
+static void XRFdc_RegCacheInvalidateTile(XRFdc_RegCache *CachePtr, u32 Index)
+{
+	memset(&CachePtr->Valid[Index / 32U], 0, XRFDC_REGCACHE_TILE_REGS / 8U);
+}
+/** @} */
@@ -7,6 +7,12 @@
 /***************************** Include Files *********************************/
 #include "xsdfec.h"
 
+/************************** Function Prototypes ******************************/
+static void XSdFecInvalidateOverlaps(XSdFec *InstancePtr, u32 CodeId, u32 SCOffset, u32 SCSize, u32 LAOffset, u32 LASize, u32 QCOffset, u32 QCSize);
+static u32  XSdFecWriteBlock(UINTPTR BaseAddress, u32 Addr, const u32 *DataArrayPtr, u32 NumData);
+static u32  XSdFecSignature(u32 Hash, const u32 *DataArrayPtr, u32 NumData);
+static int  XSdFecIsResident(const XSdFecResidentCode *ResidentPtr, const XSdFecCompiledCode *CodePtr);
+
 /************************** Function Implementation *************************/
 int XSdFecCfgInitialize(XSdFec *InstancePtr, XSdFec_Config *ConfigPtr) {
     Xil_AssertNonvoid(InstancePtr != NULL);
@@ -20,6 +26,11 @@ int XSdFecCfgInitialize(XSdFec *InstancePtr, XSdFec_Config *ConfigPtr) {
       u32 wdata = ConfigPtr->Initialization[i+1];
       XSdFecWriteReg(InstancePtr->BaseAddress, addr, wdata);
     }
+    // No compiled code is known to be resident
+    for (int i=0;i<128;i++) {
+      InstancePtr->Resident[i].Signature = 0;
+    }
+    InstancePtr->GetTime = NULL;
     InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
     return XST_SUCCESS;
@@ -64,6 +75,13 @@ void XSdFecAddLdpcParams(XSdFec *InstancePtr, u32 CodeId, u32 SCOffset, u32 LAOf
     InstancePtr->SCOffset[CodeId] = SCOffset;
     InstancePtr->LAOffset[CodeId] = LAOffset;
     InstancePtr->QCOffset[CodeId] = QCOffset;
+    // Compiled codes sharing these tables, and any compiled code previously at this ID, are no longer resident
+    XSdFecShareTableSize(ParamsPtr, &InstancePtr->SCSize[CodeId], &InstancePtr->LASize[CodeId], &InstancePtr->QCSize[CodeId]);
+    XSdFecInvalidateOverlaps(InstancePtr, CodeId,
+                             SCOffset, InstancePtr->SCSize[CodeId],
+                             LAOffset, InstancePtr->LASize[CodeId],
+                             QCOffset, InstancePtr->QCSize[CodeId]);
+    InstancePtr->Resident[CodeId].Signature = 0;
   }
 }
 
@@ -80,6 +98,206 @@ void XSdFecShareTableSize(const XSdFecLdpcParameters* ParamsPtr, u32* SCSizePtr,
   }
 }
 
+int XSdFecCompileCodeSet(XSdFecCompiledCode* CodesPtr, const u32* CodeIds, const XSdFecLdpcParameters* const* ParamsPtrs,
+                         u32 NumCodes, u32 SCBase, u32 LABase, u32 QCBase) {
+  Xil_AssertNonvoid(CodesPtr   != NULL);
+  Xil_AssertNonvoid(CodeIds    != NULL);
+  Xil_AssertNonvoid(ParamsPtrs != NULL);
+
+  u32 SCOffset = SCBase;
+  u32 LAOffset = LABase;
+  u32 QCOffset = QCBase;
+  for (u32 i = 0; i < NumCodes; i++) {
+    const XSdFecLdpcParameters* ParamsPtr = ParamsPtrs[i];
+    XSdFecCompiledCode* CodePtr = &CodesPtr[i];
+    Xil_AssertNonvoid(ParamsPtr != NULL);
+
+    if (CodeIds[i] >= XSDFEC_LDPC_CODE_REG0_DEPTH) {
+      return XST_FAILURE;
+    }
+    CodePtr->CodeId  = CodeIds[i];
+    CodePtr->SCTable = ParamsPtr->SCTable;
+    CodePtr->LATable = ParamsPtr->LATable;
+    CodePtr->QCTable = ParamsPtr->QCTable;
+    CodePtr->SCWords = (ParamsPtr->NLayers+3)>>2; // Scale is packed, 4 per reg
+    CodePtr->LAWords = ParamsPtr->NLayers;
+    CodePtr->QCWords = ParamsPtr->NQC;
+    XSdFecShareTableSize(ParamsPtr, &CodePtr->SCSize, &CodePtr->LASize, &CodePtr->QCSize);
+
+    // Offsets must fit their LDPC_CODE_REG3 fields and tables their memories (LA and QC offsets are in units of 4 words)
+    if (SCOffset > (XSDFEC_LDPC_CODE_REG3_SC_OFF_MASK >> XSDFEC_LDPC_CODE_REG3_SC_OFF_LSB) ||
+        LAOffset > (XSDFEC_LDPC_CODE_REG3_LA_OFF_MASK >> XSDFEC_LDPC_CODE_REG3_LA_OFF_LSB) ||
+        QCOffset > (XSDFEC_LDPC_CODE_REG3_QC_OFF_MASK >> XSDFEC_LDPC_CODE_REG3_QC_OFF_LSB) ||
+        SCOffset + CodePtr->SCWords > XSDFEC_LDPC_SC_TABLE_DEPTH ||
+        LAOffset*4 + CodePtr->LAWords > XSDFEC_LDPC_LA_TABLE_DEPTH ||
+        QCOffset*4 + CodePtr->QCWords > XSDFEC_LDPC_QC_TABLE_DEPTH) {
+      return XST_FAILURE;
+    }
+    Xil_AssertNonvoid(CodePtr->SCWords == 0 || CodePtr->SCTable != NULL);
+    Xil_AssertNonvoid(CodePtr->LAWords == 0 || CodePtr->LATable != NULL);
+    Xil_AssertNonvoid(CodePtr->QCWords == 0 || CodePtr->QCTable != NULL);
+    CodePtr->SCOffset = SCOffset;
+    CodePtr->LAOffset = LAOffset;
+    CodePtr->QCOffset = QCOffset;
+
+    // Register images, as written by XSdFecAddLdpcParams
+    CodePtr->Reg[0]  = (XSDFEC_LDPC_CODE_REG0_N_MASK & (ParamsPtr->N << XSDFEC_LDPC_CODE_REG0_N_LSB));
+    CodePtr->Reg[0] |= (XSDFEC_LDPC_CODE_REG0_K_MASK & (ParamsPtr->K << XSDFEC_LDPC_CODE_REG0_K_LSB));
+    CodePtr->Reg[1]  = (XSDFEC_LDPC_CODE_REG1_PSIZE_MASK       & (ParamsPtr->PSize      << XSDFEC_LDPC_CODE_REG1_PSIZE_LSB));
+    CodePtr->Reg[1] |= (XSDFEC_LDPC_CODE_REG1_NO_PACKING_MASK  & (ParamsPtr->NoPacking  << XSDFEC_LDPC_CODE_REG1_NO_PACKING_LSB));
+    CodePtr->Reg[1] |= (XSDFEC_LDPC_CODE_REG1_NM_MASK          & (ParamsPtr->NM         << XSDFEC_LDPC_CODE_REG1_NM_LSB));
+    CodePtr->Reg[2]  = (XSDFEC_LDPC_CODE_REG2_NLAYERS_MASK               & (ParamsPtr->NLayers        << XSDFEC_LDPC_CODE_REG2_NLAYERS_LSB));
+    CodePtr->Reg[2] |= (XSDFEC_LDPC_CODE_REG2_NMQC_MASK                  & (ParamsPtr->NMQC           << XSDFEC_LDPC_CODE_REG2_NMQC_LSB));
+    CodePtr->Reg[2] |= (XSDFEC_LDPC_CODE_REG2_NORM_TYPE_MASK             & (ParamsPtr->NormType       << XSDFEC_LDPC_CODE_REG2_NORM_TYPE_LSB));
+    CodePtr->Reg[2] |= (XSDFEC_LDPC_CODE_REG2_SPECIAL_QC_MASK            & (ParamsPtr->SpecialQC      << XSDFEC_LDPC_CODE_REG2_SPECIAL_QC_LSB));
+    CodePtr->Reg[2] |= (XSDFEC_LDPC_CODE_REG2_NO_FINAL_PARITY_CHECK_MASK & (ParamsPtr->NoFinalParity  << XSDFEC_LDPC_CODE_REG2_NO_FINAL_PARITY_CHECK_LSB));
+    CodePtr->Reg[2] |= (XSDFEC_LDPC_CODE_REG2_MAX_SCHEDULE_MASK          & (ParamsPtr->MaxSchedule    << XSDFEC_LDPC_CODE_REG2_MAX_SCHEDULE_LSB));
+    CodePtr->Reg[3]  = (XSDFEC_LDPC_CODE_REG3_SC_OFF_MASK & (SCOffset << XSDFEC_LDPC_CODE_REG3_SC_OFF_LSB));
+    CodePtr->Reg[3] |= (XSDFEC_LDPC_CODE_REG3_LA_OFF_MASK & (LAOffset << XSDFEC_LDPC_CODE_REG3_LA_OFF_LSB));
+    CodePtr->Reg[3] |= (XSDFEC_LDPC_CODE_REG3_QC_OFF_MASK & (QCOffset << XSDFEC_LDPC_CODE_REG3_QC_OFF_LSB));
+
+    // FNV-1a over the code ID, registers and tables. Register 3 covers the placement
+    u32 Hash = XSdFecSignature(2166136261U, &CodePtr->CodeId, 1);
+    Hash = XSdFecSignature(Hash, CodePtr->Reg, 4);
+    Hash = XSdFecSignature(Hash, CodePtr->SCTable, CodePtr->SCWords);
+    Hash = XSdFecSignature(Hash, CodePtr->LATable, CodePtr->LAWords);
+    Hash = XSdFecSignature(Hash, CodePtr->QCTable, CodePtr->QCWords);
+    CodePtr->Signature = (Hash != 0) ? Hash : 1; // 0 marks no resident code
+
+    SCOffset += CodePtr->SCSize;
+    LAOffset += CodePtr->LASize;
+    QCOffset += CodePtr->QCSize;
+  }
+  return XST_SUCCESS;
+}
+
+void XSdFecLoadCodeSet(XSdFec *InstancePtr, const XSdFecCodeSet* CodeSetPtr, XSdFecCodeSetStats* StatsPtr) {
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid(CodeSetPtr  != NULL);
+  Xil_AssertVoid(CodeSetPtr->NumCodes == 0 || CodeSetPtr->Codes != NULL);
+  Xil_AssertVoid(InstancePtr->IsReady  == XIL_COMPONENT_IS_READY);
+  Xil_AssertVoid(InstancePtr->Standard == XSDFEC_STANDARD_OTHER);
+
+  UINTPTR BaseAddress = InstancePtr->BaseAddress;
+  u64 Start = (InstancePtr->GetTime != NULL) ? InstancePtr->GetTime() : 0;
+  u32 Loaded   = 0;
+  u32 Resident = 0;
+  u32 Words    = 0;
+
+  for (u32 i = 0; i < CodeSetPtr->NumCodes; i++) {
+    const XSdFecCompiledCode* CodePtr = &CodeSetPtr->Codes[i];
+    u32 CodeId = CodePtr->CodeId;
+    Xil_AssertVoid(CodeId < XSDFEC_LDPC_CODE_REG0_DEPTH);
+
+    if (XSdFecIsResident(&InstancePtr->Resident[CodeId], CodePtr)) {
+      Resident++;
+      continue;
+    }
+    XSdFecInvalidateOverlaps(InstancePtr, CodeId,
+                             CodePtr->SCOffset, CodePtr->SCSize,
+                             CodePtr->LAOffset, CodePtr->LASize,
+                             CodePtr->QCOffset, CodePtr->QCSize);
+    // Tables first so the code registers never reference partially written tables
+    Words += XSdFecWriteBlock(BaseAddress, XSDFEC_LDPC_SC_TABLE_ADDR_BASE + CodePtr->SCOffset*XSDFEC_LDPC_SC_TABLE_STEP,
+                              CodePtr->SCTable, CodePtr->SCWords);
+    Words += XSdFecWriteBlock(BaseAddress, XSDFEC_LDPC_LA_TABLE_ADDR_BASE + CodePtr->LAOffset*4*XSDFEC_LDPC_LA_TABLE_STEP,
+                              CodePtr->LATable, CodePtr->LAWords);
+    Words += XSdFecWriteBlock(BaseAddress, XSDFEC_LDPC_QC_TABLE_ADDR_BASE + CodePtr->QCOffset*4*XSDFEC_LDPC_QC_TABLE_STEP,
+                              CodePtr->QCTable, CodePtr->QCWords);
+    // LDPC_CODE_REG0 to LDPC_CODE_REG3 of a code are contiguous
+    Words += XSdFecWriteBlock(BaseAddress, XSDFEC_LDPC_CODE_REG0_ADDR_BASE + CodeId*XSDFEC_LDPC_CODE_REG0_STEP,
+                              CodePtr->Reg, 4);
+
+    InstancePtr->SCOffset[CodeId] = CodePtr->SCOffset;
+    InstancePtr->LAOffset[CodeId] = CodePtr->LAOffset;
+    InstancePtr->QCOffset[CodeId] = CodePtr->QCOffset;
+    InstancePtr->SCSize[CodeId]   = CodePtr->SCSize;
+    InstancePtr->LASize[CodeId]   = CodePtr->LASize;
+    InstancePtr->QCSize[CodeId]   = CodePtr->QCSize;
+    XSdFecResidentCode* ResidentPtr = &InstancePtr->Resident[CodeId];
+    for (u32 r = 0; r < 4; r++) {
+      ResidentPtr->Reg[r] = CodePtr->Reg[r];
+    }
+    ResidentPtr->SCWords   = CodePtr->SCWords;
+    ResidentPtr->LAWords   = CodePtr->LAWords;
+    ResidentPtr->QCWords   = CodePtr->QCWords;
+    ResidentPtr->SCTable   = CodePtr->SCTable;
+    ResidentPtr->LATable   = CodePtr->LATable;
+    ResidentPtr->QCTable   = CodePtr->QCTable;
+    ResidentPtr->Signature = CodePtr->Signature;
+    Loaded++;
+  }
+
+  if (StatsPtr) {
+    StatsPtr->Loaded   = Loaded;
+    StatsPtr->Resident = Resident;
+    StatsPtr->Words    = Words;
+    StatsPtr->Time     = (InstancePtr->GetTime != NULL) ? InstancePtr->GetTime() - Start : 0;
+  }
+}
+
+void XSdFecInvalidateCodes(XSdFec *InstancePtr) {
+  Xil_AssertVoid(InstancePtr != NULL);
+  for (u32 i = 0; i < XSDFEC_LDPC_CODE_REG0_DEPTH; i++) {
+    InstancePtr->Resident[i].Signature = 0;
+  }
+}
+
+void XSdFecSetTimer(XSdFec *InstancePtr, u64 (*GetTime)(void)) {
+  Xil_AssertVoid(InstancePtr != NULL);
+  InstancePtr->GetTime = GetTime;
+}
+
+// Forget compiled codes whose code ID or share tables are about to be overwritten
+static void XSdFecInvalidateOverlaps(XSdFec *InstancePtr, u32 CodeId, u32 SCOffset, u32 SCSize, u32 LAOffset, u32 LASize, u32 QCOffset, u32 QCSize) {
+  InstancePtr->Resident[CodeId].Signature = 0;
+  for (u32 i = 0; i < XSDFEC_LDPC_CODE_REG0_DEPTH; i++) {
+    if (InstancePtr->Resident[i].Signature == 0) {
+      continue;
+    }
+    if ((SCSize && InstancePtr->SCSize[i] && SCOffset < InstancePtr->SCOffset[i] + InstancePtr->SCSize[i] && InstancePtr->SCOffset[i] < SCOffset + SCSize) ||
+        (LASize && InstancePtr->LASize[i] && LAOffset < InstancePtr->LAOffset[i] + InstancePtr->LASize[i] && InstancePtr->LAOffset[i] < LAOffset + LASize) ||
+        (QCSize && InstancePtr->QCSize[i] && QCOffset < InstancePtr->QCOffset[i] + InstancePtr->QCSize[i] && InstancePtr->QCOffset[i] < QCOffset + QCSize)) {
+      InstancePtr->Resident[i].Signature = 0;
+    }
+  }
+}
+
+// A matching signature only marks a load as possibly redundant. The code is resident when the register images, which
+// include the code parameters and table placement, the word counts and the share tables it was written from match too
+static int XSdFecIsResident(const XSdFecResidentCode *ResidentPtr, const XSdFecCompiledCode *CodePtr) {
+  if (ResidentPtr->Signature == 0 || ResidentPtr->Signature != CodePtr->Signature) {
+    return 0;
+  }
+  for (u32 r = 0; r < 4; r++) {
+    if (ResidentPtr->Reg[r] != CodePtr->Reg[r]) {
+      return 0;
+    }
+  }
+  return ResidentPtr->SCWords == CodePtr->SCWords && ResidentPtr->SCTable == CodePtr->SCTable &&
+         ResidentPtr->LAWords == CodePtr->LAWords && ResidentPtr->LATable == CodePtr->LATable &&
+         ResidentPtr->QCWords == CodePtr->QCWords && ResidentPtr->QCTable == CodePtr->QCTable;
+}
+
+// Contiguous register writes, without per word read-modify-write or depth checks
+static u32 XSdFecWriteBlock(UINTPTR BaseAddress, u32 Addr, const u32 *DataArrayPtr, u32 NumData) {
+  for (u32 idx = 0; idx < NumData; idx++) {
+    XSdFecWriteReg(BaseAddress, Addr + idx*4, DataArrayPtr[idx]);
+  }
+  return NumData;
+}
+
+static u32 XSdFecSignature(u32 Hash, const u32 *DataArrayPtr, u32 NumData) {
+  for (u32 idx = 0; idx < NumData; idx++) {
+    u32 Word = DataArrayPtr[idx];
+    for (int b = 0; b < 4; b++) {
+      Hash ^= (Word >> (8*b)) & 0xff;
+      Hash *= 16777619U;
+    }
+  }
+  return Hash;
+}
+
 void XSdFecSetTurboParams(XSdFec *InstancePtr, const XSdFecTurboParameters* ParamsPtr) {
   Xil_AssertVoid(InstancePtr != NULL);
   Xil_AssertVoid(ParamsPtr   != NULL);
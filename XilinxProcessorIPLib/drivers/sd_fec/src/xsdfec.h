@@ -32,6 +32,9 @@
  * - XSdFecSetTurboParams(InstancePtr, ParamsPtr)                                        - Set Turbo parameters on a device
  * - XSdFecadd_ldpc_params(InstancePtr, CodeId, SCOffset, LAOffset, QCOffset, ParamsPtr) - Add LDPC parameters to a device
  * - XSdFecShareTableSize(ParamsPtr, SCSizePtr, LASizePtr, QCSizePtr)                    - Calculate share table size for a LDPC code
+ * - XSdFecCompileCodeSet(CodesPtr, CodeIds, ParamsPtrs, NumCodes, SCBase, LABase, QCBase) - Compile LDPC codes into a code set
+ * - XSdFecLoadCodeSet(InstancePtr, CodeSetPtr, StatsPtr)                                - Load a code set on a device
+ * - XSdFecInvalidateCodes(InstancePtr)                                                  - Forget the codes resident on a device
  * - XSdFecInterruptClassifier(InstancePtr)                                              - Classify interrupts
  *
  * In addition, the driver provides set and get functions for all the individual registers defined for the SD-FEC.
@@ -77,6 +80,22 @@ typedef struct {
     u32     Initialization[4];
 } XSdFec_Config;
 
+/** \brief Compiled LDPC code resident at a code ID
+ *
+ * Kept by XSdFecLoadCodeSet() to decide whether a compiled code is already loaded. The signature only
+ * filters; residency also requires the same register images, word counts and share tables.
+ */
+typedef struct {
+  u32        Signature; /**< Signature of the compiled code, 0 if none */
+  u32        Reg[4];    /**< LDPC_CODE_REG0 to LDPC_CODE_REG3 images written */
+  u32        SCWords;   /**< Table words written */
+  u32        LAWords;
+  u32        QCWords;
+  const u32* SCTable;   /**< Share tables the words were written from */
+  const u32* LATable;
+  const u32* QCTable;
+} XSdFecResidentCode;
+
 /** \brief SD-FEC driver instance
  *
  * Contains state information for each device.
@@ -88,6 +107,11 @@ typedef struct {
     u32 SCOffset[128]; /**< Lookup to SC table offsets for each code ID */
     u32 LAOffset[128]; /**< Lookup to LA table offsets for each code ID */
     u32 QCOffset[128]; /**< Lookup to QC table offsets for each code ID */
+    u32 SCSize[128];   /**< Lookup to SC table sizes for each code ID */
+    u32 LASize[128];   /**< Lookup to LA table sizes for each code ID */
+    u32 QCSize[128];   /**< Lookup to QC table sizes for each code ID */
+    XSdFecResidentCode Resident[128]; /**< Compiled code resident at each code ID */
+    u64 (*GetTime)(void); /**< Time source for load statistics, NULL if none */
 } XSdFec;
 
 /** \brief Struct defining LDPC code parameters
@@ -112,6 +136,49 @@ typedef struct {
   u32* QCTable;
 } XSdFecLdpcParameters;
 
+/** \brief Struct defining a compiled LDPC code
+ *
+ * Register images, table placement and signature of a LDPC code, populated by XSdFecCompileCodeSet().
+ * The share tables are referenced, not copied.
+ */
+typedef struct {
+  u32        CodeId;
+  u32        Reg[4];    /**< LDPC_CODE_REG0 to LDPC_CODE_REG3 images */
+  u32        SCOffset;
+  u32        LAOffset;
+  u32        QCOffset;
+  u32        SCSize;    /**< Effective table sizes, as returned by XSdFecShareTableSize() */
+  u32        LASize;
+  u32        QCSize;
+  u32        SCWords;   /**< Table words written */
+  u32        LAWords;
+  u32        QCWords;
+  const u32* SCTable;
+  const u32* LATable;
+  const u32* QCTable;
+  u32        Signature; /**< Identifies registers, placement and table contents, never 0 */
+} XSdFecCompiledCode;
+
+/** \brief Struct defining a compiled LDPC code set
+ *
+ * A family of codes loaded together by XSdFecLoadCodeSet()
+ */
+typedef struct {
+  u32                       NumCodes;
+  const XSdFecCompiledCode* Codes;
+} XSdFecCodeSet;
+
+/** \brief Code set load statistics
+ *
+ * Populated by XSdFecLoadCodeSet()
+ */
+typedef struct {
+  u32 Loaded;   /**< Codes written to the device */
+  u32 Resident; /**< Codes skipped as already resident */
+  u32 Words;    /**< Register and table words written */
+  u64 Time;     /**< Load time in ticks of the time source set by XSdFecSetTimer(), 0 if none */
+} XSdFecCodeSetStats;
+
 /** \brief Struct defining Turbo Decode parameters
  *
  * Member values defined in device specific header x<ipinst_name>_turbo_params.h as per IP GUI configuration
@@ -202,6 +269,54 @@ void XSdFecSetTurboParams(XSdFec *InstancePtr, const XSdFecTurboParameters* Para
  */
 void XSdFecShareTableSize(const XSdFecLdpcParameters* ParamsPtr, u32* SCSizePtr, u32* LASizePtr, u32* QCSizePtr);
 
+/**\brief Compile LDPC codes into a code set
+ *
+ * Precomputes the code parameter registers of each code, places its share tables one after the other from the given
+ * base offsets and computes its signature. This replaces per code calls of XSdFecShareTableSize() and can be done once,
+ * at start-up or off-line.
+ *
+ * @param CodesPtr    Array of NumCodes compiled codes to populate
+ * @param CodeIds     Code number of each code
+ * @param ParamsPtrs  Pointer to parameters struct of each code
+ * @param NumCodes    Number of codes
+ * @param SCBase      Scale table offset of the first code
+ * @param LABase      LA table offset of the first code
+ * @param QCBase      QC table offset of the first code
+ *
+ * @returns XST_SUCCESS, or XST_FAILURE if a code ID is out of range or the tables do not fit
+ */
+int XSdFecCompileCodeSet(XSdFecCompiledCode* CodesPtr, const u32* CodeIds, const XSdFecLdpcParameters* const* ParamsPtrs,
+                         u32 NumCodes, u32 SCBase, u32 LABase, u32 QCBase);
+
+/**\brief Load a code set on a device
+ *
+ * Writes the share tables and code parameter registers of each code of the set with contiguous register writes. A code is
+ * skipped when its code ID still holds the same register images and word counts written from the same share tables, and
+ * the signature of the table contents matches. Codes whose tables are overwritten are no longer resident. Share tables
+ * changed in place after a load must be followed by XSdFecInvalidateCodes(). The offsets arrays in the given XSdFec instance structure are updated as by XSdFecAddLdpcParams().
+ *
+ * @param InstancePtr Pointer to device instance struct
+ * @param CodeSetPtr  Pointer to the code set
+ * @param StatsPtr    Pointer to statistics struct to populate, may be NULL
+ */
+void XSdFecLoadCodeSet(XSdFec *InstancePtr, const XSdFecCodeSet* CodeSetPtr, XSdFecCodeSetStats* StatsPtr);
+
+/**\brief Forget the codes resident on a device
+ *
+ * To be called when the code tables of the device are lost, for example after the device has been reprogrammed, or
+ * when the share tables of loaded codes are changed in place
+ *
+ * @param InstancePtr Pointer to device instance struct
+ */
+void XSdFecInvalidateCodes(XSdFec *InstancePtr);
+
+/**\brief Set the time source for load statistics
+ *
+ * @param InstancePtr Pointer to device instance struct
+ * @param GetTime     Function returning a free running tick count, NULL for none
+ */
+void XSdFecSetTimer(XSdFec *InstancePtr, u64 (*GetTime)(void));
+
 /**\brief Classify interrupts
  * 
  * Queries interrupt status registers and classifies interrupt and reports recovery action
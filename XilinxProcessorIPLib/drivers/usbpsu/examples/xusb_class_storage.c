@@ -25,6 +25,10 @@
  * 1.5	  vak 13/02/19  Added support for versal
  * 1.5    vak 03/25/19 Fixed incorrect data_alignment pragma directive for IAR
  * 1.8   pm   15/09/20 Fixed C++ Compilation error.
+ * 1.16  pm   10/19/26 Added XUSB_STORAGE_USE_EPQUEUE option to send READ
+ *		       data through the endpoint request queue.
+ *		       Added XUSB_STORAGE_READ_THROUGHPUT option to report
+ *		       the READ data rate.
  *
  * </pre>
  *
@@ -34,14 +38,29 @@
 #include "xusb_class_storage.h"
 #include "xparameters.h"
 #include "xusb_ch9_storage.h"
+#ifdef XUSB_STORAGE_READ_THROUGHPUT
+#include "xiltimer.h"
+#endif
 
 /************************** Constant Definitions *****************************/
+#ifdef XUSB_STORAGE_USE_EPQUEUE
+#define STORAGE_EPQ_CHUNK	(16U * 1024U)	/* Bytes per queued request */
+#define STORAGE_EPQ_LAST	((void *)1)	/* Context of the last request */
+#endif
+#ifdef XUSB_STORAGE_READ_THROUGHPUT
+#define STORAGE_RATE_BYTES	(64U * 1024U * 1024U)	/* Report interval */
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /**************************** Type Definitions *******************************/
 
 /************************** Function Prototypes ******************************/
+#ifdef XUSB_STORAGE_USE_EPQUEUE
+static s32 StorageQueueFill(struct Usb_DevData *InstancePtr);
+static void StorageQueueHandler(void *CallBackRef,
+				struct XUsbPsu_EpRequest *Req);
+#endif
 
 /************************** Variable Definitions *****************************/
 extern u8 Phase;
@@ -100,6 +119,33 @@ extern USB_CSW CSW;
 extern u32	rxBytesLeft;
 extern u8	*VirtFlashWritePointer;
 
+#ifdef XUSB_STORAGE_USE_EPQUEUE
+/* Bulk IN request queue used for READ data. */
+static struct XUsbPsu_EpQueue BulkInQueue;
+static struct XUsbPsu_EpRequest BulkInReqs[XUSBPSU_EPQ_DEFAULT_DEPTH];
+#ifdef __ICCARM__
+#if defined (PLATFORM_ZYNQMP) || defined (versal)
+#pragma data_alignment = 64
+#else
+#pragma data_alignment = 32
+#endif
+static struct XUsbPsu_Trb BulkInTrbs[XUSBPSU_EPQ_DEFAULT_DEPTH + 1U];
+#else
+static struct XUsbPsu_Trb BulkInTrbs[XUSBPSU_EPQ_DEFAULT_DEPTH + 1U]
+ALIGNMENT_CACHELINE;
+#endif
+static u8 *QueueTxPtr;
+static u32 QueueTxLeft;
+#endif
+
+#ifdef XUSB_STORAGE_READ_THROUGHPUT
+/* READ data phase timing, from the CBW to the last data completion. */
+static XTime ReadStart;
+static u32 ReadLength;
+static u64 ReadBytes;
+static u64 ReadTicks;
+#endif
+
 /* Local transmit buffer for simple replies. */
 #ifdef __ICCARM__
 static u8 txBuffer[128];
@@ -229,10 +275,22 @@ void ParseCBW(struct Usb_DevData *InstancePtr)
 #endif
 
 				Phase = USB_EP_STATE_DATA_IN;
+#ifdef XUSB_STORAGE_READ_THROUGHPUT
+				ReadLength = htons(((SCSI_READ_WRITE *) &CBW.CBWCB)->
+						   length) * VFLASH_BLOCK_SIZE;
+				XTime_GetTime(&ReadStart);
+#endif
+#ifdef XUSB_STORAGE_USE_EPQUEUE
+				QueueTxPtr = &VirtFlash[Offset];
+				QueueTxLeft = htons(((SCSI_READ_WRITE *) &CBW.CBWCB)->
+						    length) * VFLASH_BLOCK_SIZE;
+				u32 RetVal = StorageQueueFill(InstancePtr);
+#else
 				u32 RetVal = EpBufferSend(InstancePtr->PrivateData, 1,
 							  &VirtFlash[Offset],
 							  htons(((SCSI_READ_WRITE *) &CBW.CBWCB)->
 								length) * VFLASH_BLOCK_SIZE);
+#endif
 				if (RetVal != XST_SUCCESS) {
 					xil_printf("Failed: READ Offset 0x%08x\n",
 						   Offset);
@@ -348,3 +406,155 @@ void SendCSW(struct Usb_DevData *InstancePtr, u32 Length)
 	Phase = USB_EP_STATE_STATUS;
 	EpBufferSend(InstancePtr->PrivateData, 1, (u8 *) &CSW, 13);
 }
+
+#ifdef XUSB_STORAGE_USE_EPQUEUE
+/****************************************************************************/
+/**
+* This function attaches the request queue to the Bulk IN endpoint. READ
+* data is then split in STORAGE_EPQ_CHUNK requests which are posted in
+* batches on a chained TRB ring instead of one TRB per EpBufferSend call.
+*
+* @param	InstancePtr is pointer to Usb_DevData instance.
+*
+* @return	XST_SUCCESS else XST_FAILURE.
+*
+* @note		None.
+*
+*****************************************************************************/
+s32 StorageQueueInit(struct Usb_DevData *InstancePtr)
+{
+	return XUsbPsu_EpQueueInit((struct XUsbPsu *)InstancePtr->PrivateData,
+				   1U, XUSBPSU_EP_DIR_IN, &BulkInQueue,
+				   BulkInTrbs, BulkInReqs,
+				   XUSBPSU_EPQ_DEFAULT_DEPTH,
+				   StorageQueueHandler);
+}
+
+/****************************************************************************/
+/**
+* This function posts as many READ data chunks as the Bulk IN request queue
+* can take. The last chunk closes the transfer so that the CSW can be sent
+* with EpBufferSend.
+*
+* @param	InstancePtr is pointer to Usb_DevData instance.
+*
+* @return	XST_SUCCESS else XST_FAILURE.
+*
+* @note		None.
+*
+*****************************************************************************/
+static s32 StorageQueueFill(struct Usb_DevData *InstancePtr)
+{
+	struct XUsbPsu *UsbPtr = (struct XUsbPsu *)InstancePtr->PrivateData;
+	struct XUsbPsu_EpRequest Reqs[XUSBPSU_EPQ_DEFAULT_DEPTH];
+	u32 Free;
+	u32 Count = 0U;
+	u32 Flags = 0U;
+
+	Free = XUsbPsu_EpQueueFree(UsbPtr, 1U, XUSBPSU_EP_DIR_IN);
+
+	while ((QueueTxLeft != 0U) && (Count < Free)) {
+		Reqs[Count].BufferPtr = QueueTxPtr;
+		Reqs[Count].Length = (QueueTxLeft > STORAGE_EPQ_CHUNK) ?
+				     STORAGE_EPQ_CHUNK : QueueTxLeft;
+		Reqs[Count].Context = NULL;
+
+		QueueTxPtr += Reqs[Count].Length;
+		QueueTxLeft -= Reqs[Count].Length;
+		if (QueueTxLeft == 0U) {
+			Reqs[Count].Context = STORAGE_EPQ_LAST;
+			Flags = XUSBPSU_EPQ_FLAG_LAST;
+		}
+		Count++;
+	}
+
+	if (Count == 0U) {
+		return XST_SUCCESS;
+	}
+
+	return XUsbPsu_EpQueueSubmit(UsbPtr, 1U, XUSBPSU_EP_DIR_IN, Reqs,
+				     Count, Flags);
+}
+
+/****************************************************************************/
+/**
+* This function is the Bulk IN request queue completion handler. It refills
+* the ring while READ data is left and sends the CSW after the last chunk.
+*
+* @param	CallBackRef is pointer to Usb_DevData instance.
+* @param	Req is the completed request.
+*
+* @return	None
+*
+* @note		None.
+*
+*****************************************************************************/
+static void StorageQueueHandler(void *CallBackRef,
+				struct XUsbPsu_EpRequest *Req)
+{
+	struct Usb_DevData *InstancePtr = (struct Usb_DevData *)CallBackRef;
+
+	/* Given back unfinished, the endpoint was flushed or disabled */
+	if (Req->Status == (s32)XST_DEVICE_IS_STOPPED) {
+		return;
+	}
+
+	if (Req->Context != STORAGE_EPQ_LAST) {
+		/* Refill by half rings to keep one command per batch */
+		if (XUsbPsu_EpQueueFree((struct XUsbPsu *)InstancePtr->PrivateData,
+					1U, XUSBPSU_EP_DIR_IN) >=
+		    (XUSBPSU_EPQ_DEFAULT_DEPTH / 2U)) {
+			(void)StorageQueueFill(InstancePtr);
+		}
+		return;
+	}
+
+#ifdef CLASS_STORAGE_DEBUG
+	printf("EPQ: %u requests, %u commands, %u events\r\n",
+	       (unsigned)BulkInQueue.Completed, (unsigned)BulkInQueue.Commands,
+	       (unsigned)BulkInQueue.Events);
+#endif
+#ifdef XUSB_STORAGE_READ_THROUGHPUT
+	StorageReadDone();
+#endif
+	SendCSW(InstancePtr, 0);
+}
+#endif
+
+#ifdef XUSB_STORAGE_READ_THROUGHPUT
+/****************************************************************************/
+/**
+* This function ends the timing of a READ data phase. The data rate is
+* printed every STORAGE_RATE_BYTES of READ data, so that a sequential read
+* on the host (e.g. dd of the whole disk) gives comparable numbers with and
+* without XUSB_STORAGE_USE_EPQUEUE.
+*
+* @param	None.
+*
+* @return	None
+*
+* @note		Called from the Bulk IN completion handler.
+*
+*****************************************************************************/
+void StorageReadDone(void)
+{
+	XTime Now;
+
+	if (ReadLength == 0U) {
+		return;
+	}
+
+	XTime_GetTime(&Now);
+	ReadTicks += (u64)(Now - ReadStart);
+	ReadBytes += ReadLength;
+	ReadLength = 0U;
+
+	if (ReadBytes >= STORAGE_RATE_BYTES) {
+		xil_printf("READ: %d KB/s\r\n",
+			   (u32)((ReadBytes * COUNTS_PER_SECOND) /
+				 (ReadTicks * 1024U)));
+		ReadBytes = 0U;
+		ReadTicks = 0U;
+	}
+}
+#endif
@@ -159,6 +159,12 @@ typedef struct {
 void ClassReq(struct Usb_DevData *InstancePtr, SetupPacket *SetupData);
 void ParseCBW(struct Usb_DevData *InstancePtr);
 void SendCSW(struct Usb_DevData *InstancePtr, u32 Length);
+#ifdef XUSB_STORAGE_USE_EPQUEUE
+s32 StorageQueueInit(struct Usb_DevData *InstancePtr);
+#endif
+#ifdef XUSB_STORAGE_READ_THROUGHPUT
+void StorageReadDone(void);
+#endif
 
 #ifdef __cplusplus
 }
@@ -27,6 +27,8 @@
  * 1.5	 vak 13/02/19 Added support for versal
  * 1.8   pm  15/09/20 Fixed C++ Compilation error.
  * 1.14  pm   21/06/23 Added support for system device-tree flow.
+ * 1.16  pm   10/19/26 Added READ data rate report with
+ *		      XUSB_STORAGE_READ_THROUGHPUT.
  *
  * </pre>
  *
@@ -243,6 +245,14 @@ int main(void)
 	SetEpHandler(UsbInstance.PrivateData, 1, USB_EP_DIR_IN,
 		     BulkInHandler);
 
+#ifdef XUSB_STORAGE_USE_EPQUEUE
+	/* READ data is sent through the Bulk IN request queue */
+	Status = StorageQueueInit(&UsbInstance);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+#endif
+
 	/* setup interrupts */
 #ifndef SDT
 	Status = SetupInterruptSystem((struct XUsbPsu *)UsbInstance.PrivateData,
@@ -358,6 +368,9 @@ void BulkInHandler(void *CallBackRef, u32 RequestedBytes,
 	struct Usb_DevData *InstancePtr = (struct Usb_DevData *)CallBackRef;
 
 	if (Phase == USB_EP_STATE_DATA_IN) {
+#ifdef XUSB_STORAGE_READ_THROUGHPUT
+		StorageReadDone();
+#endif
 		/* Send the status */
 		SendCSW(InstancePtr, 0);
 	} else if (Phase == USB_EP_STATE_STATUS) {
@@ -54,6 +54,8 @@
 * 1.15  ml    11/16/23 Fix compilation errors reported with -std=c2x compiler flag
 * 1.15  np    26/03/24 Add doxygen and editorial fixes
 * 1.16   dn    17/05/24 Fix compilation error
+* 1.16   pm    10/19/26 Added chained TRB request queue for non-control
+*                      endpoints
 * </pre>
 *
 *****************************************************************************/
@@ -111,6 +113,24 @@ extern "C" {
 #define	XUSBPSU_PHY_TIMEOUT		5000U	/**< Phy timeout- microseconds */
 /** @endcond */
 
+#ifndef XUSBPSU_EPQ_DEFAULT_DEPTH
+#define XUSBPSU_EPQ_DEFAULT_DEPTH	32U	/**< Default number of data TRBs
+						 *   in an endpoint request queue
+						 */
+#endif
+#define XUSBPSU_EPQ_MIN_DEPTH		2U	/**< Minimum request queue depth */
+
+/** @cond INTERNAL */
+#define XUSBPSU_EPQ_IDLE		0U	/**< No transfer started */
+#define XUSBPSU_EPQ_ACTIVE		1U	/**< Transfer started, ring open */
+#define XUSBPSU_EPQ_CLOSING		2U	/**< Last TRB posted with LST */
+/** @endcond */
+
+#define XUSBPSU_EPQ_FLAG_LAST		0x1U	/**< Close the transfer with
+						 *   the last request of a
+						 *   submitted batch
+						 */
+
 #define XUSBPSU_EP_DIR_IN		1U	/**< Direction IN */
 #define XUSBPSU_EP_DIR_OUT		0U	/**< Direction OUT */
 
@@ -379,6 +399,57 @@ typedef struct {
 } __attribute__ ((packed)) SetupPacket; /**< USB Standard Control Request */
 #endif
 
+/**
+ * struct XUsbPsu_EpRequest - Endpoint queue request
+ * @param BufferPtr: Data buffer, cache-line aligned
+ * @param Length: Number of bytes to send/receive
+ * @param Actual: Number of bytes actually transferred
+ * @param Status: XST_SUCCESS, XST_FAILURE if the request completed with a
+ *	TRB error status, or XST_DEVICE_IS_STOPPED if it was given back
+ *	unfinished by a flush or by disabling the endpoint
+ * @param Context: Caller specific data returned with the completion
+ */
+struct XUsbPsu_EpRequest {
+	u8	*BufferPtr;	/**< Data buffer, cache-line aligned */
+	u32	Length;		/**< Number of bytes to send/receive */
+	u32	Actual;		/**< Number of bytes actually transferred */
+	s32	Status;		/**< Completion status */
+	void	*Context;	/**< Caller specific data */
+}; /**< Endpoint queue request */
+
+/**
+ * struct XUsbPsu_EpQueue - Chained TRB request queue of an endpoint
+ * @param TrbRing: Depth data TRBs followed by one link TRB
+ * @param Reqs: Request slots, one per data TRB
+ * @param Handler: Called once per completed request
+ * @param Depth: Number of data TRBs in the ring
+ * @param Enqueue: Index of the next free TRB
+ * @param Dequeue: Index of the oldest in-flight TRB
+ * @param InFlight: Number of TRBs owned by the core
+ * @param State: Transfer state - XUSBPSU_EPQ_IDLE/ACTIVE/CLOSING
+ * @param Submitted: Number of requests submitted
+ * @param Completed: Number of requests completed
+ * @param Commands: Number of Start/UpdateTransfer commands issued
+ * @param Events: Number of transfer events reaped
+ */
+struct XUsbPsu_EpQueue {
+	struct XUsbPsu_Trb *TrbRing;	/**< Depth data TRBs + link TRB */
+	struct XUsbPsu_EpRequest *Reqs;	/**< Request slots */
+	void (*Handler)(void *, struct XUsbPsu_EpRequest *);
+	/**< Called once per
+	 *   completed request
+	 */
+	u32	Depth;		/**< Number of data TRBs in the ring */
+	u32	Enqueue;	/**< Index of the next free TRB */
+	u32	Dequeue;	/**< Index of the oldest in-flight TRB */
+	u32	InFlight;	/**< Number of TRBs owned by the core */
+	u32	State;		/**< Transfer state */
+	u32	Submitted;	/**< Number of requests submitted */
+	u32	Completed;	/**< Number of requests completed */
+	u32	Commands;	/**< Start/UpdateTransfer commands issued */
+	u32	Events;		/**< Transfer events reaped */
+}; /**< Endpoint request queue */
+
 /**
  * struct XUsbPsu_Ep - Endpoint representation
  * @param Handler: User handler
@@ -399,6 +470,7 @@ typedef struct {
  * @param Type: Type of Endpoint - Control/BULK/INTERRUPT/ISOC
  * @param Direction: Direction - EP_DIR_OUT/EP_DIR_IN
  * @param UnalignedTx: Unaligned Tx flag - 0/1
+ * @param Queue: Request queue attached to the endpoint, NULL if none
  */
 struct XUsbPsu_Ep {
 	void (*Handler)(void *, u32, u32);
@@ -438,6 +510,7 @@ struct XUsbPsu_Ep {
 				 */
 	u8	Direction;	/**< Direction - EP_DIR_OUT/EP_DIR_IN */
 	u8	UnalignedTx;	/**< Unaligned Tx flag - 0/1 */
+	struct XUsbPsu_EpQueue *Queue;	/**< Request queue, NULL if none */
 }; /**< Endpoint representation */
 
 /**
@@ -874,6 +947,21 @@ s32 XUsbPsu_IsEpStalled(struct XUsbPsu *InstancePtr, u8 Epnum, u8 Dir);
 void XUsbPsu_StopTransfer(struct XUsbPsu *InstancePtr, u8 UsbEpNum,
 			  u8 Dir, u8 Force);
 
+/*
+ * Functions in xusbpsu_epqueue.c
+ */
+s32 XUsbPsu_EpQueueInit(struct XUsbPsu *InstancePtr, u8 UsbEp, u8 Dir,
+			struct XUsbPsu_EpQueue *Queue,
+			struct XUsbPsu_Trb *TrbRing,
+			struct XUsbPsu_EpRequest *Reqs, u32 Depth,
+			void (*Handler)(void *, struct XUsbPsu_EpRequest *));
+s32 XUsbPsu_EpQueueSubmit(struct XUsbPsu *InstancePtr, u8 UsbEp, u8 Dir,
+			  const struct XUsbPsu_EpRequest *Reqs, u32 Count,
+			  u32 Flags);
+u32 XUsbPsu_EpQueueFree(struct XUsbPsu *InstancePtr, u8 UsbEp, u8 Dir);
+void XUsbPsu_EpQueueFlush(struct XUsbPsu *InstancePtr, u8 UsbEp, u8 Dir);
+void XUsbPsu_EpQueueRelease(struct XUsbPsu *InstancePtr, u8 UsbEp, u8 Dir);
+
 /*
  * Functions in xusbpsu_intr.c
  */
@@ -22,6 +22,7 @@
 * 1.10	pm  24/07/21 Fixed MISRA-C and Coverity warnings
 * 1.12	pm  10/08/22 Update doxygen tag and addtogroup version
 * 1.15  np  26/03/24 Add doxygen and editorial fixes
+* 1.16  pm  10/19/26 Complete queued requests when an endpoint is disabled
 *
 * </pre>
 *
@@ -206,6 +207,7 @@ s32 XUsbPsu_EpDisable(struct XUsbPsu *InstancePtr, u8 UsbEpNum, u8 Dir)
 	Ept->MaxSize = 0U;
 	Ept->TrbEnqueue	= 0U;
 	Ept->TrbDequeue	= 0U;
+	XUsbPsu_EpQueueReset(InstancePtr, Ept);
 
 	return (s32)XST_SUCCESS;
 }
@@ -21,6 +21,10 @@
 * 1.8	pm  24/07/20 Fixed MISRA-C and Coverity warnings
 * 1.12	pm  10/08/22 Update doxygen tag and addtogroup version
 * 1.15  np  26/03/24 Add doxygen and editorial fixes
+* 1.16  pm  10/19/26 Reject single buffer transfers while the endpoint
+*		     request queue owns the endpoint
+*       pm  10/19/26 Complete queued requests when an endpoint is
+*		     deactivated
 * </pre>
 *
 *****************************************************************************/
@@ -135,6 +139,7 @@ void XUsbPsu_EpTransferDeactive(struct XUsbPsu *InstancePtr, u8 UsbEpNum,
 		Ept->MaxSize = 0U;
 		Ept->TrbEnqueue = 0U;
 		Ept->TrbDequeue = 0U;
+		XUsbPsu_EpQueueReset(InstancePtr, Ept);
 	}
 }
 
@@ -244,6 +249,11 @@ s32 XUsbPsu_EpBufferSend(struct XUsbPsu *InstancePtr, u8 UsbEp,
 		return (s32)XST_FAILURE;
 	}
 
+	/* Endpoint is owned by its request queue */
+	if ((Ept->Queue != NULL) && (Ept->Queue->State != XUSBPSU_EPQ_IDLE)) {
+		return (s32)XST_FAILURE;
+	}
+
 	Ept->RequestedBytes = BufferLen;
 	Ept->BytesTxed = 0U;
 	Ept->BufferPtr = BufferPtr;
@@ -393,6 +403,11 @@ s32 XUsbPsu_EpBufferRecv(struct XUsbPsu *InstancePtr, u8 UsbEp,
 		return (s32)XST_FAILURE;
 	}
 
+	/* Endpoint is owned by its request queue */
+	if ((Ept->Queue != NULL) && (Ept->Queue->State != XUSBPSU_EPQ_IDLE)) {
+		return (s32)XST_FAILURE;
+	}
+
 	Ept->RequestedBytes = Length;
 	Size = Length;
 	Ept->BytesTxed = 0U;
@@ -0,0 +1,677 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+*****************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file xusbpsu_epqueue.c
+* @addtogroup usbpsu_api USBPSU APIs
+* @{
+*
+* This file implements the request queue for bulk, interrupt and isochronous
+* endpoints. Unlike XUsbPsu_EpBufferSend()/XUsbPsu_EpBufferRecv(), which
+* program one TRB marked LST per call, the request queue keeps the transfer
+* open on a caller supplied ring of TRBs terminated by a link TRB. A batch of
+* buffers is posted with a single Start/UpdateTransfer command and one cache
+* flush of the touched TRBs, and completed TRBs are reaped in bulk from each
+* XferInProgress/XferComplete event.
+*
+* The request queue and the single buffer API may share an endpoint as long
+* as they are not used at the same time. Submitting the last batch with
+* XUSBPSU_EPQ_FLAG_LAST closes the transfer and returns the endpoint to the
+* single buffer API once it completes.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.16  pm   10/19/26 First release
+*       pm   10/19/26 Complete outstanding requests when the endpoint is
+*                     disabled or deactivated
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xusbpsu_endpoint.h"
+#include "xusbpsu_local.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+
+/****************************************************************************/
+/**
+* Returns the number of bytes programmed in the TRB of a request. OUT
+* transfer sizes are rounded up to a multiple of MaxPacketSize as required by
+* the databook (8.2.5).
+*
+* @param	Ept Pointer to the endpoint.
+* @param	Req Pointer to the request.
+*
+* @return	TRB buffer size.
+*
+*****************************************************************************/
+static u32 XUsbPsu_EpQueueTrbSize(const struct XUsbPsu_Ep *Ept,
+				  const struct XUsbPsu_EpRequest *Req)
+{
+	u32 Size = Req->Length;
+
+	if ((Ept->Direction == XUSBPSU_EP_DIR_OUT) &&
+	    (!IS_ALIGNED(Size, Ept->MaxSize))) {
+		Size = (u32)roundup(Size, (u32)Ept->MaxSize);
+	}
+
+	return Size;
+}
+
+/****************************************************************************/
+/**
+* Performs cache maintenance on the data buffers of consecutive ring slots.
+* Buffers which are contiguous in memory are merged so that a run of chunks
+* of one large buffer costs a single cache operation.
+*
+* @param	Queue Pointer to the request queue.
+* @param	First Index of the first slot.
+* @param	Count Number of slots.
+* @param	Invalidate Invalidate instead of flush when non-zero.
+*
+* @return	None.
+*
+*****************************************************************************/
+static void XUsbPsu_EpQueueSyncBuffers(const struct XUsbPsu_EpQueue *Queue,
+				       u32 First, u32 Count, u8 Invalidate)
+{
+	const struct XUsbPsu_EpRequest *Req;
+	UINTPTR Start = 0U;
+	u32 Len = 0U;
+	u32 Index = First;
+	u32 Num;
+
+	for (Num = 0U; Num < Count; Num++) {
+		Req = &Queue->Reqs[Index];
+
+		if ((Len != 0U) && ((UINTPTR)Req->BufferPtr == (Start + Len))) {
+			Len += Req->Length;
+		} else {
+			if (Len != 0U) {
+				if (Invalidate != 0U) {
+					Xil_DCacheInvalidateRange((INTPTR)Start, Len);
+				} else {
+					Xil_DCacheFlushRange((INTPTR)Start, Len);
+				}
+			}
+			Start = (UINTPTR)Req->BufferPtr;
+			Len = Req->Length;
+		}
+
+		Index++;
+		if (Index == Queue->Depth) {
+			Index = 0U;
+		}
+	}
+
+	if (Len != 0U) {
+		if (Invalidate != 0U) {
+			Xil_DCacheInvalidateRange((INTPTR)Start, Len);
+		} else {
+			Xil_DCacheFlushRange((INTPTR)Start, Len);
+		}
+	}
+}
+
+/****************************************************************************/
+/**
+* Flushes consecutive TRBs of the ring, handling wrap around the link TRB.
+*
+* @param	Queue Pointer to the request queue.
+* @param	First Index of the first TRB.
+* @param	Count Number of TRBs.
+*
+* @return	None.
+*
+*****************************************************************************/
+static void XUsbPsu_EpQueueFlushTrbs(const struct XUsbPsu_EpQueue *Queue,
+				     u32 First, u32 Count)
+{
+	u32 Head = Count;
+
+	if ((First + Count) > Queue->Depth) {
+		Head = Queue->Depth - First;
+		Xil_DCacheFlushRange((INTPTR)&Queue->TrbRing[0U],
+				     (Count - Head) * sizeof(struct XUsbPsu_Trb));
+	}
+
+	Xil_DCacheFlushRange((INTPTR)&Queue->TrbRing[First],
+			     Head * sizeof(struct XUsbPsu_Trb));
+}
+
+/****************************************************************************/
+/**
+* Takes back TRBs prepared by a submission the core did not accept. HWO is
+* cleared on each TRB and the enqueue index is rolled back to the first one.
+*
+* @param	InstancePtr Pointer to the XUsbPsu instance.
+* @param	Queue Pointer to the request queue.
+* @param	First Index of the first prepared slot.
+* @param	Count Number of prepared slots.
+*
+* @return	None.
+*
+*****************************************************************************/
+static void XUsbPsu_EpQueueUnwind(const struct XUsbPsu *InstancePtr,
+				  struct XUsbPsu_EpQueue *Queue,
+				  u32 First, u32 Count)
+{
+	u32 Index = First;
+	u32 Num;
+
+	for (Num = 0U; Num < Count; Num++) {
+		Queue->TrbRing[Index].Ctrl &= ~XUSBPSU_TRB_CTRL_HWO;
+
+		Index++;
+		if (Index == Queue->Depth) {
+			Index = 0U;
+		}
+	}
+
+	if (InstancePtr->ConfigPtr->IsCacheCoherent == (u8)0U) {
+		XUsbPsu_EpQueueFlushTrbs(Queue, First, Count);
+	}
+
+	Queue->Enqueue = First;
+}
+
+/****************************************************************************/
+/**
+* @brief
+* Attaches a chained TRB request queue to a non-control endpoint.
+*
+* @param	InstancePtr Pointer to the XUsbPsu instance.
+* @param	UsbEp USB endpoint number.
+* @param	Dir Direction of endpoint
+* 				- XUSBPSU_EP_DIR_IN/XUSBPSU_EP_DIR_OUT.
+* @param	Queue Pointer to the queue control structure.
+* @param	TrbRing Pointer to Depth + 1 TRBs. The array must be cache-line
+*		aligned; the last entry is used as link TRB.
+* @param	Reqs Pointer to Depth request slots.
+* @param	Depth Number of data TRBs in the ring, at least
+*		XUSBPSU_EPQ_MIN_DEPTH.
+* @param	Handler Called once per completed request.
+*
+* @return	XST_SUCCESS else XST_FAILURE.
+*
+* @note		Ring depth is chosen by the caller, XUSBPSU_EPQ_DEFAULT_DEPTH
+*		is a reasonable value for SuperSpeed bulk endpoints.
+*
+*****************************************************************************/
+s32 XUsbPsu_EpQueueInit(struct XUsbPsu *InstancePtr, u8 UsbEp, u8 Dir,
+			struct XUsbPsu_EpQueue *Queue,
+			struct XUsbPsu_Trb *TrbRing,
+			struct XUsbPsu_EpRequest *Reqs, u32 Depth,
+			void (*Handler)(void *, struct XUsbPsu_EpRequest *))
+{
+	struct XUsbPsu_Ep *Ept;
+	struct XUsbPsu_Trb *TrbLink;
+	u32 Index;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((UsbEp > (u8)0U) && (UsbEp <= (u8)16U));
+	Xil_AssertNonvoid((Dir == XUSBPSU_EP_DIR_IN) ||
+			  (Dir == XUSBPSU_EP_DIR_OUT));
+	Xil_AssertNonvoid(Queue != NULL);
+	Xil_AssertNonvoid(TrbRing != NULL);
+	Xil_AssertNonvoid(Reqs != NULL);
+	Xil_AssertNonvoid(Depth >= XUSBPSU_EPQ_MIN_DEPTH);
+
+	Ept = &InstancePtr->eps[XUSBPSU_PhysicalEp(UsbEp, Dir)];
+
+	if ((Ept->Queue != NULL) && (Ept->Queue->State != XUSBPSU_EPQ_IDLE)) {
+		return (s32)XST_FAILURE;
+	}
+
+	for (Index = 0U; Index < Depth; Index++) {
+		TrbRing[Index].BufferPtrLow = 0U;
+		TrbRing[Index].BufferPtrHigh = 0U;
+		TrbRing[Index].Size = 0U;
+		TrbRing[Index].Ctrl = 0U;
+	}
+
+	/* Link TRB. The HWO bit is never reset */
+	TrbLink = &TrbRing[Depth];
+	TrbLink->BufferPtrLow = (UINTPTR)TrbRing;
+	TrbLink->BufferPtrHigh = ((UINTPTR)TrbRing >> 16U) >> 16U;
+	TrbLink->Size = 0U;
+	TrbLink->Ctrl = (XUSBPSU_TRBCTL_LINK_TRB | XUSBPSU_TRB_CTRL_HWO);
+
+	if (InstancePtr->ConfigPtr->IsCacheCoherent == (u8)0U) {
+		Xil_DCacheFlushRange((INTPTR)TrbRing,
+				     (Depth + 1U) * sizeof(struct XUsbPsu_Trb));
+	}
+
+	Queue->TrbRing = TrbRing;
+	Queue->Reqs = Reqs;
+	Queue->Handler = Handler;
+	Queue->Depth = Depth;
+	Queue->Submitted = 0U;
+	Queue->Completed = 0U;
+	Queue->Commands = 0U;
+	Queue->Events = 0U;
+	Queue->Enqueue = 0U;
+	Queue->Dequeue = 0U;
+	Queue->InFlight = 0U;
+	Queue->State = XUSBPSU_EPQ_IDLE;
+	Ept->Queue = Queue;
+
+	return (s32)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* @brief
+* Posts a batch of buffers on an endpoint request queue.
+*
+* All requests are written to the ring, the touched TRBs and the data
+* buffers are flushed/invalidated once per batch, and the core is notified
+* with a single StartTransfer or UpdateTransfer command.
+*
+* @param	InstancePtr Pointer to the XUsbPsu instance.
+* @param	UsbEp USB endpoint number.
+* @param	Dir Direction of endpoint
+* 				- XUSBPSU_EP_DIR_IN/XUSBPSU_EP_DIR_OUT.
+* @param	Reqs Array of requests. BufferPtr, Length and Context are
+*		copied into the ring, the array may be reused on return.
+* @param	Count Number of requests in the array.
+* @param	Flags 0 or XUSBPSU_EPQ_FLAG_LAST to close the transfer after
+*		the last request (bulk and interrupt endpoints only).
+*
+* @return	XST_SUCCESS else XST_FAILURE if the queue is not attached,
+*		has less than Count free TRBs, or is closing.
+*
+*****************************************************************************/
+s32 XUsbPsu_EpQueueSubmit(struct XUsbPsu *InstancePtr, u8 UsbEp, u8 Dir,
+			  const struct XUsbPsu_EpRequest *Reqs, u32 Count,
+			  u32 Flags)
+{
+	struct XUsbPsu_Ep *Ept;
+	struct XUsbPsu_EpQueue *Queue;
+	struct XUsbPsu_EpRequest *Req;
+	struct XUsbPsu_Trb *TrbPtr;
+	struct XUsbPsu_EpParams Params;
+	u32 First;
+	u32 Index;
+	u32 Ctrl;
+	u32 Cmd;
+	s32 RetVal;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((UsbEp > (u8)0U) && (UsbEp <= (u8)16U));
+	Xil_AssertNonvoid((Dir == XUSBPSU_EP_DIR_IN) ||
+			  (Dir == XUSBPSU_EP_DIR_OUT));
+	Xil_AssertNonvoid(Reqs != NULL);
+
+	Ept = &InstancePtr->eps[XUSBPSU_PhysicalEp(UsbEp, Dir)];
+	Queue = Ept->Queue;
+
+	if ((Queue == NULL) || (Count == 0U) ||
+	    ((Ept->EpStatus & XUSBPSU_EP_ENABLED) == (u32)0U) ||
+	    (Queue->State == XUSBPSU_EPQ_CLOSING) ||
+	    (Count > (Queue->Depth - Queue->InFlight))) {
+		return (s32)XST_FAILURE;
+	}
+
+	/* Endpoint is busy with a single buffer transfer */
+	if ((Queue->State == XUSBPSU_EPQ_IDLE) &&
+	    ((Ept->EpStatus & XUSBPSU_EP_BUSY) != (u32)0U)) {
+		return (s32)XST_FAILURE;
+	}
+
+	if (Ept->Type == XUSBPSU_ENDPOINT_XFER_ISOC) {
+		Ctrl = XUSBPSU_TRBCTL_ISOCHRONOUS_FIRST;
+	} else {
+		Ctrl = XUSBPSU_TRBCTL_NORMAL;
+	}
+	Ctrl |= (XUSBPSU_TRB_CTRL_CSP | XUSBPSU_TRB_CTRL_ISP_IMI);
+
+	First = Queue->Enqueue;
+	for (Index = 0U; Index < Count; Index++) {
+		Req = &Queue->Reqs[Queue->Enqueue];
+		TrbPtr = &Queue->TrbRing[Queue->Enqueue];
+
+		Req->BufferPtr = Reqs[Index].BufferPtr;
+		Req->Length = Reqs[Index].Length;
+		Req->Context = Reqs[Index].Context;
+		Req->Actual = 0U;
+		Req->Status = (s32)XST_SUCCESS;
+
+		TrbPtr->BufferPtrLow  = (UINTPTR)Req->BufferPtr;
+		TrbPtr->BufferPtrHigh = ((UINTPTR)Req->BufferPtr >> 16U) >> 16U;
+		TrbPtr->Size = XUsbPsu_EpQueueTrbSize(Ept, Req) &
+			       XUSBPSU_TRB_SIZE_MASK;
+
+		/*
+		 * Only the last TRB of a batch and the TRB closing each half
+		 * of the ring interrupt, completions of the other TRBs are
+		 * reaped together with them. The half ring interrupt lets the
+		 * caller refill a full ring before the core drains it.
+		 */
+		if (((Queue->Enqueue + 1U) % (Queue->Depth / 2U)) == 0U) {
+			TrbPtr->Ctrl = Ctrl | XUSBPSU_TRB_CTRL_IOC |
+				       XUSBPSU_TRB_CTRL_HWO;
+		} else {
+			TrbPtr->Ctrl = Ctrl | XUSBPSU_TRB_CTRL_HWO;
+		}
+
+		if (Index == (Count - 1U)) {
+			TrbPtr->Ctrl = Ctrl | XUSBPSU_TRB_CTRL_IOC |
+				       XUSBPSU_TRB_CTRL_HWO;
+			if (((Flags & XUSBPSU_EPQ_FLAG_LAST) != 0U) &&
+			    (Ept->Type != XUSBPSU_ENDPOINT_XFER_ISOC)) {
+				TrbPtr->Ctrl |= XUSBPSU_TRB_CTRL_LST;
+			}
+		}
+
+		Queue->Enqueue++;
+		if (Queue->Enqueue == Queue->Depth) {
+			Queue->Enqueue = 0U;
+		}
+	}
+
+	if (InstancePtr->ConfigPtr->IsCacheCoherent == (u8)0U) {
+		XUsbPsu_EpQueueFlushTrbs(Queue, First, Count);
+		XUsbPsu_EpQueueSyncBuffers(Queue, First, Count,
+					   (Dir == XUSBPSU_EP_DIR_OUT) ? 1U : 0U);
+	}
+
+	Params.Param0 = 0U;
+	Params.Param1 = (UINTPTR)&Queue->TrbRing[First];
+	Params.Param2 = 0U;
+
+	if (Queue->State == XUSBPSU_EPQ_ACTIVE) {
+		Cmd = XUSBPSU_DEPCMD_UPDATETRANSFER;
+		Cmd |= XUSBPSU_DEPCMD_PARAM(Ept->ResourceIndex);
+	} else {
+		Cmd = XUSBPSU_DEPCMD_STARTTRANSFER;
+		Cmd |= XUSBPSU_DEPCMD_PARAM(Ept->CurUf);
+	}
+
+	RetVal = XUsbPsu_SendEpCmd(InstancePtr, UsbEp, Dir, Cmd, &Params);
+	if (RetVal != (s32)XST_SUCCESS) {
+		/*
+		 * Core did not take the TRBs, hand them back to software
+		 * before giving the slots back so that an open transfer
+		 * does not run into a half queued batch.
+		 */
+		XUsbPsu_EpQueueUnwind(InstancePtr, Queue, First, Count);
+		return (s32)XST_FAILURE;
+	}
+
+	if (Queue->State == XUSBPSU_EPQ_IDLE) {
+		Ept->ResourceIndex = (u8)XUsbPsu_EpGetTransferIndex(InstancePtr,
+				     Ept->UsbEpNum,
+				     Ept->Direction);
+		Ept->EpStatus |= XUSBPSU_EP_BUSY;
+	}
+
+	Queue->State = ((Flags & XUSBPSU_EPQ_FLAG_LAST) != 0U) ?
+		       XUSBPSU_EPQ_CLOSING : XUSBPSU_EPQ_ACTIVE;
+	Queue->InFlight += Count;
+	Queue->Submitted += Count;
+	Queue->Commands++;
+
+	return (s32)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* @brief
+* Returns the number of requests that can be submitted on an endpoint
+* request queue.
+*
+* @param	InstancePtr Pointer to the XUsbPsu instance.
+* @param	UsbEp USB endpoint number.
+* @param	Dir Direction of endpoint
+* 				- XUSBPSU_EP_DIR_IN/XUSBPSU_EP_DIR_OUT.
+*
+* @return	Number of free TRBs, 0 if no queue is attached.
+*
+*****************************************************************************/
+u32 XUsbPsu_EpQueueFree(struct XUsbPsu *InstancePtr, u8 UsbEp, u8 Dir)
+{
+	struct XUsbPsu_Ep *Ept;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((UsbEp > (u8)0U) && (UsbEp <= (u8)16U));
+	Xil_AssertNonvoid((Dir == XUSBPSU_EP_DIR_IN) ||
+			  (Dir == XUSBPSU_EP_DIR_OUT));
+
+	Ept = &InstancePtr->eps[XUSBPSU_PhysicalEp(UsbEp, Dir)];
+	if (Ept->Queue == NULL) {
+		return 0U;
+	}
+
+	return Ept->Queue->Depth - Ept->Queue->InFlight;
+}
+
+/****************************************************************************/
+/**
+* Reaps all completed TRBs of an endpoint request queue. Called for
+* XferInProgress and XferComplete events when a queued transfer is active.
+*
+* @param	InstancePtr Pointer to the XUsbPsu instance.
+* @param	Event Pointer to the endpoint event occurred in core.
+*
+* @return	None.
+*
+*****************************************************************************/
+void XUsbPsu_EpQueueXferEvent(struct XUsbPsu *InstancePtr,
+			      const struct XUsbPsu_Event_Epevt *Event)
+{
+	struct XUsbPsu_Ep *Ept;
+	struct XUsbPsu_EpQueue *Queue;
+	struct XUsbPsu_EpRequest *Req;
+	struct XUsbPsu_EpRequest Done;
+	const struct XUsbPsu_Trb *TrbPtr;
+	u32 Index;
+	u32 Count;
+	u32 Size;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(Event != NULL);
+
+	Ept = &InstancePtr->eps[Event->Epnumber];
+	Queue = Ept->Queue;
+	Queue->Events++;
+
+	if (InstancePtr->ConfigPtr->IsCacheCoherent == (u8)0U) {
+		Xil_DCacheInvalidateRange((INTPTR)Queue->TrbRing,
+					  Queue->Depth *
+					  sizeof(struct XUsbPsu_Trb));
+	}
+
+	/* Find how many TRBs the core has given back */
+	Count = 0U;
+	Index = Queue->Dequeue;
+	while (Count < Queue->InFlight) {
+		TrbPtr = &Queue->TrbRing[Index];
+		if ((TrbPtr->Ctrl & XUSBPSU_TRB_CTRL_HWO) != 0U) {
+			break;
+		}
+
+		Req = &Queue->Reqs[Index];
+		Size = XUsbPsu_EpQueueTrbSize(Ept, Req);
+		Req->Actual = Size - (TrbPtr->Size & XUSBPSU_TRB_SIZE_MASK);
+		if (XUSBPSU_TRB_SIZE_TRBSTS(TrbPtr->Size) != XUSBPSU_TRBSTS_OK) {
+			Req->Status = (s32)XST_FAILURE;
+		}
+
+		Count++;
+		Index++;
+		if (Index == Queue->Depth) {
+			Index = 0U;
+		}
+	}
+
+	if ((Ept->Direction == XUSBPSU_EP_DIR_OUT) && (Count != 0U) &&
+	    (InstancePtr->ConfigPtr->IsCacheCoherent == (u8)0U)) {
+		XUsbPsu_EpQueueSyncBuffers(Queue, Queue->Dequeue, Count, 1U);
+	}
+
+	if (Event->Endpoint_Event == XUSBPSU_DEPEVT_XFERCOMPLETE) {
+		Ept->EpStatus &= ~(XUSBPSU_EP_BUSY);
+		Ept->ResourceIndex = 0U;
+		Queue->State = XUSBPSU_EPQ_IDLE;
+	}
+
+	/*
+	 * Release each slot before its handler runs so that the handler can
+	 * submit the next buffers. The request is copied as the slot may be
+	 * reused by such a submit.
+	 */
+	while (Count != 0U) {
+		Done = Queue->Reqs[Queue->Dequeue];
+
+		Queue->Dequeue++;
+		if (Queue->Dequeue == Queue->Depth) {
+			Queue->Dequeue = 0U;
+		}
+		Queue->InFlight--;
+		Queue->Completed++;
+		Count--;
+
+		if (Queue->Handler != NULL) {
+			Queue->Handler(InstancePtr->AppData, &Done);
+		}
+	}
+}
+
+/****************************************************************************/
+/**
+* @brief
+* Ends the transfer of an endpoint request queue and completes all
+* outstanding requests with XST_DEVICE_IS_STOPPED.
+*
+* @param	InstancePtr Pointer to the XUsbPsu instance.
+* @param	UsbEp USB endpoint number.
+* @param	Dir Direction of endpoint
+* 				- XUSBPSU_EP_DIR_IN/XUSBPSU_EP_DIR_OUT.
+*
+* @return	None.
+*
+*****************************************************************************/
+void XUsbPsu_EpQueueFlush(struct XUsbPsu *InstancePtr, u8 UsbEp, u8 Dir)
+{
+	struct XUsbPsu_Ep *Ept;
+	struct XUsbPsu_EpQueue *Queue;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid((UsbEp > (u8)0U) && (UsbEp <= (u8)16U));
+	Xil_AssertVoid((Dir == XUSBPSU_EP_DIR_IN) ||
+		       (Dir == XUSBPSU_EP_DIR_OUT));
+
+	Ept = &InstancePtr->eps[XUSBPSU_PhysicalEp(UsbEp, Dir)];
+	Queue = Ept->Queue;
+	if (Queue == NULL) {
+		return;
+	}
+
+	if (Queue->State != XUSBPSU_EPQ_IDLE) {
+		XUsbPsu_StopTransfer(InstancePtr, UsbEp, Dir, (u8)TRUE);
+	}
+
+	XUsbPsu_EpQueueReset(InstancePtr, Ept);
+}
+
+/****************************************************************************/
+/**
+* @brief
+* Flushes and detaches the request queue of an endpoint. The endpoint is
+* left to the single buffer API.
+*
+* @param	InstancePtr Pointer to the XUsbPsu instance.
+* @param	UsbEp USB endpoint number.
+* @param	Dir Direction of endpoint
+* 				- XUSBPSU_EP_DIR_IN/XUSBPSU_EP_DIR_OUT.
+*
+* @return	None.
+*
+*****************************************************************************/
+void XUsbPsu_EpQueueRelease(struct XUsbPsu *InstancePtr, u8 UsbEp, u8 Dir)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid((UsbEp > (u8)0U) && (UsbEp <= (u8)16U));
+	Xil_AssertVoid((Dir == XUSBPSU_EP_DIR_IN) ||
+		       (Dir == XUSBPSU_EP_DIR_OUT));
+
+	XUsbPsu_EpQueueFlush(InstancePtr, UsbEp, Dir);
+	InstancePtr->eps[XUSBPSU_PhysicalEp(UsbEp, Dir)].Queue = NULL;
+}
+
+/****************************************************************************/
+/**
+* Gives back the TRBs of the request queue attached to an endpoint and
+* completes each outstanding request with XST_DEVICE_IS_STOPPED, then resets
+* the ring indices. Used when the queue is flushed and when the endpoint is
+* disabled or deactivated.
+*
+* @param	InstancePtr Pointer to the XUsbPsu instance.
+* @param	Ept Pointer to the endpoint.
+*
+* @return	None.
+*
+* @note		The transfer must have been ended. Submits from the handlers
+*		are rejected until all requests have been completed.
+*
+*****************************************************************************/
+void XUsbPsu_EpQueueReset(struct XUsbPsu *InstancePtr,
+			  struct XUsbPsu_Ep *Ept)
+{
+	struct XUsbPsu_EpQueue *Queue = Ept->Queue;
+	struct XUsbPsu_EpRequest Done;
+	u32 Index;
+
+	if (Queue == NULL) {
+		return;
+	}
+
+	/* Closing rejects submits from the handlers below */
+	Queue->State = XUSBPSU_EPQ_CLOSING;
+
+	for (Index = 0U; Index < Queue->Depth; Index++) {
+		Queue->TrbRing[Index].Ctrl = 0U;
+	}
+	if (InstancePtr->ConfigPtr->IsCacheCoherent == (u8)0U) {
+		Xil_DCacheFlushRange((INTPTR)Queue->TrbRing,
+				     Queue->Depth * sizeof(struct XUsbPsu_Trb));
+	}
+
+	while (Queue->InFlight != 0U) {
+		Done = Queue->Reqs[Queue->Dequeue];
+		Done.Actual = 0U;
+		Done.Status = (s32)XST_DEVICE_IS_STOPPED;
+
+		Queue->Dequeue++;
+		if (Queue->Dequeue == Queue->Depth) {
+			Queue->Dequeue = 0U;
+		}
+		Queue->InFlight--;
+
+		if (Queue->Handler != NULL) {
+			Queue->Handler(InstancePtr->AppData, &Done);
+		}
+	}
+
+	Queue->Enqueue = 0U;
+	Queue->Dequeue = 0U;
+	Queue->State = XUSBPSU_EPQ_IDLE;
+}
+/** @} */
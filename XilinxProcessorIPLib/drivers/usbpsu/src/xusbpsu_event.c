@@ -73,7 +73,12 @@ void XUsbPsu_EpEvent(struct XUsbPsu *InstancePtr,
 	switch (Event->Endpoint_Event) {
 		case XUSBPSU_DEPEVT_XFERCOMPLETE:
 		case XUSBPSU_DEPEVT_XFERINPROGRESS:
-			XUsbPsu_EpXferComplete(InstancePtr, Event);
+			if ((Ept->Queue != NULL) &&
+			    (Ept->Queue->State != XUSBPSU_EPQ_IDLE)) {
+				XUsbPsu_EpQueueXferEvent(InstancePtr, Event);
+			} else {
+				XUsbPsu_EpXferComplete(InstancePtr, Event);
+			}
 			break;
 
 		case XUSBPSU_DEPEVT_XFERNOTREADY:
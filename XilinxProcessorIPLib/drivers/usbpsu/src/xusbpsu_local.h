@@ -97,6 +97,14 @@ s32 XUsbPsu_SetXferResource(struct XUsbPsu *InstancePtr, u8 UsbEpNum, u8 Dir);
 void XUsbPsu_ClearStallAllEp(struct XUsbPsu *InstancePtr);
 void XUsbPsu_StopActiveTransfers(struct XUsbPsu *InstancePtr);
 
+/*
+ * Functions in xusbpsu_epqueue.c
+ */
+void XUsbPsu_EpQueueReset(struct XUsbPsu *InstancePtr,
+			  struct XUsbPsu_Ep *Ept);
+void XUsbPsu_EpQueueXferEvent(struct XUsbPsu *InstancePtr,
+			      const struct XUsbPsu_Event_Epevt *Event);
+
 /*
  * Functions in xusbpsu_controltransfer.c
  */
@@ -36,6 +36,7 @@
 * 4.50  pg    01/07/21   Added new registers to support fid_out interlace solution.
 *						Interrupt count support for throughput measurement.
 * 4.70  pg    05/23/23   Added new 3 planar video format Y_U_V8_420.
+* 5.00  sb    10/19/26   Added frame buffer pool support.
 * </pre>
 *
 ******************************************************************************/
@@ -53,6 +54,7 @@
 #define XV_WAIT_FOR_FLUSH_DELAY		         (2000)
 /************************** Function Prototypes ******************************/
 static void SetPowerOnDefaultState(XV_FrmbufRd_l2 *InstancePtr);
+static void XVFrmbufRd_PoolProgram(XV_FrmbufRd_l2 *InstancePtr, u32 Idx);
 XVidC_ColorFormat RdMemory2Live(XVidC_ColorFormat MemFmt);
 
 /*****************************************************************************/
@@ -309,6 +311,8 @@ void XVFrmbufRd_Start(XV_FrmbufRd_l2 *InstancePtr)
 {
 	Xil_AssertVoid(InstancePtr != NULL);
 
+	if (InstancePtr->Pool != NULL)
+		InstancePtr->PoolRun = TRUE;
 	XV_frmbufrd_Start(&InstancePtr->FrmbufRd);
 }
 
@@ -329,6 +333,9 @@ int XVFrmbufRd_Stop(XV_FrmbufRd_l2 *InstancePtr)
 	u32 Data = 0;
 	Xil_AssertNonvoid(InstancePtr != NULL);
 
+	/* Do not restart from the frame done interrupt */
+	InstancePtr->PoolRun = FALSE;
+
 	/* Clear autostart bit */
 	XV_frmbufrd_DisableAutoRestart(&InstancePtr->FrmbufRd);
 
@@ -1020,4 +1027,162 @@ void XVFrmbufRd_DbgReportStatus(XV_FrmbufRd_l2 *InstancePtr)
 	xil_printf("VChroma Buffer Address:     0x%x\r\n", XV_frmbufrd_Get_HwReg_frm_buffer3_V(&InstancePtr->FrmbufRd));
 }
 
+/*****************************************************************************/
+/**
+ * This function attaches a frame buffer pool to the core, which then reads
+ * the frames of the pool. The newest ready frame is programmed and the frame
+ * done interrupt is enabled. Frames are read once XVFrmbufRd_Start() is
+ * called.
+ *
+ * @param  InstancePtr is a pointer to core instance to be worked upon
+ * @param  PoolPtr is the pool, NULL to detach the current pool
+ *
+ * @return XST_SUCCESS if the pool is attached or detached
+ *         XST_NO_DATA if the pool has no ready frame
+ *         XVFRMBUFRD_ERR_MEM_ADDR_MISALIGNED if a pool buffer is misaligned
+ *
+ * @note   The core must be stopped. When the pool is detached, the frame
+ *         being read is released.
+ *
+ ******************************************************************************/
+int XVFrmbufRd_SetPool(XV_FrmbufRd_l2 *InstancePtr, XVidC_FbPool *PoolPtr)
+{
+	const XVidC_FbBuffer *Buf;
+	UINTPTR Align;
+	u32 Idx;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	InstancePtr->PoolRun = FALSE;
+	if (PoolPtr == NULL) {
+		if (InstancePtr->Pool != NULL)
+			XVidC_FbPoolRelease(InstancePtr->Pool,
+					    InstancePtr->PoolFrame.Idx);
+		InstancePtr->Pool = NULL;
+		return XST_SUCCESS;
+	}
+
+	/* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
+	Align = 2 * InstancePtr->FrmbufRd.Config.PixPerClk * 4;
+	for (Idx = 0; Idx < PoolPtr->NumBuffers; Idx++) {
+		Buf = XVidC_FbPoolGetBuffer(PoolPtr, Idx);
+		if ((Buf->LumaAddr == 0) || ((Buf->LumaAddr % Align) != 0) ||
+		    ((Buf->ChromaAddr % Align) != 0) ||
+		    ((Buf->VChromaAddr % Align) != 0))
+			return XVFRMBUFRD_ERR_MEM_ADDR_MISALIGNED;
+	}
+
+	if (XVidC_FbPoolAcquireLatest(PoolPtr, &InstancePtr->PoolFrame,
+				      NULL) != XST_SUCCESS)
+		return XST_NO_DATA;
+
+	InstancePtr->Pool = PoolPtr;
+	memset(&InstancePtr->PoolStats, 0, sizeof(XVidC_FbStats));
+	XVFrmbufRd_PoolProgram(InstancePtr, InstancePtr->PoolFrame.Idx);
+
+	XVFrmbufRd_InterruptEnable(InstancePtr, XVFRMBUFRD_IRQ_DONE_MASK);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function returns the frame statistics of the attached pool
+ *
+ * @param  InstancePtr is a pointer to core instance to be worked upon
+ * @param  StatsPtr is where the statistics are returned
+ *
+ * @return none
+ *
+ ******************************************************************************/
+void XVFrmbufRd_GetPoolStats(XV_FrmbufRd_l2 *InstancePtr,
+			     XVidC_FbStats *StatsPtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	*StatsPtr = InstancePtr->PoolStats;
+}
+
+/*****************************************************************************/
+/**
+ * This function returns the pool frame being read, with the sequence number
+ * and timestamp given by its producer
+ *
+ * @param  InstancePtr is a pointer to core instance to be worked upon
+ * @param  FramePtr is where the frame descriptor is returned
+ *
+ * @return none
+ *
+ ******************************************************************************/
+void XVFrmbufRd_GetPoolFrame(XV_FrmbufRd_l2 *InstancePtr,
+			     XVidC_FbFrame *FramePtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->Pool != NULL);
+	Xil_AssertVoid(FramePtr != NULL);
+
+	*FramePtr = InstancePtr->PoolFrame;
+}
+
+/*****************************************************************************/
+/**
+ * This function completes a pool frame. It is called by
+ * XVFrmbufRd_InterruptHandler() on frame done when a pool is attached.
+ *
+ * The newest ready frame of the pool replaces the one just read, which is
+ * released. If no frame is ready, the current frame is read again.
+ *
+ * @param  InstancePtr is a pointer to core instance to be worked upon
+ *
+ * @return none
+ *
+ ******************************************************************************/
+void XVFrmbufRd_PoolDoneHandler(XV_FrmbufRd_l2 *InstancePtr)
+{
+	XVidC_FbFrame Frame;
+	u32 Skipped;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->Pool != NULL);
+
+	InstancePtr->PoolStats.Frames++;
+	if (XVidC_FbPoolAcquireLatest(InstancePtr->Pool, &Frame,
+				      &Skipped) == XST_SUCCESS) {
+		XVidC_FbPoolRelease(InstancePtr->Pool,
+				    InstancePtr->PoolFrame.Idx);
+		InstancePtr->PoolFrame = Frame;
+		InstancePtr->PoolStats.Drops += Skipped;
+		XVFrmbufRd_PoolProgram(InstancePtr, Frame.Idx);
+	} else {
+		InstancePtr->PoolStats.Repeats++;
+	}
+
+	if (InstancePtr->PoolRun)
+		XV_frmbufrd_Start(&InstancePtr->FrmbufRd);
+}
+
+/*****************************************************************************/
+/**
+ * This function programs the planes of a pool buffer
+ *
+ * @param  InstancePtr is a pointer to core instance to be worked upon
+ * @param  Idx is the buffer index
+ *
+ * @return none
+ *
+ ******************************************************************************/
+static void XVFrmbufRd_PoolProgram(XV_FrmbufRd_l2 *InstancePtr, u32 Idx)
+{
+	const XVidC_FbBuffer *Buf = XVidC_FbPoolGetBuffer(InstancePtr->Pool, Idx);
+
+	XV_frmbufrd_Set_HwReg_frm_buffer_V(&InstancePtr->FrmbufRd, Buf->LumaAddr);
+	if (Buf->ChromaAddr != 0)
+		XV_frmbufrd_Set_HwReg_frm_buffer2_V(&InstancePtr->FrmbufRd,
+						    Buf->ChromaAddr);
+	if (Buf->VChromaAddr != 0)
+		XV_frmbufrd_Set_HwReg_frm_buffer3_V(&InstancePtr->FrmbufRd,
+						    Buf->VChromaAddr);
+}
+
 /** @} */
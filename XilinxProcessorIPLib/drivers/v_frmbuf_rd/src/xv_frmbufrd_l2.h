@@ -75,6 +75,17 @@
 *     will configure the IP to keep processing frames without sw intervention.
 *   - Polling mode is the default configuration set during driver initialization
 *
+* <b> Buffer Pool </b>
+*
+* Instead of setting buffer addresses itself, the application can attach a
+* frame buffer pool (see xvidc_fbpool.h) with XVFrmbufRd_SetPool(). The
+* driver then runs in interrupt mode: on every frame done interrupt it takes
+* the newest ready frame of the pool, releases the frame it has just read and
+* starts the next frame. Older ready frames are released unread and counted
+* as dropped; when no new frame is ready, the current one is read again and
+* counted as repeated. XVFrmbufRd_GetPoolFrame() returns the frame being read,
+* with the sequence number and time its producer gave it.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -100,6 +111,7 @@
 * 4.50  kp    13/07/21   Added new 3 planar video format Y_U_V8
 * 4.60  kp    12/03/21   Added new 3 planar video format Y_U_V10
 * 4.70  pg    05/23/23   Added new 3 planar video format Y_U_V8_420.
+* 5.00  sb    10/19/26   Added frame buffer pool support.
 * </pre>
 *
 ******************************************************************************/
@@ -111,6 +123,7 @@ extern "C" {
 #endif
 
 #include "xvidc.h"
+#include "xvidc_fbpool.h"
 #include "xv_frmbufrd.h"
 
 /************************** Constant Definitions *****************************/
@@ -172,6 +185,11 @@ typedef struct {
                                 callback */
 
     XVidC_VideoStream Stream;    /**< Output AXIS */
+
+    XVidC_FbPool *Pool;          /**< Buffer pool, NULL if not used */
+    XVidC_FbFrame PoolFrame;     /**< Pool frame being read */
+    u32 PoolRun;                 /**< Restart the core on frame done */
+    XVidC_FbStats PoolStats;     /**< Pool frame statistics */
 }XV_FrmbufRd_l2;
 
 /************************** Macros Definitions *******************************/
@@ -717,6 +735,12 @@ u32 XVFrmbufRd_Get_FidErrorOut(XV_FrmbufRd_l2 *InstancePtr);
 u32 XVFrmbufRd_Get_FidErrorCount(XV_FrmbufRd_l2 *InstancePtr);
 u32 XVFrmbufRd_Get_FieldOut(XV_FrmbufRd_l2 *InstancePtr);
 void XVFrmbufRd_DbgReportStatus(XV_FrmbufRd_l2 *InstancePtr);
+int XVFrmbufRd_SetPool(XV_FrmbufRd_l2 *InstancePtr, XVidC_FbPool *PoolPtr);
+void XVFrmbufRd_GetPoolStats(XV_FrmbufRd_l2 *InstancePtr,
+			     XVidC_FbStats *StatsPtr);
+void XVFrmbufRd_GetPoolFrame(XV_FrmbufRd_l2 *InstancePtr,
+			     XVidC_FbFrame *FramePtr);
+void XVFrmbufRd_PoolDoneHandler(XV_FrmbufRd_l2 *InstancePtr);
 
 /* Interrupt related function */
 void XVFrmbufRd_InterruptHandler(void *InstancePtr);
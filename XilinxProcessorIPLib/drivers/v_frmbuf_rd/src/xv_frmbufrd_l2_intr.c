@@ -24,6 +24,7 @@
 * 4.20  pg    01/31/20   Removed Frmbuf start function from Interrupt handler.
 * 4.50  pg    01/07/21   Added new registers to support fid_out interlace solution.
 *						Interrupt count support for throughput measurement.
+* 5.00  sb    10/19/26   Take frames from the attached buffer pool on frame done
 * </pre>
 *
 ******************************************************************************/
@@ -94,7 +95,8 @@ int XVFrmbufRd_SetCallback(XV_FrmbufRd_l2 *InstancePtr, u32 HandlerType,
  *
  * This handler clears the pending interrupt and determined if the source is
  * frame done signal. If yes, starts the next frame processing and calls the
- * registered callback function
+ * registered callback function. With a buffer pool attached, the next pool
+ * frame is started first.
  *
  * The application is responsible for connecting this function to the interrupt
  * system. Application beyond this driver is also responsible for providing
@@ -125,6 +127,9 @@ void XVFrmbufRd_InterruptHandler(void *InstancePtr)
 	if(Status & XVFRMBUFRD_IRQ_DONE_MASK) {
 		/* Clear the interrupt */
 		XV_frmbufrd_InterruptClear(&FrmbufRdPtr->FrmbufRd, XVFRMBUFRD_IRQ_DONE_MASK);
+		if(FrmbufRdPtr->Pool) {
+			XVFrmbufRd_PoolDoneHandler(FrmbufRdPtr);
+		}
 		//Call user registered callback function, if any
 		if(FrmbufRdPtr->FrameDoneCallback) {
 			FrmbufRdPtr->FrameDoneCallback(FrmbufRdPtr->CallbackDoneRef);
@@ -36,6 +36,7 @@
 * 4.50  kp    12/07/21   Added new 3 planar video format Y_U_V8.
 * 4.60  kp    10/27/21   Added new 3 planar video format Y_U_V10.
 * 4.70  pg    05/23/23   Added new 3 planar video format Y_U_V8_420.
+* 5.00  sb    10/19/26   Added frame buffer pool support.
 * </pre>
 *
 ******************************************************************************/
@@ -53,6 +54,7 @@
 #define XV_WAIT_FOR_FLUSH_DONE_TIMEOUT		 (2000)
 /************************** Function Prototypes ******************************/
 static void SetPowerOnDefaultState(XV_FrmbufWr_l2 *InstancePtr);
+static void XVFrmbufWr_PoolProgram(XV_FrmbufWr_l2 *InstancePtr, u32 Idx);
 XVidC_ColorFormat WrMemory2Live(XVidC_ColorFormat MemFmt);
 
 /*****************************************************************************/
@@ -306,6 +308,9 @@ void XVFrmbufWr_Start(XV_FrmbufWr_l2 *InstancePtr)
 {
   Xil_AssertVoid(InstancePtr != NULL);
 
+  if (InstancePtr->Pool != NULL) {
+    InstancePtr->PoolRun = TRUE;
+  }
   XV_frmbufwr_Start(&InstancePtr->FrmbufWr);
 }
 
@@ -327,6 +332,9 @@ int XVFrmbufWr_Stop(XV_FrmbufWr_l2 *InstancePtr)
 
   Xil_AssertNonvoid(InstancePtr != NULL);
 
+  /* Do not restart from the frame done interrupt */
+  InstancePtr->PoolRun = FALSE;
+
   /* Clear autostart bit */
   XV_frmbufwr_DisableAutoRestart(&InstancePtr->FrmbufWr);
 
@@ -877,4 +885,141 @@ void XVFrmbufWr_DbgReportStatus(XV_FrmbufWr_l2 *InstancePtr)
   xil_printf("VChroma Buffer Address:     0x%x\r\n", XV_frmbufwr_Get_HwReg_frm_buffer3_V(&InstancePtr->FrmbufWr));
 }
 
+/*****************************************************************************/
+/**
+* This function attaches a frame buffer pool to the core, which then writes
+* into pool buffers. The first free buffer is programmed and the frame done
+* interrupt is enabled. Frames are produced once XVFrmbufWr_Start() is called.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  PoolPtr is the pool, NULL to detach the current pool
+*
+* @return XST_SUCCESS if the pool is attached or detached
+*         XST_NO_DATA if the pool has no free buffer
+*         XVFRMBUFWR_ERR_MEM_ADDR_MISALIGNED if a pool buffer is misaligned
+*
+* @note   The core must be stopped. The buffer being written when the pool is
+*         detached is not returned to the pool.
+*
+******************************************************************************/
+int XVFrmbufWr_SetPool(XV_FrmbufWr_l2 *InstancePtr, XVidC_FbPool *PoolPtr)
+{
+  const XVidC_FbBuffer *Buf;
+  UINTPTR Align;
+  u32 Idx;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  InstancePtr->PoolRun = FALSE;
+  if (PoolPtr == NULL) {
+    InstancePtr->Pool = NULL;
+    return(XST_SUCCESS);
+  }
+
+  /* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
+  Align = 2 * InstancePtr->FrmbufWr.Config.PixPerClk * 4;
+  for (Idx = 0; Idx < PoolPtr->NumBuffers; Idx++) {
+    Buf = XVidC_FbPoolGetBuffer(PoolPtr, Idx);
+    if ((Buf->LumaAddr == 0) || ((Buf->LumaAddr % Align) != 0) ||
+        ((Buf->ChromaAddr % Align) != 0) ||
+        ((Buf->VChromaAddr % Align) != 0)) {
+      return(XVFRMBUFWR_ERR_MEM_ADDR_MISALIGNED);
+    }
+  }
+
+  if (XVidC_FbPoolGetFree(PoolPtr, &Idx) != XST_SUCCESS) {
+    return(XST_NO_DATA);
+  }
+
+  InstancePtr->Pool = PoolPtr;
+  InstancePtr->PoolSeq = 0;
+  memset(&InstancePtr->PoolStats, 0, sizeof(XVidC_FbStats));
+  XVFrmbufWr_PoolProgram(InstancePtr, Idx);
+
+  XVFrmbufWr_InterruptEnable(InstancePtr, XVFRMBUFWR_IRQ_DONE_MASK);
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function returns the frame statistics of the attached pool
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  StatsPtr is where the statistics are returned
+*
+* @return none
+*
+******************************************************************************/
+void XVFrmbufWr_GetPoolStats(XV_FrmbufWr_l2 *InstancePtr,
+                             XVidC_FbStats *StatsPtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid(StatsPtr != NULL);
+
+  *StatsPtr = InstancePtr->PoolStats;
+}
+
+/*****************************************************************************/
+/**
+* This function completes a pool frame. It is called by
+* XVFrmbufWr_InterruptHandler() on frame done when a pool is attached.
+*
+* The written frame is published to the pool and the next free buffer is
+* programmed. If there is none, the frame is dropped and its buffer written
+* again.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return none
+*
+******************************************************************************/
+void XVFrmbufWr_PoolDoneHandler(XV_FrmbufWr_l2 *InstancePtr)
+{
+  u32 Next;
+
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid(InstancePtr->Pool != NULL);
+
+  InstancePtr->PoolStats.Frames++;
+  if (XVidC_FbPoolGetFree(InstancePtr->Pool, &Next) == XST_SUCCESS) {
+    XVidC_FbPoolPublish(InstancePtr->Pool, InstancePtr->PoolCur,
+                        InstancePtr->PoolSeq);
+    XVFrmbufWr_PoolProgram(InstancePtr, Next);
+  } else {
+    InstancePtr->PoolStats.Drops++;
+  }
+  InstancePtr->PoolSeq++;
+
+  if (InstancePtr->PoolRun) {
+    XV_frmbufwr_Start(&InstancePtr->FrmbufWr);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function programs the planes of a pool buffer
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Idx is the buffer index
+*
+* @return none
+*
+******************************************************************************/
+static void XVFrmbufWr_PoolProgram(XV_FrmbufWr_l2 *InstancePtr, u32 Idx)
+{
+  const XVidC_FbBuffer *Buf = XVidC_FbPoolGetBuffer(InstancePtr->Pool, Idx);
+
+  XV_frmbufwr_Set_HwReg_frm_buffer_V(&InstancePtr->FrmbufWr, Buf->LumaAddr);
+  if (Buf->ChromaAddr != 0) {
+    XV_frmbufwr_Set_HwReg_frm_buffer2_V(&InstancePtr->FrmbufWr,
+                                        Buf->ChromaAddr);
+  }
+  if (Buf->VChromaAddr != 0) {
+    XV_frmbufwr_Set_HwReg_frm_buffer3_V(&InstancePtr->FrmbufWr,
+                                        Buf->VChromaAddr);
+  }
+  InstancePtr->PoolCur = Idx;
+}
+
 /** @} */
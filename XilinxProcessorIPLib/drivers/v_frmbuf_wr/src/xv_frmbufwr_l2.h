@@ -75,6 +75,17 @@
 *     will configure the IP to keep processing frames without sw intervention.
 *   - Polling mode is the default configuration set during driver initialization
 *
+* <b> Buffer Pool </b>
+*
+* Instead of setting buffer addresses itself, the application can attach a
+* frame buffer pool (see xvidc_fbpool.h) with XVFrmbufWr_SetPool(). The
+* driver then runs in interrupt mode: on every frame done interrupt it
+* publishes the written frame to the pool, programs a free buffer and starts
+* the next frame. When no buffer is free, the next frame overwrites the one
+* just written and the frame is counted as dropped. XVFrmbufWr_GetPoolStats()
+* returns the frame and drop counts. A frame buffer read core attached to the
+* same pool displays the captured frames without copying them.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -100,6 +111,7 @@
 * 4.50  kp    12/07/21   Added new 3 planar video format Y_U_V8.
 * 4.60  kp    10/27/21   Added new 3 planar video format Y_U_V10.
 * 4.70  pg    05/23/23   Added new 3 planar video format Y_U_V8_420.
+* 5.00  sb    10/19/26   Added frame buffer pool support.
 * </pre>
 *
 ******************************************************************************/
@@ -111,6 +123,7 @@ extern "C" {
 #endif
 
 #include "xvidc.h"
+#include "xvidc_fbpool.h"
 #include "xv_frmbufwr.h"
 
 /************************** Constant Definitions *****************************/
@@ -172,6 +185,12 @@ typedef struct {
                                 callback */
 
     XVidC_VideoStream Stream;    /**< Input AXIS */
+
+    XVidC_FbPool *Pool;          /**< Buffer pool, NULL if not used */
+    u32 PoolCur;                 /**< Pool buffer being written */
+    u32 PoolSeq;                 /**< Frame number of PoolCur */
+    u32 PoolRun;                 /**< Restart the core on frame done */
+    XVidC_FbStats PoolStats;     /**< Pool frame statistics */
 }XV_FrmbufWr_l2;
 
 /************************** Macros Definitions *******************************/
@@ -726,6 +745,10 @@ int XVFrmbufWr_SetVChromaBufferAddr(XV_FrmbufWr_l2 *InstancePtr,
 UINTPTR XVFrmbufWr_GetVChromaBufferAddr(XV_FrmbufWr_l2 *InstancePtr);
 u32 XVFrmbufWr_GetFieldID(XV_FrmbufWr_l2 *InstancePtr);
 void XVFrmbufWr_DbgReportStatus(XV_FrmbufWr_l2 *InstancePtr);
+int XVFrmbufWr_SetPool(XV_FrmbufWr_l2 *InstancePtr, XVidC_FbPool *PoolPtr);
+void XVFrmbufWr_GetPoolStats(XV_FrmbufWr_l2 *InstancePtr,
+                             XVidC_FbStats *StatsPtr);
+void XVFrmbufWr_PoolDoneHandler(XV_FrmbufWr_l2 *InstancePtr);
 
 /* Interrupt related function */
 void XVFrmbufWr_InterruptHandler(void *InstancePtr);
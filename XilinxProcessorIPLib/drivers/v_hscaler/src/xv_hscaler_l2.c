@@ -31,6 +31,9 @@
 *       rco   02/09/17   Fix c++ compilation warnings
 *	jsr   09/07/18 Fix for 64-bit driver support
 * 3.3   vsa   04/07/20   Improve quality with better coefficient tables
+* 3.5   sb    10/19/26   Write coefficients and phases only when they change,
+*                        phases only for the active width, and cache phase
+*                        register images per width pair
 * </pre>
 *
 ******************************************************************************/
@@ -76,7 +79,16 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
                             u32 PixelRate);
 
 static void XV_HScalerSetCoeff(XV_Hscaler_l2 *HscPtr);
-static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr);
+static u32 XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr,
+                              u32 loopWidth,
+                              u32 *Regs);
+static void XV_HScalerWritePhases(XV_Hscaler_l2 *HscPtr,
+                                  const u32 *Regs,
+                                  u32 NumWords);
+static void XV_HScalerLoadPhases(XV_Hscaler_l2 *HscPtr,
+                                 u32 WidthIn,
+                                 u32 WidthOut,
+                                 u32 PixelRate);
 
 /*****************************************************************************/
 /**
@@ -248,6 +260,12 @@ static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
 	numTaps = XV_HSCALER_TAPS_6;
   }
 
+  /* Nothing to do if the table is already loaded */
+  if(coeff == InstancePtr->CoeffTbl)
+  {
+    return;
+  }
+
   XV_HScalerLoadExtCoeff(InstancePtr,
                          numPhases,
                          numTaps,
@@ -255,6 +273,7 @@ static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
 
   /* Disable use of external coefficients */
   InstancePtr->UseExtCoeff = FALSE;
+  InstancePtr->CoeffTbl = coeff;
 }
 
 /*****************************************************************************/
@@ -329,6 +348,8 @@ void XV_HScalerLoadExtCoeff(XV_Hscaler_l2 *InstancePtr,
 
   /* Enable use of external coefficients */
   InstancePtr->UseExtCoeff = TRUE;
+  InstancePtr->CoeffTbl = NULL;
+  InstancePtr->CoeffLoaded = FALSE;
 }
 
 /*****************************************************************************/
@@ -430,23 +451,28 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
 
 /*****************************************************************************/
 /**
-* This function programs the phase data into core registers
+* This function programs the phase data of the active line width into core
+* registers
 *
 * @param  HscPtr is a pointer to the core instance to be worked on.
+* @param  loopWidth is the number of phase entries to be programmed
+* @param  Regs is a buffer of XV_HSCALER_PHASE_REG_WORDS words which receives
+*         a copy of the programmed registers, NULL if not needed
 *
-* @return None
+* @return Number of phase registers programmed
 *
 * @Note  This version of driver does not make use of computed coefficients.
 *        User must load the coefficients, using the provided API, before
 *        scaler can be used
 ******************************************************************************/
-static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
+static u32 XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr,
+                              u32 loopWidth,
+                              u32 *Regs)
 {
-  u32 loopWidth;
+  u32 NumWords = 0;
   UINTPTR baseAddr;
   //program phases
   baseAddr = XV_hscaler_Get_HwReg_phasesH_V_BaseAddress(&HscPtr->Hsc);
-  loopWidth = HscPtr->Hsc.Config.MaxWidth/HscPtr->Hsc.Config.PixPerClk;
   switch(HscPtr->Hsc.Config.PixPerClk)
   {
     case XVIDC_PPC_1:
@@ -465,8 +491,13 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
                 msb = (u32)(HscPtr->phasesH[i+1] & (u64)XHSC_MASK_LOW_16BITS);
                 val = (msb<<16 | lsb);
                 Xil_Out32(baseAddr+(index*4), val);
+                if(Regs != NULL)
+                {
+                  Regs[index] = val;
+                }
                 ++index;
               }
+              NumWords = index;
             }
             break;
 
@@ -481,7 +512,12 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
               {
                 val = (u32)(HscPtr->phasesH[i] & XHSC_MASK_LOW_32BITS);
                 Xil_Out32(baseAddr+(i*4), val);
+                if(Regs != NULL)
+                {
+                  Regs[i] = val;
+                }
               }
+              NumWords = loopWidth;
             }
             break;
 
@@ -503,9 +539,15 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
                 msb = (u32)((phaseHData>>32) & XHSC_MASK_LOW_32BITS);
                 Xil_Out32(baseAddr+(offset*4), lsb);
                 Xil_Out32(baseAddr+((offset+1)*4), msb);
+                if(Regs != NULL)
+                {
+                  Regs[offset] = lsb;
+                  Regs[offset+1] = msb;
+                }
                 ++index;
                 offset += 2;
               }
+              NumWords = offset;
             }
             break;
     case XVIDC_PPC_8:
@@ -537,10 +579,17 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
 			Xil_Out32(baseAddr+(offset*4), bits_0_31);
 			Xil_Out32(baseAddr+((offset+1)*4), bits_32_63);
 			Xil_Out32(baseAddr+((offset+2)*4), bits_64_95);
+			if (Regs != NULL) {
+				Regs[offset] = bits_0_31;
+				Regs[offset+1] = bits_32_63;
+				Regs[offset+2] = bits_64_95;
+				Regs[offset+3] = 0;
+			}
 			/*(offset+3)*4 register is reserved,so increment offset by 4*/
 			offset += 4;
 			index++;
 		}
+		NumWords = offset;
 	    }
 	    break;
 
@@ -548,8 +597,122 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
     default:
            break;
   }
+
+  return NumWords;
 }
 
+/*****************************************************************************/
+/**
+* This function programs a phase register image, as produced by
+* XV_HScalerSetPhase(), into core registers
+*
+* @param  HscPtr is a pointer to the core instance to be worked on.
+* @param  Regs is the phase register image
+* @param  NumWords is the number of registers in the image
+*
+* @return None
+*
+******************************************************************************/
+static void XV_HScalerWritePhases(XV_Hscaler_l2 *HscPtr,
+                                  const u32 *Regs,
+                                  u32 NumWords)
+{
+  UINTPTR baseAddr;
+  u32 i;
+
+  baseAddr = XV_hscaler_Get_HwReg_phasesH_V_BaseAddress(&HscPtr->Hsc);
+  if(HscPtr->Hsc.Config.PixPerClk == XVIDC_PPC_8)
+  {
+    /* Every 4th register is reserved */
+    for(i=0; i < NumWords; i+=4)
+    {
+      Xil_Out32(baseAddr+(i*4), Regs[i]);
+      Xil_Out32(baseAddr+((i+1)*4), Regs[i+1]);
+      Xil_Out32(baseAddr+((i+2)*4), Regs[i+2]);
+    }
+  }
+  else
+  {
+    for(i=0; i < NumWords; ++i)
+    {
+      Xil_Out32(baseAddr+(i*4), Regs[i]);
+    }
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function programs the phases of a width pair into the core, from the
+* phase cache if it holds them. Otherwise they are computed and, if there is a
+* phase cache, stored in its least recently used entry.
+*
+* @param  HscPtr is a pointer to the core instance to be worked on.
+* @param  WidthIn is the input frame width
+* @param  WidthOut is the scaled frame width
+* @param  PixelRate is the scaling step computed by XV_HScalerSetup()
+*
+* @return None
+*
+******************************************************************************/
+static void XV_HScalerLoadPhases(XV_Hscaler_l2 *HscPtr,
+                                 u32 WidthIn,
+                                 u32 WidthOut,
+                                 u32 PixelRate)
+{
+  XV_HscalerPhaseEntry *Entry = NULL;
+  XV_HscalerPhaseEntry *Victim = NULL;
+  u32 loopWidth, NumWords, i;
+
+  HscPtr->SetupCount++;
+  for(i=0; i < HscPtr->PhaseCacheSize; ++i)
+  {
+    if((HscPtr->PhaseCache[i].WidthIn == WidthIn) &&
+       (HscPtr->PhaseCache[i].WidthOut == WidthOut))
+    {
+      Entry = &HscPtr->PhaseCache[i];
+      break;
+    }
+    if((Victim == NULL) ||
+       (HscPtr->PhaseCache[i].LastUse < Victim->LastUse))
+    {
+      Victim = &HscPtr->PhaseCache[i];
+    }
+  }
+
+  if(Entry != NULL)
+  {
+    XV_HScalerWritePhases(HscPtr, Entry->Regs, Entry->NumWords);
+  }
+  else
+  {
+    loopWidth = ((WidthIn > WidthOut) ? WidthIn : WidthOut);
+    loopWidth = (loopWidth + (HscPtr->Hsc.Config.PixPerClk-1)) /
+                HscPtr->Hsc.Config.PixPerClk;
+
+    /* Compute Phase for 1 line */
+    CalculatePhases(HscPtr, WidthIn, WidthOut, PixelRate);
+
+    /* Program computed Phase into the IP register bank */
+    NumWords = XV_HScalerSetPhase(HscPtr, loopWidth,
+                                  ((Victim != NULL) ? Victim->Regs : NULL));
+    if(Victim != NULL)
+    {
+      Victim->WidthIn = WidthIn;
+      Victim->WidthOut = WidthOut;
+      Victim->NumWords = NumWords;
+      Entry = Victim;
+    }
+  }
+
+  if(Entry != NULL)
+  {
+    Entry->LastUse = HscPtr->SetupCount;
+  }
+  HscPtr->PhaseWidthIn = WidthIn;
+  HscPtr->PhaseWidthOut = WidthOut;
+}
+
+
 
 /*****************************************************************************/
 /**
@@ -634,14 +797,19 @@ int XV_HScalerSetup(XV_Hscaler_l2  *InstancePtr,
       XV_HScalerSelectCoeff(InstancePtr, WidthIn, WidthOut);
     }
     /* Program generated coefficients into the IP register bank */
-    XV_HScalerSetCoeff(InstancePtr);
+    if(!InstancePtr->CoeffLoaded)
+    {
+      XV_HScalerSetCoeff(InstancePtr);
+      InstancePtr->CoeffLoaded = TRUE;
+    }
   }
 
-  /* Compute Phase for 1 line */
-  CalculatePhases(InstancePtr, WidthIn, WidthOut, PixelRate);
-
-  /* Program computed Phase into the IP register bank */
-  XV_HScalerSetPhase(InstancePtr);
+  /* Program the phases unless the core has those of this width pair */
+  if((WidthIn != InstancePtr->PhaseWidthIn) ||
+     (WidthOut != InstancePtr->PhaseWidthOut))
+  {
+    XV_HScalerLoadPhases(InstancePtr, WidthIn, WidthOut, PixelRate);
+  }
 
   XV_hscaler_Set_HwReg_Height(&InstancePtr->Hsc,        HeightIn);
   XV_hscaler_Set_HwReg_WidthIn(&InstancePtr->Hsc,       WidthIn);
@@ -653,6 +821,62 @@ int XV_HScalerSetup(XV_Hscaler_l2  *InstancePtr,
   return XST_SUCCESS;
 }
 
+/*****************************************************************************/
+/**
+* This function gives the driver memory to cache the phase tables of recently
+* used width pairs in, so that switching back to one of them does not
+* recompute its phases. Each entry takes 16 KB. Passing 0 entries removes the
+* cache.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+* @param  Entries is an array of NumEntries phase cache entries
+* @param  NumEntries is the number of entries
+*
+* @return None
+*
+******************************************************************************/
+void XV_HScalerSetPhaseCache(XV_Hscaler_l2 *InstancePtr,
+                             XV_HscalerPhaseEntry *Entries,
+                             u32 NumEntries)
+{
+  u32 i;
+
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid((Entries != NULL) || (NumEntries == 0));
+  Xil_AssertVoid(InstancePtr->Hsc.Config.MaxWidth <= XV_HSCALER_MAX_LINE_WIDTH);
+
+  for(i=0; i < NumEntries; ++i)
+  {
+    Entries[i].WidthIn = 0;
+    Entries[i].WidthOut = 0;
+    Entries[i].NumWords = 0;
+    Entries[i].LastUse = 0;
+  }
+  InstancePtr->PhaseCache = ((NumEntries > 0) ? Entries : NULL);
+  InstancePtr->PhaseCacheSize = NumEntries;
+  InstancePtr->SetupCount = 0;
+}
+
+/*****************************************************************************/
+/**
+* This function makes the next XV_HScalerSetup() program the coefficient and
+* phase tables even if they did not change. It is needed when the tables of
+* the core may have lost their content. The phase cache stays valid.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+void XV_HScalerInvalidateTables(XV_Hscaler_l2 *InstancePtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  InstancePtr->CoeffLoaded = FALSE;
+  InstancePtr->PhaseWidthIn = 0;
+  InstancePtr->PhaseWidthOut = 0;
+}
+
 
 /*****************************************************************************/
 /**
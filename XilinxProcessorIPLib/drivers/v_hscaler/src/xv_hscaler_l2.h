@@ -45,6 +45,21 @@
 * Advanced users always have the capability to directly interact with the IP
 * core using Layer-1 API's that perform low level register peek/poke.
 *
+* <b> Resolution switching </b>
+*
+* XV_HScalerSetup() writes the filter coefficients only when a different
+* table is selected, and the phase table only when WidthIn or WidthOut change,
+* and then only the entries of the active line width. The phase table of a
+* width pair is computed once if the application gives the driver a phase
+* cache with XV_HScalerSetPhaseCache(): each entry holds the register image
+* of one width pair, and a switch to a cached width pair is a plain copy of
+* the image into the core. The least recently used entry is replaced when the
+* cache is full.
+*
+* The tables of the core keep their content over a core reset. If they may
+* have been lost, e.g. after the bitstream was reloaded, the application calls
+* XV_HScalerInvalidateTables() before the next setup.
+*
 * <b> Interrupts </b>
 *
 * This driver does not have any interrupts
@@ -71,6 +86,8 @@
 *       dmc   12/17/15   Add macro to query the Is422Enabled flag that was
 *                        added to the XV_hscaler_Config structure
 * 3.0   mpe   04/28/16   Added optional color format conversion handling
+* 3.5   sb    10/19/26   Added phase table cache and skipping of unchanged
+*                        coefficient and phase tables
 * </pre>
 *
 ******************************************************************************/
@@ -92,6 +109,8 @@ extern "C" {
 #define XV_HSCALER_MAX_H_TAPS           (12)
 #define XV_HSCALER_MAX_H_PHASES         (64)
 #define XV_HSCALER_MAX_LINE_WIDTH       (8192)
+/** Size of the phase table of the core in 32-bit registers, for all PPC */
+#define XV_HSCALER_PHASE_REG_WORDS      (XV_HSCALER_MAX_LINE_WIDTH/2)
 
 /**************************** Type Definitions *******************************/
 /**
@@ -115,6 +134,19 @@ typedef enum
   XV_HSCALER_TAPS_12 = 12
 }XV_HSCALER_TAPS;
 
+/**
+ * Phase cache entry, the register image of the phase table of one width pair.
+ * An array of entries is given to the driver with XV_HScalerSetPhaseCache().
+ */
+typedef struct
+{
+  u32 WidthIn;    /*<< Input width of the image, 0 if the entry is free */
+  u32 WidthOut;   /*<< Output width of the image */
+  u32 NumWords;   /*<< Registers used by the image */
+  u32 LastUse;    /*<< Setup count at the last use of the entry */
+  u32 Regs[XV_HSCALER_PHASE_REG_WORDS]; /*<< Phase register image */
+}XV_HscalerPhaseEntry;
+
 /**
  * H Scaler Layer 2 data. The user is required to allocate a variable
  * of this type for every H Scaler device in the system. A pointer to a
@@ -127,6 +159,13 @@ typedef struct
   short coeff[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_MAX_H_TAPS];
   u64 phasesH[XV_HSCALER_MAX_LINE_WIDTH];
   u64 phasesH_H[XV_HSCALER_MAX_LINE_WIDTH];
+  const short *CoeffTbl;  /*<< Table of coeff, NULL if loaded by the user */
+  u8 CoeffLoaded;         /*<< coeff is in the core */
+  u32 PhaseWidthIn;       /*<< Width pair of the phase table in the core, */
+  u32 PhaseWidthOut;      /*<< 0 if unknown */
+  XV_HscalerPhaseEntry *PhaseCache; /*<< Phase cache, NULL if none */
+  u32 PhaseCacheSize;     /*<< Entries in the phase cache */
+  u32 SetupCount;         /*<< Setups with a phase table, for LRU */
 }XV_Hscaler_l2;
 
 /************************** Macros Definitions *******************************/
@@ -185,6 +224,10 @@ int XV_HScalerValidateConfig(XV_Hscaler_l2 *InstancePtr,
                              u32 ColorFormatIn,
                              u32 ColorFormatOut);
 void XV_HScalerDbgReportStatus(XV_Hscaler_l2 *InstancePtr);
+void XV_HScalerSetPhaseCache(XV_Hscaler_l2 *InstancePtr,
+                             XV_HscalerPhaseEntry *Entries,
+                             u32 NumEntries);
+void XV_HScalerInvalidateTables(XV_Hscaler_l2 *InstancePtr);
 
 #ifdef __cplusplus
 }
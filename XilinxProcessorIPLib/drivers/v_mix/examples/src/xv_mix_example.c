@@ -38,6 +38,8 @@
 *                        Program CSC coefficient registers to do color conversion
 *                        from YUV to RGB and RGB to YUV.
 *       se    30/05/22	 Added 4K overlay layer support
+* 6.50  sb    10/19/26   Add layer update benchmark, direct register writes
+*                        against shadow register commit on frame done
 * </pre>
 *
 ******************************************************************************/
@@ -50,6 +52,7 @@
 #include "xvidc.h"
 #include "xvtc.h"
 #include "xgpio.h"
+#include "xiltimer.h"
 
 #ifndef SDT
 #if defined (__MICROBLAZE__)
@@ -95,6 +98,9 @@ extern XV_frmbufrd_Config XV_frmbufrd_ConfigTable[];
 
 #define VIDEO_MONITOR_LOCK_TIMEOUT (2000000)
 
+/* Frame updates measured by the layer update benchmark */
+#define COMMIT_BENCH_FRAMES        (120)
+
 extern unsigned char Logo_R[];
 extern unsigned char Logo_G[];
 extern unsigned char Logo_B[];
@@ -102,6 +108,7 @@ extern unsigned char Logo_A[];
 
 XV_tpg     tpg;
 XV_Mix_l2  mix;
+XVMix_Shadow MixShadow;
 XVtc       vtc;
 #if defined (__MICROBLAZE__)
 XIntc      intc;
@@ -180,6 +187,7 @@ static int ConfigFrmbuf(XV_FrmbufRd_l2 *LayerFrmbuf,
 #endif
 static void ConfigVtc(XVidC_VideoStream *StreamPtr);
 static int RunMixerFeatureTests(XVidC_VideoStream *StreamPtr);
+static int RunCommitBenchmark(XVidC_VideoStream *StreamPtr);
 static int CheckVidoutLock(void);
 
 #ifndef SDT
@@ -902,6 +910,116 @@ static int RunMixerFeatureTests(XVidC_VideoStream *StreamPtr)
 }
 
 
+/*****************************************************************************/
+/**
+ * This function measures the cost of moving all overlay layers once per
+ * frame. The layers are first moved with the layer APIs writing the core
+ * registers directly, then with the shadow registers, committed once per
+ * frame and written on frame done. Register accesses and CPU time per frame
+ * update are reported for both.
+ *
+ * @return Number of errors
+ *
+ *****************************************************************************/
+static int RunCommitBenchmark(XVidC_VideoStream *StreamPtr)
+{
+  int layerIndex, frame;
+  int NumWin, Timeout;
+  int ErrorCount = 0;
+  XVidC_VideoWindow Win[8];
+  XVidC_ColorFormat Cfmt;
+  XVMix_RegStats Stats;
+  XTime Start, End, Ticks;
+  u32 Stride, Usec;
+  XV_Mix_l2 *MixerPtr = &mix;
+
+  xil_printf("\r\n****Running Layer Update Benchmark****\r\n");
+
+  /* Place and enable the overlay layers */
+  NumWin = (StreamPtr->VmId <= XVIDC_VM_4096x2160_24_P) ? 8 : 4;
+  if(NumWin > (XVMix_GetNumLayers(MixerPtr) - 1)) {
+    NumWin = XVMix_GetNumLayers(MixerPtr) - 1;
+  }
+  for(layerIndex=XVMIX_LAYER_1; layerIndex<=NumWin; ++layerIndex) {
+    Win[layerIndex-1] = (NumWin == 8) ? MixLayerConfig[layerIndex-1] :
+                                        MixLayerConfig_4K[layerIndex-1];
+    if(Win[layerIndex-1].StartX >= 16) {
+      Win[layerIndex-1].StartX -= 16;
+    }
+    XVMix_GetLayerColorFormat(MixerPtr, layerIndex, &Cfmt);
+    Stride = ((Cfmt == XVIDC_CSF_YCRCB_422) ? 2: 4) * Win[layerIndex-1].Width;
+    XVMix_SetLayerScaleFactor(MixerPtr, layerIndex, XVMIX_SCALE_FACTOR_1X);
+    XVMix_SetLayerWindow(MixerPtr, layerIndex, &Win[layerIndex-1], Stride);
+    XVMix_LayerEnable(MixerPtr, layerIndex);
+  }
+
+  /* Direct register writes */
+  XVMix_ClearRegStats(MixerPtr);
+  XTime_GetTime(&Start);
+  for(frame=0; frame<COMMIT_BENCH_FRAMES; ++frame) {
+    for(layerIndex=XVMIX_LAYER_1; layerIndex<=NumWin; ++layerIndex) {
+      XVMix_MoveLayerWindow(MixerPtr, layerIndex,
+                            Win[layerIndex-1].StartX + ((frame & 1) ? 16 : 0),
+                            Win[layerIndex-1].StartY);
+    }
+  }
+  XTime_GetTime(&End);
+  XVMix_GetRegStats(MixerPtr, &Stats);
+  Usec = (u32)(((End - Start) * 1000000) /
+               (COUNTS_PER_SECOND * COMMIT_BENCH_FRAMES));
+  xil_printf("   Direct: %d layers, %d reg writes, %d reg reads, %d us per frame\r\n",
+             NumWin, Stats.RegWrites / COMMIT_BENCH_FRAMES,
+             Stats.RegReads / COMMIT_BENCH_FRAMES, Usec);
+
+  /* Shadow registers, written by the frame done interrupt */
+  XVMix_InterruptEnable(MixerPtr);
+  XVMix_SetShadow(MixerPtr, &MixShadow);
+  XVMix_ClearRegStats(MixerPtr);
+  Ticks = 0;
+  for(frame=0; frame<COMMIT_BENCH_FRAMES; ++frame) {
+    XTime_GetTime(&Start);
+    for(layerIndex=XVMIX_LAYER_1; layerIndex<=NumWin; ++layerIndex) {
+      XVMix_MoveLayerWindow(MixerPtr, layerIndex,
+                            Win[layerIndex-1].StartX + ((frame & 1) ? 16 : 0),
+                            Win[layerIndex-1].StartY);
+    }
+    XVMix_Commit(MixerPtr);
+    XTime_GetTime(&End);
+    Ticks += End - Start;
+
+    /* Wait for the update to land on the next frame */
+    Timeout = 100;
+    while(XVMix_IsCommitPending(MixerPtr) && Timeout--) {
+      usleep(1000);
+    }
+    if(XVMix_IsCommitPending(MixerPtr)) {
+      xil_printf("<ERROR:: Commit not written on frame done>\r\n");
+      ++ErrorCount;
+      break;
+    }
+  }
+  XVMix_GetRegStats(MixerPtr, &Stats);
+  Usec = (u32)((Ticks * 1000000) / (COUNTS_PER_SECOND * COMMIT_BENCH_FRAMES));
+  xil_printf("   Commit: %d layers, %d reg writes, %d reg reads, %d us per frame\r\n",
+             NumWin, Stats.RegWrites / COMMIT_BENCH_FRAMES,
+             Stats.RegReads / COMMIT_BENCH_FRAMES, Usec);
+  xil_printf("   %d commits written on frame done\r\n", Stats.Commits);
+
+  /* Back to direct register writes and polling mode */
+  XVMix_SetShadow(MixerPtr, NULL);
+  XVMix_InterruptDisable(MixerPtr);
+  XVMix_Start(MixerPtr);
+
+  xil_printf("   Check Vidout State: ");
+  ErrorCount += (!CheckVidoutLock() ? 1 : 0);
+
+  for(layerIndex=XVMIX_LAYER_1; layerIndex<=NumWin; ++layerIndex) {
+    XVMix_LayerDisable(MixerPtr, layerIndex);
+  }
+
+  return(ErrorCount);
+}
+
 /*****************************************************************************/
 /**
  * This function toggles HW reset line for all IP's
@@ -1068,6 +1186,7 @@ int main(void)
     Lock = CheckVidoutLock();
     if(Lock) {
       Status = RunMixerFeatureTests(&VidStream);
+      Status += RunCommitBenchmark(&VidStream);
       if(Status != 0) { //problems encountered in feature test
         ++FailCount;
       }
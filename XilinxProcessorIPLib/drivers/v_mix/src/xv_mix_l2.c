@@ -49,6 +49,8 @@
 * 6.00  pg    01/10/20   Add Colorimetry feature.
 *                        Program Mixer CSC registers to do color conversion
 *                        from YUV to RGB and RGB to YUV.
+* 6.50  sb    10/19/26   Add shadow registers and commit of layer updates.
+*                        Layer array is indexed up to the logo layer id.
 * </pre>
 *
 ******************************************************************************/
@@ -68,6 +70,23 @@
 #define XVMIX_MIN_LOGO_HEIGHT           (32u)
 #define XV_WAIT_FOR_FLUSH_DONE		    (25)
 #define XV_WAIT_FOR_FLUSH_DONE_TIMEOUT	(2000)
+#define XVMIX_SHADOW_LOGO_SLOT          (1)
+#define XVMIX_SHADOW_LAYER_SLOT         (7)
+#define XVMIX_SHADOW_REGS_PER_LAYER     (9)
+
+/* Offsets of the shadowed registers within the register block of a layer */
+static const u8 ShadowLayerReg[XVMIX_SHADOW_REGS_PER_LAYER] =
+{
+  0x00, //Alpha
+  0x08, //StartX
+  0x10, //StartY
+  0x18, //Width
+  0x20, //Stride
+  0x28, //Height
+  0x30, //Scale Factor
+  0x40, //Buffer 1
+  0x4c  //Buffer 2
+};
 
 /* Pixel values in 8 bit resolution in YUV color space*/
 static const u8 bkgndColorYUV[XVMIX_BKGND_LAST][3] =
@@ -94,6 +113,10 @@ static void SetPowerOnDefaultState(XV_Mix_l2 *InstancePtr);
 static int IsWindowValid(XVidC_VideoStream *Strm,
                          XVidC_VideoWindow *Win,
                          XVMix_Scalefactor ScaleFactor);
+static int ShadowRegSlot(u32 Offset);
+static u32 ShadowRegOffset(XV_Mix_l2 *InstancePtr, u32 Slot);
+static void WriteLayerReg(XV_Mix_l2 *InstancePtr, u32 Offset, u32 Data);
+static u32 ReadLayerReg(XV_Mix_l2 *InstancePtr, u32 Offset);
 
 /*****************************************************************************/
 /**
@@ -323,6 +346,135 @@ static int IsWindowValid(XVidC_VideoStream *Strm,
   }
 }
 
+/*****************************************************************************/
+/**
+* This function returns the shadow register slot of a register
+*
+* @param  Offset is the register offset
+*
+* @return Slot index, or -1 if the register is not shadowed
+*
+******************************************************************************/
+static int ShadowRegSlot(u32 Offset)
+{
+  u32 LayerId, Reg;
+
+  if(Offset == XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA) {
+    return(0);
+  }
+
+  if((Offset >= XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTX_DATA) &&
+     (Offset <= XV_MIX_CTRL_ADDR_HWREG_LOGOALPHA_DATA)) {
+    return(XVMIX_SHADOW_LOGO_SLOT +
+           ((Offset - XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTX_DATA) / 8));
+  }
+
+  /* Layer N registers are in block N+1 */
+  LayerId = (Offset / XVMIX_REG_OFFSET) - 1;
+  if((LayerId >= XVMIX_LAYER_1) && (LayerId <= XVMIX_LAYER_16)) {
+    for(Reg=0; Reg<XVMIX_SHADOW_REGS_PER_LAYER; ++Reg) {
+      if((Offset % XVMIX_REG_OFFSET) == ShadowLayerReg[Reg]) {
+        return(XVMIX_SHADOW_LAYER_SLOT +
+               ((LayerId - 1) * XVMIX_SHADOW_REGS_PER_LAYER) + Reg);
+      }
+    }
+  }
+  return(-1);
+}
+
+/*****************************************************************************/
+/**
+* This function returns the register offset of a shadow register slot
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Slot is the slot index
+*
+* @return Register offset, or 0 if the register is not available in HW
+*
+******************************************************************************/
+static u32 ShadowRegOffset(XV_Mix_l2 *InstancePtr, u32 Slot)
+{
+  u32 LayerId;
+
+  if(Slot == 0) {
+    return(XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA);
+  }
+
+  if(Slot < XVMIX_SHADOW_LAYER_SLOT) {
+    if(!XVMix_IsLogoEnabled(InstancePtr)) {
+      return(0);
+    }
+    return(XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTX_DATA +
+           ((Slot - XVMIX_SHADOW_LOGO_SLOT) * 8));
+  }
+
+  Slot -= XVMIX_SHADOW_LAYER_SLOT;
+  LayerId = XVMIX_LAYER_1 + (Slot / XVMIX_SHADOW_REGS_PER_LAYER);
+  if(LayerId >= XVMix_GetNumLayers(InstancePtr)) {
+    return(0);
+  }
+  return(((LayerId + 1) * XVMIX_REG_OFFSET) +
+         ShadowLayerReg[Slot % XVMIX_SHADOW_REGS_PER_LAYER]);
+}
+
+/*****************************************************************************/
+/**
+* This function writes a layer register. With a shadow register set attached
+* the write goes to the shadow set, to be written to the core by the next
+* commit
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Offset is the register offset
+* @param  Data is the value to write
+*
+* @return None
+*
+******************************************************************************/
+static void WriteLayerReg(XV_Mix_l2 *InstancePtr, u32 Offset, u32 Data)
+{
+  XVMix_Shadow *ShadowPtr = InstancePtr->Shadow;
+  int Slot = -1;
+
+  if(ShadowPtr != NULL) {
+    Slot = ShadowRegSlot(Offset);
+  }
+
+  if(Slot >= 0) {
+    ShadowPtr->Value[Slot] = Data;
+    ShadowPtr->Dirty[Slot / 32] |= (1U << (Slot % 32));
+  } else {
+    XV_mix_WriteReg(InstancePtr->Mix.Config.BaseAddress, Offset, Data);
+    InstancePtr->RegStats.RegWrites++;
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function reads a layer register. With a shadow register set attached
+* the value is read from the shadow set
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Offset is the register offset
+*
+* @return Register value
+*
+******************************************************************************/
+static u32 ReadLayerReg(XV_Mix_l2 *InstancePtr, u32 Offset)
+{
+  XVMix_Shadow *ShadowPtr = InstancePtr->Shadow;
+  int Slot = -1;
+
+  if(ShadowPtr != NULL) {
+    Slot = ShadowRegSlot(Offset);
+  }
+
+  if(Slot >= 0) {
+    return(ShadowPtr->Value[Slot]);
+  }
+  InstancePtr->RegStats.RegReads++;
+  return(XV_mix_ReadReg(InstancePtr->Mix.Config.BaseAddress, Offset));
+}
+
 /*****************************************************************************/
 /**
 * This function configures the mixer input stream
@@ -366,7 +518,6 @@ void XVMix_SetVidStream(XV_Mix_l2 *InstancePtr,
 ******************************************************************************/
 int XVMix_LayerEnable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 NumLayers, CurrenState;
   int Status = XST_FAILURE;
 
@@ -374,21 +525,23 @@ int XVMix_LayerEnable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
   Xil_AssertNonvoid((LayerId >= XVMIX_LAYER_MASTER) &&
                     (LayerId < XVMIX_LAYER_LAST));
 
-  MixPtr = &InstancePtr->Mix;
   NumLayers = XVMix_GetNumLayers(InstancePtr);
 
   //Check if request is to enable all layers or single layer
   if(LayerId == XVMIX_LAYER_ALL) {
-    XV_mix_Set_HwReg_layerEnable(MixPtr, XVMIX_MASK_ENABLE_ALL_LAYERS);
+    WriteLayerReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA,
+                  XVMIX_MASK_ENABLE_ALL_LAYERS);
     Status = XST_SUCCESS;
   }
   else if((LayerId < NumLayers) ||
           ((LayerId == XVMIX_LAYER_LOGO) &&
            (XVMix_IsLogoEnabled(InstancePtr)))) {
 
-    CurrenState = XV_mix_Get_HwReg_layerEnable(MixPtr);
+    CurrenState = ReadLayerReg(InstancePtr,
+                               XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA);
     CurrenState |= (1<<LayerId);
-    XV_mix_Set_HwReg_layerEnable(MixPtr, CurrenState);
+    WriteLayerReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA,
+                  CurrenState);
     Status = XST_SUCCESS;
   }
   return(Status);
@@ -408,7 +561,6 @@ int XVMix_LayerEnable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 ******************************************************************************/
 int XVMix_LayerDisable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 NumLayers, CurrenState;
   int Status = XST_FAILURE;
 
@@ -416,20 +568,22 @@ int XVMix_LayerDisable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
   Xil_AssertNonvoid((LayerId >= XVMIX_LAYER_MASTER) &&
                     (LayerId < XVMIX_LAYER_LAST));
 
-  MixPtr = &InstancePtr->Mix;
   NumLayers = XVMix_GetNumLayers(InstancePtr);
 
   //Check if request is to disable all layers or single layer
   if(LayerId == XVMIX_LAYER_ALL) {
-    XV_mix_Set_HwReg_layerEnable(MixPtr, XVMIX_MASK_DISABLE_ALL_LAYERS);
+    WriteLayerReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA,
+                  XVMIX_MASK_DISABLE_ALL_LAYERS);
     Status = XST_SUCCESS;
   }
   else if((LayerId < NumLayers) ||
           ((LayerId == XVMIX_LAYER_LOGO) &&
            (XVMix_IsLogoEnabled(InstancePtr)))) {
-    CurrenState = XV_mix_Get_HwReg_layerEnable(MixPtr);
+    CurrenState = ReadLayerReg(InstancePtr,
+                               XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA);
     CurrenState &= ~(1<<LayerId);
-    XV_mix_Set_HwReg_layerEnable(MixPtr, CurrenState);
+    WriteLayerReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA,
+                  CurrenState);
     Status = XST_SUCCESS;
   }
   return(Status);
@@ -448,16 +602,14 @@ int XVMix_LayerDisable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 ******************************************************************************/
 int XVMix_IsLayerEnabled(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 State, Mask;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
   Xil_AssertNonvoid((LayerId >= XVMIX_LAYER_MASTER) &&
                     (LayerId < XVMIX_LAYER_LAST));
 
-  MixPtr = &InstancePtr->Mix;
   Mask = (1<<LayerId);
-  State = XV_mix_Get_HwReg_layerEnable(MixPtr);
+  State = ReadLayerReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA);
   return ((State & Mask) ? TRUE : FALSE);
 }
 
@@ -562,10 +714,14 @@ int XVMix_SetLayerWindow(XV_Mix_l2 *InstancePtr,
                           (Win->Width  <= MixPtr->Config.MaxLogoWidth) &&
                           (Win->Height <= MixPtr->Config.MaxLogoHeight));
          if(WinResInRange) {
-            XV_mix_Set_HwReg_logoStartX(MixPtr, Win->StartX);
-            XV_mix_Set_HwReg_logoStartY(MixPtr, Win->StartY);
-            XV_mix_Set_HwReg_logoWidth(MixPtr,  Win->Width);
-            XV_mix_Set_HwReg_logoHeight(MixPtr, Win->Height);
+            WriteLayerReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTX_DATA,
+                          Win->StartX);
+            WriteLayerReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTY_DATA,
+                          Win->StartY);
+            WriteLayerReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOWIDTH_DATA,
+                          Win->Width);
+            WriteLayerReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOHEIGHT_DATA,
+                          Win->Height);
 
             InstancePtr->Layer[LayerId].Win = *Win;
             Status = XST_SUCCESS;
@@ -615,18 +771,18 @@ int XVMix_SetLayerWindow(XV_Mix_l2 *InstancePtr,
              BaseStrideReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSTRIDE_0_DATA;
              Offset = LayerId*XVMIX_REG_OFFSET;
 
-             XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                             (BaseStartXReg+Offset), Win->StartX);
-             XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                             (BaseStartYReg+Offset), Win->StartY);
-             XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                             (BaseWidthReg+Offset),  Win->Width);
-             XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                             (BaseHeightReg+Offset), Win->Height);
+             WriteLayerReg(InstancePtr,
+                           (BaseStartXReg+Offset), Win->StartX);
+             WriteLayerReg(InstancePtr,
+                           (BaseStartYReg+Offset), Win->StartY);
+             WriteLayerReg(InstancePtr,
+                           (BaseWidthReg+Offset),  Win->Width);
+             WriteLayerReg(InstancePtr,
+                           (BaseHeightReg+Offset), Win->Height);
 
              if(!XVMix_IsLayerInterfaceStream(InstancePtr, LayerId)) {
-                XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                                (BaseStrideReg+Offset), StrideInBytes);
+                WriteLayerReg(InstancePtr,
+                              (BaseStrideReg+Offset), StrideInBytes);
              }
              InstancePtr->Layer[LayerId].Win = *Win;
              Status = XST_SUCCESS;
@@ -660,7 +816,6 @@ int XVMix_GetLayerWindow(XV_Mix_l2 *InstancePtr,
                          XVMix_LayerId LayerId,
                          XVidC_VideoWindow *Win)
 {
-  XV_mix *MixPtr;
   int Status = XST_FAILURE;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
@@ -668,16 +823,18 @@ int XVMix_GetLayerWindow(XV_Mix_l2 *InstancePtr,
                     (LayerId <= XVMIX_LAYER_LOGO));
   Xil_AssertNonvoid(Win != NULL);
 
-  MixPtr = &InstancePtr->Mix;
-
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
       if(XVMix_IsLogoEnabled(InstancePtr)) {
 
-        Win->StartX = XV_mix_Get_HwReg_logoStartX(MixPtr);
-        Win->StartY = XV_mix_Get_HwReg_logoStartY(MixPtr);
-        Win->Width  = XV_mix_Get_HwReg_logoWidth(MixPtr);
-        Win->Height = XV_mix_Get_HwReg_logoHeight(MixPtr);
+        Win->StartX = ReadLayerReg(InstancePtr,
+                                   XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTX_DATA);
+        Win->StartY = ReadLayerReg(InstancePtr,
+                                   XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTY_DATA);
+        Win->Width  = ReadLayerReg(InstancePtr,
+                                   XV_MIX_CTRL_ADDR_HWREG_LOGOWIDTH_DATA);
+        Win->Height = ReadLayerReg(InstancePtr,
+                                   XV_MIX_CTRL_ADDR_HWREG_LOGOHEIGHT_DATA);
 
         Status = XST_SUCCESS;
       } else {
@@ -698,14 +855,14 @@ int XVMix_GetLayerWindow(XV_Mix_l2 *InstancePtr,
         BaseHeightReg = XV_MIX_CTRL_ADDR_HWREG_LAYERHEIGHT_0_DATA;
         Offset = LayerId*XVMIX_REG_OFFSET;
 
-        Win->StartX = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
-                                     (BaseStartXReg+Offset));
-        Win->StartY = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
-                                     (BaseStartYReg+Offset));
-        Win->Width  = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
-                                     (BaseWidthReg+Offset));
-        Win->Height = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
-                                     (BaseHeightReg+Offset));
+        Win->StartX = ReadLayerReg(InstancePtr,
+                                   (BaseStartXReg+Offset));
+        Win->StartY = ReadLayerReg(InstancePtr,
+                                   (BaseStartYReg+Offset));
+        Win->Width  = ReadLayerReg(InstancePtr,
+                                   (BaseWidthReg+Offset));
+        Win->Height = ReadLayerReg(InstancePtr,
+                                   (BaseHeightReg+Offset));
 
         Status = XST_SUCCESS;
       } else {
@@ -737,7 +894,6 @@ int XVMix_MoveLayerWindow(XV_Mix_l2 *InstancePtr,
                           u16 StartX,
                           u16 StartY)
 {
-  XV_mix *MixPtr;
   XVidC_VideoWindow CurrWin;
   XVMix_Scalefactor Scale;
   int Status = XST_FAILURE;
@@ -766,14 +922,14 @@ int XVMix_MoveLayerWindow(XV_Mix_l2 *InstancePtr,
       return(XVMIX_ERR_LAYER_WINDOW_INVALID);
   }
 
-  MixPtr = &InstancePtr->Mix;
-
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
       if(XVMix_IsLogoEnabled(InstancePtr)) {
 
-        XV_mix_Set_HwReg_logoStartX(MixPtr, StartX);
-        XV_mix_Set_HwReg_logoStartY(MixPtr, StartY);
+        WriteLayerReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTX_DATA,
+                      StartX);
+        WriteLayerReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTY_DATA,
+                      StartY);
 
         InstancePtr->Layer[LayerId].Win.StartX = StartX;
         InstancePtr->Layer[LayerId].Win.StartY = StartY;
@@ -790,10 +946,10 @@ int XVMix_MoveLayerWindow(XV_Mix_l2 *InstancePtr,
         BaseStartYReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTY_0_DATA;
         Offset = LayerId*XVMIX_REG_OFFSET;
 
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                        (BaseStartXReg+Offset), StartX);
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                        (BaseStartYReg+Offset), StartY);
+        WriteLayerReg(InstancePtr,
+                      (BaseStartXReg+Offset), StartX);
+        WriteLayerReg(InstancePtr,
+                      (BaseStartYReg+Offset), StartY);
 
         InstancePtr->Layer[LayerId].Win.StartX = StartX;
         InstancePtr->Layer[LayerId].Win.StartY = StartY;
@@ -821,7 +977,6 @@ int XVMix_SetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
                               XVMix_LayerId LayerId,
                               XVMix_Scalefactor Scale)
 {
-  XV_mix *MixPtr;
   XVidC_VideoWindow CurrWin;
   int Status = XST_FAILURE;
   int WinStatus;
@@ -842,12 +997,11 @@ int XVMix_SetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
       return(XVMIX_ERR_LAYER_WINDOW_INVALID);
   }
 
-  MixPtr = &InstancePtr->Mix;
-
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
       if(XVMix_IsLogoEnabled(InstancePtr)) {
-        XV_mix_Set_HwReg_logoScaleFactor(MixPtr, Scale);
+        WriteLayerReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSCALEFACTOR_DATA,
+                      Scale);
         Status = XST_SUCCESS;
       }
       break;
@@ -859,8 +1013,8 @@ int XVMix_SetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
         u32 BaseReg;
 
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSCALEFACTOR_0_DATA;
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                        (BaseReg+(LayerId*XVMIX_REG_OFFSET)), Scale);
+        WriteLayerReg(InstancePtr,
+                      (BaseReg+(LayerId*XVMIX_REG_OFFSET)), Scale);
 
         Status = XST_SUCCESS;
       }
@@ -883,19 +1037,17 @@ int XVMix_SetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
 ******************************************************************************/
 int XVMix_GetLayerScaleFactor(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 ReadVal = ~0;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
   Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
                     (LayerId <= XVMIX_LAYER_LOGO));
 
-  MixPtr = &InstancePtr->Mix;
-
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
       if(XVMix_IsLogoEnabled(InstancePtr)) {
-        ReadVal = XV_mix_Get_HwReg_logoScaleFactor(MixPtr);
+        ReadVal = ReadLayerReg(InstancePtr,
+                               XV_MIX_CTRL_ADDR_HWREG_LOGOSCALEFACTOR_DATA);
       }
       break;
 
@@ -905,8 +1057,8 @@ int XVMix_GetLayerScaleFactor(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
         u32 BaseReg;
 
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSCALEFACTOR_0_DATA;
-        ReadVal = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
-                                 (BaseReg+(LayerId*XVMIX_REG_OFFSET)));
+        ReadVal = ReadLayerReg(InstancePtr,
+                               (BaseReg+(LayerId*XVMIX_REG_OFFSET)));
       }
       break;
   }
@@ -930,7 +1082,6 @@ int XVMix_SetLayerAlpha(XV_Mix_l2 *InstancePtr,
                         XVMix_LayerId LayerId,
                         u16 Alpha)
 {
-  XV_mix *MixPtr;
   int Status = XST_FAILURE;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
@@ -938,12 +1089,11 @@ int XVMix_SetLayerAlpha(XV_Mix_l2 *InstancePtr,
                     (LayerId <= XVMIX_LAYER_LOGO));
   Xil_AssertNonvoid(Alpha <= XVMIX_ALPHA_MAX);
 
-  MixPtr = &InstancePtr->Mix;
-
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
       if(XVMix_IsLogoEnabled(InstancePtr)) {
-        XV_mix_Set_HwReg_logoAlpha(MixPtr, Alpha);
+        WriteLayerReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOALPHA_DATA,
+                      Alpha);
         Status = XST_SUCCESS;
       } else {
         Status = XVMIX_ERR_DISABLED_IN_HW;
@@ -956,8 +1106,8 @@ int XVMix_SetLayerAlpha(XV_Mix_l2 *InstancePtr,
         u32 BaseReg;
 
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYERALPHA_0_DATA;
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                        (BaseReg+(LayerId*XVMIX_REG_OFFSET)), Alpha);
+        WriteLayerReg(InstancePtr,
+                      (BaseReg+(LayerId*XVMIX_REG_OFFSET)), Alpha);
         Status = XST_SUCCESS;
       } else {
         Status = XVMIX_ERR_DISABLED_IN_HW;
@@ -981,19 +1131,17 @@ int XVMix_SetLayerAlpha(XV_Mix_l2 *InstancePtr,
 ******************************************************************************/
 int XVMix_GetLayerAlpha(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 ReadVal = ~0;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
   Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
                     (LayerId <= XVMIX_LAYER_LOGO));
 
-  MixPtr = &InstancePtr->Mix;
-
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
       if(XVMix_IsLogoEnabled(InstancePtr)) {
-        ReadVal = XV_mix_Get_HwReg_logoAlpha(MixPtr);
+        ReadVal = ReadLayerReg(InstancePtr,
+                               XV_MIX_CTRL_ADDR_HWREG_LOGOALPHA_DATA);
       }
       break;
 
@@ -1003,8 +1151,8 @@ int XVMix_GetLayerAlpha(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
         u32 BaseReg;
 
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYERALPHA_0_DATA;
-        ReadVal = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
-                                 (BaseReg+(LayerId*XVMIX_REG_OFFSET)));
+        ReadVal = ReadLayerReg(InstancePtr,
+                               (BaseReg+(LayerId*XVMIX_REG_OFFSET)));
       }
       break;
   }
@@ -1126,7 +1274,6 @@ int XVMix_SetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
                              XVMix_LayerId LayerId,
                              UINTPTR Addr)
 {
-  XV_mix *MixPtr;
   UINTPTR BaseReg, Align;
   u32 WinValid = FALSE;
   int Status = XST_FAILURE;
@@ -1136,8 +1283,6 @@ int XVMix_SetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
                     (LayerId < XVMIX_LAYER_LOGO));
   Xil_AssertNonvoid(Addr != 0);
 
-  MixPtr = &InstancePtr->Mix;
-
   if(LayerId < XVMix_GetNumLayers(InstancePtr)) {
       /* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
       Align = 2 * InstancePtr->Mix.Config.PixPerClk * 4;
@@ -1151,8 +1296,8 @@ int XVMix_SetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
       if(WinValid) {
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA;
 
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                        (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)), Addr);
+        WriteLayerReg(InstancePtr,
+                      (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)), Addr);
 
         InstancePtr->Layer[LayerId].BufAddr = Addr;
         Status = XST_SUCCESS;
@@ -1175,7 +1320,6 @@ int XVMix_SetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
 ******************************************************************************/
 UINTPTR XVMix_GetLayerBufferAddr(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 BaseReg;
   UINTPTR ReadVal = 0;
 
@@ -1183,13 +1327,11 @@ UINTPTR XVMix_GetLayerBufferAddr(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
   Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
                     (LayerId < XVMIX_LAYER_LOGO));
 
-  MixPtr = &InstancePtr->Mix;
-
   if(LayerId < XVMix_GetNumLayers(InstancePtr)) {
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA;
 
-        ReadVal = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
-                                 (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)));
+        ReadVal = ReadLayerReg(InstancePtr,
+                               (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)));
   }
   return(ReadVal);
 }
@@ -1212,7 +1354,6 @@ int XVMix_SetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
                                    XVMix_LayerId LayerId,
                                    UINTPTR Addr)
 {
-  XV_mix *MixPtr;
   UINTPTR BaseReg, Align;
   u32 WinValid = FALSE;
   int Status = XST_FAILURE;
@@ -1222,8 +1363,6 @@ int XVMix_SetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
                     (LayerId < XVMIX_LAYER_LOGO));
   Xil_AssertNonvoid(Addr != 0);
 
-  MixPtr = &InstancePtr->Mix;
-
   if(LayerId < XVMix_GetNumLayers(InstancePtr)) {
       /* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
       Align = 2 * InstancePtr->Mix.Config.PixPerClk * 4;
@@ -1237,8 +1376,8 @@ int XVMix_SetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
       if(WinValid) {
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA;
 
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                        (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)), Addr);
+        WriteLayerReg(InstancePtr,
+                      (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)), Addr);
 
         InstancePtr->Layer[LayerId].ChromaBufAddr = Addr;
         Status = XST_SUCCESS;
@@ -1263,7 +1402,6 @@ int XVMix_SetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
 UINTPTR XVMix_GetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
                                        XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 BaseReg;
   UINTPTR ReadVal = 0;
 
@@ -1271,13 +1409,11 @@ UINTPTR XVMix_GetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
   Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
                     (LayerId < XVMIX_LAYER_LOGO));
 
-  MixPtr = &InstancePtr->Mix;
-
   if(LayerId < XVMix_GetNumLayers(InstancePtr)) {
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA;
 
-        ReadVal = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
-                                 (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)));
+        ReadVal = ReadLayerReg(InstancePtr,
+                               (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)));
   }
   return(ReadVal);
 }
@@ -1788,4 +1924,193 @@ u32 XVMix_SetCscCoeffs(XV_Mix_l2 *InstancePtr,
 	return XST_SUCCESS;
 
 }
+
+/*****************************************************************************/
+/**
+* This function attaches a shadow register set to the core. The shadow set is
+* loaded with the current register values. From then on the layer APIs update
+* the shadow set and XVMix_Commit() writes the changes to the core.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  ShadowPtr is the shadow register set, NULL to detach the current one
+*
+* @return XST_SUCCESS if the shadow set is attached or detached
+*         XST_DEVICE_BUSY if a commit is waiting for frame done
+*
+* @note   Changes not committed when the shadow set is detached are lost
+*
+******************************************************************************/
+int XVMix_SetShadow(XV_Mix_l2 *InstancePtr, XVMix_Shadow *ShadowPtr)
+{
+  u32 Slot, Offset;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  if(XVMix_IsCommitPending(InstancePtr)) {
+    return(XST_DEVICE_BUSY);
+  }
+  InstancePtr->Shadow = NULL;
+
+  if(ShadowPtr == NULL) {
+    return(XST_SUCCESS);
+  }
+
+  memset(ShadowPtr, 0, sizeof(XVMix_Shadow));
+  for(Slot=0; Slot<XVMIX_SHADOW_NUM_REGS; ++Slot) {
+    Offset = ShadowRegOffset(InstancePtr, Slot);
+    if(Offset != 0) {
+      ShadowPtr->Value[Slot] = ReadLayerReg(InstancePtr, Offset);
+      ShadowPtr->HwValue[Slot] = ShadowPtr->Value[Slot];
+    }
+  }
+  InstancePtr->Shadow = ShadowPtr;
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function commits the layer updates made since the last commit. Only
+* registers whose value changed are written. With the frame done interrupt
+* enabled the registers are written by XVMix_InterruptHandler() before the
+* next frame is started, otherwise they are written right away.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return XST_SUCCESS if the updates are committed
+*         XST_DEVICE_BUSY if the previous commit still waits for frame done
+*
+* @note   A shadow register set must be attached
+*
+******************************************************************************/
+int XVMix_Commit(XV_Mix_l2 *InstancePtr)
+{
+  XVMix_Shadow *ShadowPtr;
+  u32 Word, Bit, Bits, Slot;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(InstancePtr->Shadow != NULL);
+
+  ShadowPtr = InstancePtr->Shadow;
+  if(ShadowPtr->CommitPending) {
+    return(XST_DEVICE_BUSY);
+  }
+
+  /* Collect the changed registers */
+  ShadowPtr->CommitCount = 0;
+  for(Word=0; Word<((XVMIX_SHADOW_NUM_REGS + 31) / 32); ++Word) {
+    Bits = ShadowPtr->Dirty[Word];
+    ShadowPtr->Dirty[Word] = 0;
+    for(Bit=0; Bits!=0; ++Bit, Bits>>=1) {
+      Slot = (Word * 32) + Bit;
+      if((Bits & 1) &&
+         (ShadowPtr->Value[Slot] != ShadowPtr->HwValue[Slot])) {
+        ShadowPtr->HwValue[Slot] = ShadowPtr->Value[Slot];
+        ShadowPtr->CommitOffset[ShadowPtr->CommitCount] =
+                                     ShadowRegOffset(InstancePtr, Slot);
+        ShadowPtr->CommitValue[ShadowPtr->CommitCount] =
+                                     ShadowPtr->Value[Slot];
+        ShadowPtr->CommitCount++;
+      }
+    }
+  }
+  if(ShadowPtr->CommitCount == 0) {
+    return(XST_SUCCESS);
+  }
+
+  InstancePtr->RegStats.RegReads++;
+  if(XV_mix_InterruptGetEnabled(&InstancePtr->Mix) & XVMIX_IRQ_DONE_MASK) {
+    /* Commit list is complete before the interrupt handler can see it */
+    DATA_SYNC;
+    ShadowPtr->CommitPending = TRUE;
+  } else {
+    XVMix_ApplyCommit(InstancePtr);
+  }
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function writes the registers of the last commit to the core. It is
+* called by XVMix_InterruptHandler() on frame done and by XVMix_Commit() in
+* polling mode.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return None
+*
+******************************************************************************/
+void XVMix_ApplyCommit(XV_Mix_l2 *InstancePtr)
+{
+  XVMix_Shadow *ShadowPtr;
+  u32 Index;
+
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid(InstancePtr->Shadow != NULL);
+
+  ShadowPtr = InstancePtr->Shadow;
+  for(Index=0; Index<ShadowPtr->CommitCount; ++Index) {
+    XV_mix_WriteReg(InstancePtr->Mix.Config.BaseAddress,
+                    ShadowPtr->CommitOffset[Index],
+                    ShadowPtr->CommitValue[Index]);
+  }
+
+  InstancePtr->RegStats.RegWrites += ShadowPtr->CommitCount;
+  InstancePtr->RegStats.LastCommitWrites = ShadowPtr->CommitCount;
+  InstancePtr->RegStats.Commits++;
+  ShadowPtr->CommitCount = 0;
+  ShadowPtr->CommitPending = FALSE;
+}
+
+/*****************************************************************************/
+/**
+* This function checks if a commit waits for frame done
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return TRUE if a commit is pending, else FALSE
+*
+******************************************************************************/
+int XVMix_IsCommitPending(XV_Mix_l2 *InstancePtr)
+{
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  return(((InstancePtr->Shadow != NULL) &&
+          InstancePtr->Shadow->CommitPending) ? TRUE : FALSE);
+}
+
+/*****************************************************************************/
+/**
+* This function returns the register access statistics of the layer APIs
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  StatsPtr is where the statistics are returned
+*
+* @return None
+*
+******************************************************************************/
+void XVMix_GetRegStats(XV_Mix_l2 *InstancePtr, XVMix_RegStats *StatsPtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid(StatsPtr != NULL);
+
+  *StatsPtr = InstancePtr->RegStats;
+}
+
+/*****************************************************************************/
+/**
+* This function clears the register access statistics of the layer APIs
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return None
+*
+******************************************************************************/
+void XVMix_ClearRegStats(XV_Mix_l2 *InstancePtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  memset(&InstancePtr->RegStats, 0, sizeof(XVMix_RegStats));
+}
 /** @} */
@@ -80,6 +80,20 @@
 *     will configure the IP to keep processing frames without sw intervention.
 *   - Polling mode is the default configuration set during driver initialization
 *
+* <b> Shadow Registers </b>
+*
+* By default every layer API writes the core registers immediately, so an
+* update of many layers costs many register accesses and may be split over
+* two frames. The application can instead attach a shadow register set with
+* XVMix_SetShadow(). The layer enable, window, stride, scale factor, alpha and
+* buffer address APIs then only update the shadow set and read back from it.
+* XVMix_Commit() collects the registers whose value changed since the last
+* commit. In interrupt mode they are written by XVMix_InterruptHandler() when
+* the current frame is done, before the next frame is started, so all updates
+* of a commit take effect on the same frame. In polling mode they are written
+* right away. XVMix_GetRegStats() returns the number of register accesses
+* made by the layer APIs and commits.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -107,6 +121,7 @@
 * 4.00  vyc   04/04/18   Add 8th overlayer
 *                        Move logo layer enable from bit 8 to bit 15
 * 6.00  pg    01/10/20   Add Colorimetry Feature
+* 6.50  sb    10/19/26   Add shadow registers and commit of layer updates
 * </pre>
 *
 ******************************************************************************/
@@ -135,6 +150,9 @@ extern "C" {
 #define XVMIX_CSC_MATRIX_SIZE	(XVMIX_CSC_MAX_ROWS * XVMIX_CSC_MAX_COLS)
 #define XVMIX_CSC_COEFF_SIZE		(12)
 
+/* Shadowed registers: layer enable, 6 logo and 9 per overlay layer */
+#define XVMIX_SHADOW_NUM_REGS   (7 + (XVMIX_MAX_SUPPORTED_LAYERS * 9))
+
 /**************************** Type Definitions *******************************/
 /**
  * This typedef enumerates supported background colors
@@ -281,6 +299,32 @@ typedef struct {
     };
 }XVMix_Layer;
 
+/**
+ * This typedef contains the shadow register set of the core. It is allocated
+ * by the application and attached with XVMix_SetShadow()
+ */
+typedef struct {
+    u32 Value[XVMIX_SHADOW_NUM_REGS];    /**< Values set by the layer APIs */
+    u32 HwValue[XVMIX_SHADOW_NUM_REGS];  /**< Values of the core, including
+                                              the pending commit */
+    u32 Dirty[(XVMIX_SHADOW_NUM_REGS + 31) / 32]; /**< Registers set since the
+                                                       last commit */
+    u32 CommitOffset[XVMIX_SHADOW_NUM_REGS]; /**< Register offsets to write */
+    u32 CommitValue[XVMIX_SHADOW_NUM_REGS];  /**< Register values to write */
+    u32 CommitCount;                     /**< Registers to write */
+    volatile u32 CommitPending;          /**< Commit waits for frame done */
+}XVMix_Shadow;
+
+/**
+ * This typedef contains the register access statistics of the layer APIs
+ */
+typedef struct {
+    u32 RegWrites;         /**< Register writes */
+    u32 RegReads;          /**< Register reads */
+    u32 Commits;           /**< Commits written to the core */
+    u32 LastCommitWrites;  /**< Register writes of the last commit */
+}XVMix_RegStats;
+
 /**
 * Callback type for interrupt.
 *
@@ -308,11 +352,14 @@ typedef struct {
     void *CallbackRef;     /**< To be passed to the connect interrupt
                                 callback */
 
-    XVMix_Layer Layer[XVMIX_MAX_SUPPORTED_LAYERS];  /**< Layer configuration
-                                                         structure */
+    XVMix_Layer Layer[XVMIX_LAYER_LAST];  /**< Layer configuration structure,
+                                               indexed by layer id */
     XVMix_BackgroundId BkgndColor;
 
     XVidC_VideoStream Stream;    /**< Input AXIS */
+
+    XVMix_Shadow *Shadow;        /**< Shadow registers, NULL if not used */
+    XVMix_RegStats RegStats;     /**< Register access statistics */
 }XV_Mix_l2;
 
 /************************** Macros Definitions *******************************/
@@ -541,6 +588,13 @@ int XVMix_LoadLogoPixelAlpha(XV_Mix_l2 *InstancePtr,
 void XVMix_DbgReportStatus(XV_Mix_l2 *InstancePtr);
 void XVMix_DbgLayerInfo(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId);
 
+int XVMix_SetShadow(XV_Mix_l2 *InstancePtr, XVMix_Shadow *ShadowPtr);
+int XVMix_Commit(XV_Mix_l2 *InstancePtr);
+void XVMix_ApplyCommit(XV_Mix_l2 *InstancePtr);
+int XVMix_IsCommitPending(XV_Mix_l2 *InstancePtr);
+void XVMix_GetRegStats(XV_Mix_l2 *InstancePtr, XVMix_RegStats *StatsPtr);
+void XVMix_ClearRegStats(XV_Mix_l2 *InstancePtr);
+
 /* Interrupt related function */
 void XVMix_InterruptHandler(void *InstancePtr);
 int XVMix_SetCallback(XV_Mix_l2 *InstancePtr, void *CallbackFunc, void *CallbackRef);
@@ -21,6 +21,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  rco   12/14/15   Initial Release
 *             02/12/16   Move user call back before frame start trigger
+* 6.50  sb    10/19/26   Write pending shadow register commit on frame done
 *
 * </pre>
 *
@@ -66,8 +67,9 @@ int XVMix_SetCallback(XV_Mix_l2 *InstancePtr, void *CallbackFunc, void *Callback
 * This function is the interrupt handler for the mixer core driver.
 *
 * This handler clears the pending interrupt and determined if the source is
-* frame done signal. If yes, starts the next frame processing and calls the
-* registered callback function
+* frame done signal. If yes, calls the registered callback function, writes
+* the pending shadow register commit, if any, and starts the next frame
+* processing
 *
 * The application is responsible for connecting this function to the interrupt
 * system. Application beyond this driver is also responsible for providing
@@ -103,6 +105,10 @@ void XVMix_InterruptHandler(void *InstancePtr)
     if(MixPtr->FrameDoneCallback) {
 	      MixPtr->FrameDoneCallback(MixPtr->CallbackRef);
     }
+    //Write committed layer updates, they take effect on the next frame
+    if(XVMix_IsCommitPending(MixPtr)) {
+      XVMix_ApplyCommit(MixPtr);
+    }
     XV_mix_Start(&MixPtr->Mix);
   }
 }
@@ -0,0 +1,260 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+*
+* @file xv_multi_scaler_queue_example.c
+*
+* This example runs several video streams through the MultiScaler using the
+* command queue of the driver.
+*
+* XNUM_STREAMS streams are scaled from one input format to one of two output
+* geometries. The example keeps the queue filled with one job per frame of
+* each stream; the done interrupt programs the next jobs and restarts the
+* core. Jobs of streams sharing a geometry are placed on outputs that
+* already hold their coefficients, so the number of coefficient tables
+* written stays at the initial fill of the outputs.
+*
+* When all frames are scaled, the throughput of each stream is printed in
+* frames per second, along with the number of core runs and coefficient
+* tables written.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.5   sb   10/19/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+#include <stdio.h>
+#include "xil_cache.h"
+#include "xparameters.h"
+#include "xiltimer.h"
+#include "xv_multi_scaler_l2.h"
+#ifndef SDT
+#include "xscugic.h"
+#else
+#include "xinterrupt_wrap.h"
+#endif
+
+/************************** Local Constants *********************************/
+#define XNUM_STREAMS 4
+#define XNUM_FRAMES 300		/* Frames per stream */
+#define XNUM_JOBS 16		/* Job ring size, a power of two */
+#define SRC_BUF_START_ADDR 0x10000000
+#define DST_BUF_START_ADDR 0x30000000
+
+#if defined XPAR_PSU_ACPU_GIC_DEVICE_ID
+#define PS_ACPU_GIC_DEVICE_ID XPAR_PSU_ACPU_GIC_DEVICE_ID
+#elif defined XPAR_SCUGIC_0_DEVICE_ID
+#define PS_ACPU_GIC_DEVICE_ID XPAR_SCUGIC_0_DEVICE_ID
+#else
+#warning No GIC Device ID found
+#endif
+
+#ifndef SDT
+XScuGic Intc;
+#endif
+XV_multi_scaler MultiScalerInst;
+XV_multi_scaler_Queue Queue;
+XV_multi_scaler_Job JobMem[XNUM_JOBS];
+XV_multi_scaler_StreamStats StatsMem[XNUM_STREAMS];
+XV_multi_scaler_Video_Config Stream[XNUM_STREAMS];
+
+#ifndef SDT
+/*****************************************************************************/
+/**
+ *
+ * This function setups the interrupt system so interrupts can occur for the
+ * multiscaler core.
+ *
+ * @return
+ *	- XST_SUCCESS if interrupt setup was successful.
+ *	- A specific error code defined in "xstatus.h" if an error
+ *	occurs.
+ *
+ ******************************************************************************/
+static int SetupInterruptSystem(void)
+{
+	int Status;
+	XScuGic *IntcInstPtr = &Intc;
+	XScuGic_Config *IntcCfgPtr;
+
+	IntcCfgPtr = XScuGic_LookupConfig(PS_ACPU_GIC_DEVICE_ID);
+	if (!IntcCfgPtr) {
+		xil_printf("ERR:: Interrupt Controller not found");
+		return XST_DEVICE_NOT_FOUND;
+	}
+	Status = XScuGic_CfgInitialize(IntcInstPtr, IntcCfgPtr,
+		IntcCfgPtr->CpuBaseAddress);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Intc initialization failed!\r\n");
+		return XST_FAILURE;
+	}
+
+	Xil_ExceptionInit();
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT,
+		(Xil_ExceptionHandler) XScuGic_InterruptHandler,
+		(XScuGic *)IntcInstPtr);
+
+	return XST_SUCCESS;
+}
+#endif
+
+/*****************************************************************************/
+/**
+ *
+ * This function is the time source of the command queue.
+ *
+ * @return Current time in timer ticks
+ *
+ ******************************************************************************/
+static u64 GetTime(void)
+{
+	XTime Now;
+
+	XTime_GetTime(&Now);
+	return (u64)Now;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function sets up the streams. Even streams are scaled from 1080p to
+ * 720p, odd streams from 1080p to 360p, each with its own buffers.
+ *
+ * @param	MultiScalerPtr is a pointer to the core instance.
+ *
+ ******************************************************************************/
+static void SetupStreams(XV_multi_scaler *MultiScalerPtr)
+{
+	XV_multi_scaler_Video_Config *Cfg;
+	u32 MMWidthBytes = MultiScalerPtr->MaxDataWidth / 8;
+	u32 i;
+
+	for (i = 0; i < XNUM_STREAMS; i++) {
+		Cfg = &Stream[i];
+		Cfg->ChannelId = 0;
+		Cfg->WidthIn = 1920;
+		Cfg->HeightIn = 1080;
+		Cfg->WidthOut = (i & 1) ? 640 : 1280;
+		Cfg->HeightOut = (i & 1) ? 360 : 720;
+		Cfg->ColorFormatIn = XV_MULTI_SCALER_RGB8;
+		Cfg->ColorFormatOut = XV_MULTI_SCALER_RGB8;
+		Cfg->InStride = ((Cfg->WidthIn * 3 + MMWidthBytes - 1) /
+			MMWidthBytes) * MMWidthBytes;
+		Cfg->OutStride = ((Cfg->WidthOut * 3 + MMWidthBytes - 1) /
+			MMWidthBytes) * MMWidthBytes;
+		Cfg->SrcImgBuf0 = SRC_BUF_START_ADDR + 2 * i * XV_MAX_BUF_SIZE;
+		Cfg->SrcImgBuf1 = Cfg->SrcImgBuf0 + XV_MAX_BUF_SIZE;
+		Cfg->DstImgBuf0 = DST_BUF_START_ADDR + 2 * i * XV_MAX_BUF_SIZE;
+		Cfg->DstImgBuf1 = Cfg->DstImgBuf0 + XV_MAX_BUF_SIZE;
+		Cfg->CropWin.Crop = 0;
+	}
+}
+
+int main(void)
+{
+	XV_multi_scaler *MultiScalerPtr = &MultiScalerInst;
+	u32 Submitted = 0;
+	u32 Fps;
+	u32 status;
+	u32 i;
+
+	Xil_ICacheInvalidate();
+	Xil_ICacheDisable();
+	Xil_DCacheInvalidate();
+	Xil_DCacheDisable();
+
+	Xil_ExceptionDisable();
+
+	xil_printf("\r\n-----------------------------------------------\r\n");
+	xil_printf(" Multi Scaler Command Queue Example\r\n");
+
+#ifndef SDT
+	status = XV_multi_scaler_Initialize(MultiScalerPtr,
+		XPAR_V_MULTI_SCALER_0_DEVICE_ID);
+#else
+	status = XV_multi_scaler_Initialize(MultiScalerPtr,
+		XPAR_XV_MULTI_SCALER_0_BASEADDR);
+#endif
+	if (status != XST_SUCCESS) {
+		xil_printf("CRITICAL ERROR:: System Init Failed.\n\r");
+		return XST_FAILURE;
+	}
+
+	status = XV_MultiScalerQueueInitialize(MultiScalerPtr, &Queue, JobMem,
+		XNUM_JOBS, StatsMem, XNUM_STREAMS);
+	if (status != XST_SUCCESS) {
+		xil_printf("ERR:: Queue init failed\n\r");
+		return XST_FAILURE;
+	}
+	XV_MultiScalerQueueSetTimer(MultiScalerPtr, GetTime, COUNTS_PER_SECOND);
+
+#ifndef SDT
+	status = SetupInterruptSystem();
+	if (status == XST_FAILURE) {
+		xil_printf("IRQ init failed.\n\r\r");
+		return XST_FAILURE;
+	}
+	status = XScuGic_Connect(&Intc,
+		XPAR_FABRIC_V_MULTI_SCALER_0_INTERRUPT_INTR,
+		(XInterruptHandler)XV_MultiScalerIntrHandler,
+		(void *)MultiScalerPtr);
+#else
+	status = XSetupInterruptSystem(MultiScalerPtr,
+				       &XV_MultiScalerIntrHandler,
+				       MultiScalerInst.Config.IntrId,
+				       MultiScalerInst.Config.IntrParent,
+				       XINTERRUPT_DEFAULT_PRIORITY);
+#endif
+	if (status == XST_SUCCESS) {
+#ifndef SDT
+		XScuGic_Enable(&Intc,
+			XPAR_FABRIC_V_MULTI_SCALER_0_INTERRUPT_INTR);
+#endif
+	} else {
+		xil_printf("ERR:: Unable to register interrupt handler");
+		return XST_FAILURE;
+	}
+
+	SetupStreams(MultiScalerPtr);
+	Xil_ExceptionEnable();
+
+	/* Keep the queue filled, frames of all streams interleaved */
+	while ((Submitted < XNUM_STREAMS * XNUM_FRAMES) ||
+		!XV_MultiScalerQueueIsIdle(MultiScalerPtr)) {
+		while ((Submitted < XNUM_STREAMS * XNUM_FRAMES) &&
+			(XV_MultiScalerQueueSubmit(MultiScalerPtr,
+			&Stream[Submitted % XNUM_STREAMS],
+			Submitted % XNUM_STREAMS, NULL) == XST_SUCCESS))
+			Submitted++;
+		XV_MultiScalerQueueStart(MultiScalerPtr);
+	}
+
+	for (i = 0; i < XNUM_STREAMS; i++) {
+		Fps = XV_MultiScalerQueueGetFps(MultiScalerPtr, i);
+		xil_printf("Stream %d: %dx%d -> %dx%d, %d frames, %d.%03d fps\r\n",
+			i, Stream[i].WidthIn, Stream[i].HeightIn,
+			Stream[i].WidthOut, Stream[i].HeightOut,
+			StatsMem[i].Frames, Fps / 1000, Fps % 1000);
+	}
+	xil_printf("Core runs: %d, coefficient tables written: %d\r\n",
+		Queue.Batches, Queue.CoeffLoads);
+
+	if (Queue.Cons != XNUM_STREAMS * XNUM_FRAMES) {
+		xil_printf("MultiScaler queue test failed. \r\n");
+		return XST_FAILURE;
+	}
+	xil_printf("MultiScaler queue test successful. \r\n");
+
+	return 0;
+}
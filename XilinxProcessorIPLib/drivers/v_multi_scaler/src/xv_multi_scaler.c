@@ -40,6 +40,11 @@ int XV_multi_scaler_CfgInitialize(XV_multi_scaler *InstancePtr,
 	InstancePtr->Config.IntrId = ConfigPtr->IntrId;
 	InstancePtr->Config.IntrParent = ConfigPtr->IntrParent;
 #endif
+	for (i = 0; i < XV_MAX_OUTS; i++) {
+		InstancePtr->VCoeffTbl[i] = NULL;
+		InstancePtr->HCoeffTbl[i] = NULL;
+	}
+	InstancePtr->Queue = NULL;
 	return XST_SUCCESS;
 }
 #endif
@@ -100,6 +100,9 @@ extern XV_multi_scaler_Config XV_multi_scaler_ConfigTable[];
 #endif
 
 typedef void (*XVMultiScaler_Callback)(void *CallbackRef);
+#ifndef __linux__
+typedef struct XV_multi_scaler_Queue XV_multi_scaler_Queue;
+#endif
 typedef struct {
     XV_multi_scaler_Config Config;
     u32 Ctrl_BaseAddress;
@@ -115,6 +118,11 @@ typedef struct {
     XVMultiScaler_Callback FrameDoneCallback;
     void *CallbackRef;
     u8 OutBitMask;
+#ifndef __linux__
+    const short *VCoeffTbl[XV_MAX_OUTS]; /* Coefficients in the core, */
+    const short *HCoeffTbl[XV_MAX_OUTS]; /* NULL if unknown */
+    XV_multi_scaler_Queue *Queue;	/* Command queue, NULL if not used */
+#endif
 } XV_multi_scaler;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -20,6 +20,7 @@
 #include "xil_printf.h"
 #include "xv_multi_scaler_hw.h"
 #include "xv_multi_scaler.h"
+#include "xv_multi_scaler_l2.h"
 
 /*****************************************************************************/
 /**
@@ -55,7 +56,9 @@ void XVMultiScaler_SetCallback(XV_multi_scaler *InstancePtr, void *CallbackFunc,
  ** This function is the interrupt handler for the MultiScaler core driver.
  **
  ** This handler clears the pending interrupt and determines if the source is
- ** frame done signal. If yes, calls the registered callback function.
+ ** frame done signal. If yes, it completes the running jobs and starts the
+ ** next ones when a command queue is set up, or calls the registered callback
+ ** function otherwise.
  **
  ** The application is responsible for connecting this function to the interrupt
  ** system.
@@ -80,7 +83,9 @@ void *XV_MultiScalerIntrHandler(void *InstancePtr)
 		XV_multi_scaler_InterruptClear(MscPtr,
 			XV_MULTI_SCALER_ISR_DONE_BIT_MASK |
 			XV_MULTI_SCALER_ISR_READY_BIT_MASK);
-		if (MscPtr->FrameDoneCallback)
+		if (MscPtr->Queue != NULL)
+			XV_MultiScalerQueueDoneHandler(MscPtr);
+		else if (MscPtr->FrameDoneCallback)
 			MscPtr->FrameDoneCallback(MscPtr);
 	}
 }
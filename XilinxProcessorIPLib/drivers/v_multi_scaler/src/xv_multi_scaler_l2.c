@@ -265,6 +265,9 @@ static const void (*XV_MS_Set_DstImgBuf1[XV_MAX_OUTS])(XV_multi_scaler
 /************************** Function Prototypes ******************************/
 static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
 				   XV_multi_scaler_Video_Config *MS_cfg);
+static const short *XV_MultiScalerSelectCoeff(XV_multi_scaler *MscPtr,
+		u32 SizeIn, u32 SizeOut);
+static void XV_MultiScalerQueueDispatch(XV_multi_scaler *InstancePtr);
 
 /*****************************************************************************/
 /**
@@ -345,30 +348,22 @@ void XV_MultiScalerSetNumOutputs(XV_multi_scaler *InstancePtr, u32 NumOuts)
 
 /*****************************************************************************/
 /**
-* This function programs the computed filter coefficients and phase data into
-* core registers
+* This function selects the filter coefficient table for a scaling ratio
 *
 * @param	MscPtr is a pointer to the core instance to be worked on.
-* @param	NumOut is the output channel number.
+* @param	SizeIn is the input width or height.
+* @param	SizeOut is the output width or height.
 *
-* @return None
+* @return Coefficient table, 12 taps per phase
 *
 ******************************************************************************/
-static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
-		XV_multi_scaler_Video_Config *MS_cfg)
+static const short *XV_MultiScalerSelectCoeff(XV_multi_scaler *MscPtr,
+		u32 SizeIn, u32 SizeOut)
 {
-	u32 num_phases = 1<<MscPtr->PhaseShift;
-	u32 num_taps	= MscPtr->NumTaps/2;
-	u32 val;
-	u32 i;
-	u32 j;
-	u32 baseAddr;
-	short *coeff;
-	u32 vfltcoef_offset;
-	u32 hfltcoef_offset;
+	const short *coeff = NULL;
 	float scale;
 
-	scale = (float)MS_cfg->HeightIn / MS_cfg->HeightOut;
+	scale = (float)SizeIn / SizeOut;
 	if ((scale >= 2) && (scale < 2.5))
 	{
 		if(MscPtr->NumTaps == 6)
@@ -416,11 +411,29 @@ static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
 	if(scale < 1)
 		coeff = &XV_multiscaler_fixedcoeff_taps6_12C[0][0];
 
-	vfltcoef_offset = XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_VFLTCOEFF_0_BASE +
-		MS_cfg->ChannelId *
-		XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
+	return coeff;
+}
+
+/*****************************************************************************/
+/**
+* This function programs a filter coefficient table into core registers
+*
+* @param	MscPtr is a pointer to the core instance to be worked on.
+* @param	baseAddr is the address of the coefficient memory.
+* @param	coeff is the coefficient table.
+*
+* @return None
+*
+******************************************************************************/
+static void XV_MultiScalerWriteCoeff(XV_multi_scaler *MscPtr, u32 baseAddr,
+		const short *coeff)
+{
+	u32 num_phases = 1<<MscPtr->PhaseShift;
+	u32 num_taps	= MscPtr->NumTaps/2;
+	u32 val;
+	u32 i;
+	u32 j;
 
-	baseAddr = MscPtr->Ctrl_BaseAddress + vfltcoef_offset;
 	for (i = 0; i < num_phases; i++) {
 		for (j = 0; j < XV_MULTISCALER_TAPS_12; j = j + 2) {
 			val = (coeff[i * XV_MULTISCALER_TAPS_12 + (j + 1)] << 16) |
@@ -429,67 +442,74 @@ static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
 					((i * num_taps + j / 2) * 4), val);
 		}
 	}
+}
 
-	scale = (float)MS_cfg->WidthIn / MS_cfg->WidthOut;
-	if ((scale >= 2) && (scale < 2.5))
-	{
-		if(MscPtr->NumTaps == 6)
-			coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-		else
-			coeff = &XV_multiscaler_fixedcoeff_taps8_12C[0][0];
-	}
-	if ((scale >= 2.5) && (scale < 3))
-	{
-		if(MscPtr->NumTaps >= 10)
-			coeff = &XV_multiscaler_fixedcoeff_taps10_12C[0][0];
-		else
-		{
-			if(MscPtr->NumTaps == 6)
-				coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-			else
-				coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-		}
+/*****************************************************************************/
+/**
+* This function programs the filter coefficients of a channel into core
+* registers. A table is only written if it differs from the one the channel
+* already has.
+*
+* @param	MscPtr is a pointer to the core instance to be worked on.
+* @param	MS_cfg is a pointer to the channel configuration.
+*
+* @return None
+*
+******************************************************************************/
+static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
+		XV_multi_scaler_Video_Config *MS_cfg)
+{
+	const short *coeff;
+	u32 baseAddr;
+	u32 vfltcoef_offset;
+	u32 hfltcoef_offset;
+
+	coeff = XV_MultiScalerSelectCoeff(MscPtr, MS_cfg->HeightIn,
+			MS_cfg->HeightOut);
+	if ((coeff != NULL) && (coeff != MscPtr->VCoeffTbl[MS_cfg->ChannelId])) {
+		vfltcoef_offset = XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_VFLTCOEFF_0_BASE +
+			MS_cfg->ChannelId *
+			XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
+
+		baseAddr = MscPtr->Ctrl_BaseAddress + vfltcoef_offset;
+		XV_MultiScalerWriteCoeff(MscPtr, baseAddr, coeff);
+		MscPtr->VCoeffTbl[MS_cfg->ChannelId] = coeff;
 	}
 
-	if ((scale >= 3) && (scale < 3.5))
-		if(MscPtr->NumTaps == 12)
-			coeff = &XV_multiscaler_fixedcoeff_taps12_12C[0][0];
-		else
-		{
-			if(MscPtr->NumTaps == 6)
-				coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-			if(MscPtr->NumTaps == 8)
-				coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-			if(MscPtr->NumTaps == 10)
-				coeff = &XV_multiscaler_fixedcoeff_taps10_10C[0][0];
-		}
+	coeff = XV_MultiScalerSelectCoeff(MscPtr, MS_cfg->WidthIn,
+			MS_cfg->WidthOut);
+	if ((coeff != NULL) && (coeff != MscPtr->HCoeffTbl[MS_cfg->ChannelId])) {
+		hfltcoef_offset = XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_HFLTCOEFF_0_BASE +
+			MS_cfg->ChannelId *
+			XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
 
-	if ((scale >= 3.5) || (scale < 2 && scale >= 1))
-	{
-		if(MscPtr->NumTaps == 6)
-			coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-		if(MscPtr->NumTaps == 8)
-			coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-		if(MscPtr->NumTaps == 10)
-			coeff = &XV_multiscaler_fixedcoeff_taps10_10C[0][0];
-		if(MscPtr->NumTaps == 12)
-			coeff = &XV_multiscaler_fixedcoeff_taps12_12C[0][0];
+		baseAddr = MscPtr->Ctrl_BaseAddress + hfltcoef_offset;
+		XV_MultiScalerWriteCoeff(MscPtr, baseAddr, coeff);
+		MscPtr->HCoeffTbl[MS_cfg->ChannelId] = coeff;
 	}
-	if(scale < 1)
-		coeff = &XV_multiscaler_fixedcoeff_taps6_12C[0][0];
+}
 
-	hfltcoef_offset = XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_HFLTCOEFF_0_BASE +
-		MS_cfg->ChannelId *
-		XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
+/*****************************************************************************/
+/**
+* This function makes the next XV_MultiScalerSetChannelConfig() of each
+* channel program its filter coefficients even if they did not change. It is
+* needed when the coefficient memories of the core may have lost their
+* content.
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+void XV_MultiScalerInvalidateTables(XV_multi_scaler *InstancePtr)
+{
+	u32 i;
 
-	baseAddr = MscPtr->Ctrl_BaseAddress + hfltcoef_offset;
-	for (i = 0; i < num_phases; i++) {
-		for (j = 0; j < XV_MULTISCALER_TAPS_12; j = j + 2) {
-			val = (coeff[i * XV_MULTISCALER_TAPS_12 + (j + 1)] << 16) |
-				(coeff[i * XV_MULTISCALER_TAPS_12 + j] & 0x0000FFFF);
-			XV_multi_scaler_WriteReg(baseAddr,
-					((i * num_taps + j / 2) * 4), val);
-		}
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	for (i = 0; i < XV_MAX_OUTS; i++) {
+		InstancePtr->VCoeffTbl[i] = NULL;
+		InstancePtr->HCoeffTbl[i] = NULL;
 	}
 }
 
@@ -691,4 +711,395 @@ void XV_MultiScalerSetChannelConfig(XV_multi_scaler *InstancePtr,
 	XV_MS_Set_DstImgBuf0[i](InstancePtr, MS_cfg->DstImgBuf0);
 	XV_MS_Set_DstImgBuf1[i](InstancePtr, MS_cfg->DstImgBuf1);
 }
+
+/*****************************************************************************/
+/**
+* This function sets up the command queue of the core. Jobs submitted with
+* XV_MultiScalerQueueSubmit() are held in JobMem until they complete, and
+* frames are counted per stream in StatsMem.
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+* @param	QueuePtr is a pointer to the queue to be set up.
+* @param	JobMem is the memory of the job ring.
+* @param	NumJobs is the number of jobs JobMem can hold, a power of two.
+* @param	StatsMem is the memory of the stream statistics.
+* @param	NumStreams is the number of streams StatsMem can hold. Stream
+*		identifiers run from 0 to NumStreams - 1.
+*
+* @return
+*		- XST_SUCCESS if the queue was set up.
+*		- XST_INVALID_PARAM if NumJobs is not a power of two.
+*
+* @note		The core must be idle. To drive the core directly again,
+*		wait for XV_MultiScalerQueueIsIdle() and set the Queue member
+*		of the instance to NULL.
+*
+******************************************************************************/
+int XV_MultiScalerQueueInitialize(XV_multi_scaler *InstancePtr,
+	XV_multi_scaler_Queue *QueuePtr, XV_multi_scaler_Job *JobMem,
+	u32 NumJobs, XV_multi_scaler_StreamStats *StatsMem, u32 NumStreams)
+{
+	u32 i;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(JobMem != NULL);
+	Xil_AssertNonvoid(StatsMem != NULL);
+	Xil_AssertNonvoid(NumStreams > 0);
+
+	if ((NumJobs == 0) || ((NumJobs & (NumJobs - 1)) != 0))
+		return XST_INVALID_PARAM;
+
+	QueuePtr->Jobs = JobMem;
+	QueuePtr->Mask = NumJobs - 1;
+	QueuePtr->Prod = 0;
+	QueuePtr->Cons = 0;
+	QueuePtr->InFlight = 0;
+	QueuePtr->Stats = StatsMem;
+	QueuePtr->NumStreams = NumStreams;
+	QueuePtr->JobDoneCallback = NULL;
+	QueuePtr->JobDoneRef = NULL;
+	QueuePtr->GetTime = NULL;
+	QueuePtr->TicksPerSec = 0;
+	QueuePtr->Batches = 0;
+	QueuePtr->CoeffLoads = 0;
+	for (i = 0; i < NumStreams; i++) {
+		StatsMem[i].Frames = 0;
+		StatsMem[i].FirstTime = 0;
+		StatsMem[i].LastTime = 0;
+	}
+
+	InstancePtr->Queue = QueuePtr;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function installs the callback invoked from the done interrupt for
+* each completed job of the command queue.
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+* @param	CallbackFunc is the callback function, NULL for none.
+* @param	CallbackRef is passed to the callback function.
+*
+* @return None
+*
+******************************************************************************/
+void XV_MultiScalerQueueSetCallback(XV_multi_scaler *InstancePtr,
+	XVMultiScaler_JobCallback CallbackFunc, void *CallbackRef)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->Queue != NULL);
+
+	InstancePtr->Queue->JobDoneCallback = CallbackFunc;
+	InstancePtr->Queue->JobDoneRef = CallbackRef;
+}
+
+/*****************************************************************************/
+/**
+* This function installs the time source used to timestamp completed frames
+* for XV_MultiScalerQueueGetFps().
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+* @param	TimeFunc returns a free running tick count, NULL for none.
+* @param	TicksPerSec is the tick frequency of TimeFunc.
+*
+* @return None
+*
+******************************************************************************/
+void XV_MultiScalerQueueSetTimer(XV_multi_scaler *InstancePtr,
+	XVMultiScaler_TimeFunc TimeFunc, u64 TicksPerSec)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->Queue != NULL);
+	Xil_AssertVoid((TimeFunc == NULL) || (TicksPerSec != 0));
+
+	InstancePtr->Queue->GetTime = TimeFunc;
+	InstancePtr->Queue->TicksPerSec = (TimeFunc != NULL) ? TicksPerSec : 0;
+}
+
+/*****************************************************************************/
+/**
+* This function adds a scaling job to the command queue. The job is not run
+* before XV_MultiScalerQueueStart() is called, or before the core completes
+* the jobs it is running.
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+* @param	MS_cfg is the channel configuration of the job. It is copied,
+*		its ChannelId is ignored.
+* @param	StreamId is the stream the frame belongs to.
+* @param	Ref is application data, handed back in the job done callback.
+*
+* @return
+*		- XST_SUCCESS if the job was queued.
+*		- XST_DEVICE_BUSY if the queue is full.
+*
+* @note		This function must be called from one context only, which
+*		the done interrupt may preempt.
+*
+******************************************************************************/
+int XV_MultiScalerQueueSubmit(XV_multi_scaler *InstancePtr,
+	XV_multi_scaler_Video_Config *MS_cfg, u32 StreamId, void *Ref)
+{
+	XV_multi_scaler_Queue *QueuePtr;
+	XV_multi_scaler_Job *JobPtr;
+	u32 Prod;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->Queue != NULL);
+	Xil_AssertNonvoid(MS_cfg != NULL);
+	Xil_AssertNonvoid(StreamId < InstancePtr->Queue->NumStreams);
+	Xil_AssertNonvoid((MS_cfg->WidthIn > 0) &&
+		(MS_cfg->WidthIn <= InstancePtr->MaxCols));
+	Xil_AssertNonvoid((MS_cfg->WidthOut > 0) &&
+		(MS_cfg->WidthOut <= InstancePtr->MaxCols));
+	Xil_AssertNonvoid((MS_cfg->HeightIn > 0) &&
+		(MS_cfg->HeightIn <= InstancePtr->MaxRows));
+	Xil_AssertNonvoid((MS_cfg->HeightOut > 0) &&
+		(MS_cfg->HeightOut <= InstancePtr->MaxRows));
+
+	QueuePtr = InstancePtr->Queue;
+	Prod = QueuePtr->Prod;
+	if ((Prod - QueuePtr->Cons) > QueuePtr->Mask)
+		return XST_DEVICE_BUSY;
+
+	JobPtr = &QueuePtr->Jobs[Prod & QueuePtr->Mask];
+	JobPtr->Cfg = *MS_cfg;
+	JobPtr->StreamId = StreamId;
+	JobPtr->Ref = Ref;
+	JobPtr->VCoeff = XV_MultiScalerSelectCoeff(InstancePtr,
+			MS_cfg->HeightIn, MS_cfg->HeightOut);
+	JobPtr->HCoeff = XV_MultiScalerSelectCoeff(InstancePtr,
+			MS_cfg->WidthIn, MS_cfg->WidthOut);
+
+	QueuePtr->Prod = Prod + 1;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function starts the core on the queued jobs if it is idle. While jobs
+* are pending, the done interrupt keeps the core running by itself.
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return None
+*
+* @note		This function must be called from the context that submits
+*		jobs.
+*
+******************************************************************************/
+void XV_MultiScalerQueueStart(XV_multi_scaler *InstancePtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->Queue != NULL);
+
+	/*
+	 * InFlight is only cleared by the done interrupt when it finds the
+	 * queue empty, after which no interrupt comes until the core is
+	 * started again here
+	 */
+	if (InstancePtr->Queue->InFlight == 0)
+		XV_MultiScalerQueueDispatch(InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+* This function returns whether the command queue has run all its jobs.
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return TRUE if no job is pending or running, FALSE otherwise
+*
+******************************************************************************/
+u32 XV_MultiScalerQueueIsIdle(XV_multi_scaler *InstancePtr)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->Queue != NULL);
+
+	return (InstancePtr->Queue->InFlight == 0) &&
+		(InstancePtr->Queue->Prod == InstancePtr->Queue->Cons);
+}
+
+/*****************************************************************************/
+/**
+* This function returns the throughput of a stream, from the completion of
+* its first frame to the completion of its last frame.
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+* @param	StreamId is the stream.
+*
+* @return Frames per second multiplied by 1000, 0 if no time source is
+*		installed or less than two frames completed
+*
+* @note		While the queue runs, the result may be off by one frame.
+*
+******************************************************************************/
+u32 XV_MultiScalerQueueGetFps(XV_multi_scaler *InstancePtr, u32 StreamId)
+{
+	XV_multi_scaler_Queue *QueuePtr;
+	XV_multi_scaler_StreamStats *StatsPtr;
+	u64 Elapsed;
+	u32 Frames;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->Queue != NULL);
+	Xil_AssertNonvoid(StreamId < InstancePtr->Queue->NumStreams);
+
+	QueuePtr = InstancePtr->Queue;
+	StatsPtr = &QueuePtr->Stats[StreamId];
+	Frames = StatsPtr->Frames;
+	Elapsed = StatsPtr->LastTime - StatsPtr->FirstTime;
+	if ((QueuePtr->TicksPerSec == 0) || (Frames < 2) || (Elapsed == 0))
+		return 0;
+
+	return (u32)(((u64)(Frames - 1) * 1000 * QueuePtr->TicksPerSec) /
+		Elapsed);
+}
+
+/*****************************************************************************/
+/**
+* This function returns how many of the two coefficient tables of a job are
+* already loaded in a channel.
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+* @param	JobPtr is the job.
+* @param	Ch is the channel.
+*
+* @return 0, 1 or 2
+*
+******************************************************************************/
+static u32 XV_MultiScalerQueueMatch(XV_multi_scaler *InstancePtr,
+	XV_multi_scaler_Job *JobPtr, u32 Ch)
+{
+	u32 Match = 0;
+
+	if ((JobPtr->VCoeff == NULL) ||
+		(JobPtr->VCoeff == InstancePtr->VCoeffTbl[Ch]))
+		Match++;
+	if ((JobPtr->HCoeff == NULL) ||
+		(JobPtr->HCoeff == InstancePtr->HCoeffTbl[Ch]))
+		Match++;
+
+	return Match;
+}
+
+/*****************************************************************************/
+/**
+* This function programs the next batch of queued jobs, one per channel, and
+* starts the core on it. If no job is queued, the queue becomes idle.
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+static void XV_MultiScalerQueueDispatch(XV_multi_scaler *InstancePtr)
+{
+	XV_multi_scaler_Queue *QueuePtr = InstancePtr->Queue;
+	XV_multi_scaler_Job *JobPtr[XV_MAX_OUTS];
+	u32 ChanOf[XV_MAX_OUTS];
+	u32 ChanUsed = 0;
+	u32 Count;
+	u32 Match;
+	u32 Ch;
+	u32 i;
+
+	Count = QueuePtr->Prod - QueuePtr->Cons;
+	if (Count > InstancePtr->MaxOuts)
+		Count = InstancePtr->MaxOuts;
+	QueuePtr->InFlight = Count;
+	if (Count == 0)
+		return;
+
+	for (i = 0; i < Count; i++) {
+		JobPtr[i] = &QueuePtr->Jobs[(QueuePtr->Cons + i) &
+			QueuePtr->Mask];
+		ChanOf[i] = XV_MAX_OUTS;
+	}
+
+	/*
+	 * Place each job on a channel holding both of its coefficient
+	 * tables first, then on one holding either, then on any free one
+	 */
+	Match = 3;
+	while (Match-- > 0) {
+		for (i = 0; i < Count; i++) {
+			if (ChanOf[i] != XV_MAX_OUTS)
+				continue;
+			for (Ch = 0; Ch < Count; Ch++) {
+				if (!(ChanUsed & (1 << Ch)) &&
+					(XV_MultiScalerQueueMatch(InstancePtr,
+					JobPtr[i], Ch) >= Match)) {
+					ChanOf[i] = Ch;
+					ChanUsed |= 1 << Ch;
+					break;
+				}
+			}
+		}
+	}
+
+	XV_MultiScalerSetNumOutputs(InstancePtr, Count);
+	for (i = 0; i < Count; i++) {
+		Ch = ChanOf[i];
+		QueuePtr->CoeffLoads += 2 -
+			XV_MultiScalerQueueMatch(InstancePtr, JobPtr[i], Ch);
+		JobPtr[i]->Cfg.ChannelId = Ch;
+		XV_MultiScalerSetChannelConfig(InstancePtr, &JobPtr[i]->Cfg);
+	}
+	QueuePtr->Batches++;
+
+	XV_multi_scaler_DisableAutoRestart(InstancePtr);
+	XV_multi_scaler_InterruptGlobalEnable(InstancePtr);
+	XV_multi_scaler_InterruptEnable(InstancePtr,
+		XV_MULTI_SCALER_ISR_DONE_BIT_MASK);
+	XV_multi_scaler_Start(InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+* This function completes the running batch of the command queue and starts
+* the next one. It is called by XV_MultiScalerIntrHandler() on the done
+* interrupt when a command queue is set up.
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+void XV_MultiScalerQueueDoneHandler(XV_multi_scaler *InstancePtr)
+{
+	XV_multi_scaler_Queue *QueuePtr;
+	XV_multi_scaler_Job *JobPtr;
+	XV_multi_scaler_StreamStats *StatsPtr;
+	u64 Now = 0;
+	u32 i;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->Queue != NULL);
+
+	QueuePtr = InstancePtr->Queue;
+	if (QueuePtr->InFlight == 0)
+		return;
+
+	if (QueuePtr->GetTime != NULL)
+		Now = QueuePtr->GetTime();
+
+	for (i = 0; i < QueuePtr->InFlight; i++) {
+		JobPtr = &QueuePtr->Jobs[(QueuePtr->Cons + i) &
+			QueuePtr->Mask];
+		StatsPtr = &QueuePtr->Stats[JobPtr->StreamId];
+		if (StatsPtr->Frames == 0)
+			StatsPtr->FirstTime = Now;
+		StatsPtr->LastTime = Now;
+		StatsPtr->Frames++;
+		if (QueuePtr->JobDoneCallback != NULL)
+			QueuePtr->JobDoneCallback(QueuePtr->JobDoneRef, JobPtr);
+	}
+	QueuePtr->Cons += QueuePtr->InFlight;
+
+	XV_MultiScalerQueueDispatch(InstancePtr);
+}
 /** @} */
@@ -22,6 +22,24 @@
 * through callback functions that user has registered. If there are no
 * registered callback functions, then a stub callback function is called.
 *
+* <b> Command queue </b>
+*
+* Instead of programming each output and restarting the core for every
+* batch of frames, the application can submit scaling jobs of any number of
+* streams to a command queue with XV_MultiScalerQueueSubmit(). The queue is
+* set up with XV_MultiScalerQueueInitialize() on application provided memory
+* and is started with XV_MultiScalerQueueStart(). From then on the done
+* interrupt takes the next jobs off the queue, up to one per output, programs
+* them and restarts the core, so the CPU is not involved between frames as
+* long as jobs are pending.
+*
+* Jobs are run in submission order. Within a batch, each job is placed on the
+* output whose filter coefficients already match the ones it needs, so
+* streams with the same geometry keep their output and do not reload
+* coefficients. The queue counts frames per stream, and with a time source
+* installed by XV_MultiScalerQueueSetTimer(), XV_MultiScalerQueueGetFps()
+* reports the throughput of each stream.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -124,6 +142,59 @@ typedef struct {
 	XV_multi_scaler_Crop_Window CropWin;
 } XV_multi_scaler_Video_Config;
 
+/**
+ * Scaling job of the command queue
+ */
+typedef struct {
+	XV_multi_scaler_Video_Config Cfg;	/**< Channel configuration,
+						  *  ChannelId is assigned by
+						  *  the queue */
+	u32 StreamId;		/**< Stream the frame belongs to */
+	void *Ref;		/**< Application data of the job */
+	const short *VCoeff;	/**< Vertical coefficients, internal */
+	const short *HCoeff;	/**< Horizontal coefficients, internal */
+} XV_multi_scaler_Job;
+
+/**
+ * Per stream statistics of the command queue
+ */
+typedef struct {
+	u32 Frames;		/**< Frames completed */
+	u64 FirstTime;		/**< Completion time of the first frame */
+	u64 LastTime;		/**< Completion time of the last frame */
+} XV_multi_scaler_StreamStats;
+
+/**
+ * Callback invoked from the done interrupt for each completed job. The job
+ * is only valid during the callback.
+ */
+typedef void (*XVMultiScaler_JobCallback)(void *CallbackRef,
+	XV_multi_scaler_Job *JobPtr);
+
+/**
+ * Time source of the command queue, returns a free running tick count
+ */
+typedef u64 (*XVMultiScaler_TimeFunc)(void);
+
+/**
+ * Command queue. Prod and Cons run freely and are masked when indexing Jobs.
+ */
+struct XV_multi_scaler_Queue {
+	XV_multi_scaler_Job *Jobs;	/**< Job ring */
+	u32 Mask;			/**< Number of jobs - 1 */
+	volatile u32 Prod;		/**< Jobs submitted */
+	volatile u32 Cons;		/**< Jobs completed */
+	volatile u32 InFlight;		/**< Jobs in the core, 0 if idle */
+	XV_multi_scaler_StreamStats *Stats;	/**< Statistics per stream */
+	u32 NumStreams;			/**< Number of entries of Stats */
+	XVMultiScaler_JobCallback JobDoneCallback;	/**< Job done callback */
+	void *JobDoneRef;		/**< Job done callback reference */
+	XVMultiScaler_TimeFunc GetTime;	/**< Time source, NULL if none */
+	u64 TicksPerSec;		/**< Frequency of the time source */
+	u32 Batches;			/**< Core runs started */
+	u32 CoeffLoads;			/**< Coefficient tables written */
+};
+
 /*extern const short XV_multiscaler_fixedcoeff_taps6[XV_MULTISCALER_MAX_V_PHASES]
 	[XV_MULTISCALER_TAPS_12];
 extern const short XV_multiscaler_fixedcoeff_taps8[XV_MULTISCALER_MAX_V_PHASES]
@@ -156,6 +227,20 @@ void XV_MultiScalerGetChannelConfig(XV_multi_scaler  *InstancePtr,
 	XV_multi_scaler_Video_Config *multi_scaler_cfg);
 void XV_MultiScalerSetChannelConfig(XV_multi_scaler  *InstancePtr,
 	XV_multi_scaler_Video_Config *multi_scaler_cfg);
+void XV_MultiScalerInvalidateTables(XV_multi_scaler *InstancePtr);
+int XV_MultiScalerQueueInitialize(XV_multi_scaler *InstancePtr,
+	XV_multi_scaler_Queue *QueuePtr, XV_multi_scaler_Job *JobMem,
+	u32 NumJobs, XV_multi_scaler_StreamStats *StatsMem, u32 NumStreams);
+void XV_MultiScalerQueueSetCallback(XV_multi_scaler *InstancePtr,
+	XVMultiScaler_JobCallback CallbackFunc, void *CallbackRef);
+void XV_MultiScalerQueueSetTimer(XV_multi_scaler *InstancePtr,
+	XVMultiScaler_TimeFunc TimeFunc, u64 TicksPerSec);
+int XV_MultiScalerQueueSubmit(XV_multi_scaler *InstancePtr,
+	XV_multi_scaler_Video_Config *MS_cfg, u32 StreamId, void *Ref);
+void XV_MultiScalerQueueStart(XV_multi_scaler *InstancePtr);
+u32 XV_MultiScalerQueueIsIdle(XV_multi_scaler *InstancePtr);
+u32 XV_MultiScalerQueueGetFps(XV_multi_scaler *InstancePtr, u32 StreamId);
+void XV_MultiScalerQueueDoneHandler(XV_multi_scaler *InstancePtr);
 
 #ifdef __cplusplus
 }
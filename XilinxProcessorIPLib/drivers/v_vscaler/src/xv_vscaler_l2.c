@@ -28,6 +28,7 @@
 *       rco   02/09/17   Fix c++ compilation warnings
 *	jsr   09/07/18 Fix for 64-bit driver support
 * 3.1   vsa   04/07/20   Improve quality with new coefficients
+* 3.3   sb    10/19/26   Write coefficients only when they change
 *
 * </pre>
 *
@@ -234,6 +235,12 @@ static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
 	numTaps = XV_VSCALER_TAPS_6;
   }
 
+  /* Nothing to do if the table is already loaded */
+  if(coeff == InstancePtr->CoeffTbl)
+  {
+    return;
+  }
+
   XV_VScalerLoadExtCoeff(InstancePtr,
 		                 numPhases,
 		                 numTaps,
@@ -241,6 +248,7 @@ static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
 
   /* Disable use of external coefficients */
   InstancePtr->UseExtCoeff = FALSE;
+  InstancePtr->CoeffTbl = coeff;
 }
 
 /*****************************************************************************/
@@ -315,6 +323,8 @@ void XV_VScalerLoadExtCoeff(XV_Vscaler_l2 *InstancePtr,
 
   /* Enable use of external coefficients */
   InstancePtr->UseExtCoeff = TRUE;
+  InstancePtr->CoeffTbl = NULL;
+  InstancePtr->CoeffLoaded = FALSE;
 }
 
 /*****************************************************************************/
@@ -399,7 +409,11 @@ int XV_VScalerSetup(XV_Vscaler_l2  *InstancePtr,
     }
 
     /* Program coefficients into the IP register bank */
-    XV_VScalerSetCoeff(InstancePtr);
+    if(!InstancePtr->CoeffLoaded)
+    {
+      XV_VScalerSetCoeff(InstancePtr);
+      InstancePtr->CoeffLoaded = TRUE;
+    }
   }
 
   LineRate = (HeightIn * STEP_PRECISION)/HeightOut;
@@ -413,6 +427,24 @@ int XV_VScalerSetup(XV_Vscaler_l2  *InstancePtr,
   return XST_SUCCESS;
 }
 
+/*****************************************************************************/
+/**
+* This function makes the next XV_VScalerSetup() program the coefficients even
+* if they did not change. It is needed when the coefficient memory of the core
+* may have lost its content.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+void XV_VScalerInvalidateTables(XV_Vscaler_l2 *InstancePtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  InstancePtr->CoeffLoaded = FALSE;
+}
+
 /*****************************************************************************/
 /**
 *
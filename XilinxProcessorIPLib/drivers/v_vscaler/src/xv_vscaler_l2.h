@@ -45,6 +45,14 @@
 * Advanced users always have the capability to directly interact with the IP
 * core using Layer-1 API's that perform low level register peek/poke.
 *
+* <b> Resolution switching </b>
+*
+* XV_VScalerSetup() writes the filter coefficients only when a different
+* table is selected or the user loaded new ones. The coefficient memory of the
+* core keeps its content over a core reset. If it may have been lost, e.g.
+* after the bitstream was reloaded, the application calls
+* XV_VScalerInvalidateTables() before the next setup.
+*
 * <b> Interrupts </b>
 *
 * This driver does not have any interrupts
@@ -70,6 +78,7 @@
 * 2.00  rco   11/05/15   Integrate layer-1 with layer-2
 * 3.0   mpe   04/28/16   Added optional color format conversion handling
 * 3.1   vsa   04/07/20   Improve quality with new coefficients
+* 3.3   sb    10/19/26   Skip reloading of unchanged coefficients
 *
 * </pre>
 *
@@ -125,6 +134,8 @@ typedef struct
   XV_vscaler Vsc; /*<< Layer 1 instance */
   u8 UseExtCoeff;
   short coeff[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_MAX_V_TAPS];
+  const short *CoeffTbl;  /*<< Table of coeff, NULL if loaded by the user */
+  u8 CoeffLoaded;         /*<< coeff is in the core */
 }XV_Vscaler_l2;
 
 /************************** Macros Definitions *******************************/
@@ -155,6 +166,7 @@ int XV_VScalerSetup(XV_Vscaler_l2  *InstancePtr,
                     u32 HeightOut,
                     u32 ColorFormat);
 void XV_VScalerDbgReportStatus(XV_Vscaler_l2 *InstancePtr);
+void XV_VScalerInvalidateTables(XV_Vscaler_l2 *InstancePtr);
 
 #ifdef __cplusplus
 }
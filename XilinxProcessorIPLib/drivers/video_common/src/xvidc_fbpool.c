@@ -0,0 +1,358 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_fbpool.c
+ * @addtogroup video_common Overview
+ * @{
+ *
+ * Frame buffer pool. See xvidc_fbpool.h for a description.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.16  sb   10/19/26 First release
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+
+#include "xil_assert.h"
+#include "xil_io.h"
+#include "xstatus.h"
+#include "xvidc_fbpool.h"
+
+/**************************** Function Prototypes *****************************/
+
+static void XVidC_FbQueuePut(XVidC_FbQueue *QueuePtr,
+		const XVidC_FbFrame *FramePtr);
+static int XVidC_FbQueueGet(XVidC_FbQueue *QueuePtr, XVidC_FbFrame *FramePtr);
+
+/*************************** Function Definitions *****************************/
+
+/******************************************************************************/
+/**
+ * This function initializes a frame buffer pool. All buffers start on the
+ * free queue.
+ *
+ * @param	PoolPtr is a pointer to the pool to be initialized.
+ * @param	Buffers is the array of buffers, copied into the pool.
+ * @param	NumBuffers is the number of buffers.
+ *
+ * @return
+ *		- XST_SUCCESS if the pool was initialized.
+ *		- XST_INVALID_PARAM if NumBuffers is 0 or larger than
+ *		  XVIDC_FBPOOL_MAX_BUFFERS.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+int XVidC_FbPoolInitialize(XVidC_FbPool *PoolPtr,
+		const XVidC_FbBuffer *Buffers, u32 NumBuffers)
+{
+	XVidC_FbFrame Frame;
+	u32 Index;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(PoolPtr != NULL);
+	Xil_AssertNonvoid(Buffers != NULL);
+
+	if ((NumBuffers == 0) || (NumBuffers > XVIDC_FBPOOL_MAX_BUFFERS)) {
+		return XST_INVALID_PARAM;
+	}
+
+	PoolPtr->NumBuffers = NumBuffers;
+	PoolPtr->Free.Prod = 0;
+	PoolPtr->Free.Cons = 0;
+	PoolPtr->Ready.Prod = 0;
+	PoolPtr->Ready.Cons = 0;
+	PoolPtr->GetTime = NULL;
+
+	Frame.Seq = 0;
+	Frame.Timestamp = 0;
+	for (Index = 0; Index < NumBuffers; Index++) {
+		PoolPtr->Buf[Index] = Buffers[Index];
+		Frame.Idx = Index;
+		XVidC_FbQueuePut(&PoolPtr->Free, &Frame);
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function installs the time source used to timestamp published frames.
+ *
+ * @param	PoolPtr is a pointer to the pool.
+ * @param	TimeFunc returns a free running tick count, NULL for none.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_FbPoolSetTimer(XVidC_FbPool *PoolPtr, XVidC_FbTimeFunc TimeFunc)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(PoolPtr != NULL);
+
+	PoolPtr->GetTime = TimeFunc;
+}
+
+/******************************************************************************/
+/**
+ * This function returns the planes of a pool buffer.
+ *
+ * @param	PoolPtr is a pointer to the pool.
+ * @param	Idx is the buffer index.
+ *
+ * @return	A pointer to the buffer.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+const XVidC_FbBuffer *XVidC_FbPoolGetBuffer(const XVidC_FbPool *PoolPtr,
+		u32 Idx)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(PoolPtr != NULL);
+	Xil_AssertNonvoid(Idx < PoolPtr->NumBuffers);
+
+	return &PoolPtr->Buf[Idx];
+}
+
+/******************************************************************************/
+/**
+ * This function takes a buffer from the free queue. The caller owns it until
+ * it passes it to XVidC_FbPoolPublish().
+ *
+ * @param	PoolPtr is a pointer to the pool.
+ * @param	IdxPtr is where the buffer index is returned.
+ *
+ * @return
+ *		- XST_SUCCESS if a buffer was taken.
+ *		- XST_NO_DATA if no buffer is free.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+int XVidC_FbPoolGetFree(XVidC_FbPool *PoolPtr, u32 *IdxPtr)
+{
+	XVidC_FbFrame Frame;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(PoolPtr != NULL);
+	Xil_AssertNonvoid(IdxPtr != NULL);
+
+	if (XVidC_FbQueueGet(&PoolPtr->Free, &Frame) != XST_SUCCESS) {
+		return XST_NO_DATA;
+	}
+	*IdxPtr = Frame.Idx;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function hands a filled buffer to the consumer. The frame is stamped
+ * with the current time if a time source is installed.
+ *
+ * @param	PoolPtr is a pointer to the pool.
+ * @param	Idx is the buffer index, as returned by XVidC_FbPoolGetFree().
+ * @param	Seq is the frame number of the producer.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_FbPoolPublish(XVidC_FbPool *PoolPtr, u32 Idx, u32 Seq)
+{
+	XVidC_FbFrame Frame;
+
+	/* Verify arguments. */
+	Xil_AssertVoid(PoolPtr != NULL);
+	Xil_AssertVoid(Idx < PoolPtr->NumBuffers);
+
+	Frame.Idx = Idx;
+	Frame.Seq = Seq;
+	Frame.Timestamp = (PoolPtr->GetTime != NULL) ? PoolPtr->GetTime() : 0;
+	XVidC_FbQueuePut(&PoolPtr->Ready, &Frame);
+}
+
+/******************************************************************************/
+/**
+ * This function returns the number of frames waiting to be acquired.
+ *
+ * @param	PoolPtr is a pointer to the pool.
+ *
+ * @return	Number of ready frames.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u32 XVidC_FbPoolGetReadyCount(const XVidC_FbPool *PoolPtr)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(PoolPtr != NULL);
+
+	return PoolPtr->Ready.Prod - PoolPtr->Ready.Cons;
+}
+
+/******************************************************************************/
+/**
+ * This function takes the oldest ready frame. The caller owns its buffer
+ * until it passes it to XVidC_FbPoolRelease().
+ *
+ * @param	PoolPtr is a pointer to the pool.
+ * @param	FramePtr is where the frame descriptor is returned.
+ *
+ * @return
+ *		- XST_SUCCESS if a frame was taken.
+ *		- XST_NO_DATA if no frame is ready.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+int XVidC_FbPoolAcquire(XVidC_FbPool *PoolPtr, XVidC_FbFrame *FramePtr)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(PoolPtr != NULL);
+	Xil_AssertNonvoid(FramePtr != NULL);
+
+	return XVidC_FbQueueGet(&PoolPtr->Ready, FramePtr);
+}
+
+/******************************************************************************/
+/**
+ * This function takes the newest ready frame and releases the older ones,
+ * for consumers such as a display that only need the latest frame.
+ *
+ * @param	PoolPtr is a pointer to the pool.
+ * @param	FramePtr is where the frame descriptor is returned.
+ * @param	SkippedPtr is where the number of released older frames is
+ *		returned. It may be NULL.
+ *
+ * @return
+ *		- XST_SUCCESS if a frame was taken.
+ *		- XST_NO_DATA if no frame is ready.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+int XVidC_FbPoolAcquireLatest(XVidC_FbPool *PoolPtr, XVidC_FbFrame *FramePtr,
+		u32 *SkippedPtr)
+{
+	u32 Skipped = 0;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(PoolPtr != NULL);
+	Xil_AssertNonvoid(FramePtr != NULL);
+
+	if (XVidC_FbQueueGet(&PoolPtr->Ready, FramePtr) != XST_SUCCESS) {
+		return XST_NO_DATA;
+	}
+	while (PoolPtr->Ready.Prod != PoolPtr->Ready.Cons) {
+		XVidC_FbQueuePut(&PoolPtr->Free, FramePtr);
+		(void)XVidC_FbQueueGet(&PoolPtr->Ready, FramePtr);
+		Skipped++;
+	}
+
+	if (SkippedPtr != NULL) {
+		*SkippedPtr = Skipped;
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function gives a consumed buffer back to the producer.
+ *
+ * @param	PoolPtr is a pointer to the pool.
+ * @param	Idx is the buffer index of an acquired frame.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_FbPoolRelease(XVidC_FbPool *PoolPtr, u32 Idx)
+{
+	XVidC_FbFrame Frame;
+
+	/* Verify arguments. */
+	Xil_AssertVoid(PoolPtr != NULL);
+	Xil_AssertVoid(Idx < PoolPtr->NumBuffers);
+
+	Frame.Idx = Idx;
+	Frame.Seq = 0;
+	Frame.Timestamp = 0;
+	XVidC_FbQueuePut(&PoolPtr->Free, &Frame);
+}
+
+/******************************************************************************/
+/**
+ * This function adds an entry to a queue. A queue holds all buffers of the
+ * pool, so it cannot overflow.
+ *
+ * @param	QueuePtr is a pointer to the queue.
+ * @param	FramePtr is the entry.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XVidC_FbQueuePut(XVidC_FbQueue *QueuePtr,
+		const XVidC_FbFrame *FramePtr)
+{
+	u32 Prod = QueuePtr->Prod;
+
+	Xil_AssertVoid((Prod - QueuePtr->Cons) < XVIDC_FBPOOL_MAX_BUFFERS);
+
+	QueuePtr->Desc[Prod & (XVIDC_FBPOOL_MAX_BUFFERS - 1)] = *FramePtr;
+
+	/* Buffer and entry are complete before the consumer can see them */
+	DATA_SYNC;
+	QueuePtr->Prod = Prod + 1;
+}
+
+/******************************************************************************/
+/**
+ * This function removes the oldest entry of a queue.
+ *
+ * @param	QueuePtr is a pointer to the queue.
+ * @param	FramePtr is where the entry is returned.
+ *
+ * @return
+ *		- XST_SUCCESS if an entry was removed.
+ *		- XST_NO_DATA if the queue is empty.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static int XVidC_FbQueueGet(XVidC_FbQueue *QueuePtr, XVidC_FbFrame *FramePtr)
+{
+	u32 Cons = QueuePtr->Cons;
+
+	if (Cons == QueuePtr->Prod) {
+		return XST_NO_DATA;
+	}
+
+	*FramePtr = QueuePtr->Desc[Cons & (XVIDC_FBPOOL_MAX_BUFFERS - 1)];
+
+	/* Entry is read before the producer can reuse its slot */
+	DATA_SYNC;
+	QueuePtr->Cons = Cons + 1;
+
+	return XST_SUCCESS;
+}
+/** @} */
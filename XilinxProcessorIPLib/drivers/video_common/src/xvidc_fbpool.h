@@ -0,0 +1,151 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_fbpool.h
+ * @addtogroup video_common Overview
+ * @{
+ * @details
+ *
+ * Frame buffer pool shared by the frame buffer write and read drivers.
+ *
+ * A pool holds up to XVIDC_FBPOOL_MAX_BUFFERS video buffers, each made of up
+ * to three planes. A buffer is owned by one party at a time and changes hands
+ * through two single-producer, single-consumer queues:
+ *
+ * - Free: buffers the producer may fill.
+ * - Ready: filled frames, in the order they were completed, each with its
+ *   sequence number and completion time.
+ *
+ * The producer takes a buffer with XVidC_FbPoolGetFree() and hands the filled
+ * frame over with XVidC_FbPoolPublish(). The consumer takes frames with
+ * XVidC_FbPoolAcquire() or XVidC_FbPoolAcquireLatest() and gives the buffer
+ * back with XVidC_FbPoolRelease(). Publish and release are the fences of the
+ * pool: the memory barrier they execute makes everything the producer or the
+ * consumer did with the buffer visible before the buffer changes hands, and
+ * nobody else touches a buffer between acquire and release.
+ *
+ * The frame buffer write driver can be the producer and the frame buffer read
+ * driver the consumer of a pool, see XVFrmbufWr_SetPool() and
+ * XVFrmbufRd_SetPool(). They then program the next buffer from their done
+ * interrupt. Attaching both to one pool hands captured frames to the display
+ * without copying them. Either side may also be the application.
+ *
+ * Each queue must be used by one producer and one consumer context. Buffer
+ * contents accessed by the CPU need cache maintenance by the application.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.16  sb   10/19/26 First release
+ * </pre>
+ *
+*******************************************************************************/
+
+#ifndef XVIDC_FBPOOL_H_  /* Prevent circular inclusions by using protection macros. */
+#define XVIDC_FBPOOL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************* Include Files ********************************/
+
+#include "xil_types.h"
+
+/************************** Constant Definitions ******************************/
+
+/** Maximum number of buffers of a pool, the size of its queues */
+#define XVIDC_FBPOOL_MAX_BUFFERS	16U
+
+/** No buffer */
+#define XVIDC_FBPOOL_NONE		0xFFFFFFFFU
+
+/****************************** Type Definitions ******************************/
+
+/**
+ * Planes of a pool buffer.
+ */
+typedef struct {
+	UINTPTR LumaAddr;	/**< Luma or packed plane */
+	UINTPTR ChromaAddr;	/**< UV or U plane, 0 if not used */
+	UINTPTR VChromaAddr;	/**< V plane, 0 if not used */
+} XVidC_FbBuffer;
+
+/**
+ * Frame descriptor, the entry of the pool queues.
+ */
+typedef struct {
+	u32 Idx;		/**< Buffer index in the pool */
+	u32 Seq;		/**< Frame number given by the producer */
+	u64 Timestamp;		/**< Time of XVidC_FbPoolPublish() */
+} XVidC_FbFrame;
+
+/**
+ * Single-producer, single-consumer queue of frame descriptors. Prod and Cons
+ * run freely and are masked when indexing Desc.
+ */
+typedef struct {
+	XVidC_FbFrame Desc[XVIDC_FBPOOL_MAX_BUFFERS];	/**< Entries */
+	volatile u32 Prod;	/**< Entries produced */
+	volatile u32 Cons;	/**< Entries consumed */
+} XVidC_FbQueue;
+
+/**
+ * Time source of a pool, returns a free running tick count.
+ */
+typedef u64 (*XVidC_FbTimeFunc)(void);
+
+/**
+ * Frame buffer pool.
+ */
+typedef struct {
+	XVidC_FbBuffer Buf[XVIDC_FBPOOL_MAX_BUFFERS];	/**< Buffers */
+	u32 NumBuffers;			/**< Number of buffers */
+	XVidC_FbQueue Free;		/**< Buffers to be filled */
+	XVidC_FbQueue Ready;		/**< Filled frames */
+	XVidC_FbTimeFunc GetTime;	/**< Time source, NULL if none */
+} XVidC_FbPool;
+
+/**
+ * Frame statistics of a core attached to a pool.
+ */
+typedef struct {
+	u32 Frames;	/**< Frames completed by the core */
+	u32 Drops;	/**< Frames lost. Writer: a frame was overwritten for
+			  *  lack of a free buffer. Reader: a ready frame was
+			  *  skipped for a newer one */
+	u32 Repeats;	/**< Reader: frames read again for lack of a new one */
+} XVidC_FbStats;
+
+/**************************** Function Prototypes *****************************/
+
+int XVidC_FbPoolInitialize(XVidC_FbPool *PoolPtr,
+		const XVidC_FbBuffer *Buffers, u32 NumBuffers);
+void XVidC_FbPoolSetTimer(XVidC_FbPool *PoolPtr, XVidC_FbTimeFunc TimeFunc);
+const XVidC_FbBuffer *XVidC_FbPoolGetBuffer(const XVidC_FbPool *PoolPtr,
+		u32 Idx);
+
+/* Producer side */
+int XVidC_FbPoolGetFree(XVidC_FbPool *PoolPtr, u32 *IdxPtr);
+void XVidC_FbPoolPublish(XVidC_FbPool *PoolPtr, u32 Idx, u32 Seq);
+
+/* Consumer side */
+u32 XVidC_FbPoolGetReadyCount(const XVidC_FbPool *PoolPtr);
+int XVidC_FbPoolAcquire(XVidC_FbPool *PoolPtr, XVidC_FbFrame *FramePtr);
+int XVidC_FbPoolAcquireLatest(XVidC_FbPool *PoolPtr, XVidC_FbFrame *FramePtr,
+		u32 *SkippedPtr);
+void XVidC_FbPoolRelease(XVidC_FbPool *PoolPtr, u32 Idx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XVIDC_FBPOOL_H_ */
+/** @} */
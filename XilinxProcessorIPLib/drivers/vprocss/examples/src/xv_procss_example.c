@@ -38,6 +38,13 @@
 *     after several seconds the test reports "FAILED"
 *  4) Optionally, go back and set up the next use case, repeating steps 1,2,3.
 *
+* The use cases are run SWITCH_PASSES times. For each one the time taken by
+* the VPSS setup call and the time from that call to video lock are printed.
+* The first pass configures the VPSS with XVprocSs_CreatePlan(), which shows
+* a resolution switch with cold scaler tables and records a plan per use
+* case. The following passes switch with XVprocSs_ApplyPlan(), which replays
+* the plan and takes the H scaler phases from its phase cache.
+*
 ******************************************************************************/
 
 #include <stdio.h>
@@ -45,6 +52,7 @@
 #include "xparameters.h"
 #include "system.h"
 #include "xvprocss_vdma.h"
+#include "xiltimer.h"
 
 #if XPAR_XCLK_WIZ_NUM_INSTANCES
 #include "xclk_wiz.h"
@@ -55,6 +63,7 @@
 #define VERBOSE_MODE 0
 #define TOPOLOGY_COUNT 6
 #define USECASE_COUNT 2
+#define SWITCH_PASSES 2
 #define VIDEO_MONITOR_LOCK_TIMEOUT (2000000)
 
 #define PROC_DELAY 2
@@ -169,11 +178,14 @@ static void check_usecase(XVprocSs *VpssPtr, vpssVideo *useCase);
 static int setup_video_io(
 	XPeriph *PeriphPtr, XVprocSs *VpssPtr, vpssVideo *useCase);
 
-static int start_system(XPeriph *PeriphPtr, XVprocSs *VpssPtr);
+static int start_system(XPeriph *PeriphPtr, XVprocSs *VpssPtr,
+			XVprocSs_Plan *PlanPtr, int UsePlan);
 
 /************************** Variable Definitions *****************************/
 XPeriph  PeriphInst;
 XVprocSs VprocInst;
+XV_HscalerPhaseEntry PhaseCache[USECASE_COUNT];
+XVprocSs_Plan Plan[USECASE_COUNT];
 const char topo_name[XVPROCSS_TOPOLOGY_NUM_SUPPORTED][32] = {
 	"Scaler-only",
 	"Full",
@@ -648,6 +660,7 @@ int main(void)
 	int status, cnt;
 	u32 Timeout, errors;
 	static int Lock = FALSE;
+	XTime SetupStart, SetupEnd, LockTime;
 
 	/* Bind instance pointer with definition */
 	PeriphPtr = &PeriphInst;
@@ -665,19 +678,27 @@ int main(void)
 		xil_printf("CRITICAL ERROR:: System Init Failed. Cannot recover from this error. Check HW\n\r");
 	}
 
+	/* Let the H scaler keep the phase tables of all use cases */
+	if (VpssPtr->HscalerPtr != NULL) {
+		XV_HScalerSetPhaseCache(VpssPtr->HscalerPtr, PhaseCache,
+					USECASE_COUNT);
+	}
+
 	/* Based on the customized Video Processing Subsystem functionality
 	 * the video input and output formats are chosen.
 	 */
 
 	status = errors = 0;
 	cnt = 0;
-	while (cnt < USECASE_COUNT) {
+	while (cnt < (USECASE_COUNT * SWITCH_PASSES)) {
 		xil_printf("--------------------------------------------------------\r\n");
-		printf("Topology is %s, case %d\r\n", topo_name[VpssPtr->Config.Topology], cnt + 1);
+		printf("Topology is %s, case %d, pass %d\r\n",
+		       topo_name[VpssPtr->Config.Topology],
+		       (cnt % USECASE_COUNT) + 1, (cnt / USECASE_COUNT) + 1);
 
 		reset_video_ips();
 
-		thisCase = &useCase[VpssPtr->Config.Topology][cnt];
+		thisCase = &useCase[VpssPtr->Config.Topology][cnt % USECASE_COUNT];
 
 		switch (VpssPtr->Config.Topology) {
 			case XVPROCSS_TOPOLOGY_SCALER_ONLY:
@@ -768,23 +789,24 @@ int main(void)
 		XPeriph_ConfigTpg(PeriphPtr);
 
 		xil_printf("\n\rStart VPSS...");
-		status = start_system(PeriphPtr, VpssPtr);
+		XTime_GetTime(&SetupStart);
+		status = start_system(PeriphPtr, VpssPtr,
+				      &Plan[cnt % USECASE_COUNT],
+				      (cnt >= USECASE_COUNT));
+		XTime_GetTime(&SetupEnd);
+		LockTime = SetupEnd;
 
 		if (status != XST_SUCCESS) {
 			xil_printf("\r\nERROR:: Test Failed\r\n");
 			xil_printf("    ->VProcss Configuration Failed. \r\n");
 		}
 
-		xil_printf("Done...\n\r");
-
-		XVprocSs_ReportSubsystemConfig(VpssPtr);
-
 		/* check for output lock */
-		xil_printf("Waiting for lock... ");
 		Timeout = VIDEO_MONITOR_LOCK_TIMEOUT;
 		while (!Lock && Timeout) {
 			status = XPeriph_IsVideoLocked(PeriphPtr);
 			if (status & 0x1) {
+				XTime_GetTime(&LockTime);
 				xil_printf("Locked.\r\n");
 				Lock = TRUE;
 			} else if (status & 0x2) {
@@ -806,9 +828,16 @@ int main(void)
 			errors++;
 			xil_printf("\r\nERROR:: Test Failed\r\n");
 		} else {
+			xil_printf("Setup call: %d us, lock: %d us after setup call\r\n",
+				   (u32)(((SetupEnd - SetupStart) * 1000000) /
+					 COUNTS_PER_SECOND),
+				   (u32)(((LockTime - SetupStart) * 1000000) /
+					 COUNTS_PER_SECOND));
 			xil_printf("\r\nTest Completed Successfully\r\n");
 		}
 
+		XVprocSs_ReportSubsystemConfig(VpssPtr);
+
 		XVprocSs_Stop(VpssPtr);
 
 		// In the Deint-only configuration, it is necessary to allow
@@ -826,7 +855,8 @@ int main(void)
 		XVprocSs_LogDisplay(VpssPtr);
 #endif
 
-		xil_printf ("End testing this use case %d.\r\n\r\n", (cnt+1));
+		xil_printf ("End testing this use case %d.\r\n\r\n",
+			    (cnt % USECASE_COUNT) + 1);
 		Lock = FALSE;
 		cnt++;
 	}
@@ -906,12 +936,14 @@ static int setup_video_io(XPeriph *PeriphPtr, XVprocSs *VpssPtr,
 *
 * @local routine start_system()
 *
-*  Configure and Start the video system.
+*  Configure and Start the video system. The first time a use case is run
+*  its plan is created, later runs apply the plan.
 *
 *  @return Returns XST_SUCCESS for successful configuration, else XST_FAILURE.
 *
 ******************************************************************************/
-static int start_system(XPeriph *PeriphPtr, XVprocSs *VpssPtr)
+static int start_system(XPeriph *PeriphPtr, XVprocSs *VpssPtr,
+			XVprocSs_Plan *PlanPtr, int UsePlan)
 {
 	int status;
 	// For single-IP VPSS cases only, reset is handled outside vpss
@@ -925,7 +957,12 @@ static int start_system(XPeriph *PeriphPtr, XVprocSs *VpssPtr)
 
 	// Configure and Start the VPSS IP
 	// (reset logic for multi-IP VPSS cases is done here)
-	status = XVprocSs_SetSubsystemConfig(VpssPtr);
+	if (UsePlan) {
+		status = XVprocSs_ApplyPlan(VpssPtr, PlanPtr);
+	} else {
+		status = XVprocSs_CreatePlan(VpssPtr, &VpssPtr->VidIn,
+					     &VpssPtr->VidOut, PlanPtr);
+	}
 
 	return status;
 }
@@ -38,6 +38,9 @@
 * 2.40  vyc  10/04/17   Added support for conversion from 420/422/444/RGB to
 *                       420/422/444/RGB with CSC-only topology
 * 2.50  vyc  04/04/18   Fix for HScaler setup with 420 input
+* 2.14  sb   10/19/26   Added XVprocSs_CreatePlan and XVprocSs_ApplyPlan to
+*                       switch between known formats without validating and
+*                       computing the sub-core settings again
 *
 * </pre>
 *
@@ -149,6 +152,11 @@ static int SetupModeDeintOnly(XVprocSs *XVprocSsPtr);
 static int SetupModeVCResampleOnly(XVprocSs *XVprocSsPtr);
 static int SetupModeHCResampleOnly(XVprocSs *XVprocSsPtr);
 static int SetupModeMax(XVprocSs *XVprocSsPtr);
+static void PlanAddRegs(XVprocSs_Plan *PlanPtr,
+                        UINTPTR BaseAddr,
+                        u32 Offset,
+                        u32 Count,
+                        u32 Stride);
 
 /***************** Macros (Inline Functions) Definitions *********************/
 /*****************************************************************************/
@@ -1893,6 +1901,314 @@ int XVprocSs_SetSubsystemConfig(XVprocSs *InstancePtr)
   return(status);
 }
 
+/*****************************************************************************/
+/**
+* This function appends sub-core registers, read back from the core, to the
+* register list of a plan
+*
+* @param  PlanPtr is a pointer to the plan being created
+* @param  BaseAddr is the base address of the sub-core
+* @param  Offset is the offset of the first register
+* @param  Count is the number of registers
+* @param  Stride is the address increment between two registers
+*
+* @return None
+*
+******************************************************************************/
+static void PlanAddRegs(XVprocSs_Plan *PlanPtr,
+                        UINTPTR BaseAddr,
+                        u32 Offset,
+                        u32 Count,
+                        u32 Stride)
+{
+  u32 index;
+
+  Xil_AssertVoid((PlanPtr->NumRegs + Count) <= XVPROCSS_PLAN_MAX_REGS);
+
+  for(index=0; index<Count; ++index)
+  {
+    PlanPtr->RegAddr[PlanPtr->NumRegs]  = BaseAddr + Offset + (index*Stride);
+    PlanPtr->RegValue[PlanPtr->NumRegs] = Xil_In32(BaseAddr + Offset + (index*Stride));
+    PlanPtr->NumRegs++;
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function configures the subsystem for an input/output stream pair and
+* records the resulting configuration in a plan. Later switches to this stream
+* pair can use XVprocSs_ApplyPlan() instead of XVprocSs_SetSubsystemConfig()
+*
+* @param  InstancePtr is a pointer to the Subsystem instance to be worked on.
+* @param  StrmIn is the pointer to the input stream configuration
+* @param  StrmOut is the pointer to the output stream configuration
+* @param  PlanPtr is a pointer to the plan to be created
+*
+* @return XST_SUCCESS if the plan was created else XST_FAILURE
+*
+* @note The subsystem is configured exactly as by XVprocSs_SetSubsystemConfig()
+*       and runs the stream pair when this function returns. The registers are
+*       recorded by reading them back from the sub-cores. The current PIP/Zoom
+*       settings are part of the plan
+*
+******************************************************************************/
+int XVprocSs_CreatePlan(XVprocSs *InstancePtr,
+                        const XVidC_VideoStream *StrmIn,
+                        const XVidC_VideoStream *StrmOut,
+                        XVprocSs_Plan *PlanPtr)
+{
+  u8 *StartCorePtr;
+  UINTPTR BaseAddr;
+  u32 count;
+  int status;
+
+  /* Verify arguments */
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(StrmIn != NULL);
+  Xil_AssertNonvoid(StrmOut != NULL);
+  Xil_AssertNonvoid(PlanPtr != NULL);
+
+  PlanPtr->IsValid = FALSE;
+
+  XVprocSs_SetVidStreamIn(InstancePtr, StrmIn);
+  XVprocSs_SetVidStreamOut(InstancePtr, StrmOut);
+
+  status = XVprocSs_SetSubsystemConfig(InstancePtr);
+  if(status != XST_SUCCESS) {
+    XVprocSs_LogWrite(InstancePtr, XVPROCSS_EVT_CREATE_PLAN, XVPROCSS_EDAT_FAILURE);
+    return(status);
+  }
+
+  PlanPtr->BaseAddress = InstancePtr->Config.BaseAddress;
+  PlanPtr->VidIn       = InstancePtr->VidIn;
+  PlanPtr->VidOut      = InstancePtr->VidOut;
+  PlanPtr->CtxtData    = InstancePtr->CtxtData;
+  StartCorePtr = &PlanPtr->CtxtData.StartCore[0];
+
+  /* Single-IP topologies start their cores directly, mark them to start */
+  switch(XVprocSs_GetSubsystemTopology(InstancePtr))
+  {
+    case XVPROCSS_TOPOLOGY_SCALER_ONLY:
+      StartCorePtr[XVPROCSS_SUBCORE_SCALER_V] = TRUE;
+      StartCorePtr[XVPROCSS_SUBCORE_SCALER_H] = TRUE;
+      break;
+
+    case XVPROCSS_TOPOLOGY_CSC_ONLY:
+      StartCorePtr[XVPROCSS_SUBCORE_CSC] = TRUE;
+      break;
+
+    case XVPROCSS_TOPOLOGY_DEINTERLACE_ONLY:
+      StartCorePtr[XVPROCSS_SUBCORE_DEINT] = TRUE;
+      break;
+
+    case XVPROCSS_TOPOLOGY_VCRESAMPLE_ONLY:
+      StartCorePtr[XVPROCSS_SUBCORE_CR_V_IN] = TRUE;
+      break;
+
+    case XVPROCSS_TOPOLOGY_HCRESAMPLE_ONLY:
+      StartCorePtr[XVPROCSS_SUBCORE_CR_H] = TRUE;
+      break;
+
+    default:
+      break;
+  }
+
+  /* Router connections */
+  PlanPtr->NumMi = 0;
+  if(XVprocSs_IsConfigModeMax(InstancePtr) && InstancePtr->RouterPtr) {
+    Xil_AssertNonvoid(InstancePtr->RouterPtr->Config.MaxNumMI <= XVPROCSS_PLAN_MAX_MI);
+
+    PlanPtr->NumMi = InstancePtr->RouterPtr->Config.MaxNumMI;
+    for(count=0; count<PlanPtr->NumMi; ++count) {
+      PlanPtr->RouterMux[count] =
+        XAxisScr_ReadReg(InstancePtr->RouterPtr->Config.BaseAddress,
+                         XAXIS_SCR_MI_MUX_START_OFFSET + (count*4));
+    }
+  }
+
+  /* Parameter registers of the cores in the processing path */
+  PlanPtr->NumRegs = 0;
+
+  if(StartCorePtr[XVPROCSS_SUBCORE_DEINT]) {
+    BaseAddr = InstancePtr->DeintPtr->Deint.Config.BaseAddress;
+    PlanAddRegs(PlanPtr, BaseAddr, XV_DEINTERLACER_CTRL_ADDR_WIDTH_DATA, 2, 8);
+    PlanAddRegs(PlanPtr, BaseAddr, XV_DEINTERLACER_CTRL_ADDR_READ_FB_V_DATA, 2, 4);
+    PlanAddRegs(PlanPtr, BaseAddr, XV_DEINTERLACER_CTRL_ADDR_COLORFORMAT_DATA, 3, 8);
+    PlanAddRegs(PlanPtr, BaseAddr, XV_DEINTERLACER_CTRL_ADDR_WRITE_FB_V_DATA, 2, 4);
+  }
+
+  if(StartCorePtr[XVPROCSS_SUBCORE_CR_V_IN]) {
+    BaseAddr = InstancePtr->VcrsmplrInPtr->Vcr.Config.BaseAddress;
+    PlanAddRegs(PlanPtr, BaseAddr, XV_VCRESAMPLER_CTRL_ADDR_HWREG_WIDTH_DATA, 4, 8);
+    if(InstancePtr->VcrsmplrInPtr->Vcr.Config.ResamplingType == XV_VCRSMPLR_TYPE_FIR) {
+      PlanAddRegs(PlanPtr, BaseAddr, XV_VCRESAMPLER_CTRL_ADDR_HWREG_COEFS_0_0_DATA,
+                  XV_VCRSMPLR_MAX_PHASES * InstancePtr->VcrsmplrInPtr->Vcr.Config.NumTaps, 8);
+    }
+  }
+
+  if(StartCorePtr[XVPROCSS_SUBCORE_LBOX]) {
+    BaseAddr = InstancePtr->LboxPtr->Lbox.Config.BaseAddress;
+    count = ((XV_LETTERBOX_CTRL_ADDR_HWREG_CR_B_VALUE_DATA -
+              XV_LETTERBOX_CTRL_ADDR_HWREG_WIDTH_DATA)/8) + 1;
+    PlanAddRegs(PlanPtr, BaseAddr, XV_LETTERBOX_CTRL_ADDR_HWREG_WIDTH_DATA, count, 8);
+  }
+
+  if(StartCorePtr[XVPROCSS_SUBCORE_CR_H]) {
+    BaseAddr = InstancePtr->HcrsmplrPtr->Hcr.Config.BaseAddress;
+    PlanAddRegs(PlanPtr, BaseAddr, XV_HCRESAMPLER_CTRL_ADDR_HWREG_WIDTH_DATA, 4, 8);
+    if(InstancePtr->HcrsmplrPtr->Hcr.Config.ResamplingType == XV_HCRSMPLR_TYPE_FIR) {
+      PlanAddRegs(PlanPtr, BaseAddr, XV_HCRESAMPLER_CTRL_ADDR_HWREG_COEFS_0_0_DATA,
+                  XV_HCRSMPLR_MAX_PHASES * InstancePtr->HcrsmplrPtr->Hcr.Config.NumTaps, 8);
+    }
+  }
+
+  if(StartCorePtr[XVPROCSS_SUBCORE_CSC]) {
+    BaseAddr = InstancePtr->CscPtr->Csc.Config.BaseAddress;
+    count = ((XV_CSC_CTRL_ADDR_HWREG_CLIPMAX_2_V_DATA -
+              XV_CSC_CTRL_ADDR_HWREG_INVIDEOFORMAT_DATA)/8) + 1;
+    PlanAddRegs(PlanPtr, BaseAddr, XV_CSC_CTRL_ADDR_HWREG_INVIDEOFORMAT_DATA, count, 8);
+    PlanPtr->Csc = *InstancePtr->CscPtr;
+  }
+
+  if(StartCorePtr[XVPROCSS_SUBCORE_CR_V_OUT]) {
+    BaseAddr = InstancePtr->VcrsmplrOutPtr->Vcr.Config.BaseAddress;
+    PlanAddRegs(PlanPtr, BaseAddr, XV_VCRESAMPLER_CTRL_ADDR_HWREG_WIDTH_DATA, 4, 8);
+    if(InstancePtr->VcrsmplrOutPtr->Vcr.Config.ResamplingType == XV_VCRSMPLR_TYPE_FIR) {
+      PlanAddRegs(PlanPtr, BaseAddr, XV_VCRESAMPLER_CTRL_ADDR_HWREG_COEFS_0_0_DATA,
+                  XV_VCRSMPLR_MAX_PHASES * InstancePtr->VcrsmplrOutPtr->Vcr.Config.NumTaps, 8);
+    }
+  }
+
+  /* Scalers are set up through their drivers, which keep track of the
+   * coefficient and phase tables loaded in the core
+   */
+  if(StartCorePtr[XVPROCSS_SUBCORE_SCALER_V]) {
+    PlanPtr->VscWidth     = XV_vscaler_Get_HwReg_Width(&InstancePtr->VscalerPtr->Vsc);
+    PlanPtr->VscHeightIn  = XV_vscaler_Get_HwReg_HeightIn(&InstancePtr->VscalerPtr->Vsc);
+    PlanPtr->VscHeightOut = XV_vscaler_Get_HwReg_HeightOut(&InstancePtr->VscalerPtr->Vsc);
+    PlanPtr->VscCformat   = XV_vscaler_Get_HwReg_ColorMode(&InstancePtr->VscalerPtr->Vsc);
+  }
+
+  if(StartCorePtr[XVPROCSS_SUBCORE_SCALER_H]) {
+    PlanPtr->HscHeight     = XV_hscaler_Get_HwReg_Height(&InstancePtr->HscalerPtr->Hsc);
+    PlanPtr->HscWidthIn    = XV_hscaler_Get_HwReg_WidthIn(&InstancePtr->HscalerPtr->Hsc);
+    PlanPtr->HscWidthOut   = XV_hscaler_Get_HwReg_WidthOut(&InstancePtr->HscalerPtr->Hsc);
+    PlanPtr->HscCformatIn  = XV_hscaler_Get_HwReg_ColorMode(&InstancePtr->HscalerPtr->Hsc);
+    PlanPtr->HscCformatOut = XV_hscaler_Get_HwReg_ColorModeOut(&InstancePtr->HscalerPtr->Hsc);
+  }
+
+  PlanPtr->IsValid = TRUE;
+  XVprocSs_LogWrite(InstancePtr, XVPROCSS_EVT_CREATE_PLAN, XVPROCSS_EDAT_SUCCESS);
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function switches the subsystem to the stream pair of a plan created by
+* XVprocSs_CreatePlan(). The subsystem goes through the same reset sequence as
+* with XVprocSs_SetSubsystemConfig(), then the recorded router and sub-core
+* registers are written back and the cores in the processing path are started.
+* Nothing is validated or computed again
+*
+* @param  InstancePtr is a pointer to the Subsystem instance to be worked on.
+* @param  PlanPtr is a pointer to the plan to apply
+*
+* @return XST_SUCCESS if the plan was applied
+*         XST_FAILURE if the plan was not created for this subsystem
+*
+* @note For single-IP topologies the reset is done outside the subsystem, as
+*       for XVprocSs_SetSubsystemConfig()
+*
+******************************************************************************/
+int XVprocSs_ApplyPlan(XVprocSs *InstancePtr,
+                       const XVprocSs_Plan *PlanPtr)
+{
+  XVprocSs_ContextData *CtxtPtr = &InstancePtr->CtxtData;
+  u8 *StartCorePtr;
+  u32 count;
+
+  /* Verify arguments */
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(PlanPtr != NULL);
+
+  if((!PlanPtr->IsValid) ||
+     (PlanPtr->BaseAddress != InstancePtr->Config.BaseAddress)) {
+    XVprocSs_LogWrite(InstancePtr, XVPROCSS_EVT_APPLY_PLAN, XVPROCSS_EDAT_FAILURE);
+    return(XST_FAILURE);
+  }
+
+  /* Reset the IP Blocks inside the VPSS */
+  if(XVprocSs_IsConfigModeMax(InstancePtr) ||
+     XVprocSs_IsConfigModeSscalerOnly(InstancePtr)) {
+    XVprocSs_Reset(InstancePtr);
+  }
+
+  InstancePtr->VidIn  = PlanPtr->VidIn;
+  InstancePtr->VidOut = PlanPtr->VidOut;
+  *CtxtPtr = PlanPtr->CtxtData;
+  StartCorePtr = &CtxtPtr->StartCore[0];
+
+  /* Set the Video Data Router registers */
+  if(PlanPtr->NumMi > 0) {
+    XAxisScr_RegUpdateDisable(InstancePtr->RouterPtr);
+    for(count=0; count<PlanPtr->NumMi; ++count) {
+      XAxisScr_WriteReg(InstancePtr->RouterPtr->Config.BaseAddress,
+                        XAXIS_SCR_MI_MUX_START_OFFSET + (count*4),
+                        PlanPtr->RouterMux[count]);
+    }
+    XAxisScr_RegUpdateEnable(InstancePtr->RouterPtr);
+  }
+
+  /* VDMA RD/WR Client needs to be programmed before Scaler */
+  if(StartCorePtr[XVPROCSS_SUBCORE_VDMA]) {
+    switch(CtxtPtr->ScaleMode) {
+      case XVPROCSS_SCALE_1_1:
+      case XVPROCSS_SCALE_UP:
+        XVprocSs_VdmaSetWinToUpScaleMode(InstancePtr, XVPROCSS_VDMA_UPDATE_ALL_CH);
+        break;
+
+      case XVPROCSS_SCALE_DN:
+        XVprocSs_VdmaSetWinToDnScaleMode(InstancePtr, XVPROCSS_VDMA_UPDATE_ALL_CH);
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  for(count=0; count<PlanPtr->NumRegs; ++count) {
+    Xil_Out32(PlanPtr->RegAddr[count], PlanPtr->RegValue[count]);
+  }
+
+  if(StartCorePtr[XVPROCSS_SUBCORE_CSC]) {
+    *InstancePtr->CscPtr = PlanPtr->Csc;
+  }
+
+  if(StartCorePtr[XVPROCSS_SUBCORE_SCALER_V]) {
+    (void)XV_VScalerSetup(InstancePtr->VscalerPtr,
+                          PlanPtr->VscWidth,
+                          PlanPtr->VscHeightIn,
+                          PlanPtr->VscHeightOut,
+                          PlanPtr->VscCformat);
+  }
+
+  if(StartCorePtr[XVPROCSS_SUBCORE_SCALER_H]) {
+    (void)XV_HScalerSetup(InstancePtr->HscalerPtr,
+                          PlanPtr->HscHeight,
+                          PlanPtr->HscWidthIn,
+                          PlanPtr->HscWidthOut,
+                          PlanPtr->HscCformatIn,
+                          PlanPtr->HscCformatOut);
+  }
+
+  /* Start all IP Blocks in the processing chain */
+  XVprocSs_Start(InstancePtr);
+
+  XVprocSs_LogWrite(InstancePtr, XVPROCSS_EVT_APPLY_PLAN, XVPROCSS_EDAT_SUCCESS);
+  return(XST_SUCCESS);
+}
+
 /*****************************************************************************/
 /**
 * This function returns picture brighntess setting
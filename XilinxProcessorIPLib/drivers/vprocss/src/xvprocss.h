@@ -134,6 +134,23 @@
 * responsible for triggering processing pipe update when any change in subsystem
 * configuration is performed at application level
 *
+* <b>Configuration Plans</b>
+*
+* XVprocSs_SetSubsystemConfig() validates the streams, builds the routing
+* table and computes the settings of every sub-core on each call. Systems
+* that switch between a small set of known formats can do this work once per
+* format. XVprocSs_CreatePlan() configures the subsystem for a stream pair
+* and records the result in a user allocated XVprocSs_Plan: the context data,
+* the router settings, the registers of the letterbox, CSC, chroma resampler
+* and deinterlacer cores, and the scaler setup parameters.
+* XVprocSs_ApplyPlan() later runs the reset sequence of the subsystem and
+* writes the recorded registers back, without validating or computing
+* anything. The scalers reload their coefficient and phase tables only if
+* they changed, see XV_HScalerSetPhaseCache(), and the VDMA channels are set
+* up from the restored context. A plan holds the PIP/Zoom settings in effect
+* when it was created and stays valid until the subsystem is initialized
+* again.
+*
 * <b>Log Capability</b>
 * Subsystem driver implements a logging feature that captures the interaction
 * between included sub-core(s) as the subsystem is being configured and started.
@@ -183,6 +200,7 @@
 *                       XVprocSs_SetFrameBufBaseaddr API
 * 2.30  rco  11/15/16   Make debug log optional (can be disabled via makefile)
 * 			 12/15/16   Added HasMADI configuration option
+* 2.14  sb   10/19/26   Added configuration plans
 *
 * </pre>
 *
@@ -406,6 +424,42 @@ typedef struct
 #endif
 } XVprocSs;
 
+/** Maximum number of sub-core registers recorded in a plan */
+#define XVPROCSS_PLAN_MAX_REGS      (160)
+
+/** Maximum number of AXIS switch master interfaces recorded in a plan */
+#define XVPROCSS_PLAN_MAX_MI        (16)
+
+/**
+ * Configuration plan for one input/output stream pair. The user allocates a
+ * variable of this type for each format to switch to, fills it with
+ * XVprocSs_CreatePlan() and passes it to XVprocSs_ApplyPlan().
+ */
+typedef struct
+{
+  u32 IsValid;                       /**< Plan has been created */
+  UINTPTR BaseAddress;               /**< Subsystem the plan belongs to */
+  XVidC_VideoStream VidIn;           /**< Input  AXIS configuration */
+  XVidC_VideoStream VidOut;          /**< Output AXIS configuration */
+  XVprocSs_ContextData CtxtData;     /**< Context of the configured pipe, with
+                                         the cores to start */
+  u32 NumMi;                         /**< Number of router mux registers */
+  u32 RouterMux[XVPROCSS_PLAN_MAX_MI]; /**< Router MI mux registers */
+  u32 NumRegs;                       /**< Number of recorded registers */
+  UINTPTR RegAddr[XVPROCSS_PLAN_MAX_REGS]; /**< Register addresses */
+  u32 RegValue[XVPROCSS_PLAN_MAX_REGS];    /**< Register values */
+  u32 HscHeight;                     /**< H scaler setup: input height */
+  u32 HscWidthIn;                    /**< H scaler setup: input width */
+  u32 HscWidthOut;                   /**< H scaler setup: output width */
+  u32 HscCformatIn;                  /**< H scaler setup: input format */
+  u32 HscCformatOut;                 /**< H scaler setup: output format */
+  u32 VscWidth;                      /**< V scaler setup: width */
+  u32 VscHeightIn;                   /**< V scaler setup: input height */
+  u32 VscHeightOut;                  /**< V scaler setup: output height */
+  u32 VscCformat;                    /**< V scaler setup: color format */
+  XV_Csc_l2 Csc;                     /**< CSC driver state */
+} XVprocSs_Plan;
+
 /************************** Macros Definitions *******************************/
 /*****************************************************************************/
 /**
@@ -604,6 +658,12 @@ int XVprocSs_CfgInitialize(XVprocSs *InstancePtr,
                            XVprocSs_Config *CfgPtr,
 						   UINTPTR EffectiveAddr);
 int XVprocSs_SetSubsystemConfig(XVprocSs *InstancePtr);
+int XVprocSs_CreatePlan(XVprocSs *InstancePtr,
+                        const XVidC_VideoStream *StrmIn,
+                        const XVidC_VideoStream *StrmOut,
+                        XVprocSs_Plan *PlanPtr);
+int XVprocSs_ApplyPlan(XVprocSs *InstancePtr,
+                       const XVprocSs_Plan *PlanPtr);
 #ifndef SDT
 XVprocSs_Config* XVprocSs_LookupConfig(u32 DeviceId);
 #else
@@ -24,6 +24,7 @@
  *                     etc.) severity from Info to Error
  * 2.30  rco  11/15/16 Make debug log optional (can be disabled via makefile)*
  * 2.40  vyc  10/04/17 Add 420 support in CSC-only topology
+ * 2.14  sb   10/19/26 Add configuration plan events
  * </pre>
  *
 *******************************************************************************/
@@ -212,6 +213,26 @@ void XVprocSs_LogDisplay(XVprocSs *InstancePtr)
 		case (XVPROCSS_EVT_STOP_VPSS):
 			xil_printf("Info: Subsystem stopped\r\n");
 			break;
+		case (XVPROCSS_EVT_CREATE_PLAN):
+			switch (Data) {
+			case (XVPROCSS_EDAT_SUCCESS):
+				xil_printf("Info: Configuration plan created\r\n");
+				break;
+			case (XVPROCSS_EDAT_FAILURE):
+				xil_printf("Error: Configuration plan not created\r\n");
+				break;
+			}
+			break;
+		case (XVPROCSS_EVT_APPLY_PLAN):
+			switch (Data) {
+			case (XVPROCSS_EDAT_SUCCESS):
+				xil_printf("Info: Configuration plan applied\r\n");
+				break;
+			case (XVPROCSS_EDAT_FAILURE):
+				xil_printf("Error: Configuration plan not valid\r\n");
+				break;
+			}
+			break;
 		case (XVPROCSS_EVT_CHK_TOPO):
 			if (Data == XVPROCSS_EDAT_INITFAIL) {
 				xil_printf("Error: Topology Not Supported\r\n");
@@ -23,6 +23,7 @@
 * 1.00  dmc  01/27/16 Initial Release
 *       dmc  03/03/16 Add events for VDMA configuration and operational errors
 * 2.30  rco  11/15/16 Make debug log optional (can be disabled via makefile)
+* 2.14  sb   10/19/26 Add events for configuration plans
 *
 * </pre>
 *
@@ -77,6 +78,8 @@ typedef enum {
 	XVPROCSS_EVT_RESET_VPSS,   /**< Log event Reset the VPSS */
 	XVPROCSS_EVT_START_VPSS,   /**< Log event Start the VPSS */
 	XVPROCSS_EVT_STOP_VPSS,    /**< Log event Stop the VPSS */
+	XVPROCSS_EVT_CREATE_PLAN,  /**< Log event Create a configuration plan */
+	XVPROCSS_EVT_APPLY_PLAN,   /**< Log event Apply a configuration plan */
 	XVPROCSS_EVT_LAST_ENUM     /**< (dummy event: marks last enum) */
 } XVprocSs_LogEvent;
 
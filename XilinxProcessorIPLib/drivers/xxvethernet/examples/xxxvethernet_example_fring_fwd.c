@@ -0,0 +1,482 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/**
+*
+* @file xxxvethernet_example_fring_fwd.c
+*
+* Implements an L2 forwarder on the MCDMA frame ring interface
+* (xmcdma_fring.h) and measures its rate in frames per second.
+*
+* The MAC is put in local loopback and a number of frames is injected into
+* the TX ring. Every received frame has its MAC addresses swapped and is sent
+* again from the buffer it was received into, so the frames circulate through
+* MCDMA and MAC for as long as the example runs. Sent frames are recycled
+* from the Comp ring to the Fill ring. No frame is allocated or copied by
+* software, and the DMA channels are polled, not interrupt driven.
+*
+* To forward between two ports instead, remove the local loopback and give
+* the frames received on one channel to the TX ring of the other.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.10  sb   10/19/26 First release
+* 1.10  sb   10/19/26 Send frames with XMcdma_FrTxSubmit()
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xxxvethernet_example.h"
+#include "xmcdma.h"
+#include "xmcdma_fring.h"
+#include "xil_cache.h"
+#include "xiltimer.h"
+#include "stdio.h"		/* stdio */
+#include "stdlib.h"
+
+#if defined(__aarch64__)
+#include "xil_mmu.h"
+#endif
+
+/*************************** Constant Definitions ****************************/
+
+/*
+ * The following constants map to the XPAR parameters created in the
+ * xparameters.h file. They are defined here such that a user can easily
+ * change all the needed parameters in one place.
+ */
+#ifndef TESTAPP_GEN
+#ifdef SDT
+#define XXVETHERNET_BASEADDR	XPAR_XXXVETHERNET_0_BASEADDR
+#else
+#define XXVETHERNET_DEVICE_ID	XPAR_XXVETHERNET_0_DEVICE_ID
+#define AXIMCDMA_DEVICE_ID	XPAR_MCDMA_0_DEVICE_ID
+#endif
+#endif
+
+#define FWD_CHAN_ID		1	/* MCDMA channel used by the forwarder */
+#define BD_CNT			512	/* Number of BDs per direction */
+#define BD_ALIGNMENT		64	/* Byte alignment of BDs */
+
+#define FRAME_SIZE		2048	/* Bytes per frame of the frame area */
+#define FRAME_COUNT		1024	/* Frames in the frame area */
+#define RING_SIZE		1024	/* Entries per ring, >= FRAME_COUNT */
+
+#define INJECT_FRAMES		256	/* Frames circulating in the loop */
+#define FRAME_PAYLOAD		46	/* Payload of injected frames, so that
+					 * they have the minimum length
+					 */
+#define POLL_BUDGET		64	/* Frames received per poll */
+#define RUN_SECONDS		10	/* Duration of the measurement */
+
+#define BD_SPACE_BYTES		(BD_CNT * sizeof(XMcdma_Bd))
+
+/*************************** Variable Definitions ****************************/
+
+XXxvEthernet XxvEthernetInstance;
+XMcdma DmaInstance;
+XMcdma_FrameRing FrameRing;
+
+/*
+ * Aligned memory segments to be used for buffer descriptors
+ */
+char RxBdSpace[BD_SPACE_BYTES] __attribute__ ((aligned(BD_ALIGNMENT)));
+char TxBdSpace[BD_SPACE_BYTES] __attribute__ ((aligned(BD_ALIGNMENT)));
+
+/*
+ * Frame area shared by application and DMA, and the memory of its rings
+ */
+u8 FrameArea[FRAME_COUNT * FRAME_SIZE] __attribute__ ((aligned(FRAME_SIZE)));
+XMcdma_FrDesc RingMem[XMCDMA_FR_NUM_RINGS * RING_SIZE];
+
+char MacAddr[6];
+
+/*************************** Function Prototypes *****************************/
+
+#ifdef SDT
+int XxvEthernetFrameRingExample(XXxvEthernet *XxvEthernetInstancePtr,
+				XMcdma *DmaInstancePtr,
+				UINTPTR XxvBaseAddress);
+#else
+int XxvEthernetFrameRingExample(XXxvEthernet *XxvEthernetInstancePtr,
+				XMcdma *DmaInstancePtr,
+				u16 XxvEthernetDeviceId,
+				u16 AxiMcDmaDeviceId);
+#endif
+static int FrameRingSetup(XMcdma *DmaInstancePtr, XMcdma_FrameRing *FrPtr);
+static int FrameRingInject(XMcdma_FrameRing *FrPtr);
+static u32 FrameRingForward(XMcdma_FrameRing *FrPtr);
+static void FrameRingRecycle(XMcdma_FrameRing *FrPtr);
+
+/*****************************************************************************/
+/**
+*
+* This is the main function for the Xxv Ethernet frame ring example.
+*
+* @param	None.
+*
+* @return	- XST_SUCCESS to indicate success.
+*		- XST_FAILURE to indicate failure
+*
+* @note		None.
+*
+****************************************************************************/
+int main(void)
+{
+	int Status;
+
+	XxvEthernetUtilErrorTrap("\r\n--- Enter main() ---");
+#ifdef SDT
+	Status = XxvEthernetFrameRingExample(&XxvEthernetInstance,
+					     &DmaInstance,
+					     XXVETHERNET_BASEADDR);
+#else
+	Status = XxvEthernetFrameRingExample(&XxvEthernetInstance,
+					     &DmaInstance,
+					     XXVETHERNET_DEVICE_ID,
+					     AXIMCDMA_DEVICE_ID);
+#endif
+	if (Status != XST_SUCCESS) {
+		XxvEthernetUtilErrorTrap("Failed test frame ring forwarder");
+		XxvEthernetUtilErrorTrap("--- Exiting main() ---");
+		return XST_FAILURE;
+	}
+
+	XxvEthernetUtilErrorTrap("Test passed");
+	XxvEthernetUtilErrorTrap("--- Exiting main() ---");
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs the L2 forwarder over the MCDMA frame ring interface
+* with the Xxv Ethernet in local loopback and prints the forwarding rate
+* every second.
+*
+* @param	XxvEthernetInstancePtr is a pointer to the instance of the
+*		XxvEthernet component.
+* @param	DmaInstancePtr is a pointer to the instance of the AXI MCDMA
+*		component.
+* @param	XxvEthernetDeviceId is Device ID of the Xxv Ethernet Device ,
+*		typically XPAR_<XXVETHERNET_instance>_DEVICE_ID value from
+*		xparameters.h.
+* @param	AxiMcDmaDeviceId is Device ID of the Axi MCDMA Device ,
+*		typically XPAR_<AXIMCDMA_instance>_DEVICE_ID value from
+*		xparameters.h.
+*
+* @return	-XST_SUCCESS to indicate success
+*		-XST_FAILURE to indicate failure
+*
+* @note		AxiMcdma hardware must be initialized before initializing
+*		XxvEthernet, see xxxvethernet_example_intr_mcdma.c.
+*
+******************************************************************************/
+#ifdef SDT
+int XxvEthernetFrameRingExample(XXxvEthernet *XxvEthernetInstancePtr,
+				XMcdma *DmaInstancePtr,
+				UINTPTR XxvBaseAddress)
+#else
+int XxvEthernetFrameRingExample(XXxvEthernet *XxvEthernetInstancePtr,
+				XMcdma *DmaInstancePtr,
+				u16 XxvEthernetDeviceId,
+				u16 AxiMcDmaDeviceId)
+#endif
+{
+	int Status;
+	XXxvEthernet_Config *MacCfgPtr;
+	XMcdma_Config *DmaConfig;
+	XMcdma_FrameRing *FrPtr = &FrameRing;
+	XTime Start, Now, Last;
+	u32 Forwarded = 0;
+	u32 Total = 0;
+	u32 Seconds = 0;
+
+	/*
+	 *  Get the configuration of XxvEthernet hardware.
+	 */
+#ifdef SDT
+	MacCfgPtr = XXxvEthernet_LookupConfig(XxvBaseAddress);
+	if ((MacCfgPtr->XxvDevBaseAddress & XXV_AXIDEVTYPE_MASK) == XXV_MCDMA) {
+		DmaConfig = XMcdma_LookupConfig(MacCfgPtr->XxvDevBaseAddress & ~XXV_AXIDEVTYPE_MASK);
+	} else {
+		XxvEthernetUtilErrorTrap("This example requires XXV and MCDMA\r\n");
+		return XST_FAILURE;
+	}
+#else
+	MacCfgPtr = XXxvEthernet_LookupConfig(XxvEthernetDeviceId);
+	DmaConfig = XMcdma_LookupConfig(AxiMcDmaDeviceId);
+#endif
+
+	/*
+	 * Initialize AXIMCDMA engine first, its reset also resets
+	 * XxvEthernet.
+	 */
+	Status = XMcDma_CfgInitialize(DmaInstancePtr, DmaConfig);
+	if (Status != XST_SUCCESS) {
+		XxvEthernetUtilErrorTrap("Error initializing DMA\r\n");
+		return XST_FAILURE;
+	}
+
+	Status = XXxvEthernet_CfgInitialize(XxvEthernetInstancePtr, MacCfgPtr,
+					    MacCfgPtr->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		XxvEthernetUtilErrorTrap("Error in initialize");
+		return XST_FAILURE;
+	}
+
+#if defined(__aarch64__)
+	Xil_SetTlbAttributes((UINTPTR)TxBdSpace, NORM_NONCACHE | INNER_SHAREABLE);
+	Xil_SetTlbAttributes((UINTPTR)RxBdSpace, NORM_NONCACHE | INNER_SHAREABLE);
+#endif
+
+	Status = FrameRingSetup(DmaInstancePtr, FrPtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/* This functions sets Ethernet into local loopback mode
+	 * To test in external HW loopback mode, comment this function call
+	 * and loop TX and RX externally on your setup.
+	 */
+	XxvEthernetUtilEnterLocalLoopback(XxvEthernetInstancePtr);
+
+	if (XXxvEthernet_Start(XxvEthernetInstancePtr)) {
+		XxvEthernetUtilErrorTrap("Error starting Xxv Ethernet");
+		return XST_FAILURE;
+	}
+
+	Status = FrameRingInject(FrPtr);
+	if (Status != XST_SUCCESS) {
+		XXxvEthernet_Stop(XxvEthernetInstancePtr);
+		return XST_FAILURE;
+	}
+
+	XTime_GetTime(&Start);
+	Last = Start;
+	while (Seconds < RUN_SECONDS) {
+		(void)XMcdma_FrPoll(FrPtr, POLL_BUDGET);
+		Forwarded += FrameRingForward(FrPtr);
+		FrameRingRecycle(FrPtr);
+
+		XTime_GetTime(&Now);
+		if ((Now - Last) >= COUNTS_PER_SECOND) {
+			Seconds++;
+			xil_printf("%d s: %d frames/s, rx errors %d, tx errors %d\r\n",
+				   Seconds, Forwarded,
+				   FrPtr->Stats.RxErrors, FrPtr->Stats.TxErrors);
+			Total += Forwarded;
+			Forwarded = 0;
+			Last = Now;
+		}
+	}
+
+	XXxvEthernet_Stop(XxvEthernetInstancePtr);
+
+	xil_printf("Forwarded %d frames, average %d frames/s\r\n",
+		   Total, Total / RUN_SECONDS);
+
+	/*
+	 * Frames are only lost on errors; any error or a stalled loop fails
+	 * the example.
+	 */
+	if ((Total == 0) || (FrPtr->Stats.RxErrors != 0) ||
+	    (FrPtr->Stats.TxErrors != 0)) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function creates the BD chains of the forwarding channel with
+* interrupts disabled, sets up the frame ring set over them and gives the
+* frames not injected to the Fill ring.
+*
+* @param	DmaInstancePtr is a pointer to the instance of the AXI MCDMA
+*		component.
+* @param	FrPtr is the frame ring set to be set up.
+*
+* @return	-XST_SUCCESS to indicate success
+*		-XST_FAILURE to indicate failure
+*
+* @note		None.
+*
+******************************************************************************/
+static int FrameRingSetup(XMcdma *DmaInstancePtr, XMcdma_FrameRing *FrPtr)
+{
+	XMcdma_ChanCtrl *Rx_Chan, *Tx_Chan;
+	u32 Count, Pos, i;
+	int Status;
+
+	Rx_Chan = XMcdma_GetMcdmaRxChan(DmaInstancePtr, FWD_CHAN_ID);
+	Tx_Chan = XMcdma_GetMcdmaTxChan(DmaInstancePtr, FWD_CHAN_ID);
+
+	XMcdma_IntrDisable(Rx_Chan, XMCDMA_IRQ_ALL_MASK);
+	XMcdma_IntrDisable(Tx_Chan, XMCDMA_IRQ_ALL_MASK);
+
+	Status = XMcDma_ChanBdCreate(Rx_Chan, (UINTPTR)RxBdSpace, BD_CNT);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Rx bd create failed with %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	Status = XMcDma_ChanBdCreate(Tx_Chan, (UINTPTR)TxBdSpace, BD_CNT);
+	if (Status != XST_SUCCESS) {
+		xil_printf("TX bd create failed with %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	Status = XMcdma_FrInitialize(FrPtr, DmaInstancePtr, FWD_CHAN_ID,
+				     (UINTPTR)FrameArea, FRAME_SIZE,
+				     FRAME_COUNT, RingMem, RING_SIZE);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Frame ring initialize failed with %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	/* Frames from INJECT_FRAMES on receive, the others are injected */
+	Count = XMcdma_FrRingReserve(&FrPtr->Fill, FRAME_COUNT - INJECT_FRAMES,
+				     &Pos);
+	for (i = 0; i < Count; i++) {
+		XMcdma_FrRingDesc(&FrPtr->Fill, Pos + i)->Idx = INJECT_FRAMES + i;
+	}
+	XMcdma_FrRingSubmit(&FrPtr->Fill, Count);
+
+	/* Post the receive frames before anything is sent */
+	(void)XMcdma_FrPoll(FrPtr, 0);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function builds INJECT_FRAMES minimum length frames in place and
+* gives them to the TX ring.
+*
+* @param	FrPtr is the frame ring set to be worked on.
+*
+* @return	-XST_SUCCESS to indicate success
+*		-XST_FAILURE to indicate failure
+*
+* @note		None.
+*
+******************************************************************************/
+static int FrameRingInject(XMcdma_FrameRing *FrPtr)
+{
+	XMcdma_FrDesc *DescPtr;
+	EthernetFrame *FramePtr;
+	u32 Count, Pos, i;
+
+	/*
+	 * In loopback the frame must carry the address the MCDMA channel is
+	 * mapped to as both destination and source, see AxiEnetMapper() in
+	 * xxxvethernet_example_intr_mcdma.c.
+	 */
+	for (i = 0; i < XXE_MAC_ADDR_SIZE; i++) {
+		MacAddr[i] = DestAddr[i];
+	}
+	MacAddr[1] = 0x00;
+
+	Count = XMcdma_FrRingReserve(&FrPtr->Tx, INJECT_FRAMES, &Pos);
+	if (Count != INJECT_FRAMES) {
+		return XST_FAILURE;
+	}
+
+	for (i = 0; i < Count; i++) {
+		/* Frames are FRAME_SIZE apart, only the header area is used */
+		FramePtr = (EthernetFrame *)XMcdma_FrAddr(FrPtr, i);
+		XxvEthernetUtilFrameHdrFormatMAC(FramePtr, MacAddr, MacAddr);
+		XxvEthernetUtilFrameHdrFormatType(FramePtr, FRAME_PAYLOAD);
+
+		DescPtr = XMcdma_FrRingDesc(&FrPtr->Tx, Pos + i);
+		DescPtr->Idx = i;
+		DescPtr->Len = XXE_HDR_SIZE + FRAME_PAYLOAD;
+	}
+
+	return XMcdma_FrTxSubmit(FrPtr, Count);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function forwards received frames: the MAC addresses of each frame
+* are swapped and its descriptor moves from the Rx ring to the Tx ring.
+*
+* @param	FrPtr is the frame ring set to be worked on.
+*
+* @return	The number of frames forwarded.
+*
+* @note		Frames that do not fit the Tx ring stay on the Rx ring until
+*		the next call.
+*
+******************************************************************************/
+static u32 FrameRingForward(XMcdma_FrameRing *FrPtr)
+{
+	XMcdma_FrDesc *RxDescPtr;
+	u32 RxPos, TxPos, Count, i, j;
+	u8 *Frame;
+	u8 Tmp;
+
+	Count = XMcdma_FrRingPeek(&FrPtr->Rx, RING_SIZE, &RxPos);
+	Count = XMcdma_FrRingReserve(&FrPtr->Tx, Count, &TxPos);
+
+	for (i = 0; i < Count; i++) {
+		RxDescPtr = XMcdma_FrRingDesc(&FrPtr->Rx, RxPos + i);
+
+		Frame = (u8 *)XMcdma_FrAddr(FrPtr, RxDescPtr->Idx);
+		for (j = 0; j < XXE_MAC_ADDR_SIZE; j++) {
+			Tmp = Frame[j];
+			Frame[j] = Frame[XXE_MAC_ADDR_SIZE + j];
+			Frame[XXE_MAC_ADDR_SIZE + j] = Tmp;
+		}
+
+		*XMcdma_FrRingDesc(&FrPtr->Tx, TxPos + i) = *RxDescPtr;
+	}
+
+	XMcdma_FrRingRelease(&FrPtr->Rx, Count);
+	/* Received frames always fit FrameSize, so they pass the check */
+	(void)XMcdma_FrTxSubmit(FrPtr, Count);
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function gives the frames of the Comp ring back to the Fill ring.
+*
+* @param	FrPtr is the frame ring set to be worked on.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void FrameRingRecycle(XMcdma_FrameRing *FrPtr)
+{
+	u32 CompPos, FillPos, Count, i;
+
+	Count = XMcdma_FrRingPeek(&FrPtr->Comp, RING_SIZE, &CompPos);
+	Count = XMcdma_FrRingReserve(&FrPtr->Fill, Count, &FillPos);
+
+	for (i = 0; i < Count; i++) {
+		XMcdma_FrRingDesc(&FrPtr->Fill, FillPos + i)->Idx =
+			XMcdma_FrRingDesc(&FrPtr->Comp, CompPos + i)->Idx;
+	}
+
+	XMcdma_FrRingRelease(&FrPtr->Comp, Count);
+	XMcdma_FrRingSubmit(&FrPtr->Fill, Count);
+}
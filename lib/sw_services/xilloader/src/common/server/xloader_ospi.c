@@ -42,6 +42,8 @@
 *       sk   02/26/2024 Added support for Infineon OSPI flash part
 *       ng   03/05/2024 Added support for Macronix OSPI 2G flash part
 *       sk   03/16/2024 Added support for Spansion Die config
+*       sb   10/19/2026 Serve small blocking copies through the linear read
+*                       path when PLM_ENABLE_FLASH_LINEAR_READ is defined
 *
 * </pre>
 *
@@ -79,6 +81,9 @@ static int FlashReadID(XOspiPsv *OspiPsvPtr);
 static int XLoader_FlashEnterExit4BAddMode(XOspiPsv *OspiPsvPtr, u32 Enable);
 static int XLoader_FlashSetDDRMode(XOspiPsv *OspiPsvPtr);
 static int XLoader_SpansionSetEccMode(XOspiPsv *OspiPsvPtr);
+#ifdef PLM_ENABLE_FLASH_LINEAR_READ
+static int XLoader_OspiLinearCopy(const XOspiPsv_Msg *FlashMsg);
+#endif
 
 /************************** Variable Definitions *****************************/
 static XOspiPsv OspiPsvInstance;
@@ -699,6 +704,23 @@ int XLoader_OspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 	else if (OspiPsvInstance.DualByteOpcodeEn == 2U) {
 		FlashMsg.ExtendedOpcode = (u8)(FlashMsg.Opcode);
 	}
+#ifdef PLM_ENABLE_FLASH_LINEAR_READ
+	/**
+	 * - Serve small blocking copies to a 32-bit destination within one flash
+	 * from the linear window, switch back to INDAC mode for everything else.
+	*/
+	if ((Flags != XPLMI_DEVICE_COPY_STATE_INITIATE) && (TrfLen == Length) &&
+		(Length <= XLOADER_OSPI_LINEAR_MAX_LEN) && (FlashMsg.Xfer64bit == 0U)) {
+		Status = XLoader_OspiLinearCopy(&FlashMsg);
+		goto END1;
+	}
+	Status = (int)XOspiPsv_LinearDisable(&OspiPsvInstance);
+	if (Status != XST_SUCCESS) {
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_OSPI_READ, Status);
+		goto END1;
+	}
+#endif
+
 	/**
 	 * - Start the DMA Transfer operation if flag is set to non blocking copy.
 	*/
@@ -803,6 +825,53 @@ END:
 	return Status;
 }
 
+#ifdef PLM_ENABLE_FLASH_LINEAR_READ
+/*****************************************************************************/
+/**
+ * @brief	This function copies data from the OSPI flash through the linear
+ * 			read path. Linear mode is enabled on first use with the read
+ * 			command of the given message and kept enabled for following small
+ * 			copies, the line after the copied range is prefetched.
+ *
+ * @param	FlashMsg is the read command prepared by XLoader_OspiCopy
+ *
+ * @return
+ * 			- XST_SUCCESS on success.
+ * 			- XLOADER_ERR_OSPI_READ on OSPI driver read fail.
+ *
+ *****************************************************************************/
+static int XLoader_OspiLinearCopy(const XOspiPsv_Msg *FlashMsg)
+{
+	int Status = XST_FAILURE;
+	static XOspiPsv_LinearCache LinearCache;
+
+	if (OspiPsvInstance.LinearActive == 0U) {
+		Status = (int)XOspiPsv_LinearEnable(&OspiPsvInstance, FlashMsg,
+			&LinearCache);
+		if (Status != XST_SUCCESS) {
+			Status = XPlmi_UpdateStatus(XLOADER_ERR_OSPI_READ, Status);
+			goto END;
+		}
+	}
+
+	Status = (int)XOspiPsv_LinearRead(&OspiPsvInstance, FlashMsg->Addr,
+		FlashMsg->RxBfrPtr, FlashMsg->ByteCount);
+	if (Status != XST_SUCCESS) {
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_OSPI_READ, Status);
+		goto END;
+	}
+
+	/**
+	 * - Prefetch is a hint only, its status is ignored.
+	*/
+	(void)XOspiPsv_LinearPrefetch(&OspiPsvInstance,
+		FlashMsg->Addr + FlashMsg->ByteCount, XOSPIPSV_LINEAR_LINE_SIZE);
+
+END:
+	return Status;
+}
+#endif
+
 /*****************************************************************************/
 /**
  * @brief	This API enters the flash device into 4 bytes addressing mode.
@@ -1137,12 +1206,28 @@ int XLoader_OspiRelease(void)
 {
 	int Status = XST_FAILURE;
 
+#ifdef PLM_ENABLE_FLASH_LINEAR_READ
+	/**
+	 * - Leave linear mode so that the next user finds the controller in
+	 * INDAC mode.
+	*/
+	if (OspiPsvInstance.LinearActive != 0U) {
+		Status = (int)XOspiPsv_LinearDisable(&OspiPsvInstance);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+#endif
+
 	/**
 	 * - Request the OSPI driver to release the device.
 	*/
 	Status = XPm_ReleaseDevice(PM_SUBSYS_PMC, PM_DEV_OSPI,
 		XPLMI_CMD_SECURE);
 
+#ifdef PLM_ENABLE_FLASH_LINEAR_READ
+END:
+#endif
 	return Status;
 }
 
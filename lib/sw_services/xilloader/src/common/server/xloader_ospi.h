@@ -128,6 +128,7 @@ extern "C" {
 #define XLOADER_MACRONIX_OSPI_SET_DDR_DUMMY_CYCLES	(4U)
 #define XLOADER_READ_ID_BYTES		(8U)
 #define XLOADER_OSPI_READ_ADDR_SIZE	(4U)
+#define XLOADER_OSPI_LINEAR_MAX_LEN	(0x1000U) /* Max copy served in linear mode */
 #define XLOADER_OSPI_DDR_MODE_BYTE_CNT	(2U)
 #define XLOADER_OSPI_SDR_MODE_BYTE_CNT	(1U)
 
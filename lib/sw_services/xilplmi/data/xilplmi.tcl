@@ -31,6 +31,7 @@
 #       pre  07/16/2024 Corrected typo
 #       kal  09/25/2024 Remove deleting folders which are set in secure_drc
 #       pre  10/22/2024 Added configurable option for CFI selective read feature
+# 2.2   sb   10/19/2026 Added configurable option for flash linear read
 #
 ##############################################################################
 
@@ -483,6 +484,13 @@ proc xgen_opts_file {libhandle} {
 		puts $file_handle "#define PLM_ENABLE_CFI_SELECTIVE_READ"
 	}
 
+	# Get flash_linear_read_en value set by user, by default it is FALSE
+	set value [common::get_property CONFIG.flash_linear_read_en $libhandle]
+	if {$value == true} {
+		puts $file_handle "\n/* Flash linear read enable */"
+		puts $file_handle "#define PLM_ENABLE_FLASH_LINEAR_READ"
+	}
+
 	# Get user_modules count set by user, by default it is 0
 	set value [common::get_property CONFIG.user_modules_count $libhandle]
 	puts $file_handle "\n/* Number of User Modules */"
@@ -50,6 +50,7 @@
 *       ng   03/20/2024 Added CDO debug prints
 *       pre  07/11/2024 Implemented secure PLM to PLM communication
 *       pre  10/22/2024 Added configurable option for CFI selective read feature
+*       sb   10/19/2026 Added configurable option for flash linear read
 * </pre>
 *
 * @note
@@ -235,6 +236,9 @@ extern "C" {
 /* Enable the below define to enable CFI selective read */
 //#define PLM_ENABLE_CFI_SELECTIVE_READ
 
+/* Enable the below define to serve small OSPI copies in linear mode */
+//#define PLM_ENABLE_FLASH_LINEAR_READ
+
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
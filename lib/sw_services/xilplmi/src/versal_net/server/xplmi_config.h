@@ -30,6 +30,7 @@
 * 1.03  am   01/31/2024 Added PLM_OCP_KEY_MNGMT configuration macro
 *       ng   03/20/2024 Added CDO debug prints
 *       pre  10/22/2024 Added configurable option for CFI selective read feature
+*       sb   10/19/2026 Added configurable option for flash linear read
 *
 * </pre>
 *
@@ -194,6 +195,9 @@ extern "C" {
 /* Enable the below define to enable CFI selective read */
 //#define PLM_ENABLE_CFI_SELECTIVE_READ
 
+/* Enable the below define to serve small OSPI copies in linear mode */
+//#define PLM_ENABLE_FLASH_LINEAR_READ
+
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
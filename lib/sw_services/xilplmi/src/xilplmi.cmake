@@ -153,6 +153,11 @@ if (XILPLMI_cfi_selective_read_en)
   set(PLM_ENABLE_CFI_SELECTIVE_READ " ")
 endif()
 
+option(XILPLMI_flash_linear_read_en "Enables or disables linear mode reads of small OSPI copies" OFF)
+if (XILPLMI_flash_linear_read_en)
+  set(PLM_ENABLE_FLASH_LINEAR_READ " ")
+endif()
+
 set(XILPLMI_user_modules_count "0" CACHE STRING "Number of User Modules.")
 set(XILPLMI_USER_MODULES_COUNT "${XILPLMI_user_modules_count}")
 
@@ -0,0 +1,524 @@
+/******************************************************************************
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+ * SPDX-License-Identifier: MIT
+ *******************************************************************************/
+
+
+/******************************************************************************/
+/**
+ *
+ * @file xilsfl_log_sim_example.c
+ *
+ *
+ * This file contains a design example using the log-structured record store
+ * of the SFL library on the simulated flash controller.
+ *
+ * A set of cold keys is written once, then a random update/delete workload
+ * on the hot keys is run and compared with updating the records in place,
+ * which costs a sector read-modify-erase-write per update; the write
+ * amplification and the erase count spread are reported. The workload is
+ * then repeated with power cuts injected at random program/erase commands,
+ * including the ones issued by compaction. After every cut the log is
+ * mounted again and each key is checked against a model of the acknowledged
+ * writes; the update that was in progress at the cut may read back either
+ * its old or its new value.
+ *
+ * The small log above is compacted for space all the time, which also
+ * moves the cold records, so the erase counts never spread far enough for
+ * static wear levelling. A last run formats a larger log in which the cold
+ * records fill a sector of their own and updates the hot keys, with a
+ * compaction step after every update, until the spread exceeds
+ * XSFL_LOG_WEAR_DELTA and compaction moves the cold sector, then checks
+ * every key again.
+ *
+ * The library has to be built with XILSFL_sim_flash enabled, which defines
+ * XSFL_SIM_FLASH in xilsfl_config.h.
+ *
+ * @note
+ *
+ * None.
+ *
+
+ *</pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- ---------------------------------------------------------
+ * 1.1   sb  10/19/26  Initial release
+ * 1.1   sb  10/19/26  Add a run that forces a static wear levelling move
+ *
+ *</pre>
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xilsfl.h"
+#include "xilsfl_log.h"
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * Log region
+ */
+#define LOG_BASE_ADDR		0x0
+#define LOG_SECTORS		4
+
+/*
+ * Max sector size to initialize the in place update buffer
+ */
+#define MAX_SECT_SIZE		0x10000
+
+#define NUM_KEYS		48
+#define COLD_KEYS		16	/* Keys written only once */
+#define MIN_LEN			8
+#define MAX_LEN			200
+
+#define NUM_UPDATES		30000
+#define COMPACT_INTERVAL	16	/* Operations between compaction calls */
+#define COMPACT_RECORDS		8	/* Records examined per compaction call */
+
+#define CUT_ROUNDS		200
+#define CUT_MAX_OPS		64	/* Max program/erase commands before a cut */
+
+/*
+ * Wear levelling log, placed after the log and the in place update sector
+ */
+#define WEAR_SECTORS		8
+#define WEAR_MAX_UPDATES	400000	/* Bound of the hot key updates */
+
+/**************************** Type Definitions *******************************/
+
+/*
+ * Acknowledged state of a key, Version 0 means not present
+ */
+typedef struct {
+	u32 Version;
+	u32 Len;
+} KeyModel;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+int SflLogSimExample(void);
+static int WearLevelRun(u32 SectSize);
+static u32 RunOp(KeyModel *Pending, u32 *PendKey);
+static u32 WriteKey(u32 Key, KeyModel *Pending);
+static int VerifyLog(u32 PendKey, const KeyModel *Pending);
+static int MatchModel(u32 Key, const KeyModel *Model);
+static void FillPattern(u8 *Buf, u32 Key, u32 Version, u32 Len);
+static u32 Random(void);
+
+/************************** Variable Definitions *****************************/
+u8 SflHandler;     /* file descriptor for the XSfl instance*/
+
+XSfl_Log Log;
+KeyModel Model[NUM_KEYS];
+u32 NextVersion = 1;
+u32 RandomState = 0x12345678;
+
+u8 WriteBuffer[XSFL_LOG_MAX_DATA];
+u8 ReadBuffer[XSFL_LOG_MAX_DATA];
+
+/*
+ * Sector buffer of the in place update reference
+ */
+#ifdef __ICCARM__
+#pragma data_alignment = 64
+u8 SectBuffer[MAX_SECT_SIZE];
+#else
+u8 SectBuffer[MAX_SECT_SIZE] __attribute__ ((aligned(64)));
+#endif
+
+#ifdef XSFL_SIM_FLASH
+/*****************************************************************************/
+/**
+ *
+ * Main function to call the SflLogSimExample.
+ *
+ *
+ * @return	XST_SUCCESS if successful, otherwise XST_FAILURE.
+ *
+ * @note		None
+ *
+ ******************************************************************************/
+int main(void)
+{
+	int Status;
+
+	xil_printf("SflLogSimExample Test\r\n");
+
+	Status = SflLogSimExample();
+	if (Status != XST_SUCCESS) {
+		xil_printf("SflLogSimExample Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran SflLogSimExample\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Runs the workload without and with power cuts and verifies the log after
+ * every mount.
+ *
+ * @return	XST_SUCCESS if successful, else XST_FAILURE.
+ *
+ * @note		None.
+ *
+ *****************************************************************************/
+int SflLogSimExample(void) {
+	u32 Status;
+	u32 SectSize;
+	u32 Count;
+	u32 Round;
+	u32 Cuts = 0;
+	u32 Torn = 0;
+	u32 PendKey;
+	u64 Start;
+	u64 LogTime;
+	u64 RmwTime;
+	KeyModel Pending;
+	XSfl_LogStats Stats;
+	XSfl_UserConfig SflUserOptions;
+
+	SflUserOptions.Sim_Config.ConnectionMode = XSFL_CONNECTION_MODE_SINGLE;
+
+	Status = XSfl_FlashInit(&SflHandler, SflUserOptions, XSFL_SIM_CNTRL);
+	if (Status != XST_SUCCESS ) {
+		return XST_FAILURE;
+	}
+
+	Status = XSfl_FlashGetInfo(SflHandler, XSFL_SECT_SIZE, &SectSize);
+	if ((Status != XST_SUCCESS) || (SectSize > MAX_SECT_SIZE)) {
+		return XST_FAILURE;
+	}
+
+	Status = XSfl_LogFormat(&Log, SflHandler, LOG_BASE_ADDR, LOG_SECTORS);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	for (Count = 0; Count < NUM_KEYS; Count++) {
+		Status = WriteKey(Count, &Model[Count]);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	/*
+	 * Update workload without power cuts
+	 */
+	Start = XSfl_SimGetTimeNs();
+	for (Count = 0; Count < NUM_UPDATES; Count++) {
+		Status = RunOp(&Pending, &PendKey);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		if (PendKey < NUM_KEYS) {
+			Model[PendKey] = Pending;
+		}
+	}
+	LogTime = XSfl_SimGetTimeNs() - Start;
+
+	if (VerifyLog(NUM_KEYS, NULL) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * In place reference: every update rewrites the sector holding the
+	 * record
+	 */
+	Start = XSfl_SimGetTimeNs();
+	Status = XSfl_FlashRead(SflHandler, LOG_BASE_ADDR + (LOG_SECTORS * SectSize),
+			SectSize, SectBuffer, 0);
+	Status |= XSfl_FlashErase(SflHandler, LOG_BASE_ADDR + (LOG_SECTORS * SectSize),
+			SectSize);
+	Status |= XSfl_FlashWrite(SflHandler, LOG_BASE_ADDR + (LOG_SECTORS * SectSize),
+			SectSize, SectBuffer);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	RmwTime = XSfl_SimGetTimeNs() - Start;
+
+	XSfl_LogGetStats(&Log, &Stats);
+	xil_printf("Log update %d us, in place update %d us\r\n",
+			(u32)(LogTime / NUM_UPDATES / 1000U), (u32)(RmwTime / 1000U));
+	xil_printf("Write amplification %d.%02d, in place %d\r\n",
+			(u32)(Stats.FlashBytes / Stats.UserBytes),
+			(u32)(((Stats.FlashBytes * 100U) / Stats.UserBytes) % 100U),
+			(u32)((u64)SectSize * Stats.Writes / Stats.UserBytes));
+	xil_printf("Compactions %d (wear %d), records moved %d, erase count %d..%d\r\n",
+			Stats.Compactions, Stats.WearMoves, Stats.RecordsMoved,
+			Stats.MinEraseCount, Stats.MaxEraseCount);
+
+	/*
+	 * Same workload with power cuts
+	 */
+	for (Round = 0; Round < CUT_ROUNDS; Round++) {
+		XSfl_SimSetPowerCut(1 + (Random() % CUT_MAX_OPS));
+
+		PendKey = NUM_KEYS;
+		while (XSfl_SimPowerLost() == 0U) {
+			Status = RunOp(&Pending, &PendKey);
+			if (XSfl_SimPowerLost() != 0U) {
+				break;
+			}
+			if (Status != XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+			if (PendKey < NUM_KEYS) {
+				Model[PendKey] = Pending;
+			}
+			PendKey = NUM_KEYS;
+		}
+		Cuts++;
+
+		XSfl_SimPowerRestore();
+		Status = XSfl_LogMount(&Log, SflHandler, LOG_BASE_ADDR, LOG_SECTORS);
+		if (Status != XST_SUCCESS) {
+			xil_printf("Mount failed after cut %d\r\n", Cuts);
+			return XST_FAILURE;
+		}
+		XSfl_LogGetStats(&Log, &Stats);
+		Torn += Stats.TornRecords;
+
+		if (VerifyLog(PendKey, &Pending) != XST_SUCCESS) {
+			xil_printf("Verify failed after cut %d\r\n", Cuts);
+			return XST_FAILURE;
+		}
+	}
+
+	XSfl_LogGetStats(&Log, &Stats);
+	xil_printf("Power cuts %d, torn records dropped %d, keys %d, erase count %d..%d\r\n",
+			Cuts, Torn, Stats.NumKeys, Stats.MinEraseCount, Stats.MaxEraseCount);
+
+	return WearLevelRun(SectSize);
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Formats a log of WEAR_SECTORS sectors, writes the cold keys first so that
+ * they share a sector, and runs the hot key workload until compaction has
+ * moved a sector for wear levelling.
+ *
+ * @param	SectSize is the sector size of the flash.
+ *
+ * @return	XST_SUCCESS if successful, else XST_FAILURE.
+ *
+ * @note		None.
+ *
+ *****************************************************************************/
+static int WearLevelRun(u32 SectSize)
+{
+	u32 Status;
+	u32 Count;
+	u32 PendKey;
+	KeyModel Pending;
+	XSfl_LogStats Stats;
+
+	Status = XSfl_LogFormat(&Log, SflHandler,
+			LOG_BASE_ADDR + ((LOG_SECTORS + 1) * SectSize), WEAR_SECTORS);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	for (Count = 0; Count < NUM_KEYS; Count++) {
+		Status = WriteKey(Count, &Model[Count]);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	XSfl_LogGetStats(&Log, &Stats);
+	for (Count = 0; (Count < WEAR_MAX_UPDATES) && (Stats.WearMoves == 0U);
+			Count++) {
+		Status = RunOp(&Pending, &PendKey);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		if (PendKey < NUM_KEYS) {
+			Model[PendKey] = Pending;
+		}
+
+		/* Idle time after every update, as an idle loop would have */
+		Status = XSfl_LogCompact(&Log, COMPACT_RECORDS);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		XSfl_LogGetStats(&Log, &Stats);
+	}
+
+	xil_printf("Wear levelling: %d updates, compactions %d (wear %d), erase count %d..%d\r\n",
+			Count, Stats.Compactions, Stats.WearMoves,
+			Stats.MinEraseCount, Stats.MaxEraseCount);
+	if (Stats.WearMoves == 0U) {
+		xil_printf("No wear levelling move within %d updates\r\n",
+				WEAR_MAX_UPDATES);
+		return XST_FAILURE;
+	}
+
+	return VerifyLog(NUM_KEYS, NULL);
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Runs one random operation on a hot key: mostly updates, some deletes, and
+ * a bounded compaction step every COMPACT_INTERVAL operations on average.
+ *
+ * @param	Pending is the state of the key once the operation completes.
+ * @param	PendKey is the key of the operation, NUM_KEYS for compaction.
+ *
+ * @return	XST_SUCCESS if successful, else XST_FAILURE.
+ *
+ *****************************************************************************/
+static u32 RunOp(KeyModel *Pending, u32 *PendKey)
+{
+	u32 Key = COLD_KEYS + (Random() % (NUM_KEYS - COLD_KEYS));
+	u32 Status;
+
+	if ((Random() % COMPACT_INTERVAL) == 0) {
+		*PendKey = NUM_KEYS;
+		return XSfl_LogCompact(&Log, COMPACT_RECORDS);
+	}
+
+	*PendKey = Key;
+	if ((Random() % 20) == 0) {
+		Pending->Version = 0;
+		Pending->Len = 0;
+		Status = XSfl_LogDelete(&Log, Key);
+	} else {
+		Status = WriteKey(Key, Pending);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Writes a new version of a key with a random length.
+ *
+ * @param	Key is the key to write.
+ * @param	Pending is the state of the key once the write completes.
+ *
+ * @return	XST_SUCCESS if successful, else XST_FAILURE.
+ *
+ *****************************************************************************/
+static u32 WriteKey(u32 Key, KeyModel *Pending)
+{
+	Pending->Version = NextVersion++;
+	Pending->Len = MIN_LEN + (Random() % (MAX_LEN - MIN_LEN + 1));
+	FillPattern(WriteBuffer, Key, Pending->Version, Pending->Len);
+
+	return XSfl_LogWrite(&Log, Key, WriteBuffer, Pending->Len);
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Checks every key against the model. The key of the operation cut by a
+ * power loss may hold its old or its new state, the model follows what the
+ * flash holds.
+ *
+ * @param	PendKey is the key of the cut operation, NUM_KEYS if none.
+ * @param	Pending is the new state of PendKey.
+ *
+ * @return	XST_SUCCESS if successful, else XST_FAILURE.
+ *
+ *****************************************************************************/
+static int VerifyLog(u32 PendKey, const KeyModel *Pending)
+{
+	u32 Key;
+
+	for (Key = 0; Key < NUM_KEYS; Key++) {
+		if (MatchModel(Key, &Model[Key]) == XST_SUCCESS) {
+			continue;
+		}
+		if ((Key == PendKey) && (MatchModel(Key, Pending) == XST_SUCCESS)) {
+			Model[Key] = *Pending;
+			continue;
+		}
+		xil_printf("Key %d does not match version %d\r\n", Key,
+				Model[Key].Version);
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Reads a key and compares it with a model state.
+ *
+ *****************************************************************************/
+static int MatchModel(u32 Key, const KeyModel *Expected)
+{
+	u32 Status;
+	u32 Len;
+	u32 Count;
+
+	Status = XSfl_LogRead(&Log, Key, ReadBuffer, sizeof(ReadBuffer), &Len);
+	if (Expected->Version == 0) {
+		return (Status == (u32)XST_NO_DATA) ? XST_SUCCESS : XST_FAILURE;
+	}
+
+	if ((Status != XST_SUCCESS) || (Len != Expected->Len)) {
+		return XST_FAILURE;
+	}
+
+	FillPattern(WriteBuffer, Key, Expected->Version, Len);
+	for (Count = 0; Count < Len; Count++) {
+		if (ReadBuffer[Count] != WriteBuffer[Count]) {
+			return XST_FAILURE;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Fills the data of a key version, the version is stored in the first bytes
+ * so that no two versions share a pattern.
+ *
+ *****************************************************************************/
+static void FillPattern(u8 *Buf, u32 Key, u32 Version, u32 Len)
+{
+	u32 Count;
+
+	Buf[0] = (u8)Version;
+	Buf[1] = (u8)(Version >> 8);
+	Buf[2] = (u8)(Version >> 16);
+	Buf[3] = (u8)(Version >> 24);
+	for (Count = 4; Count < Len; Count++) {
+		Buf[Count] = (u8)((Key * 31U) + (Version * 7U) + Count);
+	}
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Returns a pseudo random number (xorshift32).
+ *
+ *****************************************************************************/
+static u32 Random(void)
+{
+	RandomState ^= RandomState << 13;
+	RandomState ^= RandomState >> 17;
+	RandomState ^= RandomState << 5;
+
+	return RandomState;
+}
+#else
+int main(void)
+{
+	xil_printf("SflLogSimExample needs the library built with XILSFL_sim_flash\r\n");
+	return XST_FAILURE;
+}
+#endif
@@ -0,0 +1,358 @@
+/******************************************************************************
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+ * SPDX-License-Identifier: MIT
+ *******************************************************************************/
+
+
+/******************************************************************************/
+/**
+ *
+ * @file xilsfl_queue_sim_example.c
+ *
+ *
+ * This file contains a design example using the queued I/O engine of the SFL
+ * library on the simulated flash controller. The same erase and program
+ * workload, on two stacked dies, is run through the blocking
+ * XSfl_FlashErase/XSfl_FlashWrite APIs and through the I/O queue, and the
+ * throughput of each run is reported in MB/s of virtual time.
+ *
+ * XSfl_FlashWrite programs BLOCKING_PROGRAM_SIZE bytes per command, so the
+ * queue is first run with the same program size to compare like with like.
+ * A second queued run with one page per program command shows what page
+ * programming adds on top.
+ *
+ * The library has to be built with XILSFL_sim_flash enabled, which defines
+ * XSFL_SIM_FLASH in xilsfl_config.h.
+ *
+ * @note
+ *
+ * None.
+ *
+
+ *</pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- ---------------------------------------------------------
+ * 1.1   sb  10/19/26  Initial release
+ * 1.1   sb  10/19/26  Compare blocking and queued runs at the same program size
+ *
+ *</pre>
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xilsfl.h"
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * Number of sectors erased and programmed on each die.
+ */
+#define TEST_SECTORS		2
+
+/*
+ * Max sector size to initialize write and read buffer
+ */
+#define MAX_SECT_SIZE		0x10000
+
+#define UNIQUE_VALUE		0x0A
+
+/*
+ * Requests queued per die: an erase and a write per sector.
+ */
+#define REQS_PER_DIE		(TEST_SECTORS * 2)
+
+/*
+ * Bytes programmed per command by XSfl_FlashWrite
+ */
+#define BLOCKING_PROGRAM_SIZE	8U
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+int SflQueueSimExample(void);
+static int QueueRun(u32 ProgramSize, const u32 *DieBase, u32 SectSize,
+		u64 *TimePtr, XSfl_QueueStats *StatsPtr);
+static void ReportRate(const char *Name, u64 Bytes, u64 TimeNs);
+static void IoDoneHandler(void *CallBackRef, XSfl_IoReq *IoReq, u32 Status);
+
+/************************** Variable Definitions *****************************/
+u8 SflHandler;     /* file descriptor for the XSfl instance*/
+
+/*
+ * The following variables are used to read and write to the flash and they
+ * are global to avoid having large buffers on the stack
+ */
+#ifdef __ICCARM__
+#pragma data_alignment = 64
+u8 ReadBuffer[TEST_SECTORS * MAX_SECT_SIZE];
+#pragma data_alignment = 4
+u8 WriteBuffer[TEST_SECTORS * MAX_SECT_SIZE];
+#else
+u8 ReadBuffer[TEST_SECTORS * MAX_SECT_SIZE] __attribute__ ((aligned(64)));
+u8 WriteBuffer[TEST_SECTORS * MAX_SECT_SIZE] __attribute__ ((aligned(4)));
+#endif
+
+XSfl_IoReq IoReqs[XSFL_QUEUE_MAX_DIES * REQS_PER_DIE];
+volatile u32 IoErrors;
+
+#ifdef XSFL_SIM_FLASH
+/*****************************************************************************/
+/**
+ *
+ * Main function to call the SflQueueSimExample.
+ *
+ *
+ * @return	XST_SUCCESS if successful, otherwise XST_FAILURE.
+ *
+ * @note		None
+ *
+ ******************************************************************************/
+int main(void)
+{
+	int Status;
+
+	xil_printf("SflQueueSimExample Test\r\n");
+
+	Status = SflQueueSimExample();
+	if (Status != XST_SUCCESS) {
+		xil_printf("SflQueueSimExample Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran SflQueueSimExample\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Runs the same workload through the blocking APIs and through the I/O queue
+ * and verifies the data written by the queue.
+ *
+ * @return	XST_SUCCESS if successful, else XST_FAILURE.
+ *
+ * @note		None.
+ *
+ *****************************************************************************/
+int SflQueueSimExample(void) {
+	u32 Status;
+	u8 UniqueValue;
+	u32 Count;
+	u32 SectSize;
+	u32 DeviceSize;
+	u32 ByteCount;
+	u32 DieBase[XSFL_QUEUE_MAX_DIES];
+	u32 Die;
+	u64 Start;
+	u64 SyncTime;
+	u64 QueueTime;
+	XSfl_QueueStats Stats;
+	XSfl_UserConfig SflUserOptions;
+
+	SflUserOptions.Sim_Config.ConnectionMode = XSFL_CONNECTION_MODE_STACKED;
+
+	Status = XSfl_FlashInit(&SflHandler, SflUserOptions, XSFL_SIM_CNTRL);
+	if (Status != XST_SUCCESS ) {
+		return XST_FAILURE;
+	}
+
+	Status = XSfl_FlashGetInfo(SflHandler, XSFL_SECT_SIZE, &SectSize);
+	Status |= XSfl_FlashGetInfo(SflHandler, XSFL_DEVICE_SIZE, &DeviceSize);
+	if ((Status != XST_SUCCESS) || (SectSize > MAX_SECT_SIZE)) {
+		return XST_FAILURE;
+	}
+
+	ByteCount = TEST_SECTORS * SectSize;
+	DieBase[0] = 0;
+	DieBase[1] = DeviceSize / 2;
+
+	for (UniqueValue = UNIQUE_VALUE, Count = 0; Count < ByteCount;
+			Count++, UniqueValue++) {
+		WriteBuffer[Count] = (u8)(UniqueValue);
+	}
+
+	/*
+	 * Blocking reference: every page and every sector waits for the flash.
+	 */
+	Start = XSfl_SimGetTimeNs();
+	for (Die = 0; Die < XSFL_QUEUE_MAX_DIES; Die++) {
+		Status = XSfl_FlashErase(SflHandler, DieBase[Die], ByteCount);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		Status = XSfl_FlashWrite(SflHandler, DieBase[Die], ByteCount, WriteBuffer);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+	SyncTime = XSfl_SimGetTimeNs() - Start;
+
+	/*
+	 * Queued runs: each die gets erase + write per sector, the engine
+	 * overlaps the dies and stages the next program while the flash is busy.
+	 */
+	Status = QueueRun(BLOCKING_PROGRAM_SIZE, DieBase, SectSize, &QueueTime,
+			&Stats);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	ReportRate("Blocking, 8 B programs", (u64)ByteCount * XSFL_QUEUE_MAX_DIES,
+			SyncTime);
+	ReportRate("Queued, 8 B programs  ", Stats.BytesWritten, QueueTime);
+	xil_printf("Overlapped commands %d, staged programs %d, busy polls %d\r\n",
+			Stats.Overlapped, Stats.Staged, Stats.BusyPolls);
+
+	Status = QueueRun(0U, DieBase, SectSize, &QueueTime, &Stats);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	ReportRate("Queued, page programs ", Stats.BytesWritten, QueueTime);
+	xil_printf("Overlapped commands %d, staged programs %d, busy polls %d\r\n",
+			Stats.Overlapped, Stats.Staged, Stats.BusyPolls);
+
+	/*
+	 * Read back each die through the queue and verify.
+	 */
+	for (Die = 0; Die < XSFL_QUEUE_MAX_DIES; Die++) {
+		for (Count = 0; Count < ByteCount; Count++) {
+			ReadBuffer[Count] = 0;
+		}
+
+		IoReqs[0].Op = XSFL_IO_READ;
+		IoReqs[0].Address = DieBase[Die];
+		IoReqs[0].ByteCount = ByteCount;
+		IoReqs[0].BufferPtr = ReadBuffer;
+		IoReqs[0].Handler = IoDoneHandler;
+		IoReqs[0].CallBackRef = NULL;
+		Status = XSfl_FlashQueueSubmit(SflHandler, &IoReqs[0]);
+		Status |= XSfl_FlashQueueDrain(SflHandler);
+		if ((Status != XST_SUCCESS) || (IoErrors != 0)) {
+			return XST_FAILURE;
+		}
+
+		for (Count = 0; Count < ByteCount; Count++) {
+			if (ReadBuffer[Count] != WriteBuffer[Count]) {
+				return XST_FAILURE;
+			}
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Erases and writes TEST_SECTORS sectors of each die through the I/O queue.
+ *
+ * @param	ProgramSize is the queue program size, 0 for one page.
+ * @param	DieBase is the base address of each die.
+ * @param	SectSize is the flash sector size.
+ * @param	TimePtr returns the virtual time of the run.
+ * @param	StatsPtr returns the queue statistics of the run.
+ *
+ * @return	XST_SUCCESS if successful, else XST_FAILURE.
+ *
+ *****************************************************************************/
+static int QueueRun(u32 ProgramSize, const u32 *DieBase, u32 SectSize,
+		u64 *TimePtr, XSfl_QueueStats *StatsPtr)
+{
+	u32 Status;
+	u32 Die;
+	u32 Sect;
+	u32 Req = 0;
+	u64 Start;
+
+	/* Also clears the statistics of the previous run */
+	Status = XSfl_FlashQueueInit(SflHandler);
+	if ((Status == XST_SUCCESS) && (ProgramSize != 0U)) {
+		Status = XSfl_FlashQueueSetProgramSize(SflHandler, ProgramSize);
+	}
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	IoErrors = 0;
+	Start = XSfl_SimGetTimeNs();
+	for (Die = 0; Die < XSFL_QUEUE_MAX_DIES; Die++) {
+		for (Sect = 0; Sect < TEST_SECTORS; Sect++) {
+			IoReqs[Req].Op = XSFL_IO_ERASE;
+			IoReqs[Req].Address = DieBase[Die] + (Sect * SectSize);
+			IoReqs[Req].ByteCount = SectSize;
+			IoReqs[Req].BufferPtr = NULL;
+			IoReqs[Req].Handler = IoDoneHandler;
+			IoReqs[Req].CallBackRef = NULL;
+			Status = XSfl_FlashQueueSubmit(SflHandler, &IoReqs[Req++]);
+
+			IoReqs[Req].Op = XSFL_IO_WRITE;
+			IoReqs[Req].Address = DieBase[Die] + (Sect * SectSize);
+			IoReqs[Req].ByteCount = SectSize;
+			IoReqs[Req].BufferPtr = WriteBuffer + (Sect * SectSize);
+			IoReqs[Req].Handler = IoDoneHandler;
+			IoReqs[Req].CallBackRef = NULL;
+			Status |= XSfl_FlashQueueSubmit(SflHandler, &IoReqs[Req++]);
+			if (Status != XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+		}
+	}
+
+	Status = XSfl_FlashQueueDrain(SflHandler);
+	if ((Status != XST_SUCCESS) || (IoErrors != 0)) {
+		return XST_FAILURE;
+	}
+	*TimePtr = XSfl_SimGetTimeNs() - Start;
+
+	XSfl_FlashQueueGetStats(SflHandler, StatsPtr);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Completion callback of the queued requests, counts failed requests.
+ *
+ *****************************************************************************/
+static void IoDoneHandler(void *CallBackRef, XSfl_IoReq *IoReq, u32 Status)
+{
+	(void)CallBackRef;
+	(void)IoReq;
+
+	if (Status != XST_SUCCESS) {
+		IoErrors++;
+	}
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Prints the programmed bytes, the virtual time and the rate in MB/s.
+ *
+ *****************************************************************************/
+static void ReportRate(const char *Name, u64 Bytes, u64 TimeNs)
+{
+	u32 Rate = 0;
+
+	/* Rate in 1/100 MB/s */
+	if (TimeNs != 0U) {
+		Rate = (u32)((Bytes * 100000000000ULL) / (TimeNs * 1048576U));
+	}
+
+	xil_printf("%s: %d KB in %d us, %d.%02d MB/s\r\n", Name, (u32)(Bytes / 1024U),
+			(u32)(TimeNs / 1000U), Rate / 100U, Rate % 100U);
+}
+#else
+int main(void)
+{
+	xil_printf("SflQueueSimExample needs the library built with XILSFL_sim_flash\r\n");
+	return XST_FAILURE;
+}
+#endif
@@ -22,6 +22,10 @@
  * 1.0   sb  8/20/24  Initial release
  * 1.0   sb  9/25/24  Add XSfl_FlashRead API and callback for non blocking transfer
  *                    in XSfl_CntrlInfo.
+ * 1.1   sb  10/19/26 Add queued asynchronous I/O engine and simulated flash
+ *                    controller.
+ * 1.1   sb  10/19/26 Add power cut injection to the simulated flash controller.
+ * 1.1   sb  10/19/26 Take XSFL_SIM_FLASH from xilsfl_config.h.
  *
  * </pre>
  *
@@ -31,6 +35,7 @@
 
 /***************************** Include Files *********************************/
 #include "xparameters.h"	/* SDK generated parameters */
+#include "xilsfl_config.h"	/* Library build options */
 #ifdef XPAR_XOSPIPSV_NUM_INSTANCES
 #include "xospipsv.h"		/* OSPIPSV device driver */
 #endif
@@ -110,6 +115,7 @@
 
 /**< Controller Type */
 #define XSFL_OSPI_CNTRL 0x01
+#define XSFL_SIM_CNTRL  0x02	/**< Simulated flash, needs XSFL_SIM_FLASH */
 
 /* Flash Device Type */
 #define XSFL_QSPI_FLASH  0x01
@@ -192,6 +198,23 @@
 #define XSFL_PAGE_SIZE     3U /* Individual sector size or combined sector size
                                  in case of Parrellel config */
 
+/**
+ * @name I/O queue request types
+ * @{
+ */
+/**
+ * Operations that can be submitted to the queued I/O engine.
+ */
+#define XSFL_IO_READ       0U
+#define XSFL_IO_WRITE      1U
+#define XSFL_IO_ERASE      2U
+/** @} */
+
+/*
+ * Max number of flash dies (chip selects) the I/O queue interleaves across
+ */
+#define XSFL_QUEUE_MAX_DIES    2U
+
 /**************************** Type Definitions *******************************/
 
 /**
@@ -292,8 +315,52 @@ typedef union XSfl_UserConfig{
 		u8 ReadMode;		/**< Operating Mode DAC or INDAC */
 		u8 ChipSelect;		/**< Chip select information */
 	} Ospi_Config;
+#ifdef XSFL_SIM_FLASH
+	struct Sim_Config{
+		u8 ConnectionMode;	/**< Single or stacked simulated flash */
+	} Sim_Config;
+#endif
 } XSfl_UserConfig;
 
+typedef struct XSfl_IoReq XSfl_IoReq;
+
+/**
+ * Completion callback of a queued I/O request. Status is XST_SUCCESS when
+ * the whole request completed, XST_FAILURE otherwise.
+ */
+typedef void (*XSfl_IoHandler)(void *CallBackRef, XSfl_IoReq *IoReq, u32 Status);
+
+/**
+ * This typedef describes one request of the queued I/O engine. The request
+ * and its buffer are owned by the caller and must stay valid until the
+ * completion callback is invoked.
+ */
+struct XSfl_IoReq {
+	u8 *BufferPtr;		/**< Read destination or write source buffer */
+	u32 Address;		/**< Flash address */
+	u32 ByteCount;		/**< Number of bytes to read/write/erase */
+	u8 Op;			/**< XSFL_IO_READ, XSFL_IO_WRITE or XSFL_IO_ERASE */
+	XSfl_IoHandler Handler;	/**< Completion callback, may be NULL */
+	void *CallBackRef;	/**< Argument passed to the callback */
+
+	u32 Done;		/**< Bytes completed, maintained by the engine */
+	XSfl_IoReq *Next;	/**< Queue link, maintained by the engine */
+};
+
+/**
+ * This typedef contains the statistics of the queued I/O engine.
+ */
+typedef struct {
+	u64 BytesRead;		/**< Bytes read through the queue */
+	u64 BytesWritten;	/**< Bytes programmed through the queue */
+	u64 BytesErased;	/**< Bytes erased through the queue */
+	u32 Completed;		/**< Requests completed successfully */
+	u32 Failed;		/**< Requests completed with an error */
+	u32 BusyPolls;		/**< Status polls that found a die busy */
+	u32 Overlapped;		/**< Commands issued while another die was busy */
+	u32 Staged;		/**< Pages staged while their die was busy */
+} XSfl_QueueStats;
+
 /************************** Function Prototypes ******************************/
 u32 XSfl_FlashInit(u8 *SflHandler, XSfl_UserConfig SflUserOptions, u8 ControllerInfo);
 u32 XSfl_FlashErase(u8 SflHandler, u32 Address, u32 ByteCount);
@@ -305,6 +372,18 @@ u32 XSfl_FlashReadDone(u8 SflHandler);
 u32 XSfl_FlashGetInfo(u8 SflHandler, u8 Option, u32 *DataPtr);
 u32 XSfl_FlashRead(u8 SflHandler, u32 Address, u32 ByteCount,
                 u8 *ReadBfrPtr, u64 RxAddr64bit);
+u32 XSfl_FlashQueueInit(u8 SflHandler);
+u32 XSfl_FlashQueueSetProgramSize(u8 SflHandler, u32 ProgramSize);
+u32 XSfl_FlashQueueSubmit(u8 SflHandler, XSfl_IoReq *IoReq);
+u32 XSfl_FlashQueuePoll(u8 SflHandler);
+u32 XSfl_FlashQueueDrain(u8 SflHandler);
+void XSfl_FlashQueueGetStats(u8 SflHandler, XSfl_QueueStats *StatsPtr);
+#ifdef XSFL_SIM_FLASH
+u64 XSfl_SimGetTimeNs(void);
+void XSfl_SimSetPowerCut(u32 Count);
+u8 XSfl_SimPowerLost(void);
+void XSfl_SimPowerRestore(void);
+#endif
 
 /************************** Variable Definitions *****************************/
 #endif /* XILSFL_H */
@@ -19,6 +19,8 @@
  * ----- --- -------- -----------------------------------------------
  * 1.0   sb  8/20/24  Initial release
  * 1.0   sb  9/25/24  Add XSfl_FlashNonBlockingReadProcess API.
+ * 1.1   sb  10/19/26 Add split program/erase/status helpers for the I/O queue
+ *                    and the simulated flash controller.
  *
  * </pre>
  *
@@ -43,12 +45,18 @@
 
 /************************** Function Prototypes ******************************/
 u32 XSfl_OspiInit(XSfl_Interface *Ptr, const XSfl_UserConfig *UserConfig);
+#ifdef XSFL_SIM_FLASH
+u32 XSfl_SimInit(XSfl_Interface *Ptr, const XSfl_UserConfig *UserConfig);
+#endif
 u32 XSfl_FlashIdRead(XSfl_Interface *SflInstnacePtr, u8 ChipSelect, u8 *SflReadBuffer );
 u32 XSfl_CalculateFCTIndex(u32 ReadId, u32 *FCTIndex);
 u32 XSfl_FlashSetSDRDDRMode(XSfl_Interface *SflInstnacePtr, int Mode, u8 *SflReadBuffer);
 u32 XSfl_FlashEnterExit4BAddMode(XSfl_Interface *SflInstnacePtr, int Enable, u8 ChpiSelect);
 u32 XSfl_GetRealAddr(XSfl_Interface *SflInstnacePtr, u32 Address);
 u32 XSfl_SectorErase(XSfl_Interface *SflInstnacePtr, u32 Address);
+u32 XSfl_SectorEraseStart(XSfl_Interface *SflInstancePtr, u32 Address);
+u32 XSfl_FlashProgramStart(XSfl_Interface *SflInstancePtr, u32 Address, u32 ByteCount,
+		u8 *WriteBfrPtr);
 u32 XSfl_FlashPageWrite(XSfl_Interface *SflInstnacePtr, u32 Address, u32 ByteCount,
 		u8 *WriteBfrPtr);
 u32 XSfl_FlashReadProcess(XSfl_Interface *SflInstnacePtr, u32 Address, u32 ByteCount,
@@ -56,6 +64,7 @@ u32 XSfl_FlashReadProcess(XSfl_Interface *SflInstnacePtr, u32 Address, u32 ByteC
 u32 XSfl_FlashTransferDone(XSfl_Interface *SflInstnacePtr);
 
 u32 XSfl_WaitforStatusDone(XSfl_Interface *SflInstnacePtr);
+u32 XSfl_FlashStatusReady(XSfl_Interface *SflInstancePtr, u8 *IsReady);
 u32 XSfl_FlashRegisterReadWrite(XSfl_Interface *SflInstnacePtr,
 		u8 *RxBfrPtr,u8 *TxBfrPtr, u32 *CmdBufferPtr,u8 Addrvalid);
 u32 XSfl_FlashCmdTransfer(XSfl_Interface *SflInstnacePtr,u8 Cmd);
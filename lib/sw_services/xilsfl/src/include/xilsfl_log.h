@@ -0,0 +1,150 @@
+/******************************************************************************
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xilsfl_log.h
+ * @addtogroup xilsfl overview
+ * @{
+ * @details
+ *
+ * This file contains the interface of the log-structured record store of the
+ * SFL library. Records are identified by a 32-bit key, appended to the flash
+ * and never overwritten in place; an in-RAM index locates the latest record of
+ * every key. See xilsfl_log.c for the on-flash layout.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who Date     Changes
+ * ----- --- -------- -----------------------------------------------
+ * 1.1   sb  10/19/26 Initial release
+ *
+ * </pre>
+ *
+ ******************************************************************************/
+#ifndef XILSFL_LOG_H
+#define XILSFL_LOG_H
+
+/***************************** Include Files *********************************/
+#include "xilsfl.h"
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * Max number of flash sectors managed by one log
+ */
+#ifndef XSFL_LOG_MAX_SECTORS
+#define XSFL_LOG_MAX_SECTORS	16U
+#endif
+
+/*
+ * Number of index slots, must be a power of two. Bounds the number of
+ * distinct keys (live records and pending deletes) of one log.
+ */
+#ifndef XSFL_LOG_INDEX_SIZE
+#define XSFL_LOG_INDEX_SIZE	256U
+#endif
+
+/*
+ * Max data bytes of one record
+ */
+#ifndef XSFL_LOG_MAX_DATA
+#define XSFL_LOG_MAX_DATA	244U
+#endif
+
+/*
+ * Erase count spread above which compaction also moves cold sectors
+ * (static wear levelling)
+ */
+#ifndef XSFL_LOG_WEAR_DELTA
+#define XSFL_LOG_WEAR_DELTA	16U
+#endif
+
+/*
+ * Free sector count at or below which XSfl_LogCompact() reclaims space
+ */
+#ifndef XSFL_LOG_GC_FREE_LOW
+#define XSFL_LOG_GC_FREE_LOW	2U
+#endif
+
+#define XSFL_LOG_INVALID_KEY	0xFFFFFFFFU /**< Reserved, marks blank flash */
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * In-RAM index entry, locates the latest record of a key.
+ */
+typedef struct {
+	u32 Key;		/**< Record key */
+	u32 Addr;		/**< Flash address of the latest record */
+	u16 Len;		/**< Data length of the latest record */
+	u8 State;		/**< Slot state, internal */
+} XSfl_LogKey;
+
+/**
+ * RAM copy of the state of one managed sector.
+ */
+typedef struct {
+	u32 Seq;		/**< Append sequence number, 0 if not in use */
+	u32 EraseCount;		/**< Number of erases of the sector */
+	u32 WriteOffset;	/**< End of the valid records */
+	u32 LiveBytes;		/**< Bytes of records still referenced */
+	u8 State;		/**< Sector state, internal */
+} XSfl_LogSector;
+
+/**
+ * This typedef contains the statistics of a log.
+ */
+typedef struct {
+	u32 Writes;		/**< Records written by the user */
+	u32 Deletes;		/**< Keys deleted by the user */
+	u64 UserBytes;		/**< Data bytes written by the user */
+	u64 FlashBytes;		/**< Bytes programmed, including headers and GC */
+	u32 Compactions;	/**< Sectors reclaimed */
+	u32 WearMoves;		/**< Sectors reclaimed for wear levelling */
+	u32 RecordsMoved;	/**< Records copied by compaction */
+	u32 TornRecords;	/**< Incomplete records found at mount */
+	u32 FreeSectors;	/**< Sectors currently erased and unused */
+	u32 MinEraseCount;	/**< Lowest erase count of the managed sectors */
+	u32 MaxEraseCount;	/**< Highest erase count of the managed sectors */
+	u32 NumKeys;		/**< Keys currently stored */
+} XSfl_LogStats;
+
+/**
+ * The XSfl_Log instance data. The user is required to allocate a variable
+ * of this type for every log. A pointer to a variable of this type is then
+ * passed to the log API functions.
+ */
+typedef struct {
+	XSfl_LogSector Sector[XSFL_LOG_MAX_SECTORS]; /**< Managed sectors */
+	XSfl_LogKey Index[XSFL_LOG_INDEX_SIZE];	/**< Key index */
+	XSfl_LogStats Stats;	/**< Statistics */
+	u32 BaseAddr;		/**< Flash address of the first sector */
+	u32 SectSize;		/**< Sector size in bytes */
+	u32 NumSectors;		/**< Number of managed sectors */
+	u32 NextSeq;		/**< Sequence number of the next opened sector */
+	u32 NumKeys;		/**< Keys present in the index */
+	u32 Head;		/**< Sector being appended to */
+	u32 GcSect;		/**< Sector being compacted */
+	u32 GcOffset;		/**< Next record to examine in GcSect */
+	u8 SflHandler;		/**< SFL handler of the flash */
+	u8 GcWear;		/**< GcSect was picked for wear levelling */
+	u8 IsReady;		/**< Log is mounted */
+	u32 RecBuf[(12U + XSFL_LOG_MAX_DATA + 7U) / 4U]; /**< Record buffer */
+} XSfl_Log;
+
+/************************** Function Prototypes ******************************/
+u32 XSfl_LogFormat(XSfl_Log *LogPtr, u8 SflHandler, u32 BaseAddr, u32 NumSectors);
+u32 XSfl_LogMount(XSfl_Log *LogPtr, u8 SflHandler, u32 BaseAddr, u32 NumSectors);
+u32 XSfl_LogWrite(XSfl_Log *LogPtr, u32 Key, const u8 *DataPtr, u32 Len);
+u32 XSfl_LogRead(XSfl_Log *LogPtr, u32 Key, u8 *DataPtr, u32 MaxLen, u32 *LenPtr);
+u32 XSfl_LogDelete(XSfl_Log *LogPtr, u32 Key);
+u32 XSfl_LogCompact(XSfl_Log *LogPtr, u32 MaxRecords);
+void XSfl_LogGetStats(XSfl_Log *LogPtr, XSfl_LogStats *StatsPtr);
+
+#endif /* XILSFL_LOG_H */
+/** @} */
@@ -21,6 +21,7 @@
  * 1.0   sb  8/20/24  Initial release
  * 1.0   sb  9/25/24  Add check for bytecount in non-blocking read and
  *                    add support for unaligned byte read
+ * 1.1   sb  10/19/26 Add simulated flash controller type
  *
  * </pre>
  *
@@ -56,7 +57,6 @@ u32 XSfl_FlashInit(u8 *SflHandler, XSfl_UserConfig SflUserOptions, u8 Controller
 
 	u32 FlashSize;
 	u32 Status;
-	u8 FlashType;
 	u8 FCTIndex;
 	u8 DualSize;
 	u8 Idx = SflInstance.Index;
@@ -82,6 +82,11 @@ u32 XSfl_FlashInit(u8 *SflHandler, XSfl_UserConfig SflUserOptions, u8 Controller
 		case XSFL_OSPI_CNTRL:
 			Status = XSfl_OspiInit(&SflInstance.Instance[Idx], &SflUserOptions);
 			break;
+#endif
+#ifdef XSFL_SIM_FLASH
+		case XSFL_SIM_CNTRL:
+			Status = XSfl_SimInit(&SflInstance.Instance[Idx], &SflUserOptions);
+			break;
 #endif
 		default:
 #ifdef XSFL_DEBUG
@@ -108,11 +113,11 @@ u32 XSfl_FlashInit(u8 *SflHandler, XSfl_UserConfig SflUserOptions, u8 Controller
 	}
 
 	FCTIndex = SflInstance.Instance[Idx].SflFlashInfo.FlashIndex;
-	FlashType = Flash_Config_Table[FCTIndex].FlashType;
 	FlashSize = Flash_Config_Table[FCTIndex].FlashDeviceSize;
 
+#ifdef XPAR_XOSPIPSV_NUM_INSTANCES
 	if (SflInstance.Instance[Idx].CntrlInfo.CntrlType == XSFL_OSPI_CNTRL) {
-		if (FlashType == XSFL_OSPI_FLASH){
+		if (Flash_Config_Table[FCTIndex].FlashType == XSFL_OSPI_FLASH){
 			/* Set Flash device and Controller mode to DDR Phy */
 			Status = XSfl_FlashSetSDRDDRMode(&SflInstance.Instance[Idx], XSFL_EDGE_MODE_DDR_PHY,
 					SflReadBuffer);
@@ -171,6 +176,7 @@ u32 XSfl_FlashInit(u8 *SflHandler, XSfl_UserConfig SflUserOptions, u8 Controller
 	}
 
 set_mode_done:
+#endif
 
 #ifdef XSFL_DEBUG
 	xil_printf("Flash connection mode : %d\n\r",
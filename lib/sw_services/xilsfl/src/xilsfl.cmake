@@ -0,0 +1,9 @@
+# Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+# SPDX-License-Identifier: MIT
+
+option(XILSFL_sim_flash "Build the simulated flash controller (XSFL_SIM_CNTRL) to measure the library without hardware" OFF)
+if (${XILSFL_sim_flash})
+	set(XSFL_SIM_FLASH " ")
+endif()
+
+configure_file(${CMAKE_CURRENT_SOURCE_DIR}/xilsfl_config.h.in ${CMAKE_BINARY_DIR}/include/xilsfl_config.h)
@@ -21,6 +21,8 @@
  * 1.0   sb  8/20/24  Initial release
  * 1.0   sb  9/25/24  Update XSfl_FlashReadProcess() to support unaligned bytes read and
  *                    add support for non-blocking read
+ * 1.1   sb  10/19/26 Split program/erase command issue from the status wait so
+ *                    the queued engine can overlap them across dies
  *
  * </pre>
  *
@@ -212,17 +214,20 @@ u32 XSfl_FlashEnterExit4BAddMode(XSfl_Interface *SflInstancePtr, int Enable, u8
 /*****************************************************************************/
 /**
  *
- * This function used to erase the sectors of the serial nor flash connected to the
- * specific interface.
+ * This function issues the sector erase command to the serial nor flash
+ * without waiting for the erase to complete.
  *
  * @param	Sfl_Handler is a pointer to the XSfl interface component to use.
- * @param	Address contains the address of the first sector which needs to
+ * @param	Address contains the address of the sector which needs to
  *              be erased.
  *
  * @return	XST_SUCCESS if successful, else error code.
  *
+ * @note	The caller has to poll the flash status before issuing the next
+ *		command to the same flash.
+ *
  ******************************************************************************/
-u32 XSfl_SectorErase(XSfl_Interface *SflInstancePtr, u32 Address)
+u32 XSfl_SectorEraseStart(XSfl_Interface *SflInstancePtr, u32 Address)
 {
 	u32 Status;
 	u32 RealAddr;
@@ -280,6 +285,34 @@ u32 XSfl_SectorErase(XSfl_Interface *SflInstancePtr, u32 Address)
 		return XST_FAILURE;
 	}
 
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function used to erase the sectors of the serial nor flash connected to the
+ * specific interface.
+ *
+ * @param	Sfl_Handler is a pointer to the XSfl interface component to use.
+ * @param	Address contains the address of the first sector which needs to
+ *              be erased.
+ *
+ * @return	XST_SUCCESS if successful, else error code.
+ *
+ ******************************************************************************/
+u32 XSfl_SectorErase(XSfl_Interface *SflInstancePtr, u32 Address)
+{
+	u32 Status;
+
+	/* Validate the input arguments */
+	Xil_AssertNonvoid(SflInstancePtr != NULL);
+
+	Status = XSfl_SectorEraseStart(SflInstancePtr, Address);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
 	Status = XSfl_WaitforStatusDone(SflInstancePtr);
 	if (Status != XST_SUCCESS) {
 		return XST_FAILURE;
@@ -288,6 +321,84 @@ u32 XSfl_SectorErase(XSfl_Interface *SflInstancePtr, u32 Address)
 	return 0;
 }
 
+/*****************************************************************************/
+/**
+ *
+ * This function issues a single program command to the serial nor flash
+ * without waiting for the program operation to complete.
+ *
+ * @param	Sfl_Handler is a index to the Sfl interface component to use.
+ * @param	Address contains the flash address to be programmed.
+ * @param	ByteCount contains the number of bytes to program, it must not
+ *		cross a page boundary.
+ * @param	WriteBfrPtr is Pointer to the write buffer (which is to be transmitted)
+ *
+ * @return	XST_SUCCESS if successful, else Error code.
+ *
+ * @note	The caller has to poll the flash status before issuing the next
+ *		command to the same flash.
+ *
+ ******************************************************************************/
+u32 XSfl_FlashProgramStart(XSfl_Interface *SflInstancePtr, u32 Address, u32 ByteCount,
+		u8 *WriteBfrPtr)
+{
+	u32 Status;
+	u32 RealAddr;
+	u8 FCTIndex;
+
+	/* Validate the input arguments */
+	Xil_AssertNonvoid(SflInstancePtr != NULL);
+
+	FCTIndex = SflInstancePtr->SflFlashInfo.FlashIndex;
+
+	/*
+	 * Translate address based on type of connection
+	 * If stacked assert the slave select based on address
+	 */
+	RealAddr = XSfl_GetRealAddr(SflInstancePtr, Address);
+
+	/*
+	 * Send the write enable command to the Flash so that it can be
+	 * written to, this needs to be sent as a separate transfer before
+	 * the write
+	 */
+	Status = XSfl_FlashCmdTransfer(SflInstancePtr, XSFL_WRITE_ENABLE_CMD);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	SflMsg.Opcode = (u8)Flash_Config_Table[FCTIndex].WriteCmd;
+	SflMsg.Addrvalid = 1;
+	SflMsg.TxBfrPtr = WriteBfrPtr;
+	SflMsg.RxBfrPtr = NULL;
+	SflMsg.ByteCount = ByteCount;
+	SflMsg.Proto =  (u8)Flash_Config_Table[FCTIndex].Proto;
+	SflMsg.Dummy = 0;
+	SflMsg.Addrsize = 4;
+	SflMsg.Addr = RealAddr;
+	SflMsg.DualByteOpCode = 0;
+
+	if(Flash_Config_Table[FCTIndex].FlashType == XSFL_QSPI_FLASH) {
+		SflMsg.Proto = (u8)(Flash_Config_Table[FCTIndex].Proto >> 16);
+	}
+	if (SflInstancePtr->CntrlInfo.SdrDdrMode == XSFL_EDGE_MODE_DDR_PHY) {
+		SflMsg.Proto = (u8)(Flash_Config_Table[FCTIndex].Proto >> 8);
+	}
+
+	if (Flash_Config_Table[FCTIndex].ExtOpCodeType == XSFL_DUAL_BYTE_OP_INVERT){
+		SflMsg.DualByteOpCode = (u8)(~SflMsg.Opcode);
+	} else if (Flash_Config_Table[FCTIndex].ExtOpCodeType == XSFL_DUAL_BYTE_OP_SAME){
+		SflMsg.DualByteOpCode = (u8)(SflMsg.Opcode);
+	}
+
+	Status = SflInstancePtr->CntrlInfo.Transfer(SflInstancePtr->CntrlInfo.DeviceId, &SflMsg);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  *
@@ -307,31 +418,11 @@ u32 XSfl_FlashPageWrite(XSfl_Interface *SflInstancePtr, u32 Address, u32 ByteCou
 {
 	u32 Status;
 	u32 Bytestowrite;
-	u32 RealAddr;
-	u8 FCTIndex;
 
 	/* Validate the input arguments */
 	Xil_AssertNonvoid(SflInstancePtr != NULL);
 
-	FCTIndex = SflInstancePtr->SflFlashInfo.FlashIndex;
-
 	while (ByteCount != 0) {
-		/*
-		 * Translate address based on type of connection
-		 * If stacked assert the slave select based on address
-		 */
-		RealAddr = XSfl_GetRealAddr(SflInstancePtr, Address);
-
-		/*
-		 * Send the write enable command to the Flash so that it can be
-		 * written to, this needs to be sent as a separate transfer before
-		 * the write
-		 */
-		Status = XSfl_FlashCmdTransfer(SflInstancePtr, XSFL_WRITE_ENABLE_CMD);
-		if (Status != XST_SUCCESS) {
-			return XST_FAILURE;
-		}
-
 		if (ByteCount <= 8) {
 			Bytestowrite = ByteCount;
 			ByteCount = 0;
@@ -341,31 +432,8 @@ u32 XSfl_FlashPageWrite(XSfl_Interface *SflInstancePtr, u32 Address, u32 ByteCou
 			ByteCount -= 8;
 		}
 
-		SflMsg.Opcode = (u8)Flash_Config_Table[FCTIndex].WriteCmd;
-		SflMsg.Addrvalid = 1;
-		SflMsg.TxBfrPtr = WriteBfrPtr;
-		SflMsg.RxBfrPtr = NULL;
-		SflMsg.ByteCount = Bytestowrite;
-		SflMsg.Proto =  (u8)Flash_Config_Table[FCTIndex].Proto;
-		SflMsg.Dummy = 0;
-		SflMsg.Addrsize = 4;
-		SflMsg.Addr = RealAddr;
-		SflMsg.DualByteOpCode = 0;
-
-		if(Flash_Config_Table[FCTIndex].FlashType == XSFL_QSPI_FLASH) {
-			SflMsg.Proto = (u8)(Flash_Config_Table[FCTIndex].Proto >> 16);
-		}
-		if (SflInstancePtr->CntrlInfo.SdrDdrMode == XSFL_EDGE_MODE_DDR_PHY) {
-			SflMsg.Proto = (u8)(Flash_Config_Table[FCTIndex].Proto >> 8);
-		}
-
-		if (Flash_Config_Table[FCTIndex].ExtOpCodeType == XSFL_DUAL_BYTE_OP_INVERT){
-			SflMsg.DualByteOpCode = (u8)(~SflMsg.Opcode);
-		} else if (Flash_Config_Table[FCTIndex].ExtOpCodeType == XSFL_DUAL_BYTE_OP_SAME){
-			SflMsg.DualByteOpCode = (u8)(SflMsg.Opcode);
-		}
-
-		Status = SflInstancePtr->CntrlInfo.Transfer(SflInstancePtr->CntrlInfo.DeviceId, &SflMsg);
+		Status = XSfl_FlashProgramStart(SflInstancePtr, Address, Bytestowrite,
+				WriteBfrPtr);
 		if (Status != XST_SUCCESS) {
 			return XST_FAILURE;
 		}
@@ -20,6 +20,7 @@
  * Ver   Who Date     Changes
  * ----- --- -------- -----------------------------------------------
  * 1.0   sb  8/20/24  Initial release
+ * 1.1   sb  10/19/26 Add XSfl_FlashStatusReady() for non-blocking status poll
  *
  * </pre>
  *
@@ -141,16 +142,18 @@ u32 XSfl_FlashCmdTransfer(XSfl_Interface *SflInstancePtr,u8 Cmd){
 /*****************************************************************************/
 /**
  *
- * This API can be used to read status of the flash status register.
+ * This API reads the flash status register once and reports whether the
+ * currently selected flash has finished its program/erase operation.
  *
  * @param	SflInstancePtr is a pointer to the interface driver component to use.
+ * @param	IsReady is set to 1 if the flash is ready, 0 if it is still busy.
  *
  * @return	XST_SUCCESS if successful, else error code.
  *
  * @note	This API can only be used for one flash at a time.
  *
  ******************************************************************************/
-u32 XSfl_WaitforStatusDone(XSfl_Interface *SflInstancePtr){
+u32 XSfl_FlashStatusReady(XSfl_Interface *SflInstancePtr, u8 *IsReady){
 
 	XSfl_Msg SflMsg = {0};
 	u32 Status;
@@ -162,44 +165,65 @@ u32 XSfl_WaitforStatusDone(XSfl_Interface *SflInstancePtr){
 	u8 FlashStatus[2] __attribute__ ((aligned(4)));
 #endif
 
-	while (1) {
-		SflMsg.Opcode = Flash_Config_Table[FCTIndex].StatusCmd;
-		SflMsg.TxBfrPtr = NULL;
-		SflMsg.RxBfrPtr = FlashStatus;
-		SflMsg.ByteCount = 1;
-		SflMsg.Dummy     = 0;
-		SflMsg.Addrsize = 0;
-		SflMsg.Addrvalid = 0;
-		SflMsg.Addr = 0;
-		SflMsg.DualByteOpCode = 0;
-		SflMsg.Proto =  (u8)Flash_Config_Table[0].Proto;
-		if (SflInstancePtr->CntrlInfo.SdrDdrMode == XSFL_EDGE_MODE_DDR_PHY) {
-			SflMsg.Proto = (u8)(Flash_Config_Table[0].Proto >> 8);
-			SflMsg.ByteCount = 2;
-			SflMsg.Dummy += 8;
-		}
+	SflMsg.Opcode = Flash_Config_Table[FCTIndex].StatusCmd;
+	SflMsg.TxBfrPtr = NULL;
+	SflMsg.RxBfrPtr = FlashStatus;
+	SflMsg.ByteCount = 1;
+	SflMsg.Dummy     = 0;
+	SflMsg.Addrsize = 0;
+	SflMsg.Addrvalid = 0;
+	SflMsg.Addr = 0;
+	SflMsg.DualByteOpCode = 0;
+	SflMsg.Proto =  (u8)Flash_Config_Table[0].Proto;
+	if (SflInstancePtr->CntrlInfo.SdrDdrMode == XSFL_EDGE_MODE_DDR_PHY) {
+		SflMsg.Proto = (u8)(Flash_Config_Table[0].Proto >> 8);
+		SflMsg.ByteCount = 2;
+		SflMsg.Dummy += 8;
+	}
 
-		if (Flash_Config_Table[FCTIndex].ExtOpCodeType == XSFL_DUAL_BYTE_OP_INVERT){
-			SflMsg.DualByteOpCode = (u8)(~SflMsg.Opcode);
-		} else if (Flash_Config_Table[FCTIndex].ExtOpCodeType == XSFL_DUAL_BYTE_OP_SAME){
-			SflMsg.DualByteOpCode = (u8)(SflMsg.Opcode);
-		}
+	if (Flash_Config_Table[FCTIndex].ExtOpCodeType == XSFL_DUAL_BYTE_OP_INVERT){
+		SflMsg.DualByteOpCode = (u8)(~SflMsg.Opcode);
+	} else if (Flash_Config_Table[FCTIndex].ExtOpCodeType == XSFL_DUAL_BYTE_OP_SAME){
+		SflMsg.DualByteOpCode = (u8)(SflMsg.Opcode);
+	}
+
+	Status = SflInstancePtr->CntrlInfo.Transfer(SflInstancePtr->CntrlInfo.DeviceId, &SflMsg);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
 
-		Status = SflInstancePtr->CntrlInfo.Transfer(SflInstancePtr->CntrlInfo.DeviceId, &SflMsg);
+	if (Flash_Config_Table[FCTIndex].FSRFlag) {
+		*IsReady = ((FlashStatus[0] & 0x80) != 0) ? 1U : 0U;
+	} else {
+		*IsReady = ((FlashStatus[0] & 0x01) == 0) ? 1U : 0U;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This API can be used to read status of the flash status register.
+ *
+ * @param	SflInstancePtr is a pointer to the interface driver component to use.
+ *
+ * @return	XST_SUCCESS if successful, else error code.
+ *
+ * @note	This API can only be used for one flash at a time.
+ *
+ ******************************************************************************/
+u32 XSfl_WaitforStatusDone(XSfl_Interface *SflInstancePtr){
+
+	u32 Status;
+	u8 IsReady = 0;
+
+	do {
+		Status = XSfl_FlashStatusReady(SflInstancePtr, &IsReady);
 		if (Status != XST_SUCCESS) {
 			return XST_FAILURE;
 		}
-
-		if (Flash_Config_Table[FCTIndex].FSRFlag) {
-			if ((FlashStatus[0] & 0x80) != 0) {
-				break;
-			}
-		} else {
-			if ((FlashStatus[0] & 0x01) == 0) {
-				break;
-			}
-		}
-	}
+	} while (IsReady == 0U);
 
 	return Status;
 }
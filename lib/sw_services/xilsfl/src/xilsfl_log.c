@@ -0,0 +1,1250 @@
+/******************************************************************************
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xilsfl_log.c
+ * @addtogroup xilsfl overview
+ * @{
+ *
+ * The xilsfl_log.c file implements a log-structured, wear-levelled record
+ * store on top of the SFL flash APIs.
+ *
+ * A record update never rewrites a sector. Records are appended to the head
+ * sector with a single program of a few pages, and an in-RAM hash index maps
+ * every key to its latest record, so reads and writes cost O(1) flash
+ * operations instead of a read-modify-erase-write of a whole sector.
+ * Superseded records are reclaimed by compaction: the live records of a
+ * sealed sector are copied to the head and the sector is erased. Compaction
+ * can be run in small steps from an idle loop with XSfl_LogCompact(); a write
+ * that finds no free sector left compacts in the foreground.
+ *
+ * Sector layout:
+ *	0x00 Magic, EraseCount, ~EraseCount, 0xFFFFFFFF  written after erase
+ *	0x10 Seq, ~Seq                                   written when opened
+ *	0x18 records
+ *
+ * Record layout, padded with 0xFF to a multiple of 8 bytes:
+ *	0x00 Key
+ *	0x04 Len (16 bits), Flags (8 bits), ~Flags (8 bits)
+ *	0x08 CRC32 of bytes 0x00-0x07 and of the data
+ *	0x0C data
+ *
+ * Power fail safety: a record is acknowledged only after it is fully
+ * programmed. A record cut by a power loss fails its checks at mount; the
+ * bytes it left in the head sector are programmed to zero, a pattern the scan
+ * skips, and appending resumes after them. This relies on NOR flash accepting
+ * a second program that only clears bits, and keeps the head in use so that
+ * the sector reserved for compaction is never lost to a torn record. A
+ * sector is erased only after all its live records have been copied, and the
+ * sequence numbers let the mount replay the sectors in write order so that a
+ * copy and its original resolve to the same value. Sectors with a damaged
+ * header are erased at mount.
+ *
+ * Wear levelling: free sectors are opened lowest erase count first, and when
+ * the erase counts spread more than XSFL_LOG_WEAR_DELTA, XSfl_LogCompact()
+ * moves the data of the coldest sector so that it returns to the pool.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who Date     Changes
+ * ----- --- -------- -----------------------------------------------
+ * 1.1   sb  10/19/26 Initial release
+ * 1.1   sb  10/19/26 Break garbage ties by erase count when picking a victim.
+ *
+ * </pre>
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include "xilsfl_log.h"
+#include "xil_mem.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XSFL_LOG_MAGIC		0x4C534658U /**< "XFSL" */
+
+#define XSFL_LOG_SEQ_OFFSET	0x10U	/**< Sequence number in the header */
+#define XSFL_LOG_SECT_HDR_SIZE	0x18U	/**< Sector header size */
+#define XSFL_LOG_REC_HDR_SIZE	0x0CU	/**< Record header size */
+#define XSFL_LOG_REC_ALIGN	8U	/**< Record size granularity */
+
+#define XSFL_LOG_REC_DATA	0x00U	/**< Record holds data */
+#define XSFL_LOG_REC_DELETE	0x01U	/**< Record deletes the key */
+
+#define XSFL_LOG_SECT_FREE	0U	/**< Erased, header written */
+#define XSFL_LOG_SECT_HEAD	1U	/**< Open for append */
+#define XSFL_LOG_SECT_SEALED	2U	/**< Full, read only */
+#define XSFL_LOG_SECT_DIRTY	3U	/**< Header damaged, needs erase */
+
+#define XSFL_LOG_KEY_EMPTY	0U	/**< Slot never used */
+#define XSFL_LOG_KEY_LIVE	1U	/**< Latest record holds data */
+#define XSFL_LOG_KEY_DELETED	2U	/**< Latest record deletes the key */
+#define XSFL_LOG_KEY_VOID	3U	/**< Slot released */
+
+#define XSFL_LOG_NO_SECT	0xFFFFFFFFU
+
+/*
+ * Free sectors kept for compaction, user writes never use them
+ */
+#define XSFL_LOG_RESERVED_SECTORS	1U
+
+#define XSFL_LOG_MIN_SECTORS	(XSFL_LOG_RESERVED_SECTORS + 2U)
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define XSfl_LogRecSize(Len)	(((Len) + XSFL_LOG_REC_HDR_SIZE + \
+				(XSFL_LOG_REC_ALIGN - 1U)) & \
+				~(XSFL_LOG_REC_ALIGN - 1U))
+
+#define XSfl_LogSectAddr(LogPtr, Sect)	((LogPtr)->BaseAddr + \
+					((Sect) * (LogPtr)->SectSize))
+
+#define XSfl_LogAddrSect(LogPtr, Addr)	(((Addr) - (LogPtr)->BaseAddr) / \
+					(LogPtr)->SectSize)
+
+/************************** Function Prototypes ******************************/
+static u32 XSfl_LogCrc(u32 Crc, const u8 *Buf, u32 Len);
+static u32 XSfl_LogRecCrc(const XSfl_Log *LogPtr, u32 Len);
+static XSfl_LogKey *XSfl_LogFind(XSfl_Log *LogPtr, u32 Key, u8 Insert);
+static void XSfl_LogApply(XSfl_Log *LogPtr, XSfl_LogKey *Entry, u32 Key,
+		u32 Flags, u32 Len, u32 Addr);
+static u32 XSfl_LogFreeSectors(const XSfl_Log *LogPtr);
+static u32 XSfl_LogOldestSeq(const XSfl_Log *LogPtr);
+static u32 XSfl_LogEraseSector(XSfl_Log *LogPtr, u32 Sect, u32 EraseCount);
+static u32 XSfl_LogOpenSector(XSfl_Log *LogPtr);
+static u32 XSfl_LogAppend(XSfl_Log *LogPtr, u32 Len, u32 *AddrPtr);
+static u32 XSfl_LogPickVictim(const XSfl_Log *LogPtr, u8 *WearPtr);
+static u32 XSfl_LogGcStep(XSfl_Log *LogPtr);
+static u32 XSfl_LogGcSector(XSfl_Log *LogPtr);
+static u32 XSfl_LogMakeRoom(XSfl_Log *LogPtr, u32 Size);
+static u32 XSfl_LogPut(XSfl_Log *LogPtr, u32 Key, u32 Flags,
+		const u8 *DataPtr, u32 Len);
+static u32 XSfl_LogScan(XSfl_Log *LogPtr, u32 Sect);
+static u32 XSfl_LogHealTail(XSfl_Log *LogPtr, u32 Sect);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API erases the sectors of a log region, keeping their erase counts,
+ * and mounts the empty log.
+ *
+ * @param	LogPtr is a pointer to the XSfl_Log instance.
+ * @param	SflHandler is the SFL handler of an initialized flash.
+ * @param	BaseAddr is the flash address of the region, sector aligned.
+ * @param	NumSectors is the number of sectors of the region.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if the region is invalid or a flash access fails.
+ *
+ ******************************************************************************/
+u32 XSfl_LogFormat(XSfl_Log *LogPtr, u8 SflHandler, u32 BaseAddr, u32 NumSectors)
+{
+	u32 Status;
+	u32 SectSize;
+	u32 Sect;
+	u32 EraseCount;
+	u32 Hdr[4];
+
+	Xil_AssertNonvoid(LogPtr != NULL);
+	Xil_AssertNonvoid(NumSectors >= XSFL_LOG_MIN_SECTORS);
+	Xil_AssertNonvoid(NumSectors <= XSFL_LOG_MAX_SECTORS);
+
+	Status = XSfl_FlashGetInfo(SflHandler, XSFL_SECT_SIZE, &SectSize);
+	if ((Status != XST_SUCCESS) || ((BaseAddr % SectSize) != 0U)) {
+		return XST_FAILURE;
+	}
+
+	LogPtr->IsReady = 0U;
+	LogPtr->SflHandler = SflHandler;
+	LogPtr->BaseAddr = BaseAddr;
+	LogPtr->SectSize = SectSize;
+	LogPtr->NumSectors = NumSectors;
+
+	for (Sect = 0U; Sect < NumSectors; Sect++) {
+		Status = XSfl_FlashRead(SflHandler, XSfl_LogSectAddr(LogPtr, Sect),
+				sizeof(Hdr), (u8 *)Hdr, 0U);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		EraseCount = 0U;
+		if ((Hdr[0] == XSFL_LOG_MAGIC) && (Hdr[1] == ~Hdr[2])) {
+			EraseCount = Hdr[1] + 1U;
+		}
+
+		Status = XSfl_LogEraseSector(LogPtr, Sect, EraseCount);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	return XSfl_LogMount(LogPtr, SflHandler, BaseAddr, NumSectors);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API mounts a log: it reads the sector headers, replays the records in
+ * write order to rebuild the index, drops records cut by a power loss and
+ * erases the sectors whose header is damaged. A blank region is turned into
+ * an empty log.
+ *
+ * @param	LogPtr is a pointer to the XSfl_Log instance.
+ * @param	SflHandler is the SFL handler of an initialized flash.
+ * @param	BaseAddr is the flash address of the region, sector aligned.
+ * @param	NumSectors is the number of sectors of the region.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if the region is invalid, the index overflows or a
+ *		flash access fails.
+ *
+ ******************************************************************************/
+u32 XSfl_LogMount(XSfl_Log *LogPtr, u8 SflHandler, u32 BaseAddr, u32 NumSectors)
+{
+	u32 Status;
+	u32 SectSize;
+	u32 Sect;
+	u32 Next;
+	u32 Last = XSFL_LOG_NO_SECT;
+	u32 PrevSeq = 0U;
+	u32 MaxEraseCount = 0U;
+	u32 Hdr[XSFL_LOG_SECT_HDR_SIZE / 4U];
+	XSfl_LogSector *SectPtr;
+
+	Xil_AssertNonvoid(LogPtr != NULL);
+	Xil_AssertNonvoid(NumSectors >= XSFL_LOG_MIN_SECTORS);
+	Xil_AssertNonvoid(NumSectors <= XSFL_LOG_MAX_SECTORS);
+
+	Status = XSfl_FlashGetInfo(SflHandler, XSFL_SECT_SIZE, &SectSize);
+	if ((Status != XST_SUCCESS) || ((BaseAddr % SectSize) != 0U)) {
+		return XST_FAILURE;
+	}
+
+	LogPtr->IsReady = 0U;
+	LogPtr->SflHandler = SflHandler;
+	LogPtr->BaseAddr = BaseAddr;
+	LogPtr->SectSize = SectSize;
+	LogPtr->NumSectors = NumSectors;
+	LogPtr->NextSeq = 1U;
+	LogPtr->NumKeys = 0U;
+	LogPtr->Head = XSFL_LOG_NO_SECT;
+	LogPtr->GcSect = XSFL_LOG_NO_SECT;
+	LogPtr->GcOffset = 0U;
+	LogPtr->GcWear = 0U;
+	(void)memset(&LogPtr->Stats, 0, sizeof(LogPtr->Stats));
+	for (Next = 0U; Next < XSFL_LOG_INDEX_SIZE; Next++) {
+		LogPtr->Index[Next].State = XSFL_LOG_KEY_EMPTY;
+	}
+
+	/*
+	 * Classify the sectors by their header
+	 */
+	for (Sect = 0U; Sect < NumSectors; Sect++) {
+		SectPtr = &LogPtr->Sector[Sect];
+		SectPtr->Seq = 0U;
+		SectPtr->LiveBytes = 0U;
+		SectPtr->WriteOffset = XSFL_LOG_SECT_HDR_SIZE;
+		SectPtr->State = XSFL_LOG_SECT_DIRTY;
+		SectPtr->EraseCount = XSFL_LOG_NO_SECT;
+
+		Status = XSfl_FlashRead(SflHandler, XSfl_LogSectAddr(LogPtr, Sect),
+				sizeof(Hdr), (u8 *)Hdr, 0U);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		if ((Hdr[0] != XSFL_LOG_MAGIC) || (Hdr[1] != ~Hdr[2])) {
+			continue;
+		}
+
+		SectPtr->EraseCount = Hdr[1];
+		if (Hdr[1] > MaxEraseCount) {
+			MaxEraseCount = Hdr[1];
+		}
+
+		if ((Hdr[4] == 0xFFFFFFFFU) && (Hdr[5] == 0xFFFFFFFFU)) {
+			SectPtr->State = XSFL_LOG_SECT_FREE;
+		} else if ((Hdr[4] == ~Hdr[5]) && (Hdr[4] != 0U)) {
+			SectPtr->State = XSFL_LOG_SECT_SEALED;
+			SectPtr->Seq = Hdr[4];
+			if (Hdr[4] >= LogPtr->NextSeq) {
+				LogPtr->NextSeq = Hdr[4] + 1U;
+			}
+		} else {
+			/* Opening of the sector was cut */
+		}
+	}
+
+	/*
+	 * Replay the used sectors oldest first
+	 */
+	while (1) {
+		Next = XSFL_LOG_NO_SECT;
+		for (Sect = 0U; Sect < NumSectors; Sect++) {
+			SectPtr = &LogPtr->Sector[Sect];
+			if ((SectPtr->State == XSFL_LOG_SECT_SEALED) &&
+					(SectPtr->Seq > PrevSeq) &&
+					((Next == XSFL_LOG_NO_SECT) ||
+					 (SectPtr->Seq < LogPtr->Sector[Next].Seq))) {
+				Next = Sect;
+			}
+		}
+		if (Next == XSFL_LOG_NO_SECT) {
+			break;
+		}
+
+		Status = XSfl_LogScan(LogPtr, Next);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		PrevSeq = LogPtr->Sector[Next].Seq;
+		Last = Next;
+	}
+
+	/*
+	 * Keep appending to the newest sector once whatever a power loss left
+	 * behind its last record is skipped
+	 */
+	if (Last != XSFL_LOG_NO_SECT) {
+		Status = XSfl_LogHealTail(LogPtr, Last);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		LogPtr->Sector[Last].State = XSFL_LOG_SECT_HEAD;
+		LogPtr->Head = Last;
+	}
+
+	/*
+	 * Erase the damaged sectors, an unknown erase count is assumed to be
+	 * the highest one seen
+	 */
+	for (Sect = 0U; Sect < NumSectors; Sect++) {
+		SectPtr = &LogPtr->Sector[Sect];
+		if (SectPtr->State != XSFL_LOG_SECT_DIRTY) {
+			continue;
+		}
+		if (SectPtr->EraseCount == XSFL_LOG_NO_SECT) {
+			SectPtr->EraseCount = MaxEraseCount;
+		}
+		Status = XSfl_LogEraseSector(LogPtr, Sect, SectPtr->EraseCount + 1U);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	LogPtr->IsReady = 1U;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API writes a record. The call returns after the record is programmed,
+ * from then on the value survives a power loss. When no free sector is left
+ * the call compacts sealed sectors first.
+ *
+ * @param	LogPtr is a pointer to the XSfl_Log instance.
+ * @param	Key is the record key, XSFL_LOG_INVALID_KEY is reserved.
+ * @param	DataPtr is a pointer to the record data.
+ * @param	Len is the data length, at most XSFL_LOG_MAX_DATA.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_INVALID_PARAM if the key or the length is not valid.
+ *		- XST_FAILURE if the log is full or a flash access fails.
+ *
+ ******************************************************************************/
+u32 XSfl_LogWrite(XSfl_Log *LogPtr, u32 Key, const u8 *DataPtr, u32 Len)
+{
+	u32 Status;
+
+	Xil_AssertNonvoid(LogPtr != NULL);
+	Xil_AssertNonvoid(LogPtr->IsReady == 1U);
+	Xil_AssertNonvoid((DataPtr != NULL) || (Len == 0U));
+
+	if ((Key == XSFL_LOG_INVALID_KEY) || (Len > XSFL_LOG_MAX_DATA)) {
+		return (u32)XST_INVALID_PARAM;
+	}
+
+	Status = XSfl_LogPut(LogPtr, Key, XSFL_LOG_REC_DATA, DataPtr, Len);
+	if (Status == XST_SUCCESS) {
+		LogPtr->Stats.Writes++;
+		LogPtr->Stats.UserBytes += Len;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API reads the latest record of a key. The record CRC is checked.
+ *
+ * @param	LogPtr is a pointer to the XSfl_Log instance.
+ * @param	Key is the record key.
+ * @param	DataPtr is a pointer to the destination buffer.
+ * @param	MaxLen is the size of the destination buffer.
+ * @param	LenPtr is a pointer to the returned data length.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_NO_DATA if the key is not present.
+ *		- XST_FAILURE if the buffer is too small, the record is corrupt
+ *		or the flash access fails. *LenPtr holds the record length when
+ *		the buffer is too small.
+ *
+ ******************************************************************************/
+u32 XSfl_LogRead(XSfl_Log *LogPtr, u32 Key, u8 *DataPtr, u32 MaxLen, u32 *LenPtr)
+{
+	u32 Status;
+	XSfl_LogKey *Entry;
+
+	Xil_AssertNonvoid(LogPtr != NULL);
+	Xil_AssertNonvoid(LogPtr->IsReady == 1U);
+	Xil_AssertNonvoid(LenPtr != NULL);
+
+	Entry = XSfl_LogFind(LogPtr, Key, 0U);
+	if ((Entry == NULL) || (Entry->State != XSFL_LOG_KEY_LIVE)) {
+		return (u32)XST_NO_DATA;
+	}
+
+	*LenPtr = Entry->Len;
+	if ((Entry->Len > MaxLen) || ((DataPtr == NULL) && (Entry->Len != 0U))) {
+		return XST_FAILURE;
+	}
+
+	Status = XSfl_FlashRead(LogPtr->SflHandler, Entry->Addr,
+			XSFL_LOG_REC_HDR_SIZE + Entry->Len, (u8 *)LogPtr->RecBuf, 0U);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	if (LogPtr->RecBuf[2] != XSfl_LogRecCrc(LogPtr, Entry->Len)) {
+		return XST_FAILURE;
+	}
+
+	if (Entry->Len != 0U) {
+		Xil_MemCpy(DataPtr, (u8 *)LogPtr->RecBuf + XSFL_LOG_REC_HDR_SIZE,
+				Entry->Len);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API deletes a key by appending a delete record. Deleting a key that
+ * is not present succeeds without writing.
+ *
+ * @param	LogPtr is a pointer to the XSfl_Log instance.
+ * @param	Key is the record key.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if the log is full or a flash access fails.
+ *
+ ******************************************************************************/
+u32 XSfl_LogDelete(XSfl_Log *LogPtr, u32 Key)
+{
+	u32 Status;
+	const XSfl_LogKey *Entry;
+
+	Xil_AssertNonvoid(LogPtr != NULL);
+	Xil_AssertNonvoid(LogPtr->IsReady == 1U);
+
+	Entry = XSfl_LogFind(LogPtr, Key, 0U);
+	if ((Entry == NULL) || (Entry->State != XSFL_LOG_KEY_LIVE)) {
+		return XST_SUCCESS;
+	}
+
+	Status = XSfl_LogPut(LogPtr, Key, XSFL_LOG_REC_DELETE, NULL, 0U);
+	if (Status == XST_SUCCESS) {
+		LogPtr->Stats.Deletes++;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API runs background compaction for a bounded amount of work and is
+ * meant to be called from an idle loop. A sector is reclaimed when the free
+ * sectors drop to XSFL_LOG_GC_FREE_LOW, or moved for wear levelling when the
+ * erase counts spread more than XSFL_LOG_WEAR_DELTA.
+ *
+ * @param	LogPtr is a pointer to the XSfl_Log instance.
+ * @param	MaxRecords is the max number of records examined by this call,
+ *		every examined record costs at most one read and one program.
+ *		The sector erase is performed by the call that examines the last
+ *		record.
+ *
+ * @return
+ *		- XST_SUCCESS if successful or nothing is to be done.
+ *		- XST_FAILURE if a flash access fails.
+ *
+ ******************************************************************************/
+u32 XSfl_LogCompact(XSfl_Log *LogPtr, u32 MaxRecords)
+{
+	u32 Status = XST_SUCCESS;
+	u32 Count;
+	u8 Wear;
+
+	Xil_AssertNonvoid(LogPtr != NULL);
+	Xil_AssertNonvoid(LogPtr->IsReady == 1U);
+
+	if (LogPtr->GcSect == XSFL_LOG_NO_SECT) {
+		LogPtr->GcSect = XSfl_LogPickVictim(LogPtr, &Wear);
+		if (LogPtr->GcSect == XSFL_LOG_NO_SECT) {
+			return XST_SUCCESS;
+		}
+		LogPtr->GcOffset = XSFL_LOG_SECT_HDR_SIZE;
+		LogPtr->GcWear = Wear;
+	}
+
+	for (Count = 0U; (Count < MaxRecords) &&
+			(LogPtr->GcSect != XSFL_LOG_NO_SECT); Count++) {
+		Status = XSfl_LogGcStep(LogPtr);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API returns the statistics of a log.
+ *
+ * @param	LogPtr is a pointer to the XSfl_Log instance.
+ * @param	StatsPtr is a pointer to the returned statistics.
+ *
+ * @return	None.
+ *
+ ******************************************************************************/
+void XSfl_LogGetStats(XSfl_Log *LogPtr, XSfl_LogStats *StatsPtr)
+{
+	u32 Sect;
+	u32 EraseCount;
+
+	Xil_AssertVoid(LogPtr != NULL);
+	Xil_AssertVoid(LogPtr->IsReady == 1U);
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	LogPtr->Stats.FreeSectors = XSfl_LogFreeSectors(LogPtr);
+	LogPtr->Stats.NumKeys = LogPtr->NumKeys;
+	LogPtr->Stats.MinEraseCount = 0xFFFFFFFFU;
+	LogPtr->Stats.MaxEraseCount = 0U;
+	for (Sect = 0U; Sect < LogPtr->NumSectors; Sect++) {
+		EraseCount = LogPtr->Sector[Sect].EraseCount;
+		if (EraseCount < LogPtr->Stats.MinEraseCount) {
+			LogPtr->Stats.MinEraseCount = EraseCount;
+		}
+		if (EraseCount > LogPtr->Stats.MaxEraseCount) {
+			LogPtr->Stats.MaxEraseCount = EraseCount;
+		}
+	}
+
+	*StatsPtr = LogPtr->Stats;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Updates a reflected CRC32 (polynomial 0xEDB88320) with a buffer.
+ *
+ ******************************************************************************/
+static u32 XSfl_LogCrc(u32 Crc, const u8 *Buf, u32 Len)
+{
+	u32 Index;
+	u32 Bit;
+
+	for (Index = 0U; Index < Len; Index++) {
+		Crc ^= Buf[Index];
+		for (Bit = 0U; Bit < 8U; Bit++) {
+			Crc = (Crc >> 1U) ^ (0xEDB88320U & (0U - (Crc & 1U)));
+		}
+	}
+
+	return Crc;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Returns the CRC of the record held in the record buffer.
+ *
+ ******************************************************************************/
+static u32 XSfl_LogRecCrc(const XSfl_Log *LogPtr, u32 Len)
+{
+	const u8 *Rec = (const u8 *)LogPtr->RecBuf;
+	u32 Crc;
+
+	Crc = XSfl_LogCrc(0xFFFFFFFFU, Rec, 8U);
+	Crc = XSfl_LogCrc(Crc, Rec + XSFL_LOG_REC_HDR_SIZE, Len);
+
+	return ~Crc;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Looks a key up in the index. With Insert set, a free slot is returned when
+ * the key is not present; its state tells the caller that it is unused.
+ *
+ * @return	Index slot, NULL if not found or the index is full.
+ *
+ ******************************************************************************/
+static XSfl_LogKey *XSfl_LogFind(XSfl_Log *LogPtr, u32 Key, u8 Insert)
+{
+	XSfl_LogKey *Entry;
+	XSfl_LogKey *FreeSlot = NULL;
+	u32 Slot;
+	u32 Probe;
+
+	Slot = ((Key * 0x9E3779B1U) >> 16U) & (XSFL_LOG_INDEX_SIZE - 1U);
+	for (Probe = 0U; Probe < XSFL_LOG_INDEX_SIZE; Probe++) {
+		Entry = &LogPtr->Index[Slot];
+		if (Entry->State == XSFL_LOG_KEY_EMPTY) {
+			if (FreeSlot == NULL) {
+				FreeSlot = Entry;
+			}
+			break;
+		}
+		if (Entry->State == XSFL_LOG_KEY_VOID) {
+			if (FreeSlot == NULL) {
+				FreeSlot = Entry;
+			}
+		} else if (Entry->Key == Key) {
+			return Entry;
+		} else {
+			/* Slot of another key */
+		}
+		Slot = (Slot + 1U) & (XSFL_LOG_INDEX_SIZE - 1U);
+	}
+
+	return (Insert != 0U) ? FreeSlot : NULL;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Makes the record at Addr the latest record of a key and moves the live
+ * byte accounting from the superseded record to it.
+ *
+ ******************************************************************************/
+static void XSfl_LogApply(XSfl_Log *LogPtr, XSfl_LogKey *Entry, u32 Key,
+		u32 Flags, u32 Len, u32 Addr)
+{
+	u8 Present = ((Entry->State == XSFL_LOG_KEY_LIVE) ||
+			(Entry->State == XSFL_LOG_KEY_DELETED)) ? 1U : 0U;
+
+	if (Present != 0U) {
+		LogPtr->Sector[XSfl_LogAddrSect(LogPtr, Entry->Addr)].LiveBytes -=
+			XSfl_LogRecSize(Entry->Len);
+	} else if ((Flags & XSFL_LOG_REC_DELETE) != 0U) {
+		/* Nothing older to hide, the delete record is garbage */
+		return;
+	} else {
+		LogPtr->NumKeys++;
+	}
+
+	Entry->Key = Key;
+	Entry->Addr = Addr;
+	Entry->Len = (u16)Len;
+	Entry->State = ((Flags & XSFL_LOG_REC_DELETE) != 0U) ?
+			XSFL_LOG_KEY_DELETED : XSFL_LOG_KEY_LIVE;
+	LogPtr->Sector[XSfl_LogAddrSect(LogPtr, Addr)].LiveBytes +=
+		XSfl_LogRecSize(Len);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Returns the number of free sectors.
+ *
+ ******************************************************************************/
+static u32 XSfl_LogFreeSectors(const XSfl_Log *LogPtr)
+{
+	u32 Sect;
+	u32 Count = 0U;
+
+	for (Sect = 0U; Sect < LogPtr->NumSectors; Sect++) {
+		if (LogPtr->Sector[Sect].State == XSFL_LOG_SECT_FREE) {
+			Count++;
+		}
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Returns the lowest sequence number of the sectors holding records.
+ *
+ ******************************************************************************/
+static u32 XSfl_LogOldestSeq(const XSfl_Log *LogPtr)
+{
+	u32 Sect;
+	u32 Seq = 0xFFFFFFFFU;
+
+	for (Sect = 0U; Sect < LogPtr->NumSectors; Sect++) {
+		if (((LogPtr->Sector[Sect].State == XSFL_LOG_SECT_HEAD) ||
+			(LogPtr->Sector[Sect].State == XSFL_LOG_SECT_SEALED)) &&
+				(LogPtr->Sector[Sect].Seq < Seq)) {
+			Seq = LogPtr->Sector[Sect].Seq;
+		}
+	}
+
+	return Seq;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Erases a sector and writes its erase count header, the sector becomes
+ * free.
+ *
+ ******************************************************************************/
+static u32 XSfl_LogEraseSector(XSfl_Log *LogPtr, u32 Sect, u32 EraseCount)
+{
+	u32 Status;
+	u32 Hdr[4];
+	XSfl_LogSector *SectPtr = &LogPtr->Sector[Sect];
+
+	SectPtr->State = XSFL_LOG_SECT_DIRTY;
+	SectPtr->EraseCount = EraseCount;
+	SectPtr->Seq = 0U;
+	SectPtr->LiveBytes = 0U;
+	SectPtr->WriteOffset = XSFL_LOG_SECT_HDR_SIZE;
+
+	Status = XSfl_FlashErase(LogPtr->SflHandler,
+			XSfl_LogSectAddr(LogPtr, Sect), LogPtr->SectSize);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Hdr[0] = XSFL_LOG_MAGIC;
+	Hdr[1] = EraseCount;
+	Hdr[2] = ~EraseCount;
+	Hdr[3] = 0xFFFFFFFFU;
+	Status = XSfl_FlashWrite(LogPtr->SflHandler,
+			XSfl_LogSectAddr(LogPtr, Sect), sizeof(Hdr), (u8 *)Hdr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	SectPtr->State = XSFL_LOG_SECT_FREE;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Opens the free sector with the lowest erase count as the new head.
+ *
+ ******************************************************************************/
+static u32 XSfl_LogOpenSector(XSfl_Log *LogPtr)
+{
+	u32 Status;
+	u32 Sect;
+	u32 Best = XSFL_LOG_NO_SECT;
+	u32 Seq[2];
+
+	for (Sect = 0U; Sect < LogPtr->NumSectors; Sect++) {
+		if ((LogPtr->Sector[Sect].State == XSFL_LOG_SECT_FREE) &&
+				((Best == XSFL_LOG_NO_SECT) ||
+				 (LogPtr->Sector[Sect].EraseCount <
+				  LogPtr->Sector[Best].EraseCount))) {
+			Best = Sect;
+		}
+	}
+	if (Best == XSFL_LOG_NO_SECT) {
+		return XST_FAILURE;
+	}
+
+	Seq[0] = LogPtr->NextSeq;
+	Seq[1] = ~LogPtr->NextSeq;
+	LogPtr->NextSeq++;
+
+	/* A failed open leaves an undefined header, erase it on next mount */
+	LogPtr->Sector[Best].State = XSFL_LOG_SECT_DIRTY;
+	Status = XSfl_FlashWrite(LogPtr->SflHandler,
+			XSfl_LogSectAddr(LogPtr, Best) + XSFL_LOG_SEQ_OFFSET,
+			sizeof(Seq), (u8 *)Seq);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	LogPtr->Sector[Best].State = XSFL_LOG_SECT_HEAD;
+	LogPtr->Sector[Best].Seq = Seq[0];
+	LogPtr->Head = Best;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Programs the record held in the record buffer at the head, opening a new
+ * head sector when the current one is full.
+ *
+ ******************************************************************************/
+static u32 XSfl_LogAppend(XSfl_Log *LogPtr, u32 Len, u32 *AddrPtr)
+{
+	u32 Status;
+	u32 Size = XSfl_LogRecSize(Len);
+	XSfl_LogSector *SectPtr;
+
+	if ((LogPtr->Head != XSFL_LOG_NO_SECT) &&
+			((LogPtr->Sector[LogPtr->Head].WriteOffset + Size) >
+			 LogPtr->SectSize)) {
+		LogPtr->Sector[LogPtr->Head].State = XSFL_LOG_SECT_SEALED;
+		LogPtr->Head = XSFL_LOG_NO_SECT;
+	}
+
+	if (LogPtr->Head == XSFL_LOG_NO_SECT) {
+		Status = XSfl_LogOpenSector(LogPtr);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	SectPtr = &LogPtr->Sector[LogPtr->Head];
+	*AddrPtr = XSfl_LogSectAddr(LogPtr, LogPtr->Head) + SectPtr->WriteOffset;
+
+	Status = XSfl_FlashWrite(LogPtr->SflHandler, *AddrPtr, Size,
+			(u8 *)LogPtr->RecBuf);
+	if (Status != XST_SUCCESS) {
+		/* The tail is in an unknown state, never program it again */
+		SectPtr->State = XSFL_LOG_SECT_SEALED;
+		LogPtr->Head = XSFL_LOG_NO_SECT;
+		return XST_FAILURE;
+	}
+
+	SectPtr->WriteOffset += Size;
+	LogPtr->Stats.FlashBytes += Size;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Picks the next sector to compact. Below the free sector threshold the
+ * sealed sector with the most garbage is picked, otherwise the coldest
+ * sealed sector when the erase counts spread too far.
+ *
+ * @return	Sector number, XSFL_LOG_NO_SECT if nothing is to be done.
+ *
+ ******************************************************************************/
+static u32 XSfl_LogPickVictim(const XSfl_Log *LogPtr, u8 *WearPtr)
+{
+	u32 Sect;
+	u32 Best = XSFL_LOG_NO_SECT;
+	u32 Garbage;
+	u32 BestGarbage = 0U;
+	u32 MaxEraseCount = 0U;
+	const XSfl_LogSector *SectPtr;
+
+	*WearPtr = 0U;
+
+	if (XSfl_LogFreeSectors(LogPtr) <= XSFL_LOG_GC_FREE_LOW) {
+		for (Sect = 0U; Sect < LogPtr->NumSectors; Sect++) {
+			SectPtr = &LogPtr->Sector[Sect];
+			if (SectPtr->State != XSFL_LOG_SECT_SEALED) {
+				continue;
+			}
+			Garbage = LogPtr->SectSize - XSFL_LOG_SECT_HDR_SIZE -
+				SectPtr->LiveBytes;
+			/*
+			 * On a tie take the less worn sector, otherwise fully
+			 * stale sectors of a high index are never reclaimed
+			 */
+			if ((Garbage > BestGarbage) || ((Garbage != 0U) &&
+					(Garbage == BestGarbage) &&
+					(SectPtr->EraseCount <
+					 LogPtr->Sector[Best].EraseCount))) {
+				BestGarbage = Garbage;
+				Best = Sect;
+			}
+		}
+		if (Best != XSFL_LOG_NO_SECT) {
+			return Best;
+		}
+	}
+
+	for (Sect = 0U; Sect < LogPtr->NumSectors; Sect++) {
+		if (LogPtr->Sector[Sect].EraseCount > MaxEraseCount) {
+			MaxEraseCount = LogPtr->Sector[Sect].EraseCount;
+		}
+	}
+
+	for (Sect = 0U; Sect < LogPtr->NumSectors; Sect++) {
+		SectPtr = &LogPtr->Sector[Sect];
+		if ((SectPtr->State == XSFL_LOG_SECT_SEALED) &&
+				((SectPtr->EraseCount + XSFL_LOG_WEAR_DELTA) <
+				 MaxEraseCount) &&
+				((Best == XSFL_LOG_NO_SECT) ||
+				 (SectPtr->EraseCount <
+				  LogPtr->Sector[Best].EraseCount))) {
+			Best = Sect;
+		}
+	}
+	if (Best != XSFL_LOG_NO_SECT) {
+		*WearPtr = 1U;
+	}
+
+	return Best;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Examines the next record of the sector being compacted and copies it to
+ * the head if it is still live. Once all records are examined the sector is
+ * erased.
+ *
+ ******************************************************************************/
+static u32 XSfl_LogGcStep(XSfl_Log *LogPtr)
+{
+	u32 Status;
+	u32 Sect = LogPtr->GcSect;
+	XSfl_LogSector *SectPtr = &LogPtr->Sector[Sect];
+	u32 Addr;
+	u32 NewAddr;
+	u32 Key;
+	u32 Len;
+	u32 Flags;
+	XSfl_LogKey *Entry;
+
+	if (LogPtr->GcOffset >= SectPtr->WriteOffset) {
+		Status = XSfl_LogEraseSector(LogPtr, Sect, SectPtr->EraseCount + 1U);
+		LogPtr->GcSect = XSFL_LOG_NO_SECT;
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		LogPtr->Stats.Compactions++;
+		if (LogPtr->GcWear != 0U) {
+			LogPtr->Stats.WearMoves++;
+		}
+		return XST_SUCCESS;
+	}
+
+	Addr = XSfl_LogSectAddr(LogPtr, Sect) + LogPtr->GcOffset;
+	Status = XSfl_FlashRead(LogPtr->SflHandler, Addr, XSFL_LOG_REC_HDR_SIZE,
+			(u8 *)LogPtr->RecBuf, 0U);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Key = LogPtr->RecBuf[0];
+	Len = LogPtr->RecBuf[1] & 0xFFFFU;
+	Flags = (LogPtr->RecBuf[1] >> 16U) & 0xFFU;
+
+	if ((Key == 0U) && (LogPtr->RecBuf[1] == 0U)) {
+		/* Bytes of a torn record, zeroed at mount */
+		LogPtr->GcOffset += XSFL_LOG_REC_ALIGN;
+		return XST_SUCCESS;
+	}
+
+	Entry = XSfl_LogFind(LogPtr, Key, 0U);
+	if ((Entry != NULL) && (Entry->Addr == Addr)) {
+		if ((Entry->State == XSFL_LOG_KEY_DELETED) &&
+				(SectPtr->Seq == XSfl_LogOldestSeq(LogPtr))) {
+			/* No older record of the key is left to hide */
+			SectPtr->LiveBytes -= XSfl_LogRecSize(Len);
+			Entry->State = XSFL_LOG_KEY_VOID;
+			LogPtr->NumKeys--;
+		} else {
+			Status = XSfl_FlashRead(LogPtr->SflHandler, Addr,
+					XSfl_LogRecSize(Len), (u8 *)LogPtr->RecBuf, 0U);
+			if (Status != XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+
+			Status = XSfl_LogAppend(LogPtr, Len, &NewAddr);
+			if (Status != XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+
+			XSfl_LogApply(LogPtr, Entry, Key, Flags, Len, NewAddr);
+			LogPtr->Stats.RecordsMoved++;
+		}
+	}
+
+	LogPtr->GcOffset += XSfl_LogRecSize(Len);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Compacts one sector in the foreground, finishing the background
+ * compaction in progress if there is one.
+ *
+ ******************************************************************************/
+static u32 XSfl_LogGcSector(XSfl_Log *LogPtr)
+{
+	u32 Status = XST_SUCCESS;
+	u32 Sect;
+	u32 Garbage;
+	u32 BestGarbage = 0U;
+
+	if (LogPtr->GcSect == XSFL_LOG_NO_SECT) {
+		for (Sect = 0U; Sect < LogPtr->NumSectors; Sect++) {
+			if (LogPtr->Sector[Sect].State != XSFL_LOG_SECT_SEALED) {
+				continue;
+			}
+			Garbage = LogPtr->SectSize - XSFL_LOG_SECT_HDR_SIZE -
+				LogPtr->Sector[Sect].LiveBytes;
+			if (Garbage > BestGarbage) {
+				BestGarbage = Garbage;
+				LogPtr->GcSect = Sect;
+			}
+		}
+		if (LogPtr->GcSect == XSFL_LOG_NO_SECT) {
+			/* Every sealed sector is fully live: the log is full */
+			return XST_FAILURE;
+		}
+		LogPtr->GcOffset = XSFL_LOG_SECT_HDR_SIZE;
+		LogPtr->GcWear = 0U;
+	}
+
+	while ((LogPtr->GcSect != XSFL_LOG_NO_SECT) && (Status == XST_SUCCESS)) {
+		Status = XSfl_LogGcStep(LogPtr);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Makes sure a user record of Size bytes can be appended without using the
+ * sectors reserved for compaction.
+ *
+ ******************************************************************************/
+static u32 XSfl_LogMakeRoom(XSfl_Log *LogPtr, u32 Size)
+{
+	u32 Status;
+	u32 Loop;
+
+	for (Loop = 0U; Loop <= (2U * LogPtr->NumSectors); Loop++) {
+		if ((LogPtr->Head != XSFL_LOG_NO_SECT) &&
+				((LogPtr->Sector[LogPtr->Head].WriteOffset + Size) <=
+				 LogPtr->SectSize)) {
+			return XST_SUCCESS;
+		}
+		if (XSfl_LogFreeSectors(LogPtr) > XSFL_LOG_RESERVED_SECTORS) {
+			return XST_SUCCESS;
+		}
+
+		Status = XSfl_LogGcSector(LogPtr);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	return XST_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Builds a record in the record buffer, appends it and updates the index.
+ *
+ ******************************************************************************/
+static u32 XSfl_LogPut(XSfl_Log *LogPtr, u32 Key, u32 Flags,
+		const u8 *DataPtr, u32 Len)
+{
+	u32 Status;
+	u32 Size = XSfl_LogRecSize(Len);
+	u32 Addr;
+	u32 Index;
+	u8 *Rec = (u8 *)LogPtr->RecBuf;
+	XSfl_LogKey *Entry;
+
+	Status = XSfl_LogMakeRoom(LogPtr, Size);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/* Compaction may have released slots, look the key up afterwards */
+	Entry = XSfl_LogFind(LogPtr, Key, 1U);
+	if (Entry == NULL) {
+		return XST_FAILURE;
+	}
+
+	LogPtr->RecBuf[0] = Key;
+	LogPtr->RecBuf[1] = Len | (Flags << 16U) | ((~Flags & 0xFFU) << 24U);
+	if (Len != 0U) {
+		Xil_MemCpy(Rec + XSFL_LOG_REC_HDR_SIZE, DataPtr, Len);
+	}
+	for (Index = XSFL_LOG_REC_HDR_SIZE + Len; Index < Size; Index++) {
+		Rec[Index] = 0xFFU;
+	}
+	LogPtr->RecBuf[2] = XSfl_LogRecCrc(LogPtr, Len);
+
+	Status = XSfl_LogAppend(LogPtr, Len, &Addr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	XSfl_LogApply(LogPtr, Entry, Key, Flags, Len, Addr);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Replays the records of a sector into the index. Zeroed bytes of torn
+ * records are skipped. The scan stops at the first blank record header or at
+ * a record that fails its checks, which was cut by a power loss.
+ *
+ ******************************************************************************/
+static u32 XSfl_LogScan(XSfl_Log *LogPtr, u32 Sect)
+{
+	u32 Status;
+	u32 Offset = XSFL_LOG_SECT_HDR_SIZE;
+	u32 SectAddr = XSfl_LogSectAddr(LogPtr, Sect);
+	u32 Key;
+	u32 Len;
+	u32 Flags;
+	u32 Size;
+	XSfl_LogKey *Entry;
+
+	while ((Offset + XSFL_LOG_REC_HDR_SIZE) <= LogPtr->SectSize) {
+		Status = XSfl_FlashRead(LogPtr->SflHandler, SectAddr + Offset,
+				XSFL_LOG_REC_HDR_SIZE, (u8 *)LogPtr->RecBuf, 0U);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		Key = LogPtr->RecBuf[0];
+		Len = LogPtr->RecBuf[1] & 0xFFFFU;
+		Flags = (LogPtr->RecBuf[1] >> 16U) & 0xFFU;
+		Size = XSfl_LogRecSize(Len);
+
+		if ((Key == 0xFFFFFFFFU) && (LogPtr->RecBuf[1] == 0xFFFFFFFFU) &&
+				(LogPtr->RecBuf[2] == 0xFFFFFFFFU)) {
+			break;
+		}
+
+		if ((Key == 0U) && (LogPtr->RecBuf[1] == 0U)) {
+			Offset += XSFL_LOG_REC_ALIGN;
+			continue;
+		}
+
+		if ((Key == XSFL_LOG_INVALID_KEY) || (Len > XSFL_LOG_MAX_DATA) ||
+				((Offset + Size) > LogPtr->SectSize) ||
+				((LogPtr->RecBuf[1] >> 24U) != (~Flags & 0xFFU))) {
+			LogPtr->Stats.TornRecords++;
+			break;
+		}
+
+		Status = XSfl_FlashRead(LogPtr->SflHandler, SectAddr + Offset,
+				Size, (u8 *)LogPtr->RecBuf, 0U);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		if (LogPtr->RecBuf[2] != XSfl_LogRecCrc(LogPtr, Len)) {
+			LogPtr->Stats.TornRecords++;
+			break;
+		}
+
+		Entry = XSfl_LogFind(LogPtr, Key, 1U);
+		if (Entry == NULL) {
+			return XST_FAILURE;
+		}
+		XSfl_LogApply(LogPtr, Entry, Key, Flags, Len, SectAddr + Offset);
+
+		Offset += Size;
+	}
+
+	LogPtr->Sector[Sect].WriteOffset = Offset;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Programs to zero every byte a power loss left after the last valid record
+ * of a sector, up to the last non-blank byte, so that the next scan skips
+ * them and the sector can be appended to again.
+ *
+ ******************************************************************************/
+static u32 XSfl_LogHealTail(XSfl_Log *LogPtr, u32 Sect)
+{
+	u32 Status;
+	u32 SectAddr = XSfl_LogSectAddr(LogPtr, Sect);
+	u32 Offset = LogPtr->Sector[Sect].WriteOffset;
+	u32 End = Offset;
+	u32 Pos;
+	u32 Chunk;
+	u32 Index;
+	u8 *Buf = (u8 *)LogPtr->RecBuf;
+
+	for (Pos = Offset; Pos < LogPtr->SectSize; Pos += Chunk) {
+		Chunk = LogPtr->SectSize - Pos;
+		if (Chunk > sizeof(LogPtr->RecBuf)) {
+			Chunk = sizeof(LogPtr->RecBuf);
+		}
+		Status = XSfl_FlashRead(LogPtr->SflHandler, SectAddr + Pos, Chunk,
+				Buf, 0U);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		for (Index = 0U; Index < Chunk; Index++) {
+			if (Buf[Index] != 0xFFU) {
+				End = Pos + Index + 1U;
+			}
+		}
+	}
+
+	if (End == Offset) {
+		return XST_SUCCESS;
+	}
+
+	End = (End + (XSFL_LOG_REC_ALIGN - 1U)) & ~(XSFL_LOG_REC_ALIGN - 1U);
+	for (Index = 0U; Index < (sizeof(LogPtr->RecBuf) / 4U); Index++) {
+		LogPtr->RecBuf[Index] = 0U;
+	}
+	for (Pos = Offset; Pos < End; Pos += Chunk) {
+		Chunk = End - Pos;
+		if (Chunk > sizeof(LogPtr->RecBuf)) {
+			Chunk = sizeof(LogPtr->RecBuf);
+		}
+		Status = XSfl_FlashWrite(LogPtr->SflHandler, SectAddr + Pos, Chunk,
+				Buf);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	LogPtr->Sector[Sect].WriteOffset = End;
+
+	return XST_SUCCESS;
+}
+/** @} */
@@ -0,0 +1,645 @@
+/******************************************************************************
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xilsfl_queue.c
+ * @addtogroup xilsfl overview
+ * @{
+ *
+ * The xilsfl_queue.c file implements the queued asynchronous I/O engine of the
+ * SFL library.
+ *
+ * Requests are queued per flash die (chip select) and advanced by
+ * XSfl_FlashQueuePoll(). Program and erase commands are issued without
+ * waiting for the flash to become ready; while a die is busy the engine
+ * services the other die of a stacked connection, so one die can erase while
+ * the other programs, and copies the next page of a pending write into the
+ * die's staging buffer so that the next program command can be issued as
+ * soon as the status clears. Reads use the controller non-blocking (DMA)
+ * transfer when it is available.
+ *
+ * Requests to the same die complete in submission order, requests to
+ * different dies may complete in any order.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who Date     Changes
+ * ----- --- -------- -----------------------------------------------
+ * 1.1   sb  10/19/26 Initial release
+ *
+ * </pre>
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xilsfl.h"
+#include "xilsfl_control.h"
+#include "xil_mem.h"
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * Max bytes read by a single command, bounds the time a read holds the bus
+ * while other dies wait for their status to be polled
+ */
+#ifndef XSFL_QUEUE_READ_CHUNK
+#define XSFL_QUEUE_READ_CHUNK	0x10000U
+#endif
+
+#define XSFL_QUEUE_STAGE_SIZE	XSFL_FLASH_PAGE_SIZE_256 /**< Max page size */
+
+#define XSFL_DIE_IDLE		0U /**< No command in progress */
+#define XSFL_DIE_BUSY		1U /**< Program/erase running inside the flash */
+#define XSFL_DIE_XFER		2U /**< Read DMA in progress on the bus */
+
+#define XSFL_NO_DIE		0xFFU
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Per die request queue and command state.
+ */
+typedef struct {
+	XSfl_IoReq *Head;	/**< Request in progress */
+	XSfl_IoReq *Tail;	/**< Last queued request */
+	XSfl_IoReq *StageReq;	/**< Request owning the staged page, NULL if none */
+	u32 StageOffset;	/**< Offset of the staged page in StageReq */
+	u32 InFlight;		/**< Bytes covered by the command in progress */
+	u8 State;		/**< XSFL_DIE_IDLE/BUSY/XFER */
+	u32 Stage[XSFL_QUEUE_STAGE_SIZE / 4U]; /**< Next page to be programmed */
+} XSfl_DieQueue;
+
+/**
+ * I/O queue state of one SFL instance.
+ */
+typedef struct {
+	XSfl_DieQueue Die[XSFL_QUEUE_MAX_DIES];
+	XSfl_QueueStats Stats;
+	u32 ProgramSize;	/**< Max bytes per program command */
+	u8 NumDies;		/**< 2 for stacked, 1 otherwise */
+	u8 NextDie;		/**< Die serviced first on the next poll */
+	u8 XferDie;		/**< Die owning the bus for a read DMA */
+	u8 IsReady;		/**< Set by XSfl_FlashQueueInit() */
+} XSfl_IoQueue;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+extern XSfl SflInstance;
+static XSfl_IoQueue SflQueue[XSFL_NUM_INSTANCES];
+
+/*****************************************************************************/
+/**
+ *
+ * Returns the die which holds the given flash address.
+ *
+ ******************************************************************************/
+static u8 XSfl_QueueDieOf(const XSfl_Interface *SflInstancePtr, u32 Address)
+{
+	u8 FCTIndex = SflInstancePtr->SflFlashInfo.FlashIndex;
+
+	if ((SflInstancePtr->SflFlashInfo.ConnectionMode == XSFL_CONNECTION_MODE_STACKED) &&
+			((Address & Flash_Config_Table[FCTIndex].FlashDeviceSize) != 0U)) {
+		return 1U;
+	}
+
+	return 0U;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Returns the size of the next command of a request at the given offset.
+ * Writes are bounded by the program size, which divides the page size, so
+ * they never cross a page boundary. Reads are bounded by
+ * XSFL_QUEUE_READ_CHUNK and erases cover one sector.
+ *
+ ******************************************************************************/
+static u32 XSfl_QueueChunk(const XSfl_IoQueue *Queue,
+		const XSfl_Interface *SflInstancePtr, const XSfl_IoReq *IoReq,
+		u32 Offset)
+{
+	u32 Remaining = IoReq->ByteCount - Offset;
+	u32 Len;
+
+	if (IoReq->Op == XSFL_IO_WRITE) {
+		Len = Queue->ProgramSize -
+			((IoReq->Address + Offset) % Queue->ProgramSize);
+	} else if (IoReq->Op == XSFL_IO_READ) {
+		Len = XSFL_QUEUE_READ_CHUNK;
+	} else {
+		Len = SflInstancePtr->SflFlashInfo.SectSize;
+	}
+
+	return (Len < Remaining) ? Len : Remaining;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Copies one page of a write request into the staging buffer of its die.
+ *
+ ******************************************************************************/
+static void XSfl_QueueStage(const XSfl_IoQueue *Queue,
+		const XSfl_Interface *SflInstancePtr, XSfl_DieQueue *DiePtr,
+		XSfl_IoReq *IoReq, u32 Offset)
+{
+	u32 Len = XSfl_QueueChunk(Queue, SflInstancePtr, IoReq, Offset);
+
+	Xil_MemCpy(DiePtr->Stage, IoReq->BufferPtr + Offset, Len);
+	DiePtr->StageReq = IoReq;
+	DiePtr->StageOffset = Offset;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Stages the page following the command in progress on a busy die, either the
+ * next page of the current request or the first page of the next request.
+ *
+ ******************************************************************************/
+static void XSfl_QueueStageNext(XSfl_IoQueue *Queue,
+		const XSfl_Interface *SflInstancePtr, XSfl_DieQueue *DiePtr)
+{
+	XSfl_IoReq *IoReq = DiePtr->Head;
+	u32 Offset;
+
+	if ((IoReq == NULL) || (DiePtr->StageReq != NULL)) {
+		return;
+	}
+
+	Offset = IoReq->Done + DiePtr->InFlight;
+	if (Offset >= IoReq->ByteCount) {
+		IoReq = IoReq->Next;
+		Offset = 0U;
+	}
+
+	if ((IoReq == NULL) || (IoReq->Op != XSFL_IO_WRITE)) {
+		return;
+	}
+
+	XSfl_QueueStage(Queue, SflInstancePtr, DiePtr, IoReq, Offset);
+	Queue->Stats.Staged++;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Removes the head request of a die and invokes its completion callback.
+ *
+ ******************************************************************************/
+static void XSfl_QueueComplete(XSfl_IoQueue *Queue, XSfl_DieQueue *DiePtr,
+		u32 Status)
+{
+	XSfl_IoReq *IoReq = DiePtr->Head;
+
+	DiePtr->Head = IoReq->Next;
+	if (DiePtr->Head == NULL) {
+		DiePtr->Tail = NULL;
+	}
+	if (DiePtr->StageReq == IoReq) {
+		DiePtr->StageReq = NULL;
+	}
+	DiePtr->InFlight = 0U;
+	DiePtr->State = XSFL_DIE_IDLE;
+	IoReq->Next = NULL;
+
+	if (Status == (u32)XST_SUCCESS) {
+		Queue->Stats.Completed++;
+	} else {
+		Queue->Stats.Failed++;
+	}
+
+	if (IoReq->Handler != NULL) {
+		IoReq->Handler(IoReq->CallBackRef, IoReq, Status);
+	}
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Accounts the command that just finished on a die and completes the request
+ * once all of its bytes are done.
+ *
+ ******************************************************************************/
+static void XSfl_QueueAdvance(XSfl_IoQueue *Queue, XSfl_DieQueue *DiePtr)
+{
+	XSfl_IoReq *IoReq = DiePtr->Head;
+
+	IoReq->Done += DiePtr->InFlight;
+	if (IoReq->Op == XSFL_IO_READ) {
+		Queue->Stats.BytesRead += DiePtr->InFlight;
+	} else if (IoReq->Op == XSFL_IO_WRITE) {
+		Queue->Stats.BytesWritten += DiePtr->InFlight;
+	} else {
+		Queue->Stats.BytesErased += DiePtr->InFlight;
+	}
+	DiePtr->InFlight = 0U;
+	DiePtr->State = XSFL_DIE_IDLE;
+
+	if (IoReq->Done >= IoReq->ByteCount) {
+		XSfl_QueueComplete(Queue, DiePtr, XST_SUCCESS);
+	}
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Issues the next command of the head request of an idle die.
+ *
+ ******************************************************************************/
+static u32 XSfl_QueueIssue(XSfl_IoQueue *Queue, XSfl_Interface *SflInstancePtr,
+		u8 Die)
+{
+	XSfl_DieQueue *DiePtr = &Queue->Die[Die];
+	XSfl_IoReq *IoReq = DiePtr->Head;
+	u32 Offset = IoReq->Done;
+	u32 Address = IoReq->Address + Offset;
+	u32 Len = XSfl_QueueChunk(Queue, SflInstancePtr, IoReq, Offset);
+	u32 Status;
+	u8 Idx;
+
+	for (Idx = 0U; Idx < Queue->NumDies; Idx++) {
+		if ((Idx != Die) && (Queue->Die[Idx].State == XSFL_DIE_BUSY)) {
+			Queue->Stats.Overlapped++;
+			break;
+		}
+	}
+
+	DiePtr->InFlight = Len;
+
+	switch (IoReq->Op) {
+		case XSFL_IO_READ:
+			if ((SflInstancePtr->CntrlInfo.NonBlockingTransfer != NULL) &&
+					((Len % 4U) == 0U)) {
+				Status = XSfl_FlashNonBlockingReadProcess(SflInstancePtr, Address,
+						Len, IoReq->BufferPtr + Offset, 0U);
+				if (Status == (u32)XST_SUCCESS) {
+					DiePtr->State = XSFL_DIE_XFER;
+					Queue->XferDie = Die;
+				}
+			} else {
+				Status = XSfl_FlashReadProcess(SflInstancePtr, Address, Len,
+						IoReq->BufferPtr + Offset, 0U);
+				if (Status == (u32)XST_SUCCESS) {
+					XSfl_QueueAdvance(Queue, DiePtr);
+				}
+			}
+			break;
+
+		case XSFL_IO_WRITE:
+			if ((DiePtr->StageReq != IoReq) || (DiePtr->StageOffset != Offset)) {
+				XSfl_QueueStage(Queue, SflInstancePtr, DiePtr, IoReq, Offset);
+			}
+			DiePtr->StageReq = NULL;
+			Status = XSfl_FlashProgramStart(SflInstancePtr, Address, Len,
+					(u8 *)DiePtr->Stage);
+			if (Status == (u32)XST_SUCCESS) {
+				DiePtr->State = XSFL_DIE_BUSY;
+			}
+			break;
+
+		default:
+			Status = XSfl_SectorEraseStart(SflInstancePtr, Address);
+			if (Status == (u32)XST_SUCCESS) {
+				DiePtr->State = XSFL_DIE_BUSY;
+			}
+			break;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function initializes the queued I/O engine of an SFL instance. It must
+ * be called after XSfl_FlashInit() and before any request is submitted.
+ *
+ * @param	SflHandler is a index to the Sfl interface component to use.
+ *
+ * @return	XST_SUCCESS if successful, else XST_FAILURE.
+ *
+ ******************************************************************************/
+u32 XSfl_FlashQueueInit(u8 SflHandler)
+{
+	XSfl_IoQueue *Queue;
+	XSfl_Interface *SflInstancePtr;
+	u8 Idx;
+
+	/* Validate the input arguments */
+	Xil_AssertNonvoid(SflHandler < XSFL_NUM_INSTANCES);
+
+	Queue = &SflQueue[SflHandler];
+	SflInstancePtr = &SflInstance.Instance[SflHandler];
+
+	if (SflInstancePtr->SflFlashInfo.PageSize > XSFL_QUEUE_STAGE_SIZE) {
+#ifdef XSFL_DEBUG
+		xil_printf("Flash page size exceeds the queue staging buffer\n");
+#endif
+		return XST_FAILURE;
+	}
+
+	for (Idx = 0U; Idx < XSFL_QUEUE_MAX_DIES; Idx++) {
+		Queue->Die[Idx].Head = NULL;
+		Queue->Die[Idx].Tail = NULL;
+		Queue->Die[Idx].StageReq = NULL;
+		Queue->Die[Idx].StageOffset = 0U;
+		Queue->Die[Idx].InFlight = 0U;
+		Queue->Die[Idx].State = XSFL_DIE_IDLE;
+	}
+
+	Queue->Stats.BytesRead = 0U;
+	Queue->Stats.BytesWritten = 0U;
+	Queue->Stats.BytesErased = 0U;
+	Queue->Stats.Completed = 0U;
+	Queue->Stats.Failed = 0U;
+	Queue->Stats.BusyPolls = 0U;
+	Queue->Stats.Overlapped = 0U;
+	Queue->Stats.Staged = 0U;
+
+	if (SflInstancePtr->SflFlashInfo.ConnectionMode == XSFL_CONNECTION_MODE_STACKED) {
+		Queue->NumDies = 2U;
+	} else {
+		Queue->NumDies = 1U;
+	}
+	Queue->ProgramSize = SflInstancePtr->SflFlashInfo.PageSize;
+	Queue->NextDie = 0U;
+	Queue->XferDie = XSFL_NO_DIE;
+	Queue->IsReady = 1U;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function sets the max number of bytes programmed by one command of a
+ * queued write. XSfl_FlashQueueInit() sets it to the flash page size.
+ *
+ * @param	SflHandler is a index to the Sfl interface component to use.
+ * @param	ProgramSize is the program size in bytes. It must divide the
+ *		flash page size.
+ *
+ * @return	XST_SUCCESS if successful, else XST_FAILURE.
+ *
+ * @note	The size can only be changed while the queue is empty.
+ *
+ ******************************************************************************/
+u32 XSfl_FlashQueueSetProgramSize(u8 SflHandler, u32 ProgramSize)
+{
+	XSfl_IoQueue *Queue;
+	u32 PageSize;
+	u8 Idx;
+
+	/* Validate the input arguments */
+	Xil_AssertNonvoid(SflHandler < XSFL_NUM_INSTANCES);
+
+	Queue = &SflQueue[SflHandler];
+	PageSize = SflInstance.Instance[SflHandler].SflFlashInfo.PageSize;
+
+	if ((Queue->IsReady == 0U) || (ProgramSize == 0U) ||
+			(ProgramSize > PageSize) || ((PageSize % ProgramSize) != 0U)) {
+		return XST_FAILURE;
+	}
+
+	for (Idx = 0U; Idx < Queue->NumDies; Idx++) {
+		if ((Queue->Die[Idx].Head != NULL) ||
+				(Queue->Die[Idx].State != XSFL_DIE_IDLE)) {
+			return XST_FAILURE;
+		}
+	}
+
+	Queue->ProgramSize = ProgramSize;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function queues a read, write or erase request. The request is only
+ * started by XSfl_FlashQueuePoll() or XSfl_FlashQueueDrain().
+ *
+ * @param	SflHandler is a index to the Sfl interface component to use.
+ * @param	IoReq is the request to queue. Erase requests must be sector
+ *		aligned and no request may span both dies of a stacked flash.
+ *
+ * @return	XST_SUCCESS if the request is queued, else XST_FAILURE.
+ *
+ * @note	The completion callback may submit new requests.
+ *
+ ******************************************************************************/
+u32 XSfl_FlashQueueSubmit(u8 SflHandler, XSfl_IoReq *IoReq)
+{
+	XSfl_IoQueue *Queue;
+	XSfl_Interface *SflInstancePtr;
+	XSfl_DieQueue *DiePtr;
+	u32 SectSize;
+	u32 DeviceSize;
+
+	/* Validate the input arguments */
+	Xil_AssertNonvoid(SflHandler < XSFL_NUM_INSTANCES);
+	Xil_AssertNonvoid(IoReq != NULL);
+	Xil_AssertNonvoid(IoReq->Op <= XSFL_IO_ERASE);
+
+	Queue = &SflQueue[SflHandler];
+	SflInstancePtr = &SflInstance.Instance[SflHandler];
+	SectSize = SflInstancePtr->SflFlashInfo.SectSize;
+	DeviceSize = SflInstancePtr->SflFlashInfo.DeviceSize;
+
+	if ((Queue->IsReady == 0U) || (IoReq->ByteCount == 0U) ||
+			(IoReq->Address >= DeviceSize) ||
+			(IoReq->ByteCount > (DeviceSize - IoReq->Address))) {
+		return XST_FAILURE;
+	}
+
+	if ((IoReq->Op != XSFL_IO_ERASE) && (IoReq->BufferPtr == NULL)) {
+		return XST_FAILURE;
+	}
+
+	if ((IoReq->Op == XSFL_IO_ERASE) && (((IoReq->Address % SectSize) != 0U) ||
+			((IoReq->ByteCount % SectSize) != 0U))) {
+#ifdef XSFL_DEBUG
+		xil_printf(" Address or ByteCount is not aligned with sector size\n");
+#endif
+		return XST_FAILURE;
+	}
+
+	if (XSfl_QueueDieOf(SflInstancePtr, IoReq->Address) !=
+			XSfl_QueueDieOf(SflInstancePtr, IoReq->Address + IoReq->ByteCount - 1U)) {
+#ifdef XSFL_DEBUG
+		xil_printf("Queued request must not span both flash dies\n");
+#endif
+		return XST_FAILURE;
+	}
+
+	IoReq->Done = 0U;
+	IoReq->Next = NULL;
+
+	DiePtr = &Queue->Die[XSfl_QueueDieOf(SflInstancePtr, IoReq->Address)];
+	if (DiePtr->Tail == NULL) {
+		DiePtr->Head = IoReq;
+	} else {
+		DiePtr->Tail->Next = IoReq;
+	}
+	DiePtr->Tail = IoReq;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function advances the queued requests without blocking on the flash.
+ * Each call reaps the finished commands, issues the next command on every
+ * idle die and stages the next page of a write on every busy die. It can be
+ * called from the application main loop or a timer.
+ *
+ * @param	SflHandler is a index to the Sfl interface component to use.
+ *
+ * @return
+ *		- XST_SUCCESS if all queues are empty.
+ *		- XST_DEVICE_BUSY if requests are still pending.
+ *		- XST_FAILURE if the queue is not initialized.
+ *
+ * @note	Requests that fail are completed with XST_FAILURE and the
+ *		queue continues with the next request.
+ *
+ ******************************************************************************/
+u32 XSfl_FlashQueuePoll(u8 SflHandler)
+{
+	XSfl_IoQueue *Queue;
+	XSfl_Interface *SflInstancePtr;
+	XSfl_DieQueue *DiePtr;
+	u32 Status;
+	u8 IsReady;
+	u8 Idx;
+	u8 Die;
+
+	/* Validate the input arguments */
+	Xil_AssertNonvoid(SflHandler < XSFL_NUM_INSTANCES);
+
+	Queue = &SflQueue[SflHandler];
+	SflInstancePtr = &SflInstance.Instance[SflHandler];
+
+	if (Queue->IsReady == 0U) {
+		return XST_FAILURE;
+	}
+
+	/* A read DMA owns the bus until it completes */
+	if (Queue->XferDie != XSFL_NO_DIE) {
+		if (XSfl_FlashTransferDone(SflInstancePtr) != (u32)XST_SUCCESS) {
+			return XST_DEVICE_BUSY;
+		}
+		XSfl_QueueAdvance(Queue, &Queue->Die[Queue->XferDie]);
+		Queue->XferDie = XSFL_NO_DIE;
+	}
+
+	for (Idx = 0U; Idx < Queue->NumDies; Idx++) {
+		Die = (Queue->NextDie + Idx) % Queue->NumDies;
+		DiePtr = &Queue->Die[Die];
+
+		if (DiePtr->State == XSFL_DIE_BUSY) {
+			(void)SflInstancePtr->CntrlInfo.SelectFlash(Die);
+			Status = XSfl_FlashStatusReady(SflInstancePtr, &IsReady);
+			if (Status != (u32)XST_SUCCESS) {
+				XSfl_QueueComplete(Queue, DiePtr, XST_FAILURE);
+				continue;
+			}
+			if (IsReady == 0U) {
+				Queue->Stats.BusyPolls++;
+				XSfl_QueueStageNext(Queue, SflInstancePtr, DiePtr);
+				continue;
+			}
+			XSfl_QueueAdvance(Queue, DiePtr);
+		}
+
+		if (DiePtr->Head == NULL) {
+			continue;
+		}
+
+		Status = XSfl_QueueIssue(Queue, SflInstancePtr, Die);
+		if (Status != (u32)XST_SUCCESS) {
+			XSfl_QueueComplete(Queue, DiePtr, XST_FAILURE);
+			continue;
+		}
+
+		if (Queue->XferDie != XSFL_NO_DIE) {
+			break;
+		}
+	}
+
+	/* Give the other die the first slot on the next poll */
+	Queue->NextDie = (Queue->NextDie + 1U) % Queue->NumDies;
+
+	for (Idx = 0U; Idx < Queue->NumDies; Idx++) {
+		if ((Queue->Die[Idx].Head != NULL) ||
+				(Queue->Die[Idx].State != XSFL_DIE_IDLE)) {
+			return XST_DEVICE_BUSY;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function polls the queue until every queued request has completed.
+ *
+ * @param	SflHandler is a index to the Sfl interface component to use.
+ *
+ * @return	XST_SUCCESS if all requests completed successfully,
+ *		else XST_FAILURE.
+ *
+ ******************************************************************************/
+u32 XSfl_FlashQueueDrain(u8 SflHandler)
+{
+	u32 Status;
+	u32 Failed;
+
+	/* Validate the input arguments */
+	Xil_AssertNonvoid(SflHandler < XSFL_NUM_INSTANCES);
+
+	Failed = SflQueue[SflHandler].Stats.Failed;
+
+	do {
+		Status = XSfl_FlashQueuePoll(SflHandler);
+	} while (Status == (u32)XST_DEVICE_BUSY);
+
+	if ((Status != (u32)XST_SUCCESS) ||
+			(SflQueue[SflHandler].Stats.Failed != Failed)) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function returns the statistics of the queued I/O engine.
+ *
+ * @param	SflHandler is a index to the Sfl interface component to use.
+ * @param	StatsPtr is the pointer to the structure to be filled.
+ *
+ * @return	None.
+ *
+ ******************************************************************************/
+void XSfl_FlashQueueGetStats(u8 SflHandler, XSfl_QueueStats *StatsPtr)
+{
+	/* Validate the input arguments */
+	Xil_AssertVoid(SflHandler < XSFL_NUM_INSTANCES);
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	*StatsPtr = SflQueue[SflHandler].Stats;
+}
+/** @} */
@@ -0,0 +1,491 @@
+/******************************************************************************
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xilsfl_sim.c
+ * @addtogroup xilsfl overview
+ * @{
+ *
+ * The xilsfl_sim.c file implements a simulated flash controller which can be
+ * used to measure the SFL library without hardware. It is built when
+ * XSFL_SIM_FLASH is defined, i.e. with the XILSFL_sim_flash option, and
+ * selected with XSFL_SIM_CNTRL.
+ *
+ * The model answers the commands issued by the library for the flash device
+ * given by XSFL_SIM_JEDEC_ID (one or two stacked dies). Time is virtual: every
+ * transfer advances the clock by a command overhead plus the bus time of its
+ * payload, program and erase commands keep the addressed die busy for the
+ * configured array time, and a read DMA completes after its bus time. Only
+ * the first XSFL_SIM_DIE_WINDOW bytes of each die are backed by memory,
+ * addresses above it alias into the window.
+ *
+ * A power cut can be armed with XSfl_SimSetPowerCut(): the selected program
+ * or erase command is torn (only the first half of its bytes is changed) and
+ * every following command is ignored, as if the flash had lost power, until
+ * XSfl_SimPowerRestore() is called. The memory contents survive the cut.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who Date     Changes
+ * ----- --- -------- -----------------------------------------------
+ * 1.1   sb  10/19/26 Initial release
+ *       sb  10/19/26 Added power cut injection.
+ *
+ * </pre>
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xilsfl_control.h"
+#include "xil_mem.h"
+
+#ifdef XSFL_SIM_FLASH
+/************************** Constant Definitions *****************************/
+
+/*
+ * Simulated device and timing, all times are in nanoseconds
+ */
+#ifndef XSFL_SIM_JEDEC_ID
+#define XSFL_SIM_JEDEC_ID		0x20bb20U	/* n25q00a */
+#endif
+#ifndef XSFL_SIM_DIE_WINDOW
+#define XSFL_SIM_DIE_WINDOW		0x100000U	/* Backed bytes per die */
+#endif
+#ifndef XSFL_SIM_CMD_NS
+#define XSFL_SIM_CMD_NS			200U	/* Per transfer overhead */
+#endif
+#ifndef XSFL_SIM_BYTE_NS
+#define XSFL_SIM_BYTE_NS		20U	/* Payload time per byte */
+#endif
+#ifndef XSFL_SIM_PAGE_PROGRAM_NS
+#define XSFL_SIM_PAGE_PROGRAM_NS	200000U
+#endif
+#ifndef XSFL_SIM_SECTOR_ERASE_NS
+#define XSFL_SIM_SECTOR_ERASE_NS	150000000U
+#endif
+
+#define XSFL_SIM_NUM_DIES		2U
+#define XSFL_SIM_SR_WIP			0x01U	/* Status register busy */
+#define XSFL_SIM_SR_WEL			0x02U	/* Status register write enable */
+#define XSFL_SIM_FSR_READY		0x80U	/* Flag status register ready */
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * State of one simulated die.
+ */
+typedef struct {
+	u64 BusyUntil;		/**< Virtual time the array operation ends */
+	u8 Wel;			/**< Write enable latch */
+	u8 Mem[XSFL_SIM_DIE_WINDOW];
+} XSfl_SimDie;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+static XSfl_SimDie SimDie[XSFL_SIM_NUM_DIES];
+static u64 SimTime;		/* Virtual time in ns */
+static u64 SimDmaDone;		/* Virtual time the read DMA completes */
+static u32 SimDeviceIdData;
+static u32 SimSectSize;
+static u8 SimCs;
+static u32 SimCutAfter;		/* Program/erase commands left before the cut */
+static u8 SimPowerLost;
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Returns the virtual time of the simulated flash.
+ *
+ * @return	Virtual time in nanoseconds since XSfl_SimInit().
+ *
+ ******************************************************************************/
+u64 XSfl_SimGetTimeNs(void)
+{
+	return SimTime;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Arms a power cut. The Count-th program or erase command from now on is
+ * torn and the flash stops responding.
+ *
+ * @param	Count is the number of program/erase commands until the cut,
+ *		0 disarms.
+ *
+ * @return	None.
+ *
+ ******************************************************************************/
+void XSfl_SimSetPowerCut(u32 Count)
+{
+	SimCutAfter = Count;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Returns whether an armed power cut has happened.
+ *
+ * @return	1 if the flash lost power, 0 otherwise.
+ *
+ ******************************************************************************/
+u8 XSfl_SimPowerLost(void)
+{
+	return SimPowerLost;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Powers the flash up again after a cut. The memory contents are kept, the
+ * write enable latch and pending array operations are cleared.
+ *
+ * @return	None.
+ *
+ ******************************************************************************/
+void XSfl_SimPowerRestore(void)
+{
+	u32 Die;
+
+	for (Die = 0U; Die < XSFL_SIM_NUM_DIES; Die++) {
+		SimDie[Die].BusyUntil = 0U;
+		SimDie[Die].Wel = 0U;
+	}
+	SimCutAfter = 0U;
+	SimPowerLost = 0U;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Counts down an armed power cut for one program or erase command.
+ *
+ * @return	1 if this command is the one to be torn, 0 otherwise.
+ *
+ ******************************************************************************/
+static u8 XSfl_SimCutNow(void)
+{
+	u8 Cut = 0U;
+
+	if (SimCutAfter != 0U) {
+		SimCutAfter--;
+		if (SimCutAfter == 0U) {
+			SimPowerLost = 1U;
+			Cut = 1U;
+		}
+	}
+
+	return Cut;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Answers a command while the flash has no power: the status reads report
+ * ready so that the library does not hang, everything else reads as 0xFF.
+ *
+ ******************************************************************************/
+static void XSfl_SimExecuteNoPower(const XSfl_Msg *SflMsg)
+{
+	u32 Index;
+
+	if (SflMsg->RxBfrPtr == NULL) {
+		return;
+	}
+
+	for (Index = 0U; Index < SflMsg->ByteCount; Index++) {
+		SflMsg->RxBfrPtr[Index] = 0xFFU;
+	}
+	if (SflMsg->Opcode == XSFL_READ_STATUS_CMD) {
+		SflMsg->RxBfrPtr[0] = 0U;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Executes one flash command on the selected die.
+ *
+ ******************************************************************************/
+static u32 XSfl_SimExecute(const XSfl_Msg *SflMsg)
+{
+	XSfl_SimDie *Die = &SimDie[SimCs];
+	u32 Offset = SflMsg->Addr % XSFL_SIM_DIE_WINDOW;
+	u32 Count;
+	u32 Index;
+	u8 Busy;
+
+	SimTime += XSFL_SIM_CMD_NS + ((u64)SflMsg->ByteCount * XSFL_SIM_BYTE_NS);
+	Busy = (SimTime < Die->BusyUntil) ? 1U : 0U;
+
+	if (SimPowerLost != 0U) {
+		XSfl_SimExecuteNoPower(SflMsg);
+		return XST_SUCCESS;
+	}
+
+	switch (SflMsg->Opcode) {
+		case XSFL_READ_ID:
+			for (Index = 0U; Index < SflMsg->ByteCount; Index++) {
+				SflMsg->RxBfrPtr[Index] = 0U;
+			}
+			SflMsg->RxBfrPtr[0] = (u8)(XSFL_SIM_JEDEC_ID >> 16);
+			SflMsg->RxBfrPtr[1] = (u8)(XSFL_SIM_JEDEC_ID >> 8);
+			SflMsg->RxBfrPtr[2] = (u8)XSFL_SIM_JEDEC_ID;
+			break;
+
+		case XSFL_READ_STATUS_CMD:
+			SflMsg->RxBfrPtr[0] = (Busy != 0U) ? XSFL_SIM_SR_WIP : 0U;
+			SflMsg->RxBfrPtr[0] |= (Die->Wel != 0U) ? XSFL_SIM_SR_WEL : 0U;
+			break;
+
+		case XSFL_READ_FLAG_STATUS_CMD:
+			SflMsg->RxBfrPtr[0] = (Busy != 0U) ? 0U : XSFL_SIM_FSR_READY;
+			break;
+
+		case XSFL_WRITE_ENABLE_CMD:
+			if (Busy == 0U) {
+				Die->Wel = 1U;
+			}
+			break;
+
+		case XSFL_WRITE_DISABLE_CMD:
+			Die->Wel = 0U;
+			break;
+
+		case XSFL_ENTER_4B_ADDR_MODE:
+		case XSFL_EXIT_4B_ADDR_MODE:
+			Die->Wel = 0U;
+			break;
+
+		case XSFL_WRITE_CMD_4B:
+		case XSFL_QUAD_WRITE_CMD_4B:
+		case XSFL_WRITE_CMD_OCTAL_4B:
+			/* A program issued while busy or without WREN is ignored */
+			if ((Busy != 0U) || (Die->Wel == 0U)) {
+				break;
+			}
+			Count = SflMsg->ByteCount;
+			if (XSfl_SimCutNow() != 0U) {
+				Count /= 2U;
+			}
+			for (Index = 0U; Index < Count; Index++) {
+				Die->Mem[(Offset + Index) % XSFL_SIM_DIE_WINDOW] &=
+						SflMsg->TxBfrPtr[Index];
+			}
+			Die->Wel = 0U;
+			Die->BusyUntil = SimTime + XSFL_SIM_PAGE_PROGRAM_NS;
+			break;
+
+		case XSFL_SEC_ERASE_CMD_4B:
+			if ((Busy != 0U) || (Die->Wel == 0U)) {
+				break;
+			}
+			Offset -= Offset % SimSectSize;
+			Count = SimSectSize;
+			if (XSfl_SimCutNow() != 0U) {
+				Count /= 2U;
+			}
+			for (Index = 0U; Index < Count; Index++) {
+				Die->Mem[(Offset + Index) % XSFL_SIM_DIE_WINDOW] = 0xFFU;
+			}
+			Die->Wel = 0U;
+			Die->BusyUntil = SimTime + XSFL_SIM_SECTOR_ERASE_NS;
+			break;
+
+		default:
+			/* Every other addressed command with a receive buffer is a read */
+			if ((SflMsg->Addrvalid == 0U) || (SflMsg->RxBfrPtr == NULL)) {
+				break;
+			}
+			for (Index = 0U; Index < SflMsg->ByteCount; Index++) {
+				SflMsg->RxBfrPtr[Index] =
+					Die->Mem[(Offset + Index) % XSFL_SIM_DIE_WINDOW];
+			}
+			break;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Selects the simulated die.
+ *
+ * @param	ChipSelNum is the chip select to be selected.
+ *
+ * @return	XST_SUCCESS.
+ *
+ ******************************************************************************/
+static u32 XSfl_SimSelectFlash(u8 ChipSelNum)
+{
+	SimCs = (ChipSelNum == XSFL_SELECT_FLASH_CS1) ? 1U : 0U;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Performs a blocking transfer on the simulated flash.
+ *
+ * @param	Index is unused.
+ * @param	SflMsg Pointer to the structure containing transfer data.
+ *
+ * @return	XST_SUCCESS.
+ *
+ ******************************************************************************/
+static u32 XSfl_SimTransfer(u8 Index, XSfl_Msg *SflMsg)
+{
+	Xil_AssertNonvoid(SflMsg != NULL);
+	(void)Index;
+
+	return XSfl_SimExecute(SflMsg);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Starts a non-blocking read on the simulated flash. The data is copied
+ * immediately, the DMA is reported done once its bus time has elapsed.
+ *
+ * @param	Index is unused.
+ * @param	SflMsg Pointer to the structure containing transfer data.
+ *
+ * @return	XST_SUCCESS.
+ *
+ ******************************************************************************/
+static u32 XSfl_SimNonBlockingTransfer(u8 Index, XSfl_Msg *SflMsg)
+{
+	u64 Start = SimTime;
+
+	Xil_AssertNonvoid(SflMsg != NULL);
+	(void)Index;
+
+	(void)XSfl_SimExecute(SflMsg);
+	SimDmaDone = SimTime;
+	SimTime = Start + XSFL_SIM_CMD_NS;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Checks for simulated read DMA completion.
+ *
+ * @param	Index is unused.
+ *
+ * @return
+ *		- XST_SUCCESS if DMA transfer complete.
+ *		- XST_FAILURE if DMA transfer is not completed.
+ *
+ ******************************************************************************/
+static u32 XSfl_SimTransferDone(u8 Index)
+{
+	(void)Index;
+
+	SimTime += XSFL_SIM_CMD_NS;
+	if (SimTime < SimDmaDone) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Controller configuration callbacks, nothing to configure on the model.
+ *
+ ******************************************************************************/
+static u32 XSfl_SimSetSdrDdr(u8 Mode, u8 DualByteOpCode)
+{
+	(void)Mode;
+	(void)DualByteOpCode;
+
+	return XST_SUCCESS;
+}
+
+static u32 XSfl_SimRxTuning()
+{
+	return XST_SUCCESS;
+}
+
+static u32 XSfl_SimDeviceReset(u8 Type)
+{
+	(void)Type;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Initializes the simulated flash controller and erases the simulated dies.
+ *
+ * @param	Ptr is pointer to the Sfl_Interface instance.
+ * @param	UserConfig contains the connection mode of the simulated flash.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if XSFL_SIM_JEDEC_ID is not in the flash table.
+ *
+ ******************************************************************************/
+u32 XSfl_SimInit(XSfl_Interface *Ptr, const XSfl_UserConfig *UserConfig)
+{
+	u32 FCTIndex;
+	u32 Status;
+	u32 Die;
+	u32 Index;
+
+	Xil_AssertNonvoid(Ptr != NULL);
+	Xil_AssertNonvoid(UserConfig != NULL);
+
+	Status = XSfl_CalculateFCTIndex(XSFL_SIM_JEDEC_ID, &FCTIndex);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	SimSectSize = Flash_Config_Table[FCTIndex].SectSize;
+
+	for (Die = 0U; Die < XSFL_SIM_NUM_DIES; Die++) {
+		SimDie[Die].BusyUntil = 0U;
+		SimDie[Die].Wel = 0U;
+		for (Index = 0U; Index < XSFL_SIM_DIE_WINDOW; Index++) {
+			SimDie[Die].Mem[Index] = 0xFFU;
+		}
+	}
+	SimTime = 0U;
+	SimDmaDone = 0U;
+	SimCs = 0U;
+	SimCutAfter = 0U;
+	SimPowerLost = 0U;
+
+	Ptr->CntrlInfo.Transfer = XSfl_SimTransfer;
+	Ptr->CntrlInfo.NonBlockingTransfer = XSfl_SimNonBlockingTransfer;
+	Ptr->CntrlInfo.SelectFlash = XSfl_SimSelectFlash;
+	Ptr->CntrlInfo.SetSdrDdr = XSfl_SimSetSdrDdr;
+	Ptr->CntrlInfo.TransferDone = XSfl_SimTransferDone;
+	Ptr->CntrlInfo.RxTunning = XSfl_SimRxTuning;
+	Ptr->CntrlInfo.DeviceReset = XSfl_SimDeviceReset;
+
+	Ptr->CntrlInfo.DeviceId = 0U;
+	Ptr->CntrlInfo.RefClockHz = Flash_Config_Table[FCTIndex].SdrMaxFreq;
+	Ptr->CntrlInfo.DeviceIdData = &SimDeviceIdData;
+	Ptr->SflFlashInfo.ConnectionMode = UserConfig->Sim_Config.ConnectionMode;
+	Ptr->CntrlInfo.OpMode = 0U;
+	Ptr->CntrlInfo.ChipSelectNum = XSFL_SELECT_FLASH_CS0;
+	Ptr->CntrlInfo.CntrlType = XSFL_SIM_CNTRL;
+
+	return XST_SUCCESS;
+}
+#endif
+/** @} */